@@ -0,0 +1,97 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace GeoSharPlusCPP::Bench {
+namespace {
+std::atomic<uint64_t> allocations{0};
+std::atomic<uint64_t> allocatedBytes{0};
+}  // namespace
+
+// Called from the replaced allocation functions below, which live outside the namespace
+void recordAllocation(std::size_t bytes) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+AllocationCount allocationCount() noexcept {
+  return AllocationCount{allocations.load(std::memory_order_relaxed),
+                         allocatedBytes.load(std::memory_order_relaxed)};
+}
+
+bool allocationCountIncludesMalloc() noexcept {
+#ifdef __GLIBC__
+  return true;
+#else
+  return false;
+#endif
+}
+}  // namespace GeoSharPlusCPP::Bench
+
+#ifdef __GLIBC__
+// glibc lets the executable interpose malloc and friends; its own entry points do the work
+extern "C" {
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+
+void* malloc(std::size_t size) {
+  GeoSharPlusCPP::Bench::recordAllocation(size);
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) {
+  GeoSharPlusCPP::Bench::recordAllocation(count * size);
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) {
+  GeoSharPlusCPP::Bench::recordAllocation(size);
+  return __libc_realloc(ptr, size);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) {
+  GeoSharPlusCPP::Bench::recordAllocation(size);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) {
+  GeoSharPlusCPP::Bench::recordAllocation(size);
+  *ptr = __libc_memalign(alignment, size);
+  return *ptr ? 0 : ENOMEM;
+}
+}  // extern "C"
+#else
+void* operator new(std::size_t size) {
+  GeoSharPlusCPP::Bench::recordAllocation(size);
+  if (void* ptr = std::malloc(size > 0 ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+#endif
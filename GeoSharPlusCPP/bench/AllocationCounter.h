@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+namespace GeoSharPlusCPP::Bench {
+// Heap allocations made by the whole process so far, counted by replacing the allocation
+// functions of the executable that links AllocationCounter.cpp
+struct AllocationCount {
+  uint64_t count = 0;
+  uint64_t bytes = 0;
+};
+
+[[nodiscard]] AllocationCount allocationCount() noexcept;
+
+// With glibc, malloc itself is counted, which covers operator new, Eigen's storage and the
+// interop allocator. Elsewhere only operator new is replaced, so malloc-based blocks are missed.
+[[nodiscard]] bool allocationCountIncludesMalloc() noexcept;
+}  // namespace GeoSharPlusCPP::Bench
@@ -0,0 +1,394 @@
+#include "BenchInputs.h"
+
+#ifdef _WIN32
+  #include <combaseapi.h>  // CoTaskMemFree, as Marshal.FreeCoTaskMem on the C# side
+#else
+  #include <cstdlib>
+#endif
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+
+#include "GSP_FB/cpp/doubleArray_generated.h"
+#include "GSP_FB/cpp/intArray_generated.h"
+#include "GSP_FB/cpp/meshF_generated.h"
+#include "GSP_FB/cpp/mesh_generated.h"
+#include "GSP_FB/cpp/pointArray_generated.h"
+#include "GSP_FB/cpp/point_generated.h"
+#include "flatbuffers/flatbuffers.h"
+
+namespace GeoSharPlusCPP::Bench {
+namespace {
+constexpr uint64_t kNoiseSeed = 0x6765'6f73'6861'7270;  // Fixed: runs must be comparable
+
+// Regular icosahedron with outward-facing triangles
+MeshData icosahedron() {
+  const double t = (1.0 + std::sqrt(5.0)) / 2.0;
+  const double vertices[12][3] = {{-1, t, 0}, {1, t, 0}, {-1, -t, 0}, {1, -t, 0},
+                                  {0, -1, t}, {0, 1, t}, {0, -1, -t}, {0, 1, -t},
+                                  {t, 0, -1}, {t, 0, 1}, {-t, 0, -1}, {-t, 0, 1}};
+  const int32_t faces[20][3] = {{0, 11, 5}, {0, 5, 1},  {0, 1, 7},   {0, 7, 10}, {0, 10, 11},
+                                {1, 5, 9},  {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+                                {3, 9, 4},  {3, 4, 2},  {3, 2, 6},   {3, 6, 8},  {3, 8, 9},
+                                {4, 9, 5},  {2, 4, 11}, {6, 2, 10},  {8, 6, 7},  {9, 8, 1}};
+
+  MeshData mesh;
+  mesh.vertices.assign(&vertices[0][0], &vertices[0][0] + 36);
+  mesh.faces.assign(&faces[0][0], &faces[0][0] + 60);
+  return mesh;
+}
+
+// Split every triangle into four at its edge midpoints, shared between neighbouring faces
+void subdivide(MeshData& mesh) {
+  std::unordered_map<uint64_t, int32_t> midpoints;
+  midpoints.reserve(mesh.faces.size());
+  const auto midpoint = [&](int32_t a, int32_t b) {
+    const auto key =
+        (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint32_t>(std::max(a, b));
+    const auto next = static_cast<int32_t>(mesh.vertexCount());
+    const auto [it, inserted] = midpoints.try_emplace(key, next);
+    if (inserted) {
+      for (int c = 0; c < 3; ++c) {
+        mesh.vertices.push_back(0.5 * (mesh.vertices[3 * a + c] + mesh.vertices[3 * b + c]));
+      }
+    }
+    return it->second;
+  };
+
+  std::vector<int32_t> faces;
+  faces.reserve(mesh.faces.size() * 4);
+  for (std::size_t f = 0; f < mesh.faces.size(); f += 3) {
+    const auto a = mesh.faces[f];
+    const auto b = mesh.faces[f + 1];
+    const auto c = mesh.faces[f + 2];
+    const auto ab = midpoint(a, b);
+    const auto bc = midpoint(b, c);
+    const auto ca = midpoint(c, a);
+    faces.insert(faces.end(), {a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca});
+  }
+  mesh.faces = std::move(faces);
+}
+
+// Subdivision level whose face count is closest to the target: each one multiplies it by 4
+int icosphereLevel(std::size_t targetFaces) {
+  int level = 0;
+  for (std::size_t faces = 20; faces * 4 <= targetFaces * 2; faces *= 4) {
+    ++level;
+  }
+  return level;
+}
+
+MeshData makeIcosphere(std::size_t targetFaces) {
+  auto mesh = icosahedron();
+  for (int level = icosphereLevel(targetFaces); level > 0; --level) {
+    subdivide(mesh);
+  }
+
+  for (std::size_t v = 0; v < mesh.vertices.size(); v += 3) {
+    const double length = std::sqrt(mesh.vertices[v] * mesh.vertices[v] +
+                                    mesh.vertices[v + 1] * mesh.vertices[v + 1] +
+                                    mesh.vertices[v + 2] * mesh.vertices[v + 2]);
+    for (int c = 0; c < 3; ++c) {
+      mesh.vertices[v + c] /= length;
+    }
+  }
+  return mesh;
+}
+
+// Unit square of `cells` x `cells` cells, split into two triangles each or kept as quads. The
+// vertices are jittered in the plane and displaced out of it by a fraction of the cell size.
+MeshData makeGrid(std::size_t cells, bool quads) {
+  const double h = 1.0 / static_cast<double>(cells);
+  std::mt19937_64 random(kNoiseSeed);
+  std::uniform_real_distribution<double> noise(-1.0, 1.0);
+
+  MeshData mesh;
+  mesh.corners = quads ? 4 : 3;
+  const auto rows = cells + 1;
+  mesh.vertices.reserve(rows * rows * 3);
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < rows; ++j) {
+      const bool border = i == 0 || j == 0 || i == cells || j == cells;
+      const double jitter = border ? 0.0 : 0.2 * h;  // Keeps the boundary a square
+      mesh.vertices.push_back(static_cast<double>(j) * h + jitter * noise(random));
+      mesh.vertices.push_back(static_cast<double>(i) * h + jitter * noise(random));
+      mesh.vertices.push_back(0.25 * h * noise(random));
+    }
+  }
+
+  mesh.faces.reserve(cells * cells * (quads ? 4 : 6));
+  for (std::size_t i = 0; i < cells; ++i) {
+    for (std::size_t j = 0; j < cells; ++j) {
+      const auto v00 = static_cast<int32_t>(i * rows + j);
+      const auto v01 = v00 + 1;
+      const auto v10 = static_cast<int32_t>(v00 + rows);
+      const auto v11 = v10 + 1;
+      if (quads) {
+        mesh.faces.insert(mesh.faces.end(), {v00, v01, v11, v10});
+      } else {
+        mesh.faces.insert(mesh.faces.end(), {v00, v01, v11, v00, v11, v10});
+      }
+    }
+  }
+  return mesh;
+}
+
+// Cells per side of a grid with about `targetFaces` faces of `facesPerCell` each
+std::size_t gridCells(std::size_t targetFaces, std::size_t facesPerCell) {
+  const double cells = static_cast<double>(targetFaces) / static_cast<double>(facesPerCell);
+  return std::max<std::size_t>(1, static_cast<std::size_t>(std::lround(std::sqrt(cells))));
+}
+
+Buffer finish(const flatbuffers::FlatBufferBuilder& builder) {
+  return Buffer(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+}
+}  // namespace
+
+const char* meshKindName(MeshKind kind) noexcept {
+  switch (kind) {
+    case MeshKind::Icosphere:
+      return "icosphere";
+    case MeshKind::NoisyGrid:
+      return "grid";
+    case MeshKind::QuadGrid:
+      return "quad";
+    case MeshKind::File:
+      return "file";
+  }
+  return "mesh";
+}
+
+MeshData makeMesh(MeshKind kind, std::size_t targetFaces) {
+  switch (kind) {
+    case MeshKind::Icosphere:
+      return makeIcosphere(targetFaces);
+    case MeshKind::NoisyGrid:
+      return makeGrid(gridCells(targetFaces, 2), false);
+    case MeshKind::QuadGrid:
+      return makeGrid(gridCells(targetFaces, 1), true);
+    case MeshKind::File:
+      break;
+  }
+  return MeshData();
+}
+
+std::size_t meshFaceCount(MeshKind kind, std::size_t targetFaces) {
+  switch (kind) {
+    case MeshKind::Icosphere:
+      return std::size_t{20} << (2 * icosphereLevel(targetFaces));
+    case MeshKind::NoisyGrid: {
+      const auto cells = gridCells(targetFaces, 2);
+      return 2 * cells * cells;
+    }
+    case MeshKind::QuadGrid: {
+      const auto cells = gridCells(targetFaces, 1);
+      return cells * cells;
+    }
+    case MeshKind::File:
+      break;
+  }
+  return 0;
+}
+
+void InteropBuffer::reset() noexcept {
+  if (data) {
+#ifdef _WIN32
+    CoTaskMemFree(data);
+#else
+    std::free(data);
+#endif
+  }
+  data = nullptr;
+  size = 0;
+}
+
+Buffer meshBuffer(const MeshData& mesh) {
+  const auto vertexCount = mesh.vertexCount();
+  const auto faceCount = mesh.faceCount();
+  flatbuffers::FlatBufferBuilder builder(mesh.vertices.size() * sizeof(double) +
+                                         mesh.faces.size() * sizeof(int32_t) + 256);
+
+  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec3i*>> triFaces;
+  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec4i*>> quadFaces;
+  if (mesh.corners == 4) {
+    GSP::FB::Vec4i* faces = nullptr;
+    quadFaces = builder.CreateUninitializedVectorOfStructs(faceCount, &faces);
+    std::memcpy(faces, mesh.faces.data(), mesh.faces.size() * sizeof(int32_t));
+  } else {
+    GSP::FB::Vec3i* faces = nullptr;
+    triFaces = builder.CreateUninitializedVectorOfStructs(faceCount, &faces);
+    std::memcpy(faces, mesh.faces.data(), mesh.faces.size() * sizeof(int32_t));
+  }
+
+  GSP::FB::Vec3* vertices = nullptr;
+  auto vertexVector = builder.CreateUninitializedVectorOfStructs(vertexCount, &vertices);
+  std::memcpy(vertices, mesh.vertices.data(), mesh.vertices.size() * sizeof(double));
+
+  builder.Finish(GSP::FB::CreateMeshData(builder, vertexVector, triFaces, quadFaces));
+  return finish(builder);
+}
+
+Buffer meshBufferF(const MeshData& mesh) {
+  const auto vertexCount = mesh.vertexCount();
+  const auto faceCount = mesh.faceCount();
+  flatbuffers::FlatBufferBuilder builder(mesh.vertices.size() * sizeof(float) +
+                                         mesh.faces.size() * sizeof(int32_t) + 256);
+
+  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec3i*>> triFaces;
+  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec4i*>> quadFaces;
+  if (mesh.corners == 4) {
+    GSP::FB::Vec4i* faces = nullptr;
+    quadFaces = builder.CreateUninitializedVectorOfStructs(faceCount, &faces);
+    std::memcpy(faces, mesh.faces.data(), mesh.faces.size() * sizeof(int32_t));
+  } else {
+    GSP::FB::Vec3i* faces = nullptr;
+    triFaces = builder.CreateUninitializedVectorOfStructs(faceCount, &faces);
+    std::memcpy(faces, mesh.faces.data(), mesh.faces.size() * sizeof(int32_t));
+  }
+
+  GSP::FB::Vec3f* vertices = nullptr;
+  auto vertexVector = builder.CreateUninitializedVectorOfStructs(vertexCount, &vertices);
+  for (std::size_t v = 0; v < vertexCount; ++v) {
+    vertices[v] = GSP::FB::Vec3f(static_cast<float>(mesh.vertices[v * 3]),
+                                 static_cast<float>(mesh.vertices[v * 3 + 1]),
+                                 static_cast<float>(mesh.vertices[v * 3 + 2]));
+  }
+
+  builder.Finish(GSP::FB::CreateMeshDataF(builder, vertexVector, triFaces, quadFaces));
+  return finish(builder);
+}
+
+Buffer pointBuffer(double x, double y, double z) {
+  flatbuffers::FlatBufferBuilder builder(64);
+  const GSP::FB::Vec3 point(x, y, z);
+  builder.Finish(GSP::FB::CreatePointData(builder, &point));
+  return finish(builder);
+}
+
+Buffer pointArrayBuffer(const std::vector<double>& xyz) {
+  flatbuffers::FlatBufferBuilder builder(xyz.size() * sizeof(double) + 256);
+  GSP::FB::Vec3* points = nullptr;
+  auto pointVector = builder.CreateUninitializedVectorOfStructs(xyz.size() / 3, &points);
+  std::memcpy(points, xyz.data(), xyz.size() / 3 * sizeof(GSP::FB::Vec3));
+  builder.Finish(GSP::FB::CreatePointArrayData(builder, pointVector));
+  return finish(builder);
+}
+
+Buffer doubleArrayBuffer(const std::vector<double>& values) {
+  flatbuffers::FlatBufferBuilder builder(values.size() * sizeof(double) + 256);
+  builder.Finish(GSP::FB::CreateDoubleArrayDataDirect(builder, &values));
+  return finish(builder);
+}
+
+Buffer intArrayBuffer(const std::vector<int32_t>& values) {
+  flatbuffers::FlatBufferBuilder builder(values.size() * sizeof(int32_t) + 256);
+  builder.Finish(GSP::FB::CreateIntArrayDataDirect(builder, &values));
+  return finish(builder);
+}
+
+bool readMeshBuffer(const uint8_t* data, int size, MeshData& mesh) {
+  flatbuffers::Verifier verifier(data, static_cast<std::size_t>(std::max(size, 0)));
+  if (!data || !verifier.VerifyBuffer<GSP::FB::MeshData>()) {
+    return false;
+  }
+  const auto* meshData = GSP::FB::GetMeshData(data);
+  const auto* vertices = meshData->vertices();
+  if (!vertices) {
+    return false;
+  }
+
+  const auto* vertexData = reinterpret_cast<const double*>(vertices->Data());
+  mesh.vertices.assign(vertexData, vertexData + vertices->size() * 3);
+  if (const auto* quads = meshData->quad_faces(); quads && quads->size() > 0) {
+    const auto* faceData = reinterpret_cast<const int32_t*>(quads->Data());
+    mesh.faces.assign(faceData, faceData + quads->size() * 4);
+    mesh.corners = 4;
+  } else if (const auto* triangles = meshData->faces(); triangles && triangles->size() > 0) {
+    const auto* faceData = reinterpret_cast<const int32_t*>(triangles->Data());
+    mesh.faces.assign(faceData, faceData + triangles->size() * 3);
+    mesh.corners = 3;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool readDoubleArray(const uint8_t* data, int size, std::vector<double>& values) {
+  flatbuffers::Verifier verifier(data, static_cast<std::size_t>(std::max(size, 0)));
+  if (!data || !verifier.VerifyBuffer<GSP::FB::DoubleArrayData>()) {
+    return false;
+  }
+  const auto* array = GSP::FB::GetDoubleArrayData(data)->values();
+  if (!array) {
+    return false;
+  }
+  values.assign(array->begin(), array->end());
+  return true;
+}
+
+bool readPointArray(const uint8_t* data, int size, std::vector<double>& xyz) {
+  flatbuffers::Verifier verifier(data, static_cast<std::size_t>(std::max(size, 0)));
+  if (!data || !verifier.VerifyBuffer<GSP::FB::PointArrayData>()) {
+    return false;
+  }
+  const auto* points = GSP::FB::GetPointArrayData(data)->points();
+  if (!points) {
+    return false;
+  }
+  const auto* pointData = reinterpret_cast<const double*>(points->Data());
+  xyz.assign(pointData, pointData + points->size() * 3);
+  return true;
+}
+
+std::vector<double> queryPoints(const MeshData& mesh, std::size_t count) {
+  std::array<double, 3> lower{0.0, 0.0, 0.0};
+  std::array<double, 3> upper{0.0, 0.0, 0.0};
+  for (std::size_t v = 0; v < mesh.vertices.size(); v += 3) {
+    for (std::size_t c = 0; c < 3; ++c) {
+      const auto value = mesh.vertices[v + c];
+      lower[c] = v == 0 ? value : std::min(lower[c], value);
+      upper[c] = v == 0 ? value : std::max(upper[c], value);
+    }
+  }
+
+  std::mt19937_64 random(kNoiseSeed + 1);
+  std::array<std::uniform_real_distribution<double>, 3> coordinates;
+  for (std::size_t c = 0; c < 3; ++c) {
+    const double margin = 0.05 * (upper[c] - lower[c]);
+    coordinates[c] = std::uniform_real_distribution<double>(lower[c] - margin, upper[c] + margin);
+  }
+
+  std::vector<double> points(count * 3);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    points[i] = coordinates[i % 3](random);
+  }
+  return points;
+}
+
+std::size_t parseCount(const std::string& text) noexcept {
+  std::size_t value = 0;
+  std::size_t i = 0;
+  for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+    value = value * 10 + static_cast<std::size_t>(text[i] - '0');
+  }
+  if (i == 0) {
+    return 0;
+  }
+  if (i + 1 == text.size()) {
+    switch (text[i]) {
+      case 'k':
+      case 'K':
+        return value * 1000;
+      case 'm':
+      case 'M':
+        return value * 1000000;
+      default:
+        return 0;
+    }
+  }
+  return i == text.size() ? value : 0;
+}
+}  // namespace GeoSharPlusCPP::Bench
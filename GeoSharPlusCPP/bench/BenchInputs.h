@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GeoSharPlusCPP::Bench {
+// ! Synthetic meshes
+enum class MeshKind {
+  Icosphere,  // Closed triangle mesh (inside/outside queries, curvature)
+  NoisyGrid,  // Open triangle mesh with one boundary loop (parametrization, boundary queries)
+  QuadGrid,   // Open quad mesh with non-planar faces (planarity, planarization)
+  File,       // Triangle mesh read with IGM_read_triangle_mesh
+};
+
+[[nodiscard]] const char* meshKindName(MeshKind kind) noexcept;
+
+// Row-major vertex coordinates and faces, the layout of the FlatBuffers mesh table
+struct MeshData {
+  std::vector<double> vertices;  // x, y, z per vertex
+  std::vector<int32_t> faces;    // `corners` indices per face
+  int corners = 3;
+
+  [[nodiscard]] std::size_t vertexCount() const noexcept {
+    return vertices.size() / 3;
+  }
+  [[nodiscard]] std::size_t faceCount() const noexcept {
+    return faces.size() / static_cast<std::size_t>(corners);
+  }
+};
+
+// Mesh of `kind` with about `targetFaces` faces; the actual count depends on the kind's
+// subdivision steps (icospheres grow by 4x per level). Noise is seeded, so the same arguments
+// always give the same mesh.
+[[nodiscard]] MeshData makeMesh(MeshKind kind, std::size_t targetFaces);
+// Face count of makeMesh(kind, targetFaces), without building the mesh
+[[nodiscard]] std::size_t meshFaceCount(MeshKind kind, std::size_t targetFaces);
+
+// ! Interop buffers
+// Output buffer filled by an export; freed like C# frees it (CoTaskMemFree / free)
+struct InteropBuffer {
+  InteropBuffer() = default;
+  InteropBuffer(const InteropBuffer&) = delete;
+  InteropBuffer& operator=(const InteropBuffer&) = delete;
+  ~InteropBuffer() {
+    reset();
+  }
+
+  void reset() noexcept;
+
+  uint8_t* data = nullptr;
+  int size = 0;
+};
+
+// Finished FlatBuffers input buffers, as the C# side builds them
+using Buffer = std::vector<uint8_t>;
+
+[[nodiscard]] Buffer meshBuffer(const MeshData& mesh);
+// The mesh as a MeshDataF table, vertices rounded to float
+[[nodiscard]] Buffer meshBufferF(const MeshData& mesh);
+[[nodiscard]] Buffer pointBuffer(double x, double y, double z);
+[[nodiscard]] Buffer pointArrayBuffer(const std::vector<double>& xyz);
+[[nodiscard]] Buffer doubleArrayBuffer(const std::vector<double>& values);
+[[nodiscard]] Buffer intArrayBuffer(const std::vector<int32_t>& values);
+
+// Contents of output buffers; false if the buffer does not hold the expected table
+[[nodiscard]] bool readMeshBuffer(const uint8_t* data, int size, MeshData& mesh);
+[[nodiscard]] bool readDoubleArray(const uint8_t* data, int size, std::vector<double>& values);
+// x, y, z per point
+[[nodiscard]] bool readPointArray(const uint8_t* data, int size, std::vector<double>& xyz);
+
+// `count` points spread uniformly over the mesh's bounding box grown by 10%
+[[nodiscard]] std::vector<double> queryPoints(const MeshData& mesh, std::size_t count);
+
+// Parse a face count such as "1000", "10k" or "10M"; 0 if malformed
+[[nodiscard]] std::size_t parseCount(const std::string& text) noexcept;
+}  // namespace GeoSharPlusCPP::Bench
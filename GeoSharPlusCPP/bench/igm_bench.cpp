@@ -0,0 +1,1143 @@
+// igm_bench: times every export of BridgeAPI.h through its serialized C interface, the way the
+// C# bindings call it, on synthetic meshes and on mesh files.
+//
+//   igm_bench [--igm_sizes=1k,10k,100k,1M] [--igm_kinds=icosphere,grid,quad]
+//             [--igm_mesh=path ...] [--igm_threads=N] [--igm_cold] [benchmark flags]
+//
+// Results go to JSON with the usual Google Benchmark flags, e.g.
+//   --benchmark_out=run.json --benchmark_out_format=json --benchmark_context=commit=<sha>
+// and two runs compare with benchmark's tools/compare.py. Counters per benchmark: the mesh's
+// faces and vertices, faces per second (items_per_second) and output bytes per call.
+//
+// Buffer exports that build reusable data (spatial indices, Laplacian factorizations, heat
+// geodesics) find the mesh in the dedup cache together with that data after the first iteration,
+// as repeated calls from C# do; --igm_cold turns the cache off so every call pays deserialization
+// and derived data again. The other buffer exports read their mesh in place on every call and
+// are unaffected by the flag. Exports that create a handle release it in the same
+// iteration. Job status, progress and cancel are timed as part of the submit benchmarks.
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchInputs.h"
+#include "GeoSharPlusCPP/API/BridgeAPI.h"
+
+namespace GeoSharPlusCPP::Bench {
+namespace {
+constexpr uint64_t kDefaultDedupLimit = uint64_t{256} << 20;
+constexpr uint64_t kDefaultHeatCacheLimit = uint64_t{1} << 30;
+constexpr int kJobSucceeded = 2;
+
+struct Options {
+  std::vector<std::size_t> sizes{1000, 10000, 100000, 1000000};
+  std::vector<MeshKind> kinds{MeshKind::Icosphere, MeshKind::NoisyGrid, MeshKind::QuadGrid};
+  std::vector<std::string> files;
+  int threads = 0;  // 0 = the library default
+  bool cold = false;
+};
+
+struct MeshSpec {
+  MeshKind kind = MeshKind::Icosphere;
+  std::size_t targetFaces = 0;
+  std::string path;  // MeshKind::File only
+  std::string name;
+};
+
+// Inputs shared by the benchmarks of one mesh, built when the first of them runs. Handles to
+// long-lived native objects are created by the first benchmark needing them.
+struct MeshCase {
+  MeshCase() = default;
+  MeshCase(const MeshCase&) = delete;
+  MeshCase& operator=(const MeshCase&) = delete;
+  ~MeshCase() {
+    if (heat != 0) {
+      IGM_heat_geodesic_release(heat);
+    }
+    if (windingNumber != 0) {
+      IGM_fast_winding_number_release(windingNumber);
+    }
+    if (distanceIndex != 0) {
+      IGM_mesh_release(distanceIndex);
+    }
+    if (handle != 0) {
+      IGM_mesh_release(handle);
+    }
+  }
+
+  std::string name;
+  MeshData mesh;
+  Buffer meshBuffer;
+  Buffer meshBufferF;   // The mesh with float vertices, for the `_f` exports
+  Buffer vertexBuffer;  // The mesh's own vertices as a point array
+  Buffer queryBuffer;   // Points around the mesh for distance and winding number queries
+  Buffer vertexScalars;
+  Buffer faceScalars;
+  Buffer isoValues;
+  Buffer constraintIndices;
+  Buffer constraintValues;
+  Buffer heatSources;
+  Buffer heatPrecompute;  // Handle buffer from IGM_heat_geodesic_precompute
+  int sampleCount = 0;
+  int blueNoiseCount = 0;
+
+  uint64_t handle = 0;
+  uint64_t windingNumber = 0;
+  uint64_t distanceIndex = 0;
+  uint64_t heat = 0;
+};
+
+using Outputs = std::array<InteropBuffer, 4>;
+using ExportCall = std::function<bool(const MeshCase&, Outputs&)>;
+using Prepare = std::function<bool(MeshCase&)>;
+
+const std::filesystem::path& scratchMeshPath() {
+  static const auto path = std::filesystem::temp_directory_path() / "igm_bench_mesh.obj";
+  return path;
+}
+
+const std::filesystem::path& scratchTracePath() {
+  static const auto path = std::filesystem::temp_directory_path() / "igm_bench_trace.json";
+  return path;
+}
+
+bool GSP_CALL keepGoing(void*, double) {
+  return true;
+}
+
+int size(const Buffer& buffer) {
+  return static_cast<int>(buffer.size());
+}
+
+// ! Mesh cases
+std::unique_ptr<MeshCase> buildCase(const MeshSpec& spec) {
+  auto input = std::make_unique<MeshCase>();
+  input->name = spec.name;
+  if (spec.kind == MeshKind::File) {
+    InteropBuffer read;
+    if (!IGM_read_triangle_mesh(spec.path.c_str(), &read.data, &read.size) ||
+        !readMeshBuffer(read.data, read.size, input->mesh)) {
+      return nullptr;
+    }
+  } else {
+    input->mesh = makeMesh(spec.kind, spec.targetFaces);
+  }
+
+  const auto& mesh = input->mesh;
+  const auto vertexCount = mesh.vertexCount();
+  const auto faceCount = mesh.faceCount();
+  if (vertexCount == 0 || faceCount == 0) {
+    return nullptr;
+  }
+
+  input->meshBuffer = meshBuffer(mesh);
+  input->meshBufferF = meshBufferF(mesh);
+  input->vertexBuffer = pointArrayBuffer(mesh.vertices);
+  input->queryBuffer = pointArrayBuffer(
+      queryPoints(mesh, std::clamp<std::size_t>(faceCount / 10, 1000, 1000000)));
+
+  // A linear ramp along x: isolines cross every kind of mesh
+  std::vector<double> vertexScalars(vertexCount);
+  double lower = mesh.vertices[0];
+  double upper = mesh.vertices[0];
+  for (std::size_t v = 0; v < vertexCount; ++v) {
+    vertexScalars[v] = mesh.vertices[3 * v];
+    lower = std::min(lower, vertexScalars[v]);
+    upper = std::max(upper, vertexScalars[v]);
+  }
+  std::vector<double> faceScalars(faceCount);
+  for (std::size_t f = 0; f < faceCount; ++f) {
+    faceScalars[f] = static_cast<double>(f) / static_cast<double>(faceCount);
+  }
+  std::vector<double> isoValues;
+  for (int i = 1; i < 10; ++i) {
+    isoValues.push_back(lower + (upper - lower) * i / 10.0);
+  }
+
+  input->vertexScalars = doubleArrayBuffer(vertexScalars);
+  input->faceScalars = doubleArrayBuffer(faceScalars);
+  input->isoValues = doubleArrayBuffer(isoValues);
+  input->constraintIndices = intArrayBuffer({0, static_cast<int32_t>(vertexCount - 1)});
+  input->constraintValues = doubleArrayBuffer({0.0, 1.0});
+  input->heatSources = intArrayBuffer({0});
+  input->sampleCount = static_cast<int>(std::clamp<std::size_t>(faceCount / 10, 1000, 1000000));
+  input->blueNoiseCount = static_cast<int>(std::clamp<std::size_t>(faceCount / 100, 100, 100000));
+
+  if (!IGM_mesh_create(input->meshBuffer.data(), size(input->meshBuffer), &input->handle)) {
+    return nullptr;
+  }
+  return input;
+}
+
+// Benchmarks run in registration order, one mesh after the other, so only the current mesh is
+// kept: a 10M face case holds a few GB of inputs and native data
+MeshCase* loadCase(const MeshSpec& spec) {
+  static std::unique_ptr<MeshCase> current;
+  static std::string failed;
+  if (current && current->name == spec.name) {
+    return current.get();
+  }
+  if (failed == spec.name) {
+    return nullptr;
+  }
+
+  current.reset();
+  current = buildCase(spec);
+  if (!current) {
+    failed = spec.name;
+  }
+  return current.get();
+}
+
+// ! Runners
+void setCounters(benchmark::State& state, const MeshCase& input, std::size_t bytesOut) {
+  const auto faces = static_cast<int64_t>(input.mesh.faceCount());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * faces);
+  state.counters["faces"] = static_cast<double>(faces);
+  state.counters["vertices"] = static_cast<double>(input.mesh.vertexCount());
+  state.counters["bytes_out"] =
+      benchmark::Counter(static_cast<double>(bytesOut), benchmark::Counter::kAvgIterations);
+}
+
+void runExport(benchmark::State& state,
+               const MeshSpec& spec,
+               const Prepare& prepare,
+               const ExportCall& call) {
+  auto* input = loadCase(spec);
+  if (!input) {
+    state.SkipWithError("could not load the mesh");
+    return;
+  }
+  if (prepare && !prepare(*input)) {
+    state.SkipWithError("setup failed");
+    return;
+  }
+
+  std::size_t bytesOut = 0;
+  for (auto _ : state) {
+    Outputs outputs;  // Freed inside the timed loop, as C# frees them after each call
+    if (!call(*input, outputs)) {
+      state.SkipWithError("export returned false");
+      break;
+    }
+    for (const auto& output : outputs) {
+      bytesOut += static_cast<std::size_t>(output.size);
+    }
+  }
+  setCounters(state, *input, bytesOut);
+}
+
+void add(const std::string& exportName,
+         const MeshSpec& spec,
+         ExportCall call,
+         Prepare prepare = nullptr) {
+  benchmark::RegisterBenchmark(
+      (exportName + "/" + spec.name).c_str(),
+      [spec, call = std::move(call), prepare = std::move(prepare)](benchmark::State& state) {
+        runExport(state, spec, prepare, call);
+      })
+      ->UseRealTime()
+      ->Unit(benchmark::kMillisecond);
+}
+
+// Wait for a job, take its first `outputCount` outputs and release it
+bool finishJob(uint64_t job, int outputCount, Outputs& outputs) {
+  int status = 0;
+  double fraction = 0.0;
+  bool ok = IGM_job_status(job, &status) && IGM_job_progress(job, &fraction) &&
+            IGM_job_wait(job, -1, &status) && status == kJobSucceeded;
+  for (int i = 0; ok && i < outputCount; ++i) {
+    ok = IGM_job_result(job, i, &outputs[i].data, &outputs[i].size);
+  }
+  IGM_job_cancel(job);  // No effect on a finished job
+  return IGM_job_release(job) && ok;
+}
+
+// Call an `_ex` export with every output in a buffer of its own and progress reported to
+// keepGoing, as the C# bindings call it
+template <typename Call>
+bool callEx(Outputs& outputs, Call&& call) {
+  std::array<uint8_t*, std::tuple_size_v<Outputs>> buffers{};
+  std::array<int, std::tuple_size_v<Outputs>> sizes{};
+  const IGM_CallOptions options{IGM_OUTPUT_SEPARATE,
+                                IGM_ALL_OUTPUTS,
+                                buffers.data(),
+                                sizes.data(),
+                                nullptr,
+                                0,
+                                keepGoing,
+                                nullptr};
+  const bool ok = call(&options);
+  for (std::size_t i = 0; i < buffers.size(); ++i) {
+    outputs[i].data = buffers[i];
+    outputs[i].size = sizes[i];
+  }
+  return ok;
+}
+
+// Heat precompute handles come back in a number array, as a double
+bool releaseHeatBuffer(const InteropBuffer& buffer) {
+  std::vector<double> values;
+  return readDoubleArray(buffer.data, buffer.size, values) && !values.empty() &&
+         IGM_heat_geodesic_release(static_cast<uint64_t>(values[0]));
+}
+
+// ! Prepare steps
+bool prepareWindingNumber(MeshCase& input) {
+  return input.windingNumber != 0 ||
+         IGM_fast_winding_number_create_h(input.handle, 2, &input.windingNumber);
+}
+
+bool prepareDistanceIndex(MeshCase& input) {
+  return input.distanceIndex != 0 || IGM_distance_index_build(input.meshBuffer.data(),
+                                                              size(input.meshBuffer),
+                                                              4,
+                                                              &input.distanceIndex);
+}
+
+bool prepareHeat(MeshCase& input) {
+  if (input.heat == 0) {
+    InteropBuffer buffer;
+    if (!IGM_heat_geodesic_precompute_h(input.handle, &buffer.data, &buffer.size)) {
+      return false;
+    }
+    std::vector<double> values;
+    if (!readDoubleArray(buffer.data, buffer.size, values) || values.empty()) {
+      return false;
+    }
+    input.heat = static_cast<uint64_t>(values[0]);
+    input.heatPrecompute.assign(buffer.data, buffer.data + buffer.size);
+  }
+  return true;
+}
+
+bool prepareScratchMesh(MeshCase& input) {
+  return IGM_write_triangle_mesh(
+      input.meshBuffer.data(), size(input.meshBuffer), scratchMeshPath().string().c_str());
+}
+
+// ! Registration
+void addQuadBenchmarks(const MeshSpec& spec) {
+  add("IGM_quad_planarity", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_quad_planarity(
+        in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_quad_planarity_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_quad_planarity_h(in.handle, &out[0].data, &out[0].size);
+  });
+
+  constexpr int kIterations = 20;
+  constexpr double kThreshold = 1e-6;
+  add("IGM_planarize_quad_mesh", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_planarize_quad_mesh(in.meshBuffer.data(),
+                                   size(in.meshBuffer),
+                                   kIterations,
+                                   kThreshold,
+                                   &out[0].data,
+                                   &out[0].size);
+  });
+  add("IGM_planarize_quad_mesh_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_planarize_quad_mesh_h(
+        in.handle, kIterations, kThreshold, &out[0].data, &out[0].size);
+  });
+  add("IGM_planarize_quad_mesh_ex", spec, [](const MeshCase& in, Outputs& out) {
+    const IGM_MeshInput mesh{in.meshBuffer.data(), size(in.meshBuffer), 0, 0};
+    return callEx(out, [&](const IGM_CallOptions* options) {
+      return IGM_planarize_quad_mesh_ex(&mesh, kIterations, kThreshold, options);
+    });
+  });
+  add("IGM_submit_planarize_quad_mesh", spec, [](const MeshCase& in, Outputs& out) {
+    uint64_t job = 0;
+    return IGM_submit_planarize_quad_mesh(
+               in.meshBuffer.data(), size(in.meshBuffer), kIterations, kThreshold, &job) &&
+           finishJob(job, 1, out);
+  });
+  add("IGM_submit_planarize_quad_mesh_h", spec, [](const MeshCase& in, Outputs& out) {
+    uint64_t job = 0;
+    return IGM_submit_planarize_quad_mesh_h(in.handle, kIterations, kThreshold, &job) &&
+           finishJob(job, 1, out);
+  });
+}
+
+void addNormalBenchmarks(const MeshSpec& spec) {
+  add("IGM_barycenter", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_barycenter(in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_barycenter_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_barycenter_h(in.handle, &out[0].data, &out[0].size);
+  });
+  add("IGM_vert_normals", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_vert_normals(in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_vert_normals_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_vert_normals_h(in.handle, &out[0].data, &out[0].size);
+  });
+  add("IGM_face_normals", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_face_normals(in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_face_normals_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_face_normals_h(in.handle, &out[0].data, &out[0].size);
+  });
+  add("IGM_barycenter_f", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_barycenter_f(
+        in.meshBufferF.data(), size(in.meshBufferF), &out[0].data, &out[0].size);
+  });
+  add("IGM_face_normals_f", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_face_normals_f(
+        in.meshBufferF.data(), size(in.meshBufferF), &out[0].data, &out[0].size);
+  });
+
+  constexpr double kCornerThreshold = 20.0;
+  add("IGM_corner_normals", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_corner_normals(in.meshBuffer.data(),
+                              size(in.meshBuffer),
+                              kCornerThreshold,
+                              &out[0].data,
+                              &out[0].size);
+  });
+  add("IGM_corner_normals_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_corner_normals_h(in.handle, kCornerThreshold, &out[0].data, &out[0].size);
+  });
+
+  constexpr int kAreaWeighting = 1;
+  add("IGM_edge_normals", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_edge_normals(in.meshBuffer.data(),
+                            size(in.meshBuffer),
+                            kAreaWeighting,
+                            &out[0].data,
+                            &out[0].size,
+                            &out[1].data,
+                            &out[1].size,
+                            &out[2].data,
+                            &out[2].size);
+  });
+  add("IGM_edge_normals_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_edge_normals_h(in.handle,
+                              kAreaWeighting,
+                              &out[0].data,
+                              &out[0].size,
+                              &out[1].data,
+                              &out[1].size,
+                              &out[2].data,
+                              &out[2].size);
+  });
+}
+
+void addTopologyBenchmarks(const MeshSpec& spec, bool open) {
+  add("IGM_vert_vert_adjacency", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_vert_vert_adjacency(
+        in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_vert_vert_adjacency_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_vert_vert_adjacency_h(in.handle, &out[0].data, &out[0].size);
+  });
+  add("IGM_vert_tri_adjacency", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_vert_tri_adjacency(in.meshBuffer.data(),
+                                  size(in.meshBuffer),
+                                  &out[0].data,
+                                  &out[0].size,
+                                  &out[1].data,
+                                  &out[1].size);
+  });
+  add("IGM_vert_tri_adjacency_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_vert_tri_adjacency_h(
+        in.handle, &out[0].data, &out[0].size, &out[1].data, &out[1].size);
+  });
+  add("IGM_tri_tri_adjacency", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_tri_tri_adjacency(in.meshBuffer.data(),
+                                 size(in.meshBuffer),
+                                 &out[0].data,
+                                 &out[0].size,
+                                 &out[1].data,
+                                 &out[1].size);
+  });
+  add("IGM_tri_tri_adjacency_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_tri_tri_adjacency_h(
+        in.handle, &out[0].data, &out[0].size, &out[1].data, &out[1].size);
+  });
+
+  // A closed mesh has no boundary to report
+  if (open) {
+    add("IGM_boundary_loop", spec, [](const MeshCase& in, Outputs& out) {
+      return IGM_boundary_loop(
+          in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+    });
+    add("IGM_boundary_loop_h", spec, [](const MeshCase& in, Outputs& out) {
+      return IGM_boundary_loop_h(in.handle, &out[0].data, &out[0].size);
+    });
+    add("IGM_boundary_facet", spec, [](const MeshCase& in, Outputs& out) {
+      return IGM_boundary_facet(in.meshBuffer.data(),
+                                size(in.meshBuffer),
+                                &out[0].data,
+                                &out[0].size,
+                                &out[1].data,
+                                &out[1].size);
+    });
+    add("IGM_boundary_facet_h", spec, [](const MeshCase& in, Outputs& out) {
+      return IGM_boundary_facet_h(
+          in.handle, &out[0].data, &out[0].size, &out[1].data, &out[1].size);
+    });
+  }
+}
+
+void addScalarBenchmarks(const MeshSpec& spec) {
+  add("IGM_remap_VtoF", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_remap_VtoF(in.meshBuffer.data(),
+                          size(in.meshBuffer),
+                          in.vertexScalars.data(),
+                          size(in.vertexScalars),
+                          &out[0].data,
+                          &out[0].size);
+  });
+  add("IGM_remap_VtoF_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_remap_VtoF_h(
+        in.handle, in.vertexScalars.data(), size(in.vertexScalars), &out[0].data, &out[0].size);
+  });
+  add("IGM_remap_FtoV", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_remap_FtoV(in.meshBuffer.data(),
+                          size(in.meshBuffer),
+                          in.faceScalars.data(),
+                          size(in.faceScalars),
+                          &out[0].data,
+                          &out[0].size);
+  });
+  add("IGM_remap_FtoV_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_remap_FtoV_h(
+        in.handle, in.faceScalars.data(), size(in.faceScalars), &out[0].data, &out[0].size);
+  });
+
+  add("IGM_extract_isoline_from_scalar", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_extract_isoline_from_scalar(in.meshBuffer.data(),
+                                           size(in.meshBuffer),
+                                           in.vertexScalars.data(),
+                                           size(in.vertexScalars),
+                                           in.isoValues.data(),
+                                           size(in.isoValues),
+                                           &out[0].data,
+                                           &out[0].size);
+  });
+  add("IGM_extract_isoline_from_scalar_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_extract_isoline_from_scalar_h(in.handle,
+                                             in.vertexScalars.data(),
+                                             size(in.vertexScalars),
+                                             in.isoValues.data(),
+                                             size(in.isoValues),
+                                             &out[0].data,
+                                             &out[0].size);
+  });
+}
+
+void addCurvatureBenchmarks(const MeshSpec& spec) {
+  constexpr uint32_t kRadius = 5;
+  add("IGM_principal_curvature", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_principal_curvature(in.meshBuffer.data(),
+                                   size(in.meshBuffer),
+                                   kRadius,
+                                   &out[0].data,
+                                   &out[0].size,
+                                   &out[1].data,
+                                   &out[1].size,
+                                   &out[2].data,
+                                   &out[2].size,
+                                   &out[3].data,
+                                   &out[3].size);
+  });
+  add("IGM_principal_curvature_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_principal_curvature_h(in.handle,
+                                     kRadius,
+                                     &out[0].data,
+                                     &out[0].size,
+                                     &out[1].data,
+                                     &out[1].size,
+                                     &out[2].data,
+                                     &out[2].size,
+                                     &out[3].data,
+                                     &out[3].size);
+  });
+  add("IGM_gaussian_curvature", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_gaussian_curvature(
+        in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_gaussian_curvature_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_gaussian_curvature_h(in.handle, &out[0].data, &out[0].size);
+  });
+}
+
+void addMeasureBenchmarks(const MeshSpec& spec) {
+  add("IGM_fast_winding_number", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_fast_winding_number(in.meshBuffer.data(),
+                                   size(in.meshBuffer),
+                                   in.queryBuffer.data(),
+                                   size(in.queryBuffer),
+                                   &out[0].data,
+                                   &out[0].size);
+  });
+  add("IGM_fast_winding_number_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_fast_winding_number_h(
+        in.handle, in.queryBuffer.data(), size(in.queryBuffer), &out[0].data, &out[0].size);
+  });
+
+  constexpr int kExpansionOrder = 2;
+  add("IGM_fast_winding_number_create", spec, [](const MeshCase& in, Outputs&) {
+    uint64_t index = 0;
+    return IGM_fast_winding_number_create(
+               in.meshBuffer.data(), size(in.meshBuffer), kExpansionOrder, &index) &&
+           IGM_fast_winding_number_release(index);
+  });
+  add("IGM_fast_winding_number_create_h", spec, [](const MeshCase& in, Outputs&) {
+    uint64_t index = 0;
+    return IGM_fast_winding_number_create_h(in.handle, kExpansionOrder, &index) &&
+           IGM_fast_winding_number_release(index);
+  });
+  add(
+      "IGM_fast_winding_number_query",
+      spec,
+      [](const MeshCase& in, Outputs& out) {
+        constexpr double kAccuracy = 2.0;
+        return IGM_fast_winding_number_query(in.windingNumber,
+                                             kAccuracy,
+                                             in.queryBuffer.data(),
+                                             size(in.queryBuffer),
+                                             &out[0].data,
+                                             &out[0].size);
+      },
+      prepareWindingNumber);
+
+  constexpr int kFastWindingNumberSign = 4;
+  add("IGM_signed_distance", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_signed_distance(in.meshBuffer.data(),
+                               size(in.meshBuffer),
+                               in.queryBuffer.data(),
+                               size(in.queryBuffer),
+                               kFastWindingNumberSign,
+                               &out[0].data,
+                               &out[0].size,
+                               &out[1].data,
+                               &out[1].size,
+                               &out[2].data,
+                               &out[2].size);
+  });
+  add("IGM_signed_distance_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_signed_distance_h(in.handle,
+                                 in.queryBuffer.data(),
+                                 size(in.queryBuffer),
+                                 kFastWindingNumberSign,
+                                 &out[0].data,
+                                 &out[0].size,
+                                 &out[1].data,
+                                 &out[1].size,
+                                 &out[2].data,
+                                 &out[2].size);
+  });
+  add("IGM_signed_distance_ex", spec, [](const MeshCase& in, Outputs& out) {
+    const IGM_MeshInput mesh{in.meshBuffer.data(), size(in.meshBuffer), 0, 0};
+    return callEx(out, [&](const IGM_CallOptions* options) {
+      return IGM_signed_distance_ex(
+          &mesh, in.queryBuffer.data(), size(in.queryBuffer), kFastWindingNumberSign, options);
+    });
+  });
+  add("IGM_distance_index_build", spec, [](const MeshCase& in, Outputs&) {
+    uint64_t index = 0;
+    return IGM_distance_index_build(
+               in.meshBuffer.data(), size(in.meshBuffer), kFastWindingNumberSign, &index) &&
+           IGM_mesh_release(index);
+  });
+  add(
+      "IGM_signed_distance_query",
+      spec,
+      [](const MeshCase& in, Outputs& out) {
+        return IGM_signed_distance_query(in.distanceIndex,
+                                         in.queryBuffer.data(),
+                                         size(in.queryBuffer),
+                                         kFastWindingNumberSign,
+                                         &out[0].data,
+                                         &out[0].size,
+                                         &out[1].data,
+                                         &out[1].size,
+                                         &out[2].data,
+                                         &out[2].size);
+      },
+      prepareDistanceIndex);
+
+  add("IGM_closest_point_normal", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_closest_point_normal(in.meshBuffer.data(),
+                                    size(in.meshBuffer),
+                                    in.queryBuffer.data(),
+                                    size(in.queryBuffer),
+                                    &out[0].data,
+                                    &out[0].size,
+                                    &out[1].data,
+                                    &out[1].size,
+                                    &out[2].data,
+                                    &out[2].size,
+                                    &out[3].data,
+                                    &out[3].size);
+  });
+  add("IGM_closest_point_normal_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_closest_point_normal_h(in.handle,
+                                      in.queryBuffer.data(),
+                                      size(in.queryBuffer),
+                                      &out[0].data,
+                                      &out[0].size,
+                                      &out[1].data,
+                                      &out[1].size,
+                                      &out[2].data,
+                                      &out[2].size,
+                                      &out[3].data,
+                                      &out[3].size);
+  });
+}
+
+void addSolverBenchmarks(const MeshSpec& spec, bool open) {
+  // Harmonic parametrization maps the boundary loop to a circle
+  if (open) {
+    constexpr int kHarmonicOrder = 1;
+    add("IGM_param_harmonic", spec, [](const MeshCase& in, Outputs& out) {
+      return IGM_param_harmonic(
+          in.meshBuffer.data(), size(in.meshBuffer), kHarmonicOrder, &out[0].data, &out[0].size);
+    });
+    add("IGM_param_harmonic_h", spec, [](const MeshCase& in, Outputs& out) {
+      return IGM_param_harmonic_h(in.handle, kHarmonicOrder, &out[0].data, &out[0].size);
+    });
+  }
+
+  add("IGM_laplacian_scalar", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_laplacian_scalar(in.meshBuffer.data(),
+                                size(in.meshBuffer),
+                                in.constraintIndices.data(),
+                                size(in.constraintIndices),
+                                in.constraintValues.data(),
+                                size(in.constraintValues),
+                                &out[0].data,
+                                &out[0].size);
+  });
+  add("IGM_laplacian_scalar_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_laplacian_scalar_h(in.handle,
+                                  in.constraintIndices.data(),
+                                  size(in.constraintIndices),
+                                  in.constraintValues.data(),
+                                  size(in.constraintValues),
+                                  &out[0].data,
+                                  &out[0].size);
+  });
+  add("IGM_constrained_scalar", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_constrained_scalar(in.meshBuffer.data(),
+                                  size(in.meshBuffer),
+                                  in.constraintIndices.data(),
+                                  size(in.constraintIndices),
+                                  in.constraintValues.data(),
+                                  size(in.constraintValues),
+                                  &out[0].data,
+                                  &out[0].size);
+  });
+  add("IGM_constrained_scalar_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_constrained_scalar_h(in.handle,
+                                    in.constraintIndices.data(),
+                                    size(in.constraintIndices),
+                                    in.constraintValues.data(),
+                                    size(in.constraintValues),
+                                    &out[0].data,
+                                    &out[0].size);
+  });
+
+  // Precomputes are released in the same iteration, so each one factorizes from scratch; the
+  // solves run on a precompute kept for the whole mesh
+  add("IGM_heat_geodesic_precompute", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_heat_geodesic_precompute(
+               in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size) &&
+           releaseHeatBuffer(out[0]);
+  });
+  add("IGM_heat_geodesic_precompute_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_heat_geodesic_precompute_h(in.handle, &out[0].data, &out[0].size) &&
+           releaseHeatBuffer(out[0]);
+  });
+  add("IGM_heat_geodesic_create", spec, [](const MeshCase& in, Outputs&) {
+    uint64_t heat = 0;
+    return IGM_heat_geodesic_create(in.meshBuffer.data(), size(in.meshBuffer), &heat) &&
+           IGM_heat_geodesic_release(heat);
+  });
+  add("IGM_heat_geodesic_create_h", spec, [](const MeshCase& in, Outputs&) {
+    uint64_t heat = 0;
+    return IGM_heat_geodesic_create_h(in.handle, &heat) && IGM_heat_geodesic_release(heat);
+  });
+  add(
+      "IGM_heat_geodesic_solve",
+      spec,
+      [](const MeshCase& in, Outputs& out) {
+        return IGM_heat_geodesic_solve(in.heatPrecompute.data(),
+                                       size(in.heatPrecompute),
+                                       in.heatSources.data(),
+                                       size(in.heatSources),
+                                       &out[0].data,
+                                       &out[0].size);
+      },
+      prepareHeat);
+  add(
+      "IGM_heat_geodesic_distance",
+      spec,
+      [](const MeshCase& in, Outputs& out) {
+        return IGM_heat_geodesic_distance(
+            in.heat, in.heatSources.data(), size(in.heatSources), &out[0].data, &out[0].size);
+      },
+      prepareHeat);
+  add(
+      "IGM_heat_geodesic_cache_usage",
+      spec,
+      [](const MeshCase&, Outputs&) {
+        uint64_t usedBytes = 0;
+        int entryCount = 0;
+        IGM_heat_geodesic_cache_usage(&usedBytes, &entryCount);
+        return entryCount > 0;
+      },
+      prepareHeat);
+}
+
+void addSamplingBenchmarks(const MeshSpec& spec) {
+  add("IGM_random_point_on_mesh", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_random_point_on_mesh(in.meshBuffer.data(),
+                                    size(in.meshBuffer),
+                                    in.sampleCount,
+                                    &out[0].data,
+                                    &out[0].size,
+                                    &out[1].data,
+                                    &out[1].size);
+  });
+  add("IGM_random_point_on_mesh_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_random_point_on_mesh_h(
+        in.handle, in.sampleCount, &out[0].data, &out[0].size, &out[1].data, &out[1].size);
+  });
+  add("IGM_blue_noise_sampling_on_mesh", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_blue_noise_sampling_on_mesh(in.meshBuffer.data(),
+                                           size(in.meshBuffer),
+                                           in.blueNoiseCount,
+                                           &out[0].data,
+                                           &out[0].size,
+                                           &out[1].data,
+                                           &out[1].size);
+  });
+  add("IGM_blue_noise_sampling_on_mesh_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_blue_noise_sampling_on_mesh_h(
+        in.handle, in.blueNoiseCount, &out[0].data, &out[0].size, &out[1].data, &out[1].size);
+  });
+  add("IGM_blue_noise_sampling_on_mesh_ex", spec, [](const MeshCase& in, Outputs& out) {
+    const IGM_MeshInput mesh{in.meshBuffer.data(), size(in.meshBuffer), 0, 0};
+    return callEx(out, [&](const IGM_CallOptions* options) {
+      return IGM_blue_noise_sampling_on_mesh_ex(&mesh, in.blueNoiseCount, options);
+    });
+  });
+}
+
+void addJobBenchmarks(const MeshSpec& spec) {
+  constexpr int kFastWindingNumberSign = 4;
+  add("IGM_submit_signed_distance", spec, [](const MeshCase& in, Outputs& out) {
+    uint64_t job = 0;
+    return IGM_submit_signed_distance(in.meshBuffer.data(),
+                                      size(in.meshBuffer),
+                                      in.queryBuffer.data(),
+                                      size(in.queryBuffer),
+                                      kFastWindingNumberSign,
+                                      &job) &&
+           finishJob(job, 3, out);
+  });
+  add("IGM_submit_signed_distance_h", spec, [](const MeshCase& in, Outputs& out) {
+    uint64_t job = 0;
+    return IGM_submit_signed_distance_h(in.handle,
+                                        in.queryBuffer.data(),
+                                        size(in.queryBuffer),
+                                        kFastWindingNumberSign,
+                                        &job) &&
+           finishJob(job, 3, out);
+  });
+  add("IGM_submit_heat_geodesic_precompute", spec, [](const MeshCase& in, Outputs& out) {
+    uint64_t job = 0;
+    return IGM_submit_heat_geodesic_precompute(in.meshBuffer.data(), size(in.meshBuffer), &job) &&
+           finishJob(job, 1, out) && releaseHeatBuffer(out[0]);
+  });
+  add("IGM_submit_heat_geodesic_precompute_h", spec, [](const MeshCase& in, Outputs& out) {
+    uint64_t job = 0;
+    return IGM_submit_heat_geodesic_precompute_h(in.handle, &job) && finishJob(job, 1, out) &&
+           releaseHeatBuffer(out[0]);
+  });
+}
+
+// Exports taking any mesh: transport, handles and file IO
+void addCommonBenchmarks(const MeshSpec& spec) {
+  add("mesh_roundtrip", spec, [](const MeshCase& in, Outputs& out) {
+    return mesh_roundtrip(in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("point3d_array_roundtrip", spec, [](const MeshCase& in, Outputs& out) {
+    return point3d_array_roundtrip(
+        in.vertexBuffer.data(), size(in.vertexBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_mesh_create", spec, [](const MeshCase& in, Outputs&) {
+    uint64_t handle = 0;
+    return IGM_mesh_create(in.meshBuffer.data(), size(in.meshBuffer), &handle) &&
+           IGM_mesh_release(handle);
+  });
+  add("IGM_centroid", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_centroid(in.meshBuffer.data(), size(in.meshBuffer), &out[0].data, &out[0].size);
+  });
+  add("IGM_centroid_h", spec, [](const MeshCase& in, Outputs& out) {
+    return IGM_centroid_h(in.handle, &out[0].data, &out[0].size);
+  });
+}
+
+void addFileBenchmarks(const MeshSpec& spec) {
+  add("IGM_write_triangle_mesh", spec, [](const MeshCase& in, Outputs&) {
+    return IGM_write_triangle_mesh(
+        in.meshBuffer.data(), size(in.meshBuffer), scratchMeshPath().string().c_str());
+  });
+  add("IGM_write_triangle_mesh_h", spec, [](const MeshCase& in, Outputs&) {
+    return IGM_write_triangle_mesh_h(in.handle, scratchMeshPath().string().c_str());
+  });
+  add(
+      "IGM_read_triangle_mesh",
+      spec,
+      [](const MeshCase&, Outputs& out) {
+        return IGM_read_triangle_mesh(
+            scratchMeshPath().string().c_str(), &out[0].data, &out[0].size);
+      },
+      prepareScratchMesh);
+}
+
+void addMeshBenchmarks(const MeshSpec& spec) {
+  addCommonBenchmarks(spec);
+  if (spec.kind == MeshKind::QuadGrid) {
+    addQuadBenchmarks(spec);
+  } else {
+    const bool open = spec.kind != MeshKind::Icosphere;
+    addFileBenchmarks(spec);
+    addNormalBenchmarks(spec);
+    addTopologyBenchmarks(spec, open);
+    addScalarBenchmarks(spec);
+    addCurvatureBenchmarks(spec);
+    addMeasureBenchmarks(spec);
+    addSolverBenchmarks(spec, open);
+    addSamplingBenchmarks(spec);
+    addJobBenchmarks(spec);
+  }
+
+  // Last: invalidates the handle's geometric data, which the benchmarks above reuse
+  add("IGM_mesh_update_vertices", spec, [](const MeshCase& in, Outputs&) {
+    return IGM_mesh_update_vertices(in.handle, in.vertexBuffer.data(), size(in.vertexBuffer));
+  });
+}
+
+// Exports that do not take a mesh: their cost is the call and (de)serialization overhead
+void addCallBenchmarks(const Options& options) {
+  const auto addCall = [](const char* name, std::function<bool()> call) {
+    benchmark::RegisterBenchmark(name, [call = std::move(call)](benchmark::State& state) {
+      for (auto _ : state) {
+        if (!call()) {
+          state.SkipWithError("export returned false");
+          break;
+        }
+      }
+    });
+  };
+
+  const auto point = pointBuffer(1.0, 2.0, 3.0);
+  addCall("point3d_roundtrip", [point] {
+    InteropBuffer out;
+    return point3d_roundtrip(point.data(), size(point), &out.data, &out.size);
+  });
+
+  addCall("IGM_mesh_dedup_stats", [] {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    int entryCount = 0;
+    IGM_mesh_dedup_stats(&hits, &misses, &entryCount);
+    return true;
+  });
+  addCall("IGM_mesh_dedup_reset_stats", [] {
+    IGM_mesh_dedup_reset_stats();
+    return true;
+  });
+  const auto dedupLimit = options.cold ? 0 : kDefaultDedupLimit;
+  addCall("IGM_mesh_dedup_set_limit", [dedupLimit] {
+    IGM_mesh_dedup_set_limit(dedupLimit);
+    return true;
+  });
+
+  addCall("IGM_get_num_threads", [] { return IGM_get_num_threads() > 0; });
+  addCall("IGM_set_num_threads", [threads = options.threads] {
+    return IGM_set_num_threads(threads);
+  });
+
+  addCall("IGM_profile_snapshot", [] {
+    InteropBuffer out;
+    return IGM_profile_snapshot(&out.data, &out.size);
+  });
+  addCall("IGM_profile_reset", [] {
+    IGM_profile_reset();
+    return true;
+  });
+  addCall("IGM_trace_start", [] {
+    const bool started = IGM_trace_start(0);
+    IGM_trace_stop();
+    return started;
+  });
+  addCall("IGM_trace_dump", [] {
+    const bool started = IGM_trace_start(0);
+    IGM_trace_stop();
+    return started && IGM_trace_dump(scratchTracePath().string().c_str());
+  });
+
+  addCall("IGM_memory_usage", [] {
+    uint64_t current = 0;
+    uint64_t peak = 0;
+    return IGM_memory_usage(-1, &current, &peak);
+  });
+  addCall("IGM_memory_reset_peaks", [] {
+    IGM_memory_reset_peaks();
+    return true;
+  });
+  addCall("IGM_memory_set_budget", [] {
+    IGM_memory_set_budget(IGM_memory_get_budget());
+    return true;
+  });
+  addCall("IGM_heat_geodesic_set_cache_limit", [] {
+    IGM_heat_geodesic_set_cache_limit(kDefaultHeatCacheLimit);
+    return true;
+  });
+}
+
+// ! Command line
+std::vector<std::string> splitList(const std::string& text) {
+  std::vector<std::string> items;
+  std::stringstream stream(text);
+  for (std::string item; std::getline(stream, item, ',');) {
+    if (!item.empty()) {
+      items.push_back(item);
+    }
+  }
+  return items;
+}
+
+bool parseKind(const std::string& text, MeshKind& kind) {
+  for (const auto candidate : {MeshKind::Icosphere, MeshKind::NoisyGrid, MeshKind::QuadGrid}) {
+    if (text == meshKindName(candidate)) {
+      kind = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Consume the --igm_* flags; false (with a message) on a malformed or unknown argument
+bool parseOptions(int argc, char** argv, Options& options) {
+  const auto value = [](const std::string& argument, const std::string& flag, std::string& out) {
+    if (argument.rfind(flag + "=", 0) != 0) {
+      return false;
+    }
+    out = argument.substr(flag.size() + 1);
+    return true;
+  };
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string argument = argv[i];
+    std::string text;
+    if (value(argument, "--igm_sizes", text)) {
+      options.sizes.clear();
+      for (const auto& item : splitList(text)) {
+        const auto faces = parseCount(item);
+        if (faces == 0) {
+          std::fprintf(stderr, "igm_bench: bad face count '%s'\n", item.c_str());
+          return false;
+        }
+        options.sizes.push_back(faces);
+      }
+    } else if (value(argument, "--igm_kinds", text)) {
+      options.kinds.clear();
+      for (const auto& item : splitList(text)) {
+        MeshKind kind;
+        if (!parseKind(item, kind)) {
+          std::fprintf(stderr, "igm_bench: unknown mesh kind '%s'\n", item.c_str());
+          return false;
+        }
+        options.kinds.push_back(kind);
+      }
+    } else if (value(argument, "--igm_mesh", text)) {
+      options.files.push_back(text);
+    } else if (value(argument, "--igm_threads", text)) {
+      options.threads = std::atoi(text.c_str());
+    } else if (argument == "--igm_cold") {
+      options.cold = true;
+    } else {
+      std::fprintf(stderr, "igm_bench: unknown argument '%s'\n", argument.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+void printHelp() {
+  std::printf(
+      "igm_bench [--igm_sizes=1k,10k,100k,1M] [--igm_kinds=icosphere,grid,quad]\n"
+      "          [--igm_mesh=path ...] [--igm_threads=N] [--igm_cold] [benchmark flags]\n\n"
+      "  --igm_sizes    approximate face counts of the synthetic meshes (k and M suffixes)\n"
+      "  --igm_kinds    synthetic meshes to generate; empty for files only\n"
+      "  --igm_mesh     mesh file to benchmark as well (any IGM_read_triangle_mesh format)\n"
+      "  --igm_threads  native thread count (IGM_set_num_threads, 0 = hardware threads)\n"
+      "  --igm_cold     turn the mesh dedup cache off\n\n");
+  benchmark::PrintDefaultHelp();
+}
+
+std::vector<MeshSpec> meshSpecs(const Options& options) {
+  std::vector<MeshSpec> specs;
+  for (const auto faces : options.sizes) {
+    for (const auto kind : options.kinds) {
+      const auto name =
+          std::string(meshKindName(kind)) + "/faces:" + std::to_string(meshFaceCount(kind, faces));
+      specs.push_back(MeshSpec{kind, faces, {}, name});
+    }
+  }
+  for (const auto& file : options.files) {
+    specs.push_back(MeshSpec{MeshKind::File,
+                             0,
+                             file,
+                             "file:" + std::filesystem::path(file).filename().string()});
+  }
+  return specs;
+}
+}  // namespace
+}  // namespace GeoSharPlusCPP::Bench
+
+int main(int argc, char** argv) {
+  namespace Bench = GeoSharPlusCPP::Bench;
+
+  benchmark::Initialize(&argc, argv, Bench::printHelp);
+  Bench::Options options;
+  if (!Bench::parseOptions(argc, argv, options)) {
+    return 1;
+  }
+
+  if (!IGM_set_num_threads(options.threads)) {
+    std::fprintf(stderr, "igm_bench: invalid thread count %d\n", options.threads);
+    return 1;
+  }
+  IGM_mesh_dedup_set_limit(options.cold ? 0 : Bench::kDefaultDedupLimit);
+  benchmark::AddCustomContext("igm_threads", std::to_string(IGM_get_num_threads()));
+  benchmark::AddCustomContext("igm_dedup", options.cold ? "off" : "on");
+
+  Bench::addCallBenchmarks(options);
+  for (const auto& spec : Bench::meshSpecs(options)) {
+    Bench::addMeshBenchmarks(spec);
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  std::error_code ignored;
+  std::filesystem::remove(Bench::scratchMeshPath(), ignored);
+  std::filesystem::remove(Bench::scratchTracePath(), ignored);
+  return 0;
+}
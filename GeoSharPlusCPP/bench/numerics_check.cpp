@@ -0,0 +1,169 @@
+// numerics_check: compares the solvers the library implements itself with the libigl functions
+// they stand in for, through the C interface, on the synthetic bench meshes:
+//
+//   IGM_heat_geodesic_distance   igl::heat_geodesics_solve
+//   IGM_laplacian_scalar         igl::harmonic (k = 1)
+//   IGM_param_harmonic (k = 1)   igl::harmonic with the boundary mapped to a circle
+//
+// Prints the largest difference of each check relative to the largest libigl value, and exits
+// with 1 if any is above the tolerance. Run it after changing the Laplacian, mass matrix or
+// factorization code.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <igl/boundary_loop.h>
+#include <igl/harmonic.h>
+#include <igl/heat_geodesics.h>
+#include <igl/map_vertices_to_circle.h>
+
+#include "BenchInputs.h"
+#include "GeoSharPlusCPP/API/BridgeAPI.h"
+
+namespace GeoSharPlusCPP::Bench {
+namespace {
+// Both sides solve directly, so they agree far below this unless the discretization differs
+constexpr double kTolerance = 1e-6;
+constexpr double kFailed = std::numeric_limits<double>::infinity();
+constexpr std::size_t kSizes[] = {1000, 20000};
+
+int size(const Buffer& buffer) {
+  return static_cast<int>(buffer.size());
+}
+
+struct IglMesh {
+  Eigen::MatrixXd V;
+  Eigen::MatrixXi F;
+};
+
+IglMesh toIgl(const MeshData& mesh) {
+  using RowMajorXd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using RowMajorXi = Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  IglMesh result;
+  result.V = Eigen::Map<const RowMajorXd>(
+      mesh.vertices.data(), static_cast<Eigen::Index>(mesh.vertexCount()), 3);
+  result.F = Eigen::Map<const RowMajorXi>(
+      mesh.faces.data(), static_cast<Eigen::Index>(mesh.faceCount()), mesh.corners);
+  return result;
+}
+
+// Largest |ours - reference| over the largest |reference|; `ours` is row-major
+double relativeError(const std::vector<double>& ours, const Eigen::MatrixXd& reference) {
+  if (ours.size() != static_cast<std::size_t>(reference.size())) {
+    return kFailed;
+  }
+  double difference = 0.0;
+  for (Eigen::Index r = 0; r < reference.rows(); ++r) {
+    for (Eigen::Index c = 0; c < reference.cols(); ++c) {
+      const auto value = ours[static_cast<std::size_t>(r * reference.cols() + c)];
+      difference = std::max(difference, std::abs(value - reference(r, c)));
+    }
+  }
+  const double scale = reference.cwiseAbs().maxCoeff();
+  return scale > 0.0 ? difference / scale : difference;
+}
+
+double checkHeatGeodesics(const Buffer& meshBuffer, const IglMesh& mesh) {
+  uint64_t heat = 0;
+  if (!IGM_heat_geodesic_create(meshBuffer.data(), size(meshBuffer), &heat)) {
+    return kFailed;
+  }
+  const auto sources = intArrayBuffer({0});
+  InteropBuffer out;
+  const bool solved =
+      IGM_heat_geodesic_distance(heat, sources.data(), size(sources), &out.data, &out.size);
+  static_cast<void>(IGM_heat_geodesic_release(heat));
+  std::vector<double> ours;
+  if (!solved || !readDoubleArray(out.data, out.size, ours)) {
+    return kFailed;
+  }
+
+  igl::HeatGeodesicsData<double> data;
+  if (!igl::heat_geodesics_precompute(mesh.V, mesh.F, data)) {
+    return kFailed;
+  }
+  Eigen::VectorXd reference;
+  igl::heat_geodesics_solve(data, Eigen::VectorXi::Zero(1), reference);
+  return relativeError(ours, reference);
+}
+
+double checkHarmonic(const Buffer& meshBuffer, const IglMesh& mesh) {
+  const auto n = static_cast<int32_t>(mesh.V.rows());
+  const std::vector<int32_t> fixed{0, n / 3, 2 * n / 3, n - 1};
+  const std::vector<double> values{0.0, 1.0, -1.0, 0.5};
+  const auto indexBuffer = intArrayBuffer(fixed);
+  const auto valueBuffer = doubleArrayBuffer(values);
+  InteropBuffer out;
+  std::vector<double> ours;
+  if (!IGM_laplacian_scalar(meshBuffer.data(),
+                            size(meshBuffer),
+                            indexBuffer.data(),
+                            size(indexBuffer),
+                            valueBuffer.data(),
+                            size(valueBuffer),
+                            &out.data,
+                            &out.size) ||
+      !readDoubleArray(out.data, out.size, ours)) {
+    return kFailed;
+  }
+
+  const Eigen::VectorXi b = Eigen::Map<const Eigen::VectorXi>(fixed.data(), 4);
+  const Eigen::VectorXd bc = Eigen::Map<const Eigen::VectorXd>(values.data(), 4);
+  Eigen::MatrixXd reference;
+  if (!igl::harmonic(mesh.V, mesh.F, b, bc, 1, reference)) {
+    return kFailed;
+  }
+  return relativeError(ours, reference);
+}
+
+double checkParamHarmonic(const Buffer& meshBuffer, const IglMesh& mesh) {
+  InteropBuffer out;
+  std::vector<double> ours;
+  if (!IGM_param_harmonic(meshBuffer.data(), size(meshBuffer), 1, &out.data, &out.size) ||
+      !readPointArray(out.data, out.size, ours)) {
+    return kFailed;
+  }
+
+  Eigen::VectorXi boundary;
+  igl::boundary_loop(mesh.F, boundary);
+  Eigen::MatrixXd boundaryUV;
+  igl::map_vertices_to_circle(mesh.V, boundary, boundaryUV);
+  Eigen::MatrixXd uv;
+  if (!igl::harmonic(mesh.V, mesh.F, boundary, boundaryUV, 1, uv)) {
+    return kFailed;
+  }
+  Eigen::MatrixXd reference = Eigen::MatrixXd::Zero(uv.rows(), 3);  // Points with z = 0
+  reference.leftCols(2) = uv;
+  return relativeError(ours, reference);
+}
+
+bool report(const char* check, const std::string& mesh, double error) {
+  const bool passed = error <= kTolerance;
+  std::printf("%-28s %-16s %10.3e  %s\n", check, mesh.c_str(), error, passed ? "ok" : "FAILED");
+  return passed;
+}
+}  // namespace
+}  // namespace GeoSharPlusCPP::Bench
+
+int main() {
+  using namespace GeoSharPlusCPP::Bench;
+  bool passed = true;
+  for (const auto kind : {MeshKind::Icosphere, MeshKind::NoisyGrid}) {
+    for (const auto targetFaces : kSizes) {
+      const auto mesh = makeMesh(kind, targetFaces);
+      const auto buffer = meshBuffer(mesh);
+      const auto iglMesh = toIgl(mesh);
+      const auto name = std::string(meshKindName(kind)) + "/" + std::to_string(mesh.faceCount());
+
+      passed &= report("heat geodesics", name, checkHeatGeodesics(buffer, iglMesh));
+      passed &= report("harmonic", name, checkHarmonic(buffer, iglMesh));
+      if (kind == MeshKind::NoisyGrid) {
+        passed &= report("harmonic parametrization", name, checkParamHarmonic(buffer, iglMesh));
+      }
+    }
+  }
+  return passed ? 0 : 1;
+}
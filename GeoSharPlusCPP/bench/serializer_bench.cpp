@@ -0,0 +1,401 @@
+// serializer_bench: throughput and allocations of every Serializer template instantiation, per
+// size class, in both directions, separately from the geometry kernels.
+//
+//   serializer_bench [benchmark flags]
+//
+// Counters per benchmark: GB/s and bytes_per_second over the serialized buffer size, and the
+// heap allocations (allocs) and allocated bytes (alloc_bytes) per call. Serialization includes
+// freeing the output buffer, deserialization the destruction of the output container, as each
+// export does. Deserializers run with the FlatBuffers verifier on and off (the verify argument).
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "GeoSharPlusCPP/Serialization/Serializer.h"
+
+namespace GeoSharPlusCPP::Serialization {
+// Defined by Serializer.cpp in this target only (GEOSHARPLUS_SERIALIZER_BENCH)
+void setBenchInputVerification(bool enabled) noexcept;
+}  // namespace GeoSharPlusCPP::Serialization
+
+namespace GeoSharPlusCPP::Bench {
+namespace {
+namespace GS = GeoSharPlusCPP::Serialization;
+
+// Elements (numbers, pairs, points, sub-arrays or faces) per call
+const std::vector<int64_t> kSizeClasses{int64_t{1} << 10,
+                                        int64_t{1} << 14,
+                                        int64_t{1} << 18,
+                                        int64_t{1} << 22};
+constexpr int kNestedWidth = 6;  // Entries per sub-array, about a vertex's valence
+
+void serializeSizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({kSizeClasses})->ArgNames({"n"});
+}
+
+void deserializeSizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({kSizeClasses, {0, 1}})->ArgNames({"n", "verify"});
+}
+
+// ! Inputs
+template <typename Container>
+Container makeNumbers(std::size_t n) {
+  Container numbers(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    numbers[i] = static_cast<std::decay_t<decltype(numbers[0])>>(i % 1000) / 2;
+  }
+  return numbers;
+}
+
+template <typename Container>
+Container makePairs(std::size_t n) {
+  Container pairs;
+  if constexpr (requires { pairs.reserve(n); }) {
+    using Value = typename Container::value_type::first_type;
+    pairs.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      pairs.emplace_back(static_cast<Value>(i), static_cast<Value>(i + 1));
+    }
+  } else {
+    using Value = typename Container::Scalar;
+    pairs.resize(static_cast<Eigen::Index>(n), 2);
+    for (Eigen::Index i = 0; i < pairs.rows(); ++i) {
+      pairs(i, 0) = static_cast<Value>(i);
+      pairs(i, 1) = static_cast<Value>(i + 1);
+    }
+  }
+  return pairs;
+}
+
+template <typename Container>
+Container makePoints(std::size_t n) {
+  if constexpr (std::is_same_v<Container, Eigen::MatrixXd> ||
+                std::is_same_v<Container, MatrixX3f>) {
+    return Container::Random(static_cast<Eigen::Index>(n), 3);
+  } else {
+    Container points(n);
+    for (auto& point : points) {
+      point = Container::value_type::Random();
+    }
+    return points;
+  }
+}
+
+std::vector<std::vector<int>> makeNested(std::size_t n) {
+  std::vector<std::vector<int>> nested(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (int j = 0; j < kNestedWidth; ++j) {
+      nested[i].push_back(static_cast<int>((i + static_cast<std::size_t>(j)) % n));
+    }
+  }
+  return nested;
+}
+
+// `faces` faces with `corners` corners over about as many vertices; the serializer does not look
+// at the topology, so the indices only have to be in range
+Mesh makeMesh(std::size_t faces, int corners) {
+  const auto rows = static_cast<Eigen::Index>(faces);
+  Mesh mesh;
+  mesh.V = MatrixX3d::Random(rows, 3);
+  mesh.F.resize(rows, corners);
+  for (Eigen::Index f = 0; f < rows; ++f) {
+    for (int c = 0; c < corners; ++c) {
+      mesh.F(f, c) = static_cast<int>((f + c) % rows);
+    }
+  }
+  return mesh;
+}
+
+// ! Runners
+// Allocation and throughput counters around the timed loop
+class Meter {
+public:
+  explicit Meter(benchmark::State& state) : state_(state), start_(allocationCount()) {}
+
+  void finish(std::size_t bytesPerCall) {
+    const auto end = allocationCount();
+    const auto iterations = static_cast<double>(state_.iterations());
+    const auto bytes = static_cast<double>(bytesPerCall);
+    state_.SetBytesProcessed(static_cast<int64_t>(state_.iterations()) *
+                             static_cast<int64_t>(bytesPerCall));
+    state_.counters["GB/s"] = benchmark::Counter(iterations * bytes / 1e9,
+                                                 benchmark::Counter::kIsRate);
+    state_.counters["allocs"] = benchmark::Counter(static_cast<double>(end.count - start_.count),
+                                                   benchmark::Counter::kAvgIterations);
+    state_.counters["alloc_bytes"] = benchmark::Counter(
+        static_cast<double>(end.bytes - start_.bytes), benchmark::Counter::kAvgIterations);
+  }
+
+private:
+  benchmark::State& state_;
+  AllocationCount start_;
+};
+
+template <typename Serialize>
+void runSerialize(benchmark::State& state, Serialize&& serialize) {
+  std::size_t bytes = 0;
+  Meter meter(state);
+  for (auto _ : state) {
+    uint8_t* buffer = nullptr;
+    int size = 0;
+    if (!serialize(buffer, size)) {
+      state.SkipWithError("serialization failed");
+      break;
+    }
+    bytes = static_cast<std::size_t>(size);
+    GS::FreeInteropMemory(buffer);
+  }
+  meter.finish(bytes);
+}
+
+// Output buffers of a serializer, kept for the deserialization benchmarks
+class SerializedInput {
+public:
+  template <typename Serialize>
+  explicit SerializedInput(Serialize&& serialize) {
+    if (!serialize(data_, size_)) {
+      data_ = nullptr;
+      size_ = 0;
+    }
+  }
+  SerializedInput(const SerializedInput&) = delete;
+  SerializedInput& operator=(const SerializedInput&) = delete;
+  ~SerializedInput() {
+    GS::FreeInteropMemory(data_);
+  }
+
+  [[nodiscard]] const uint8_t* data() const noexcept {
+    return data_;
+  }
+  [[nodiscard]] int size() const noexcept {
+    return size_;
+  }
+
+private:
+  uint8_t* data_ = nullptr;
+  int size_ = 0;
+};
+
+template <typename Output, typename Deserialize>
+void runDeserialize(benchmark::State& state,
+                    const SerializedInput& input,
+                    Deserialize&& deserialize) {
+  if (!input.data()) {
+    state.SkipWithError("could not build the input");
+    return;
+  }
+
+  GS::setBenchInputVerification(state.range(1) != 0);
+  Meter meter(state);
+  for (auto _ : state) {
+    Output output;
+    if (!deserialize(input.data(), input.size(), output)) {
+      state.SkipWithError("deserialization failed");
+      break;
+    }
+    benchmark::DoNotOptimize(output);
+  }
+  meter.finish(static_cast<std::size_t>(input.size()));
+  GS::setBenchInputVerification(true);
+}
+
+std::size_t sizeClass(const benchmark::State& state) {
+  return static_cast<std::size_t>(state.range(0));
+}
+
+// ! Number arrays
+template <typename Container>
+void serializeNumberArray(benchmark::State& state) {
+  const auto numbers = makeNumbers<Container>(sizeClass(state));
+  runSerialize(state, [&](uint8_t*& buffer, int& size) {
+    return GS::serializeNumberArray(numbers, buffer, size);
+  });
+}
+
+template <typename Container>
+void deserializeNumberArray(benchmark::State& state) {
+  const auto numbers = makeNumbers<Container>(sizeClass(state));
+  const SerializedInput input([&](uint8_t*& buffer, int& size) {
+    return GS::serializeNumberArray(numbers, buffer, size);
+  });
+  runDeserialize<Container>(state, input, [](const uint8_t* data, int size, Container& output) {
+    return GS::deserializeNumberArray(data, size, output);
+  });
+}
+
+BENCHMARK_TEMPLATE(serializeNumberArray, std::vector<double>)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializeNumberArray, std::vector<int>)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializeNumberArray, Eigen::VectorXd)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializeNumberArray, Eigen::VectorXi)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberArray, std::vector<double>)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberArray, std::vector<int>)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberArray, Eigen::VectorXd)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberArray, Eigen::VectorXi)->Apply(deserializeSizes);
+
+// ! Pair arrays
+template <typename Container>
+void serializeNumberPairArray(benchmark::State& state) {
+  const auto pairs = makePairs<Container>(sizeClass(state));
+  runSerialize(state, [&](uint8_t*& buffer, int& size) {
+    return GS::serializeNumberPairArray(pairs, buffer, size);
+  });
+}
+
+template <typename Container>
+void deserializeNumberPairArray(benchmark::State& state) {
+  const auto pairs = makePairs<Container>(sizeClass(state));
+  const SerializedInput input([&](uint8_t*& buffer, int& size) {
+    return GS::serializeNumberPairArray(pairs, buffer, size);
+  });
+  runDeserialize<Container>(state, input, [](const uint8_t* data, int size, Container& output) {
+    return GS::deserializeNumberPairArray(data, size, output);
+  });
+}
+
+BENCHMARK_TEMPLATE(serializeNumberPairArray, std::vector<std::pair<int, int>>)
+    ->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializeNumberPairArray, Eigen::Matrix<int, Eigen::Dynamic, 2>)
+    ->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializeNumberPairArray, std::vector<std::pair<double, double>>)
+    ->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializeNumberPairArray, Eigen::Matrix<double, Eigen::Dynamic, 2>)
+    ->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberPairArray, std::vector<std::pair<int, int>>)
+    ->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberPairArray, Eigen::Matrix<int, Eigen::Dynamic, 2>)
+    ->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberPairArray, std::vector<std::pair<double, double>>)
+    ->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeNumberPairArray, Eigen::Matrix<double, Eigen::Dynamic, 2>)
+    ->Apply(deserializeSizes);
+
+// ! Point arrays
+template <typename Container>
+void serializePointArray(benchmark::State& state) {
+  const auto points = makePoints<Container>(sizeClass(state));
+  runSerialize(state, [&](uint8_t*& buffer, int& size) {
+    return GS::serializePointArray(points, buffer, size);
+  });
+}
+
+template <typename Container>
+void deserializePointArray(benchmark::State& state) {
+  const auto points = makePoints<Container>(sizeClass(state));
+  const SerializedInput input([&](uint8_t*& buffer, int& size) {
+    return GS::serializePointArray(points, buffer, size);
+  });
+  runDeserialize<Container>(state, input, [](const uint8_t* data, int size, Container& output) {
+    return GS::deserializePointArray(data, size, output);
+  });
+}
+
+BENCHMARK_TEMPLATE(serializePointArray, std::vector<Vector3d>)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializePointArray, Eigen::MatrixXd)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(deserializePointArray, std::vector<Vector3d>)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializePointArray, Eigen::MatrixXd)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(serializePointArray, std::vector<Vector3f>)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializePointArray, MatrixX3f)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(deserializePointArray, std::vector<Vector3f>)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializePointArray, MatrixX3f)->Apply(deserializeSizes);
+
+// ! Single point
+void serializePoint(benchmark::State& state) {
+  const Vector3d point(1.0, 2.0, 3.0);
+  runSerialize(state, [&](uint8_t*& buffer, int& size) {
+    return GS::serializePoint(point, buffer, size);
+  });
+}
+
+void deserializePoint(benchmark::State& state) {
+  const Vector3d point(1.0, 2.0, 3.0);
+  const SerializedInput input([&](uint8_t*& buffer, int& size) {
+    return GS::serializePoint(point, buffer, size);
+  });
+  runDeserialize<Vector3d>(state, input, [](const uint8_t* data, int size, Vector3d& output) {
+    return GS::deserializePoint(data, size, output);
+  });
+}
+
+BENCHMARK(serializePoint)->Arg(1)->ArgNames({"n"});
+BENCHMARK(deserializePoint)->ArgsProduct({{1}, {0, 1}})->ArgNames({"n", "verify"});
+
+// ! Nested arrays
+void serializeNestedIntArray(benchmark::State& state) {
+  const auto nested = makeNested(sizeClass(state));
+  runSerialize(state, [&](uint8_t*& buffer, int& size) {
+    return GS::serializeNestedIntArray(nested, buffer, size);
+  });
+}
+
+void deserializeNestedIntArray(benchmark::State& state) {
+  const auto nested = makeNested(sizeClass(state));
+  const SerializedInput input([&](uint8_t*& buffer, int& size) {
+    return GS::serializeNestedIntArray(nested, buffer, size);
+  });
+  using Nested = std::vector<std::vector<int>>;
+  runDeserialize<Nested>(state, input, [](const uint8_t* data, int size, Nested& output) {
+    return GS::deserializeNestedIntArray(data, size, output);
+  });
+}
+
+BENCHMARK(serializeNestedIntArray)->Apply(serializeSizes);
+BENCHMARK(deserializeNestedIntArray)->Apply(deserializeSizes);
+
+// ! Meshes
+template <int Corners>
+void serializeMesh(benchmark::State& state) {
+  const auto mesh = makeMesh(sizeClass(state), Corners);
+  runSerialize(state, [&](uint8_t*& buffer, int& size) {
+    return GS::serializeMesh(mesh, buffer, size);
+  });
+}
+
+template <int Corners>
+void deserializeMesh(benchmark::State& state) {
+  const auto mesh = makeMesh(sizeClass(state), Corners);
+  const SerializedInput input([&](uint8_t*& buffer, int& size) {
+    return GS::serializeMesh(mesh, buffer, size);
+  });
+  runDeserialize<Mesh>(state, input, [](const uint8_t* data, int size, Mesh& output) {
+    return GS::deserializeMesh(data, size, output);
+  });
+}
+
+// The zero-copy path the mesh exports take
+template <int Corners>
+void deserializeMeshView(benchmark::State& state) {
+  const auto mesh = makeMesh(sizeClass(state), Corners);
+  const SerializedInput input([&](uint8_t*& buffer, int& size) {
+    return GS::serializeMesh(mesh, buffer, size);
+  });
+  runDeserialize<MeshView>(state, input, [](const uint8_t* data, int size, MeshView& output) {
+    return GS::deserializeMeshView(data, size, output);
+  });
+}
+
+BENCHMARK_TEMPLATE(serializeMesh, 3)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(serializeMesh, 4)->Apply(serializeSizes);
+BENCHMARK_TEMPLATE(deserializeMesh, 3)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeMesh, 4)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeMeshView, 3)->Apply(deserializeSizes);
+BENCHMARK_TEMPLATE(deserializeMeshView, 4)->Apply(deserializeSizes);
+}  // namespace
+}  // namespace GeoSharPlusCPP::Bench
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::AddCustomContext(
+      "allocation_counting",
+      GeoSharPlusCPP::Bench::allocationCountIncludesMalloc() ? "malloc" : "operator new");
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,349 @@
+#include "Operations.h"
+
+#ifdef _WIN32
+  #include <combaseapi.h>  // CoTaskMemFree, the allocator of the export outputs
+#else
+  #include <cstdlib>
+#endif
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#include "GSP_FB/cpp/doubleArray_generated.h"
+#include "GSP_FB/cpp/intArray_generated.h"
+#include "GSP_FB/cpp/mesh_generated.h"
+#include "GSP_FB/cpp/pointArray_generated.h"
+#include "GeoSharPlusCPP/API/BridgeAPI.h"
+#include "flatbuffers/flatbuffers.h"
+
+namespace GeoSharPlusCPP::Cli {
+namespace {
+// Output buffer of an export, freed like the C# side frees it
+struct InteropBuffer {
+  InteropBuffer() = default;
+  InteropBuffer(const InteropBuffer&) = delete;
+  InteropBuffer& operator=(const InteropBuffer&) = delete;
+  ~InteropBuffer() {
+#ifdef _WIN32
+    CoTaskMemFree(data);
+#else
+    std::free(data);
+#endif
+  }
+
+  uint8_t* data = nullptr;
+  int size = 0;
+};
+
+// Mesh handle released at the end of the scope
+class MeshHandle {
+public:
+  MeshHandle() = default;
+  MeshHandle(const MeshHandle&) = delete;
+  MeshHandle& operator=(const MeshHandle&) = delete;
+  ~MeshHandle() {
+    if (handle_ != 0) {
+      IGM_mesh_release(handle_);
+    }
+  }
+
+  [[nodiscard]] uint64_t* out() noexcept {
+    return &handle_;
+  }
+  [[nodiscard]] uint64_t get() const noexcept {
+    return handle_;
+  }
+
+private:
+  uint64_t handle_ = 0;
+};
+
+template <typename Table>
+const Table* verifiedRoot(const InteropBuffer& buffer) {
+  if (!buffer.data || buffer.size <= 0) {
+    return nullptr;
+  }
+  flatbuffers::Verifier verifier(buffer.data, static_cast<std::size_t>(buffer.size));
+  if (!verifier.VerifyBuffer<Table>()) {
+    return nullptr;
+  }
+  return flatbuffers::GetRoot<Table>(buffer.data);
+}
+
+// Row-major x, y, z of a point array output
+bool readPoints(const InteropBuffer& buffer, std::vector<double>& xyz) {
+  const auto* table = verifiedRoot<GSP::FB::PointArrayData>(buffer);
+  if (!table || !table->points()) {
+    return false;
+  }
+  const auto* points = reinterpret_cast<const double*>(table->points()->Data());
+  xyz.assign(points, points + table->points()->size() * 3);
+  return true;
+}
+
+bool readDoubles(const InteropBuffer& buffer, std::vector<double>& values) {
+  const auto* table = verifiedRoot<GSP::FB::DoubleArrayData>(buffer);
+  if (!table || !table->values()) {
+    return false;
+  }
+  values.assign(table->values()->begin(), table->values()->end());
+  return true;
+}
+
+bool readInts(const InteropBuffer& buffer, std::vector<int32_t>& values) {
+  const auto* table = verifiedRoot<GSP::FB::IntArrayData>(buffer);
+  if (!table || !table->values()) {
+    return false;
+  }
+  values.assign(table->values()->begin(), table->values()->end());
+  return true;
+}
+
+// CSV with full double precision, one row per element
+class CsvWriter {
+public:
+  CsvWriter(const std::filesystem::path& path, const char* header)
+      : out_(path, std::ios::binary | std::ios::trunc) {
+    out_.precision(std::numeric_limits<double>::max_digits10);
+    out_ << header << '\n';
+  }
+
+  template <typename... Values>
+  void row(const Values&... values) {
+    bool first = true;
+    ((out_ << (first ? "" : ",") << values, first = false), ...);
+    out_ << '\n';
+  }
+
+  [[nodiscard]] bool close() {
+    out_.close();
+    return !out_.fail();
+  }
+
+private:
+  std::ofstream out_;
+};
+
+std::filesystem::path outputPath(const std::filesystem::path& stem, Operation operation) {
+  auto path = stem;
+  path += std::string(".") + operationName(operation) + ".csv";
+  return path;
+}
+
+// ! Operations
+// Each returns an empty string on success, otherwise what failed
+std::string writeNormals(uint64_t mesh, const std::filesystem::path& path) {
+  InteropBuffer normalsBuffer;
+  std::vector<double> normals;
+  if (!IGM_vert_normals_h(mesh, &normalsBuffer.data, &normalsBuffer.size) ||
+      !readPoints(normalsBuffer, normals)) {
+    return "vertex normals failed";
+  }
+
+  CsvWriter csv(path, "nx,ny,nz");
+  for (std::size_t i = 0; i < normals.size(); i += 3) {
+    csv.row(normals[i], normals[i + 1], normals[i + 2]);
+  }
+  return csv.close() ? "" : "could not write " + path.string();
+}
+
+std::string writeCurvature(uint64_t mesh, uint32_t radius, const std::filesystem::path& path) {
+  InteropBuffer pd1Buffer, pd2Buffer, pv1Buffer, pv2Buffer, gaussianBuffer;
+  std::vector<double> pd1, pd2, pv1, pv2, gaussian;
+  if (!IGM_principal_curvature_h(mesh,
+                                 radius,
+                                 &pd1Buffer.data,
+                                 &pd1Buffer.size,
+                                 &pd2Buffer.data,
+                                 &pd2Buffer.size,
+                                 &pv1Buffer.data,
+                                 &pv1Buffer.size,
+                                 &pv2Buffer.data,
+                                 &pv2Buffer.size) ||
+      !readPoints(pd1Buffer, pd1) || !readPoints(pd2Buffer, pd2) || !readDoubles(pv1Buffer, pv1) ||
+      !readDoubles(pv2Buffer, pv2)) {
+    return "principal curvature failed";
+  }
+  if (!IGM_gaussian_curvature_h(mesh, &gaussianBuffer.data, &gaussianBuffer.size) ||
+      !readDoubles(gaussianBuffer, gaussian)) {
+    return "gaussian curvature failed";
+  }
+
+  const auto count = std::min({pv1.size(), pv2.size(), gaussian.size(), pd1.size() / 3,
+                               pd2.size() / 3});
+  CsvWriter csv(path, "k1,k2,gaussian,d1x,d1y,d1z,d2x,d2y,d2z");
+  for (std::size_t i = 0; i < count; ++i) {
+    csv.row(pv1[i],
+            pv2[i],
+            gaussian[i],
+            pd1[3 * i],
+            pd1[3 * i + 1],
+            pd1[3 * i + 2],
+            pd2[3 * i],
+            pd2[3 * i + 1],
+            pd2[3 * i + 2]);
+  }
+  return csv.close() ? "" : "could not write " + path.string();
+}
+
+std::string writeDistance(const GSP::FB::MeshData& mesh,
+                          const ChainOptions& chain,
+                          const std::filesystem::path& path) {
+  // The mesh's own vertices are the query points
+  const auto* vertices = mesh.vertices();
+  flatbuffers::FlatBufferBuilder builder(vertices->size() * sizeof(GSP::FB::Vec3) + 256);
+  const auto pointVector = builder.CreateVectorOfStructs(
+      reinterpret_cast<const GSP::FB::Vec3*>(vertices->Data()), vertices->size());
+  builder.Finish(GSP::FB::CreatePointArrayData(builder, pointVector));
+
+  InteropBuffer distanceBuffer, faceBuffer, closestBuffer;
+  std::vector<double> distances, closest;
+  std::vector<int32_t> faces;
+  if (!IGM_signed_distance_query(chain.reference,
+                                 builder.GetBufferPointer(),
+                                 static_cast<int>(builder.GetSize()),
+                                 chain.signedType,
+                                 &distanceBuffer.data,
+                                 &distanceBuffer.size,
+                                 &faceBuffer.data,
+                                 &faceBuffer.size,
+                                 &closestBuffer.data,
+                                 &closestBuffer.size) ||
+      !readDoubles(distanceBuffer, distances) || !readInts(faceBuffer, faces) ||
+      !readPoints(closestBuffer, closest)) {
+    return "signed distance failed";
+  }
+
+  const auto count = std::min({distances.size(), faces.size(), closest.size() / 3});
+  CsvWriter csv(path, "distance,face,cx,cy,cz");
+  for (std::size_t i = 0; i < count; ++i) {
+    csv.row(distances[i], faces[i], closest[3 * i], closest[3 * i + 1], closest[3 * i + 2]);
+  }
+  return csv.close() ? "" : "could not write " + path.string();
+}
+
+std::string writeSamples(uint64_t mesh,
+                         const ChainOptions& chain,
+                         const std::filesystem::path& path) {
+  InteropBuffer pointBuffer, faceBuffer;
+  const bool sampled =
+      chain.blueNoise
+          ? IGM_blue_noise_sampling_on_mesh_h(mesh,
+                                              chain.sampleCount,
+                                              &pointBuffer.data,
+                                              &pointBuffer.size,
+                                              &faceBuffer.data,
+                                              &faceBuffer.size)
+          : IGM_random_point_on_mesh_h(mesh,
+                                       chain.sampleCount,
+                                       &pointBuffer.data,
+                                       &pointBuffer.size,
+                                       &faceBuffer.data,
+                                       &faceBuffer.size);
+  std::vector<double> points;
+  std::vector<int32_t> faces;
+  if (!sampled || !readPoints(pointBuffer, points) || !readInts(faceBuffer, faces)) {
+    return "sampling failed";
+  }
+
+  const auto count = std::min(points.size() / 3, faces.size());
+  CsvWriter csv(path, "x,y,z,face");
+  for (std::size_t i = 0; i < count; ++i) {
+    csv.row(points[3 * i], points[3 * i + 1], points[3 * i + 2], faces[i]);
+  }
+  return csv.close() ? "" : "could not write " + path.string();
+}
+}  // namespace
+
+const char* operationName(Operation operation) noexcept {
+  switch (operation) {
+    case Operation::Normals:
+      return "normals";
+    case Operation::Curvature:
+      return "curvature";
+    case Operation::Distance:
+      return "distance";
+    case Operation::Sample:
+      return "samples";
+  }
+  return "output";
+}
+
+bool parseOperation(const std::string& text, Operation& operation) noexcept {
+  for (const auto candidate :
+       {Operation::Normals, Operation::Curvature, Operation::Distance, Operation::Sample}) {
+    if (text == operationName(candidate)) {
+      operation = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool loadReference(const std::filesystem::path& path,
+                   int signedType,
+                   uint64_t& handle,
+                   std::string& message) {
+  InteropBuffer meshBuffer;
+  if (!IGM_read_triangle_mesh(path.string().c_str(), &meshBuffer.data, &meshBuffer.size)) {
+    message = "could not read the reference mesh " + path.string();
+    return false;
+  }
+  if (!IGM_distance_index_build(meshBuffer.data, meshBuffer.size, signedType, &handle)) {
+    message = "could not index the reference mesh " + path.string();
+    return false;
+  }
+  return true;
+}
+
+FileResult processFile(const std::filesystem::path& input,
+                       const std::filesystem::path& outputStem,
+                       const ChainOptions& chain) {
+  FileResult result;
+  InteropBuffer meshBuffer;
+  if (!IGM_read_triangle_mesh(input.string().c_str(), &meshBuffer.data, &meshBuffer.size)) {
+    result.message = "could not read the mesh";
+    return result;
+  }
+  const auto* mesh = verifiedRoot<GSP::FB::MeshData>(meshBuffer);
+  if (!mesh || !mesh->vertices() || !mesh->faces()) {
+    result.message = "not a triangle mesh";
+    return result;
+  }
+  result.vertices = mesh->vertices()->size();
+  result.faces = mesh->faces()->size();
+
+  // Derived data (normals, areas, adjacency) is shared by the operations through the handle
+  MeshHandle handle;
+  if (!IGM_mesh_create(meshBuffer.data, meshBuffer.size, handle.out())) {
+    result.message = "could not load the mesh";
+    return result;
+  }
+
+  std::error_code error;
+  std::filesystem::create_directories(outputStem.parent_path(), error);
+  for (const auto operation : chain.operations) {
+    const auto path = outputPath(outputStem, operation);
+    switch (operation) {
+      case Operation::Normals:
+        result.message = writeNormals(handle.get(), path);
+        break;
+      case Operation::Curvature:
+        result.message = writeCurvature(handle.get(), chain.curvatureRadius, path);
+        break;
+      case Operation::Distance:
+        result.message = writeDistance(*mesh, chain, path);
+        break;
+      case Operation::Sample:
+        result.message = writeSamples(handle.get(), chain, path);
+        break;
+    }
+    if (!result.message.empty()) {
+      return result;
+    }
+  }
+
+  result.ok = true;
+  return result;
+}
+}  // namespace GeoSharPlusCPP::Cli
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace GeoSharPlusCPP::Cli {
+// Steps of the per-file chain; each writes `<stem>.<name>.csv`
+enum class Operation {
+  Normals,    // Per-vertex normals: nx, ny, nz
+  Curvature,  // Per-vertex k1, k2, gaussian and the principal directions
+  Distance,   // Per-vertex signed distance to the reference, its closest face and point
+  Sample,     // Points sampled on the surface and the faces they lie on
+};
+
+[[nodiscard]] const char* operationName(Operation operation) noexcept;
+[[nodiscard]] bool parseOperation(const std::string& text, Operation& operation) noexcept;
+
+struct ChainOptions {
+  std::vector<Operation> operations;
+  uint64_t reference = 0;  // Distance index of the reference mesh, see loadReference
+  int signedType = 4;      // As IGM_signed_distance (4 = fast winding number)
+  uint32_t curvatureRadius = 5;
+  int sampleCount = 1000;
+  bool blueNoise = false;  // Blue noise instead of uniform random sampling
+};
+
+struct FileResult {
+  bool ok = false;
+  std::size_t vertices = 0;
+  std::size_t faces = 0;
+  std::string message;  // What failed, empty on success
+};
+
+// Build the distance index of the reference mesh once; it is shared by every file
+[[nodiscard]] bool loadReference(const std::filesystem::path& path,
+                                 int signedType,
+                                 uint64_t& handle,
+                                 std::string& message);
+
+// Read `input`, run the chain on it and write the outputs next to `outputStem`. Safe to call
+// from several threads at once.
+[[nodiscard]] FileResult processFile(const std::filesystem::path& input,
+                                     const std::filesystem::path& outputStem,
+                                     const ChainOptions& chain);
+}  // namespace GeoSharPlusCPP::Cli
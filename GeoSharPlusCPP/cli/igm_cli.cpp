@@ -0,0 +1,392 @@
+// igm-cli: run a chain of mesh operations over many files through the GeoSharPlusCPP C API.
+//
+//   igm-cli --out=DIR [options] INPUT...
+//
+// INPUT is a mesh file or a directory of them (.obj .off .ply .stl .mesh .wrl). For each file the
+// chain writes one CSV per operation to DIR, keeping the layout below an input directory, and a
+// line to DIR/summary.csv. Files are processed in parallel; --memory-limit bounds how much input
+// is in flight at once.
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GeoSharPlusCPP/API/BridgeAPI.h"
+#include "Operations.h"
+
+namespace fs = std::filesystem;
+using namespace GeoSharPlusCPP::Cli;
+
+namespace {
+const char* kUsage =
+    "usage: igm-cli --out=DIR [options] INPUT...\n"
+    "\n"
+    "  --ops=LIST             comma-separated chain: normals, curvature, distance, samples\n"
+    "                         (default normals,curvature,samples)\n"
+    "  --reference=FILE       reference mesh for the distance operation\n"
+    "  --signed-type=T        signed distance type as IGM_signed_distance (default 4)\n"
+    "  --curvature-radius=R   principal curvature ring radius (default 5)\n"
+    "  --samples=N            points sampled per mesh (default 1000)\n"
+    "  --sampling=KIND        random or blue (default random)\n"
+    "  --jobs=N               files processed at once (default: hardware threads)\n"
+    "  --threads=N            native threads per call, 0 = all (default 1 when --jobs > 1)\n"
+    "  --memory-limit=SIZE    bound on in-flight work, e.g. 512M or 4G (default: none)\n"
+    "  --recursive            descend into subdirectories of input directories\n";
+
+// Rough working set of a file relative to its size on disk: the parsed mesh, the handle's
+// derived data and the operation outputs. Only used to admit files under --memory-limit.
+constexpr uint64_t kWorkingSetPerFileByte = 8;
+
+struct Options {
+  fs::path out;
+  fs::path reference;
+  ChainOptions chain;
+  int jobs = 0;
+  int threads = -1;
+  uint64_t memoryLimit = 0;
+  bool recursive = false;
+  std::vector<fs::path> inputs;
+};
+
+struct InputFile {
+  fs::path path;
+  fs::path outputStem;
+  uint64_t size = 0;
+};
+
+// Admits files while their estimated working sets fit the limit. A file larger than the limit
+// still runs, alone.
+class MemoryGate {
+public:
+  explicit MemoryGate(uint64_t limit) : limit_(limit) {}
+
+  uint64_t acquire(uint64_t bytes) {
+    if (limit_ == 0) {
+      return 0;
+    }
+    bytes = std::min(bytes, limit_);
+    std::unique_lock lock(mutex_);
+    released_.wait(lock, [&] { return used_ == 0 || used_ + bytes <= limit_; });
+    used_ += bytes;
+    return bytes;
+  }
+
+  void release(uint64_t bytes) {
+    if (bytes == 0) {
+      return;
+    }
+    {
+      std::lock_guard lock(mutex_);
+      used_ -= bytes;
+    }
+    released_.notify_all();
+  }
+
+private:
+  const uint64_t limit_;
+  uint64_t used_ = 0;
+  std::mutex mutex_;
+  std::condition_variable released_;
+};
+
+bool startsWith(const std::string& text, const char* prefix, std::string& value) {
+  const std::string p(prefix);
+  if (text.compare(0, p.size(), p) != 0) {
+    return false;
+  }
+  value = text.substr(p.size());
+  return true;
+}
+
+bool parseInt(const std::string& text, int minimum, int& value) {
+  char* end = nullptr;
+  const long parsed = std::strtol(text.c_str(), &end, 10);
+  if (text.empty() || *end != '\0' || parsed < minimum || parsed > INT32_MAX) {
+    return false;
+  }
+  value = static_cast<int>(parsed);
+  return true;
+}
+
+// "1048576", "512K", "512M", "4G", optionally followed by "B"
+bool parseBytes(const std::string& text, uint64_t& value) {
+  char* end = nullptr;
+  const double parsed = std::strtod(text.c_str(), &end);
+  if (end == text.c_str() || parsed < 0) {
+    return false;
+  }
+  std::string suffix(end);
+  std::transform(suffix.begin(), suffix.end(), suffix.begin(), [](unsigned char c) {
+    return static_cast<char>(std::toupper(c));
+  });
+  if (suffix.size() == 2 && suffix[1] == 'B') {
+    suffix.pop_back();
+  }
+  double scale = 1;
+  if (suffix == "K") {
+    scale = 1024.0;
+  } else if (suffix == "M") {
+    scale = 1024.0 * 1024.0;
+  } else if (suffix == "G") {
+    scale = 1024.0 * 1024.0 * 1024.0;
+  } else if (!suffix.empty() && suffix != "B") {
+    return false;
+  }
+  value = static_cast<uint64_t>(parsed * scale);
+  return true;
+}
+
+bool parseOperations(const std::string& text, std::vector<Operation>& operations) {
+  operations.clear();
+  std::size_t begin = 0;
+  while (begin <= text.size()) {
+    const auto end = std::min(text.find(',', begin), text.size());
+    Operation operation;
+    if (!parseOperation(text.substr(begin, end - begin), operation)) {
+      return false;
+    }
+    operations.push_back(operation);
+    begin = end + 1;
+  }
+  return !operations.empty();
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+  options.chain.operations = {Operation::Normals, Operation::Curvature, Operation::Sample};
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    std::string value;
+    bool ok = true;
+    if (startsWith(arg, "--out=", value)) {
+      options.out = value;
+    } else if (startsWith(arg, "--ops=", value)) {
+      ok = parseOperations(value, options.chain.operations);
+    } else if (startsWith(arg, "--reference=", value)) {
+      options.reference = value;
+    } else if (startsWith(arg, "--signed-type=", value)) {
+      ok = parseInt(value, 1, options.chain.signedType) && options.chain.signedType <= 4;
+    } else if (startsWith(arg, "--curvature-radius=", value)) {
+      int radius = 0;
+      ok = parseInt(value, 1, radius);
+      options.chain.curvatureRadius = static_cast<uint32_t>(radius);
+    } else if (startsWith(arg, "--samples=", value)) {
+      ok = parseInt(value, 1, options.chain.sampleCount);
+    } else if (startsWith(arg, "--sampling=", value)) {
+      ok = value == "random" || value == "blue";
+      options.chain.blueNoise = value == "blue";
+    } else if (startsWith(arg, "--jobs=", value)) {
+      ok = parseInt(value, 1, options.jobs);
+    } else if (startsWith(arg, "--threads=", value)) {
+      ok = parseInt(value, 0, options.threads);
+    } else if (startsWith(arg, "--memory-limit=", value)) {
+      ok = parseBytes(value, options.memoryLimit);
+    } else if (arg == "--recursive") {
+      options.recursive = true;
+    } else if (arg == "--help" || arg == "-h") {
+      return false;
+    } else if (arg.size() > 1 && arg[0] == '-') {
+      ok = false;
+    } else {
+      options.inputs.emplace_back(arg);
+    }
+    if (!ok) {
+      std::fprintf(stderr, "igm-cli: invalid argument %s\n", arg.c_str());
+      return false;
+    }
+  }
+
+  if (options.out.empty() || options.inputs.empty()) {
+    return false;
+  }
+  const auto& operations = options.chain.operations;
+  const bool needsReference =
+      std::find(operations.begin(), operations.end(), Operation::Distance) != operations.end();
+  if (needsReference && options.reference.empty()) {
+    std::fprintf(stderr, "igm-cli: the distance operation needs --reference\n");
+    return false;
+  }
+  if (options.jobs == 0) {
+    options.jobs = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  }
+  if (options.threads < 0) {
+    // Files already fill the cores; nested parallel kernels would only oversubscribe them
+    options.threads = options.jobs > 1 ? 1 : 0;
+  }
+  return true;
+}
+
+bool isMeshFile(const fs::path& path) {
+  auto extension = path.extension().string();
+  std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+    return static_cast<char>(std::tolower(c));
+  });
+  for (const char* supported : {".obj", ".off", ".ply", ".stl", ".mesh", ".wrl"}) {
+    if (extension == supported) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void addFile(const fs::path& path,
+             const fs::path& relative,
+             const fs::path& out,
+             std::vector<InputFile>& files) {
+  std::error_code error;
+  const auto size = fs::file_size(path, error);
+  auto stem = out / relative;
+  stem.replace_extension();
+  files.push_back({path, stem, error ? 0 : static_cast<uint64_t>(size)});
+}
+
+// Files under an input directory keep their relative path below DIR, others land at its top
+bool collectInputs(const Options& options, std::vector<InputFile>& files) {
+  for (const auto& input : options.inputs) {
+    std::error_code error;
+    if (fs::is_directory(input, error)) {
+      const auto add = [&](const fs::directory_entry& entry) {
+        if (entry.is_regular_file(error) && isMeshFile(entry.path())) {
+          addFile(entry.path(), fs::relative(entry.path(), input, error), options.out, files);
+        }
+      };
+      if (options.recursive) {
+        for (const auto& entry : fs::recursive_directory_iterator(input, error)) {
+          add(entry);
+        }
+      } else {
+        for (const auto& entry : fs::directory_iterator(input, error)) {
+          add(entry);
+        }
+      }
+    } else if (fs::is_regular_file(input, error)) {
+      addFile(input, input.filename(), options.out, files);
+    } else {
+      std::fprintf(stderr, "igm-cli: no such file or directory %s\n", input.string().c_str());
+      return false;
+    }
+  }
+  // Largest first, so a big file does not start last and leave the other workers idle
+  std::stable_sort(files.begin(), files.end(), [](const InputFile& a, const InputFile& b) {
+    return a.size > b.size;
+  });
+  return true;
+}
+
+std::string csvField(std::string text) {
+  if (text.find_first_of(",\"\n") == std::string::npos) {
+    return text;
+  }
+  std::string quoted = "\"";
+  for (const char c : text) {
+    quoted += c;
+    if (c == '"') {
+      quoted += '"';
+    }
+  }
+  return quoted + "\"";
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    std::fputs(kUsage, stderr);
+    return 2;
+  }
+
+  std::vector<InputFile> files;
+  if (!collectInputs(options, files)) {
+    return 2;
+  }
+  std::error_code error;
+  fs::create_directories(options.out, error);
+  std::ofstream summary(options.out / "summary.csv", std::ios::binary | std::ios::trunc);
+  if (!summary) {
+    std::fprintf(stderr, "igm-cli: could not write to %s\n", options.out.string().c_str());
+    return 2;
+  }
+  summary << "file,status,vertices,faces,seconds,message\n";
+
+  IGM_set_num_threads(options.threads);
+  // Every file is seen once: retaining meshes for deduplication would only hold memory
+  IGM_mesh_dedup_set_limit(0);
+  // Past the limit the native caches shed data, and calls that still do not fit fail that file
+  // rather than the whole run
+  IGM_memory_set_budget(options.memoryLimit);
+
+  if (!options.reference.empty()) {
+    std::string message;
+    if (!loadReference(options.reference,
+                       options.chain.signedType,
+                       options.chain.reference,
+                       message)) {
+      std::fprintf(stderr, "igm-cli: %s\n", message.c_str());
+      return 2;
+    }
+  }
+
+  MemoryGate gate(options.memoryLimit);
+  std::mutex reportMutex;
+  std::atomic<std::size_t> next{0};
+  std::size_t done = 0;
+  std::size_t failed = 0;
+
+  const auto worker = [&] {
+    for (auto index = next++; index < files.size(); index = next++) {
+      const auto& file = files[index];
+      const auto admitted = gate.acquire(file.size * kWorkingSetPerFileByte);
+      const auto start = std::chrono::steady_clock::now();
+      const auto result = processFile(file.path, file.outputStem, options.chain);
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      gate.release(admitted);
+
+      std::lock_guard lock(reportMutex);
+      ++done;
+      failed += result.ok ? 0 : 1;
+      summary << csvField(file.path.string()) << ',' << (result.ok ? "ok" : "failed") << ','
+              << result.vertices << ',' << result.faces << ',' << elapsed.count() << ','
+              << csvField(result.message) << '\n';
+      std::fprintf(stderr,
+                   "[%zu/%zu] %s %s %.3fs%s%s\n",
+                   done,
+                   files.size(),
+                   file.path.string().c_str(),
+                   result.ok ? "ok" : "failed",
+                   elapsed.count(),
+                   result.ok ? "" : ": ",
+                   result.message.c_str());
+    }
+  };
+
+  const auto workerCount = std::min<std::size_t>(static_cast<std::size_t>(options.jobs),
+                                                 std::max<std::size_t>(files.size(), 1));
+  std::vector<std::thread> workers;
+  workers.reserve(workerCount);
+  for (std::size_t i = 0; i < workerCount; ++i) {
+    workers.emplace_back(worker);
+  }
+  for (auto& thread : workers) {
+    thread.join();
+  }
+
+  if (options.chain.reference != 0) {
+    IGM_mesh_release(options.chain.reference);
+  }
+  summary.close();
+  std::fprintf(stderr,
+               "igm-cli: %zu of %zu files processed, %zu failed\n",
+               done - failed,
+               files.size(),
+               failed);
+  return failed == 0 && summary ? 0 : 1;
+}
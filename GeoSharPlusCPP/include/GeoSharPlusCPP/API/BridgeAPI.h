@@ -24,6 +24,152 @@ GSP_API bool GSP_CALL mesh_roundtrip(const uint8_t* inBuffer,
                                      uint8_t** outBuffer,
                                      int* outSize);
 
+// ! --------------------------------
+// ! 00:: mesh handles
+// ! --------------------------------
+// Upload a mesh once and get a handle to it. Every export with an `_h` suffix takes this handle
+// in place of the mesh buffer, so repeated calls on the same mesh skip (de)serialization.
+// Derived data (normals, areas, adjacency, boundary loops, ...) is computed on the first call
+// that needs it and reused by later calls on the same handle.
+// The mesh stays alive until IGM_mesh_release; handles are never reused.
+GSP_API bool GSP_CALL IGM_mesh_create(const uint8_t* inBuffer, int inSize, uint64_t* outHandle);
+
+// Release a mesh handle. Calls already running on the mesh finish safely.
+GSP_API bool GSP_CALL IGM_mesh_release(uint64_t meshHandle);
+
+// Move the vertices of a mesh handle, keeping its faces. Topology-dependent data (adjacency,
+// boundary loops, the Laplacian pattern and solver orderings) carries over, so later solves on
+// the handle only redo the numeric work. The point count must match the mesh's vertex count.
+// Calls already running on the old positions finish on them.
+GSP_API bool GSP_CALL IGM_mesh_update_vertices(uint64_t meshHandle,
+                                               const uint8_t* inBufferPoints,
+                                               int inSizePoints);
+
+// Mesh buffers passed to IGM_mesh_create and to the buffer exports that build reusable data
+// (winding number and distance indices, Laplacian factorizations, heat geodesics) are
+// deduplicated by content hash: a buffer identical to a recently seen one reuses its mesh and
+// derived data. The other buffer exports read their mesh in place and keep nothing.
+// Counters cover every lookup since the last reset. The retained meshes are bounded by
+// IGM_mesh_dedup_set_limit (bytes of vertex and face data, default 256 MiB, 0 = keep none).
+GSP_API void GSP_CALL IGM_mesh_dedup_stats(uint64_t* hits, uint64_t* misses, int* entryCount);
+GSP_API void GSP_CALL IGM_mesh_dedup_reset_stats();
+GSP_API void GSP_CALL IGM_mesh_dedup_set_limit(uint64_t maxBytes);
+
+// ! --------------------------------
+// ! 00:: threading
+// ! --------------------------------
+// Number of threads the parallel kernels use, the calling thread included (1 = run serially,
+// 0 = one per hardware thread, the default). The pool is shared by all calls in the process;
+// changing it waits for the tasks already queued. Libigl's own internal loops keep their
+// thread count.
+GSP_API bool GSP_CALL IGM_set_num_threads(int threadCount);
+GSP_API int GSP_CALL IGM_get_num_threads();
+
+// Stop the job and pool threads once their queued work has run; cancel running jobs first to
+// return sooner. Call on process exit, before the library is unloaded: threads left running then
+// are not joined, since joining them during unload can deadlock. Later calls run serially until
+// IGM_set_num_threads starts pool workers again; a later job submission restarts the job threads.
+GSP_API void GSP_CALL IGM_shutdown();
+
+// ! --------------------------------
+// ! 00:: profiling
+// ! --------------------------------
+// Per-export counters since the last reset, as a ProfileSnapshotData buffer: calls, total and
+// slowest time, time split into deserialize / compute / serialize, and bytes in and out. Jobs
+// are recorded under "job:<operation>" for the time they run in the background.
+GSP_API bool GSP_CALL IGM_profile_snapshot(uint8_t** outBuffer, int* outSize);
+GSP_API void GSP_CALL IGM_profile_reset();
+
+// ! --------------------------------
+// ! 00:: tracing
+// ! --------------------------------
+// Opt-in event trace of bridge calls, (de)serialization phases, pool tasks and jobs, per thread.
+// Start clears the previous recording; the ring buffer keeps the last `capacity` events
+// (0 = 65536). Dump writes Chrome trace JSON, viewable in chrome://tracing or ui.perfetto.dev.
+GSP_API bool GSP_CALL IGM_trace_start(int capacity);
+GSP_API void GSP_CALL IGM_trace_stop();
+GSP_API bool GSP_CALL IGM_trace_dump(const char* path);
+
+// ! --------------------------------
+// ! 00:: memory accounting
+// ! --------------------------------
+// Current and peak bytes of the tracked native memory, in total (subsystem -1) or per subsystem:
+// 0 output buffers being built, 1 meshes, 2 cached per-mesh data, 3 spatial indices and
+// factorizations. Buffers already handed to C# are not counted.
+GSP_API bool GSP_CALL IGM_memory_usage(int subsystem, uint64_t* currentBytes, uint64_t* peakBytes);
+GSP_API void GSP_CALL IGM_memory_reset_peaks();
+// Process-wide budget in bytes (0 = no limit, the default). Past it, the mesh and precompute
+// caches drop least recently used data, and calls that still do not fit fail instead of
+// allocating.
+GSP_API void GSP_CALL IGM_memory_set_budget(uint64_t maxBytes);
+GSP_API uint64_t GSP_CALL IGM_memory_get_budget();
+
+// ! --------------------------------
+// ! 00:: progress and cancellation
+// ! --------------------------------
+// Long-running operations (signed_distance, planarize_quad_mesh, blue_noise_sampling_on_mesh)
+// take a callback and an opaque context pointer passed back to it in IGM_CallOptions of their
+// `_ex` entry point. The callback receives the fraction done in [0, 1], in steps of at least 1%,
+// and returns false to cancel: the call then stops at its next check and returns false with no
+// outputs. The callback may be called from worker threads, but never from two threads at once; a
+// null callback disables reporting.
+typedef bool(GSP_CALL* IGM_ProgressCallback)(void* context, double fraction);
+
+// ! --------------------------------
+// ! 00:: `_ex` entry points
+// ! --------------------------------
+// Operations with several outputs or calling conventions have one `_ex` entry point taking the
+// mesh and the output options as structs. The export without the suffix and its `_h` variant are
+// thin wrappers over it that return every output in a buffer of its own.
+//
+// The mesh is the handle `handle` from IGM_mesh_create if nonzero, else the MeshData in `buffer`.
+// With `batch` set, `buffer` is a MeshArrayData read as by the batch exports (11::), and a last
+// output N holds how many entries each mesh contributed; barycenter, vert_normals, face_normals,
+// gaussian_curvature and principal_curvature take batches.
+typedef struct IGM_MeshInput {
+  const uint8_t* buffer;
+  int size;
+  uint64_t handle;
+  int batch;
+} IGM_MeshInput;
+
+// Output modes of IGM_CallOptions
+enum {
+  IGM_OUTPUT_SEPARATE = 0,  // A new buffer per output: outBuffers[i], outSizes[i] for output i
+  IGM_OUTPUT_BUNDLE = 1,    // One ResultBundleData: outBuffers[0], outSizes[0]
+  IGM_OUTPUT_INTO = 2,      // The one selected output in callerBuffer, its size in outSizes[0]
+};
+#define IGM_ALL_OUTPUTS 0xFFFFFFFFu  // outputMask selecting every output
+
+// Outputs are numbered in the order listed at each `_ex` export, which is the order of the
+// wrapper's out parameters. Bit i of outputMask selects output i, e.g. 0x1 for the signed
+// distances S alone. Unselected outputs are left null or absent, and work needed only for them
+// is skipped where the kernel allows it (signed_distance without S skips the sign computation).
+// A mask selecting none of the outputs fails.
+//
+// The bundle mode returns the selected outputs as the columns of one ResultBundleData, named as
+// listed at each `_ex` export, so the caller frees a single allocation.
+//
+// The into mode builds the one selected output directly in `callerBuffer`, a caller owned (e.g.
+// pinned managed) buffer of `callerCapacity` bytes, instead of a new allocation the caller has to
+// copy and free. On success outSizes[0] is the size of the output at the start of callerBuffer.
+// If the output does not fit, or callerBuffer is null to query the size, the call fails with
+// outSizes[0] set to the capacity needed; it is 0 when the computation itself failed. A retry
+// computes the output again, so callers should pass a generous first estimate.
+//
+// Operations that report progress use the callback as described in 00:: progress; the others
+// ignore it.
+typedef struct IGM_CallOptions {
+  int outputMode;
+  uint32_t outputMask;
+  uint8_t** outBuffers;
+  int* outSizes;
+  uint8_t* callerBuffer;
+  int callerCapacity;
+  IGM_ProgressCallback progress;
+  void* progressContext;
+} IGM_CallOptions;
+
 // ! --------------------------------
 // ! 01:: IO, property funcs
 // ! --------------------------------
@@ -35,12 +181,14 @@ GSP_API bool GSP_CALL IGM_read_triangle_mesh(const char* filename,
 GSP_API bool GSP_CALL IGM_write_triangle_mesh(const uint8_t* inBuffer,
                                               const int inSize,
                                               const char* filename);
+GSP_API bool GSP_CALL IGM_write_triangle_mesh_h(uint64_t meshHandle, const char* filename);
 
 // lculate the centroid of a mesh (igl function)
 GSP_API bool GSP_CALL IGM_centroid(const uint8_t* inBuffer,
                                    int inSize,
                                    uint8_t** outBuffer,
                                    int* outSize);
+GSP_API bool GSP_CALL IGM_centroid_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize);
 // ! --------------------------------
 // ! 02:: centre, normal funcs
 // ! --------------------------------
@@ -49,19 +197,34 @@ GSP_API bool GSP_CALL IGM_barycenter(const uint8_t* inBuffer,
                                      int inSize,
                                      uint8_t** outBuffer,
                                      int* outSize);
+GSP_API bool GSP_CALL IGM_barycenter_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize);
+// Output: BC, one point per face
+GSP_API bool GSP_CALL IGM_barycenter_ex(const IGM_MeshInput* mesh, const IGM_CallOptions* options);
 
 GSP_API bool GSP_CALL IGM_vert_normals(const uint8_t* inBuffer,
                                        int inSize,
                                        uint8_t** outBuffer,
                                        int* outSize);
+GSP_API bool GSP_CALL IGM_vert_normals_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize);
+// Output: VN, one normal per vertex
+GSP_API bool GSP_CALL IGM_vert_normals_ex(const IGM_MeshInput* mesh,
+                                          const IGM_CallOptions* options);
 
 GSP_API bool GSP_CALL IGM_face_normals(const uint8_t* inBuffer,
                                        int inSize,
                                        uint8_t** outBuffer,
                                        int* outSize);
+GSP_API bool GSP_CALL IGM_face_normals_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize);
+// Output: FN, one normal per face
+GSP_API bool GSP_CALL IGM_face_normals_ex(const IGM_MeshInput* mesh,
+                                          const IGM_CallOptions* options);
 
 GSP_API bool GSP_CALL IGM_corner_normals(
     const uint8_t* inBuffer, int inSize, double threshold_deg, uint8_t** outBuffer, int* outSize);
+GSP_API bool GSP_CALL IGM_corner_normals_h(uint64_t meshHandle,
+                                           double threshold_deg,
+                                           uint8_t** outBuffer,
+                                           int* outSize);
 
 GSP_API bool GSP_CALL IGM_edge_normals(const uint8_t* inBuffer,
                                        int inSize,
@@ -72,6 +235,18 @@ GSP_API bool GSP_CALL IGM_edge_normals(const uint8_t* inBuffer,
                                        int* obsEI,
                                        uint8_t** obEMAP,
                                        int* obsEMAP);
+GSP_API bool GSP_CALL IGM_edge_normals_h(uint64_t meshHandle,
+                                         int weightingType,
+                                         uint8_t** outBufferA,
+                                         int* outSizeA,
+                                         uint8_t** outBufferB,
+                                         int* outSizeB,
+                                         uint8_t** outBufferC,
+                                         int* outSizeC);
+// Outputs: EN, EI, EMAP
+GSP_API bool GSP_CALL IGM_edge_normals_ex(const IGM_MeshInput* mesh,
+                                          int weightingType,
+                                          const IGM_CallOptions* options);
 
 // ! --------------------------------
 // ! 03:: adjacency funcs
@@ -80,6 +255,9 @@ GSP_API bool GSP_CALL IGM_vert_vert_adjacency(const uint8_t* inBuffer,
                                               int inSize,
                                               uint8_t** outBuffer,
                                               int* outSize);
+GSP_API bool GSP_CALL IGM_vert_vert_adjacency_h(uint64_t meshHandle,
+                                                uint8_t** outBuffer,
+                                                int* outSize);
 
 GSP_API bool GSP_CALL IGM_vert_tri_adjacency(const uint8_t* inBuffer,
                                              int inSize,
@@ -87,6 +265,14 @@ GSP_API bool GSP_CALL IGM_vert_tri_adjacency(const uint8_t* inBuffer,
                                              int* outSizeVT,
                                              uint8_t** outBufferVTI,
                                              int* outSizeVTI);
+GSP_API bool GSP_CALL IGM_vert_tri_adjacency_h(uint64_t meshHandle,
+                                               uint8_t** outBufferVT,
+                                               int* outSizeVT,
+                                               uint8_t** outBufferVTI,
+                                               int* outSizeVTI);
+// Outputs: VT, VTI
+GSP_API bool GSP_CALL IGM_vert_tri_adjacency_ex(const IGM_MeshInput* mesh,
+                                                const IGM_CallOptions* options);
 
 GSP_API bool GSP_CALL IGM_tri_tri_adjacency(const uint8_t* inBuffer,
                                             int inSize,
@@ -94,6 +280,14 @@ GSP_API bool GSP_CALL IGM_tri_tri_adjacency(const uint8_t* inBuffer,
                                             int* outSizeTT,
                                             uint8_t** outBufferTTI,
                                             int* outSizeTTI);
+GSP_API bool GSP_CALL IGM_tri_tri_adjacency_h(uint64_t meshHandle,
+                                              uint8_t** outBufferTT,
+                                              int* outSizeTT,
+                                              uint8_t** outBufferTTI,
+                                              int* outSizeTTI);
+// Outputs: TT, TTI
+GSP_API bool GSP_CALL IGM_tri_tri_adjacency_ex(const IGM_MeshInput* mesh,
+                                               const IGM_CallOptions* options);
 
 // ! --------------------------------
 // ! 03:: boundary funcs
@@ -102,6 +296,7 @@ GSP_API bool GSP_CALL IGM_boundary_loop(const uint8_t* inBuffer,
                                         int inSize,
                                         uint8_t** outBuffer,
                                         int* outSize);
+GSP_API bool GSP_CALL IGM_boundary_loop_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize);
 
 GSP_API bool GSP_CALL IGM_boundary_facet(const uint8_t* inBuffer,
                                          int inSize,
@@ -109,6 +304,14 @@ GSP_API bool GSP_CALL IGM_boundary_facet(const uint8_t* inBuffer,
                                          int* outSizeEL,
                                          uint8_t** outBufferTL,
                                          int* outSizeTL);
+GSP_API bool GSP_CALL IGM_boundary_facet_h(uint64_t meshHandle,
+                                           uint8_t** outBufferEL,
+                                           int* outSizeEL,
+                                           uint8_t** outBufferTL,
+                                           int* outSizeTL);
+// Outputs: EL, TL
+GSP_API bool GSP_CALL IGM_boundary_facet_ex(const IGM_MeshInput* mesh,
+                                            const IGM_CallOptions* options);
 // ! --------------------------------
 // ! 04:: scalar remap funcs
 // ! --------------------------------
@@ -118,6 +321,11 @@ GSP_API bool GSP_CALL IGM_remap_VtoF(const uint8_t* inBufferMesh,
                                      int inSizeScalar,
                                      uint8_t** outBuffer,
                                      int* outSize);
+GSP_API bool GSP_CALL IGM_remap_VtoF_h(uint64_t meshHandle,
+                                       const uint8_t* inBufferScalar,
+                                       int inSizeScalar,
+                                       uint8_t** outBuffer,
+                                       int* outSize);
 
 GSP_API bool GSP_CALL IGM_remap_FtoV(const uint8_t* inBufferMesh,
                                      int inSizeMesh,
@@ -125,6 +333,11 @@ GSP_API bool GSP_CALL IGM_remap_FtoV(const uint8_t* inBufferMesh,
                                      int inSizeScalar,
                                      uint8_t** outBuffer,
                                      int* outSize);
+GSP_API bool GSP_CALL IGM_remap_FtoV_h(uint64_t meshHandle,
+                                       const uint8_t* inBufferScalar,
+                                       int inSizeScalar,
+                                       uint8_t** outBuffer,
+                                       int* outSize);
 
 // ! --------------------------------
 // ! 05:: curvature funcs
@@ -140,11 +353,31 @@ GSP_API bool GSP_CALL IGM_principal_curvature(const uint8_t* inBuffer,
                                               int* outSizePV1,
                                               uint8_t** outBufferPV2,
                                               int* outSizePV2);
+GSP_API bool GSP_CALL IGM_principal_curvature_h(uint64_t meshHandle,
+                                                uint32_t radius,
+                                                uint8_t** outBufferPD1,
+                                                int* outSizePD1,
+                                                uint8_t** outBufferPD2,
+                                                int* outSizePD2,
+                                                uint8_t** outBufferPV1,
+                                                int* outSizePV1,
+                                                uint8_t** outBufferPV2,
+                                                int* outSizePV2);
+// Outputs: PD1, PD2, PV1, PV2
+GSP_API bool GSP_CALL IGM_principal_curvature_ex(const IGM_MeshInput* mesh,
+                                                 uint32_t radius,
+                                                 const IGM_CallOptions* options);
 
 GSP_API bool GSP_CALL IGM_gaussian_curvature(const uint8_t* inBuffer,
                                              int inSize,
                                              uint8_t** outBuffer,
                                              int* outSize);
+GSP_API bool GSP_CALL IGM_gaussian_curvature_h(uint64_t meshHandle,
+                                               uint8_t** outBuffer,
+                                               int* outSize);
+// Output: K, one value per vertex
+GSP_API bool GSP_CALL IGM_gaussian_curvature_ex(const IGM_MeshInput* mesh,
+                                                const IGM_CallOptions* options);
 
 // ! --------------------------------
 // ! 06:: measure funcs
@@ -155,6 +388,32 @@ GSP_API bool GSP_CALL IGM_fast_winding_number(const uint8_t* inBufferMesh,
                                               int inSizePoints,
                                               uint8_t** outBuffer,
                                               int* outSize);
+GSP_API bool GSP_CALL IGM_fast_winding_number_h(uint64_t meshHandle,
+                                                const uint8_t* inBufferPoints,
+                                                int inSizePoints,
+                                                uint8_t** outBuffer,
+                                                int* outSize);
+
+// Fast winding number precompute (BVH plus expansion coefficients of order 0, 1 or 2) kept
+// behind a handle, so repeated queries against the same mesh skip the precomputation. The
+// plain functions above use order 2 and accuracy 2 and share the mesh's order 2 precompute.
+// Precomputes live in a memory-bounded LRU cache (512 MiB): an evicted handle fails like a
+// released one, so callers should recreate it on failure.
+GSP_API bool GSP_CALL IGM_fast_winding_number_create(const uint8_t* inBufferMesh,
+                                                     int inSizeMesh,
+                                                     int order,
+                                                     uint64_t* outHandle);
+GSP_API bool GSP_CALL IGM_fast_winding_number_create_h(uint64_t meshHandle,
+                                                       int order,
+                                                       uint64_t* outHandle);
+// `accuracy` is libigl's beta: larger is more accurate and slower (2 is the usual choice)
+GSP_API bool GSP_CALL IGM_fast_winding_number_query(uint64_t windingNumberHandle,
+                                                    double accuracy,
+                                                    const uint8_t* inBufferPoints,
+                                                    int inSizePoints,
+                                                    uint8_t** outBuffer,
+                                                    int* outSize);
+GSP_API bool GSP_CALL IGM_fast_winding_number_release(uint64_t windingNumberHandle);
 
 GSP_API bool GSP_CALL IGM_signed_distance(const uint8_t* inBufferMesh,
                                           int inSizeMesh,
@@ -167,12 +426,84 @@ GSP_API bool GSP_CALL IGM_signed_distance(const uint8_t* inBufferMesh,
                                           int* outSizeFI,
                                           uint8_t** outBufferCP,
                                           int* outSizeCP);
+GSP_API bool GSP_CALL IGM_signed_distance_h(uint64_t meshHandle,
+                                            const uint8_t* inBufferPoints,
+                                            int inSizePoints,
+                                            int signedType,
+                                            uint8_t** outBufferSD,
+                                            int* outSizeSD,
+                                            uint8_t** outBufferFI,
+                                            int* outSizeFI,
+                                            uint8_t** outBufferCP,
+                                            int* outSizeCP);
+// Outputs: S, I, C
+GSP_API bool GSP_CALL IGM_signed_distance_ex(const IGM_MeshInput* mesh,
+                                             const uint8_t* inBufferPoints,
+                                             int inSizePoints,
+                                             int signedType,
+                                             const IGM_CallOptions* options);
+
+// Closest point on the mesh for a batch of query points: closest points, face indices,
+// barycentric coordinates (as points) in the closest triangle, quads being split into (a, b, c)
+// and (a, c, d), and the unit vertex normal interpolated there. Uses the mesh's cached AABB tree.
+GSP_API bool GSP_CALL IGM_closest_point_normal(const uint8_t* inBufferMesh,
+                                               int inSizeMesh,
+                                               const uint8_t* inBufferPoints,
+                                               int inSizePoints,
+                                               uint8_t** outBufferCP,
+                                               int* outSizeCP,
+                                               uint8_t** outBufferFI,
+                                               int* outSizeFI,
+                                               uint8_t** outBufferBC,
+                                               int* outSizeBC,
+                                               uint8_t** outBufferN,
+                                               int* outSizeN);
+GSP_API bool GSP_CALL IGM_closest_point_normal_h(uint64_t meshHandle,
+                                                 const uint8_t* inBufferPoints,
+                                                 int inSizePoints,
+                                                 uint8_t** outBufferCP,
+                                                 int* outSizeCP,
+                                                 uint8_t** outBufferFI,
+                                                 int* outSizeFI,
+                                                 uint8_t** outBufferBC,
+                                                 int* outSizeBC,
+                                                 uint8_t** outBufferN,
+                                                 int* outSizeN);
+// Outputs: CP, FI, BC, N
+GSP_API bool GSP_CALL IGM_closest_point_normal_ex(const IGM_MeshInput* mesh,
+                                                  const uint8_t* inBufferPoints,
+                                                  int inSizePoints,
+                                                  const IGM_CallOptions* options);
+
+// Upload a mesh for repeated distance queries. Returns a mesh handle whose AABB tree (and, for
+// signedType 4, fast winding number BVH) is built up front; the index is released together with
+// the mesh by IGM_mesh_release. Signed distance calls on the same mesh through any entry point
+// reuse the index instead of rebuilding it per call.
+GSP_API bool GSP_CALL IGM_distance_index_build(const uint8_t* inBufferMesh,
+                                               int inSizeMesh,
+                                               int signedType,
+                                               uint64_t* outHandle);
+// Signed distance against a handle from IGM_distance_index_build; outputs as IGM_signed_distance
+GSP_API bool GSP_CALL IGM_signed_distance_query(uint64_t indexHandle,
+                                                const uint8_t* inBufferPoints,
+                                                int inSizePoints,
+                                                int signedType,
+                                                uint8_t** outBufferSD,
+                                                int* outSizeSD,
+                                                uint8_t** outBufferFI,
+                                                int* outSizeFI,
+                                                uint8_t** outBufferCP,
+                                                int* outSizeCP);
 
 // ! --------------------------------
 // ! 07:: parametrization funcs
 // ! --------------------------------
 GSP_API bool GSP_CALL
 IGM_param_harmonic(const uint8_t* inBuffer, int inSize, int k, uint8_t** outBuffer, int* outSize);
+GSP_API bool GSP_CALL IGM_param_harmonic_h(uint64_t meshHandle,
+                                           int k,
+                                           uint8_t** outBuffer,
+                                           int* outSize);
 
 // ! --------------------------------
 // ! 08:: quad mesh funcs
@@ -181,6 +512,7 @@ GSP_API bool GSP_CALL IGM_quad_planarity(const uint8_t* inBuffer,
                                          int inSize,
                                          uint8_t** outBuffer,
                                          int* outSize);
+GSP_API bool GSP_CALL IGM_quad_planarity_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize);
 
 GSP_API bool GSP_CALL IGM_planarize_quad_mesh(const uint8_t* inBuffer,
                                               int inSize,
@@ -188,6 +520,17 @@ GSP_API bool GSP_CALL IGM_planarize_quad_mesh(const uint8_t* inBuffer,
                                               double threshold,
                                               uint8_t** outBuffer,
                                               int* outSize);
+GSP_API bool GSP_CALL IGM_planarize_quad_mesh_h(uint64_t meshHandle,
+                                                int maxIter,
+                                                double threshold,
+                                                uint8_t** outBuffer,
+                                                int* outSize);
+// Output: the planarized MeshData, which is not a bundle column (separate and into modes only).
+// The planarization itself is a single libigl call: progress is checked before and after it.
+GSP_API bool GSP_CALL IGM_planarize_quad_mesh_ex(const IGM_MeshInput* mesh,
+                                                 int maxIter,
+                                                 double threshold,
+                                                 const IGM_CallOptions* options);
 
 // ! --------------------------------
 // ! 08:: laplacian funcs
@@ -200,12 +543,22 @@ GSP_API bool GSP_CALL IGM_laplacian_scalar(const uint8_t* inBufferMesh,
                                            int inSizeValues,
                                            uint8_t** outBuffer,
                                            int* outSize);
+GSP_API bool GSP_CALL IGM_laplacian_scalar_h(uint64_t meshHandle,
+                                             const uint8_t* inBufferIndices,
+                                             int inSizeIndices,
+                                             const uint8_t* inBufferValues,
+                                             int inSizeValues,
+                                             uint8_t** outBuffer,
+                                             int* outSize);
 
 // Heat geodesics functions
 GSP_API bool GSP_CALL IGM_heat_geodesic_precompute(const uint8_t* inBuffer,
                                                    int inSize,
                                                    uint8_t** outBuffer,
                                                    int* outSize);
+GSP_API bool GSP_CALL IGM_heat_geodesic_precompute_h(uint64_t meshHandle,
+                                                     uint8_t** outBuffer,
+                                                     int* outSize);
 
 GSP_API bool GSP_CALL IGM_heat_geodesic_solve(const uint8_t* inBuffer,
                                               int inSize,
@@ -214,6 +567,27 @@ GSP_API bool GSP_CALL IGM_heat_geodesic_solve(const uint8_t* inBuffer,
                                               uint8_t** outBuffer,
                                               int* outSize);
 
+// Heat geodesics with integer handles. Precomputes live in a memory-bounded LRU cache shared with
+// the legacy functions above: once the cache is over its limit, the least recently used ones are
+// dropped and their handles fail like released ones, so callers should recompute on failure.
+GSP_API bool GSP_CALL IGM_heat_geodesic_create(const uint8_t* inBuffer,
+                                               int inSize,
+                                               uint64_t* outHandle);
+GSP_API bool GSP_CALL IGM_heat_geodesic_create_h(uint64_t meshHandle, uint64_t* outHandle);
+
+GSP_API bool GSP_CALL IGM_heat_geodesic_distance(uint64_t heatHandle,
+                                                 const uint8_t* inBufferSources,
+                                                 int inSizeSources,
+                                                 uint8_t** outBuffer,
+                                                 int* outSize);
+
+// Release a precompute (from either create or the legacy precompute functions)
+GSP_API bool GSP_CALL IGM_heat_geodesic_release(uint64_t heatHandle);
+
+// Memory limit of the precompute cache in bytes (default 1 GiB, 0 = unlimited)
+GSP_API void GSP_CALL IGM_heat_geodesic_set_cache_limit(uint64_t maxBytes);
+GSP_API void GSP_CALL IGM_heat_geodesic_cache_usage(uint64_t* usedBytes, int* entryCount);
+
 // ! --------------------------------
 // ! 09:: utility funcs
 // ! --------------------------------
@@ -226,6 +600,16 @@ GSP_API bool GSP_CALL IGM_random_point_on_mesh(const uint8_t* inBuffer,
                                                int* outSizePoints,
                                                uint8_t** outBufferFI,
                                                int* outSizeFI);
+GSP_API bool GSP_CALL IGM_random_point_on_mesh_h(uint64_t meshHandle,
+                                                 int N,
+                                                 uint8_t** outBufferPoints,
+                                                 int* outSizePoints,
+                                                 uint8_t** outBufferFI,
+                                                 int* outSizeFI);
+// Outputs: P, FI
+GSP_API bool GSP_CALL IGM_random_point_on_mesh_ex(const IGM_MeshInput* mesh,
+                                                  int N,
+                                                  const IGM_CallOptions* options);
 
 // Blue noise (uniform) sampling on mesh
 GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh(const uint8_t* inBuffer,
@@ -235,6 +619,17 @@ GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh(const uint8_t* inBuffer,
                                                       int* outSizePoints,
                                                       uint8_t** outBufferFI,
                                                       int* outSizeFI);
+GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh_h(uint64_t meshHandle,
+                                                        int N,
+                                                        uint8_t** outBufferPoints,
+                                                        int* outSizePoints,
+                                                        uint8_t** outBufferFI,
+                                                        int* outSizeFI);
+// Outputs: P, FI. The sampling itself is a single libigl call: progress is checked before and
+// after it.
+GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh_ex(const IGM_MeshInput* mesh,
+                                                         int N,
+                                                         const IGM_CallOptions* options);
 
 // Constrained scalar field computation (equivalent to laplacian scalar with constraints)
 GSP_API bool GSP_CALL IGM_constrained_scalar(const uint8_t* inBufferMesh,
@@ -245,6 +640,13 @@ GSP_API bool GSP_CALL IGM_constrained_scalar(const uint8_t* inBufferMesh,
                                              int inSizeValues,
                                              uint8_t** outBuffer,
                                              int* outSize);
+GSP_API bool GSP_CALL IGM_constrained_scalar_h(uint64_t meshHandle,
+                                               const uint8_t* inBufferIndices,
+                                               int inSizeIndices,
+                                               const uint8_t* inBufferValues,
+                                               int inSizeValues,
+                                               uint8_t** outBuffer,
+                                               int* outSize);
 
 // Extract isoline points from a scalar field
 GSP_API bool GSP_CALL IGM_extract_isoline_from_scalar(const uint8_t* inBufferMesh,
@@ -255,5 +657,136 @@ GSP_API bool GSP_CALL IGM_extract_isoline_from_scalar(const uint8_t* inBufferMes
                                                       int inSizeIsoValues,
                                                       uint8_t** outBuffer,
                                                       int* outSize);
+GSP_API bool GSP_CALL IGM_extract_isoline_from_scalar_h(uint64_t meshHandle,
+                                                        const uint8_t* inBufferScalar,
+                                                        int inSizeScalar,
+                                                        const uint8_t* inBufferIsoValues,
+                                                        int inSizeIsoValues,
+                                                        uint8_t** outBuffer,
+                                                        int* outSize);
+
+// ! --------------------------------
+// ! 10:: asynchronous jobs
+// ! --------------------------------
+// Long-running operations submitted to native background threads. A submit call copies its
+// inputs, returns a job handle at once and never blocks on the computation; input buffers may be
+// freed right after it returns. Submit fails only on invalid inputs (unreadable mesh, unknown
+// mesh handle, empty point buffer); a failing computation shows up as a failed job.
+//
+// Job status: 0 queued, 1 running, 2 succeeded, 3 failed, 4 cancelled.
+// IGM_job_wait waits up to timeoutMs (< 0 = until the job is done) and reports the status then.
+// IGM_job_result hands over output `outputIndex` of a succeeded job, in the order of the
+// blocking export's out parameters; each output can be taken once and is freed by the caller as
+// usual. Outputs never taken are freed by IGM_job_release, which may be called at any time: a
+// running job finishes in the background and its outputs are discarded.
+
+// Outputs: signed distances, face indices, closest points (as IGM_signed_distance)
+GSP_API bool GSP_CALL IGM_submit_signed_distance(const uint8_t* inBufferMesh,
+                                                 int inSizeMesh,
+                                                 const uint8_t* inBufferPoints,
+                                                 int inSizePoints,
+                                                 int signedType,
+                                                 uint64_t* outJob);
+GSP_API bool GSP_CALL IGM_submit_signed_distance_h(uint64_t meshHandle,
+                                                   const uint8_t* inBufferPoints,
+                                                   int inSizePoints,
+                                                   int signedType,
+                                                   uint64_t* outJob);
+
+// Output: the planarized mesh (as IGM_planarize_quad_mesh)
+GSP_API bool GSP_CALL IGM_submit_planarize_quad_mesh(const uint8_t* inBuffer,
+                                                     int inSize,
+                                                     int maxIter,
+                                                     double threshold,
+                                                     uint64_t* outJob);
+GSP_API bool GSP_CALL IGM_submit_planarize_quad_mesh_h(uint64_t meshHandle,
+                                                       int maxIter,
+                                                       double threshold,
+                                                       uint64_t* outJob);
+
+// Output: the precompute handle buffer (as IGM_heat_geodesic_precompute)
+GSP_API bool GSP_CALL IGM_submit_heat_geodesic_precompute(const uint8_t* inBuffer,
+                                                          int inSize,
+                                                          uint64_t* outJob);
+GSP_API bool GSP_CALL IGM_submit_heat_geodesic_precompute_h(uint64_t meshHandle, uint64_t* outJob);
+
+GSP_API bool GSP_CALL IGM_job_status(uint64_t jobHandle, int* outStatus);
+GSP_API bool GSP_CALL IGM_job_wait(uint64_t jobHandle, int timeoutMs, int* outStatus);
+GSP_API bool GSP_CALL IGM_job_result(uint64_t jobHandle,
+                                     int outputIndex,
+                                     uint8_t** outBuffer,
+                                     int* outSize);
+GSP_API bool GSP_CALL IGM_job_release(uint64_t jobHandle);
+
+// Ask a job to stop: a queued job never starts, a running one stops at its next progress check
+// (signed distance and planarization; the heat precompute runs to its end) and ends cancelled
+// with no outputs. Cancelling a finished job has no effect.
+GSP_API bool GSP_CALL IGM_job_cancel(uint64_t jobHandle);
+// Fraction of the job done so far, in [0, 1]; 0 until it starts reporting
+GSP_API bool GSP_CALL IGM_job_progress(uint64_t jobHandle, double* outFraction);
+
+// ! --------------------------------
+// ! 11:: batch funcs
+// ! --------------------------------
+// One call over many meshes (a MeshArrayData buffer), computed in parallel across meshes. Each
+// mesh is read in place, like the single mesh buffer exports. Per-mesh results are stacked in
+// mesh order into one output, with an IntArrayData of how many entries each mesh contributed; a
+// call fails as a whole if any mesh is unreadable. Operations with an `_ex` entry point take
+// batches there, with IGM_MeshInput::batch set.
+
+// Outputs: one centroid per mesh (PointArrayData)
+GSP_API bool GSP_CALL IGM_centroid_batch(const uint8_t* inBuffer,
+                                         int inSize,
+                                         uint8_t** outBuffer,
+                                         int* outSize);
+// Outputs: the boundary loops of every mesh (IntNestedArrayData), loops per mesh
+GSP_API bool GSP_CALL IGM_boundary_loop_batch(const uint8_t* inBuffer,
+                                              int inSize,
+                                              uint8_t** outBuffer,
+                                              int* outSize,
+                                              uint8_t** outBufferSizes,
+                                              int* outSizeSizes);
+// Outputs: planarity per face, faces per mesh. Triangle meshes in the batch report 0 (planar).
+GSP_API bool GSP_CALL IGM_quad_planarity_batch(const uint8_t* inBuffer,
+                                               int inSize,
+                                               uint8_t** outBuffer,
+                                               int* outSize,
+                                               uint8_t** outBufferSizes,
+                                               int* outSizeSizes);
+
+// ! --------------------------------
+// ! 12:: pipelines
+// ! --------------------------------
+// Run a chain or DAG of operations (a PipelineData buffer) in one call. Intermediate results stay
+// native, steps whose inputs are ready run in parallel, and only the steps listed as outputs are
+// serialized, into one PipelineResultData with one entry per listed step. Mesh steps take a
+// MeshData, whose derived data is shared by the steps of that run only, or a handle from
+// IGM_mesh_create. Fails as a whole if the description is invalid or any step fails (e.g. a
+// scalar field of the wrong length).
+GSP_API bool GSP_CALL IGM_pipeline_run(const uint8_t* inBuffer,
+                                       int inSize,
+                                       uint8_t** outBuffer,
+                                       int* outSize);
+// The PipelineResultData built in a caller owned buffer, as the `_ex` into mode does
+GSP_API bool GSP_CALL IGM_pipeline_run_into(const uint8_t* inBuffer,
+                                            int inSize,
+                                            uint8_t* outBuffer,
+                                            int outCapacity,
+                                            int* outSize);
+
+// ! --------------------------------
+// ! 13:: single precision
+// ! --------------------------------
+// Variants taking a MeshDataF buffer (float vertices) and returning a PointArrayDataF buffer, one
+// point per face, for data that does not need double precision (e.g. display). The kernels run in
+// float on blocks of faces, 8 at a time per instruction in AVX builds (GEOSHARPLUS_ENABLE_AVX2).
+GSP_API bool GSP_CALL IGM_barycenter_f(const uint8_t* inBuffer,
+                                       int inSize,
+                                       uint8_t** outBuffer,
+                                       int* outSize);
+GSP_API bool GSP_CALL IGM_face_normals_f(const uint8_t* inBuffer,
+                                         int inSize,
+                                         uint8_t** outBuffer,
+                                         int* outSize);
 
 }  // extern "C"
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+#include <igl/AABB.h>
+
+#include "Geometry.h"
+#include "MemoryTracker.h"
+#include "Progress.h"
+#include "WindingNumberIndex.h"
+
+namespace GeoSharPlusCPP {
+// Spatial index for distance queries against a fixed mesh: the AABB tree of its triangles, built
+// once. Queries are thread-safe and run on the ThreadPool over the query points.
+class DistanceIndex {
+public:
+  DistanceIndex(std::shared_ptr<const Mesh> mesh, std::shared_ptr<const Eigen::MatrixXi> triF);
+  DistanceIndex(const DistanceIndex&) = delete;
+  DistanceIndex& operator=(const DistanceIndex&) = delete;
+
+  struct SignedDistanceResult {
+    Eigen::VectorXd S;  // Signed distance per query point
+    Eigen::VectorXi I;  // Closest face (of the mesh, not of its triangulation)
+    Eigen::MatrixXd C;  // Closest point
+  };
+
+  // signType follows igl::SignedDistanceType: 1 and 2 winding number, 3 unsigned, 4 fast
+  // winding number, which needs `windingNumber` (the same mesh's MeshCache::windingNumberIndex).
+  // Signs follow igl::signed_distance (negative inside). Once `progress` is cancelled the
+  // remaining points are skipped and the result is incomplete.
+  [[nodiscard]] SignedDistanceResult signedDistance(
+      const Eigen::MatrixXd& P,
+      int signType,
+      const WindingNumberIndex* windingNumber = nullptr,
+      Progress* progress = nullptr) const;
+
+  // Closest points on the triangulated mesh; I holds triangle indices (see faceOfTriangle)
+  void closestPoints(const Eigen::MatrixXd& P,
+                     Eigen::VectorXd& sqrD,
+                     Eigen::VectorXi& I,
+                     Eigen::MatrixXd& C,
+                     ProgressSpan* progress = nullptr) const;
+
+  // Face of the mesh a triangle of triangles() was split from
+  [[nodiscard]] int faceOfTriangle(int triangle) const noexcept {
+    return mesh_->isQuadMesh() ? triangle / 2 : triangle;
+  }
+
+  [[nodiscard]] const Mesh& mesh() const noexcept {
+    return *mesh_;
+  }
+  [[nodiscard]] const Eigen::MatrixXi& triangles() const noexcept {
+    return *triF_;
+  }
+
+  // Approximate resident size of the tree
+  [[nodiscard]] std::size_t bytes() const;
+
+private:
+  std::shared_ptr<const Mesh> mesh_;
+  std::shared_ptr<const Eigen::MatrixXi> triF_;
+  igl::AABB<MatrixX3d, 3> tree_;
+  MemoryCharge charge_;
+};
+}  // namespace GeoSharPlusCPP
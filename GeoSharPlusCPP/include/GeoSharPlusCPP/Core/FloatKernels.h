@@ -0,0 +1,16 @@
+#pragma once
+#include "Geometry.h"
+#include "MathTypes.h"
+
+namespace GeoSharPlusCPP {
+// Single-precision per-face kernels on MeshViewF data. Faces are processed in blocks whose corners
+// are gathered into one array per coordinate, so the arithmetic runs on full SIMD registers
+// (4 floats with SSE, 8 with AVX) instead of one 3-vector at a time.
+
+// Unit normal of each face from its first three corners, as igl::per_face_normals; faces that
+// are degenerate in float precision get a zero normal
+void faceNormalsF(const MeshViewF& mesh, MatrixX3f& N);
+
+// Average of the corners of each face, as igl::barycenter
+void barycentersF(const MeshViewF& mesh, MatrixX3f& BC);
+}  // namespace GeoSharPlusCPP
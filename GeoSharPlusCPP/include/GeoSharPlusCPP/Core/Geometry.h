@@ -1,7 +1,16 @@
 #pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
 #include <vector>
 
+#include "Laplacian.h"
 #include "MathTypes.h"
+#include "MemoryTracker.h"
 
 namespace GeoSharPlusCPP {
 struct Polyline {
@@ -38,4 +47,253 @@ struct Mesh {
   [[nodiscard]] Eigen::Vector3d centroid() const;
   [[nodiscard]] std::pair<Vector3d, Vector3d> boundingBox() const;
 };
+
+// Read-only, non-owning view of mesh data stored elsewhere (typically the vertex and face vectors
+// of a verified FlatBuffer). V and F are Eigen::Maps, so they can be passed to any libigl function
+// taking Eigen::MatrixBase inputs without copying. The underlying storage must outlive the view.
+struct MeshView {
+  using VertexMap = Eigen::Map<const MatrixX3d>;
+  using FaceMap = Eigen::Map<const MatrixXi>;  // Row-major, 3 or 4 columns
+
+  MeshView() : V(nullptr, 0, 3), F(nullptr, 0, 3) {}
+
+  // Rebind the view to new storage (Eigen::Map has no rebinding API, so use placement new)
+  void reset(const double* vertices,
+             Eigen::Index numVertices,
+             const int* faces,
+             Eigen::Index numFaces,
+             Eigen::Index faceCols) noexcept {
+    new (&V) VertexMap(vertices, numVertices, 3);
+    new (&F) FaceMap(faces, numFaces, faceCols);
+  }
+
+  VertexMap V;
+  FaceMap F;
+
+  [[nodiscard]] bool isTriangleMesh() const noexcept {
+    return F.cols() == 3;
+  }
+  [[nodiscard]] bool isQuadMesh() const noexcept {
+    return F.cols() == 4;
+  }
+  [[nodiscard]] int faceVertexCount() const noexcept {
+    return static_cast<int>(F.cols());
+  }
+
+  // Deep copy into an owning Mesh, for code paths that modify or keep the data
+  [[nodiscard]] Mesh toMesh() const;
+};
+
+// MeshView of a MeshDataF buffer: single-precision vertices, for the float kernels
+struct MeshViewF {
+  using VertexMap = Eigen::Map<const MatrixX3f>;
+  using FaceMap = Eigen::Map<const MatrixXi>;  // Row-major, 3 or 4 columns
+
+  MeshViewF() : V(nullptr, 0, 3), F(nullptr, 0, 3) {}
+
+  void reset(const float* vertices,
+             Eigen::Index numVertices,
+             const int* faces,
+             Eigen::Index numFaces,
+             Eigen::Index faceCols) noexcept {
+    new (&V) VertexMap(vertices, numVertices, 3);
+    new (&F) FaceMap(faces, numFaces, faceCols);
+  }
+
+  VertexMap V;
+  FaceMap F;
+};
+
+// Split each quad (a, b, c, d) into triangles (a, b, c) and (a, c, d); triangles are copied as-is
+template <typename DerivedF>
+[[nodiscard]] Eigen::MatrixXi triangulateFaces(const Eigen::MatrixBase<DerivedF>& F) {
+  if (F.cols() != 4) {
+    return F.template cast<int>();
+  }
+
+  Eigen::MatrixXi triF(F.rows() * 2, 3);
+  for (Eigen::Index i = 0; i < F.rows(); ++i) {
+    triF.row(i * 2) << F(i, 0), F(i, 1), F(i, 2);
+    triF.row(i * 2 + 1) << F(i, 0), F(i, 2), F(i, 3);
+  }
+  return triF;
+}
+
+// Derived mesh data shared through MeshCache
+using AdjacencyList = std::vector<std::vector<int>>;
+
+struct VertexTriangleAdjacency {
+  AdjacencyList VF;   // Faces incident to each vertex
+  AdjacencyList VFI;  // Corner of the vertex in each of those faces
+};
+
+struct TriangleTriangleAdjacency {
+  Eigen::MatrixXi TT;   // Face across each edge (-1 on the boundary)
+  Eigen::MatrixXi TTI;  // Edge index of that edge in the neighbouring face
+};
+
+struct EdgeNormals {
+  Eigen::MatrixXd N;                        // One normal per unique edge
+  Eigen::Matrix<int, Eigen::Dynamic, 2> E;  // Unique edges
+  Eigen::VectorXi EMAP;                     // Face corner edge -> unique edge
+};
+
+class DistanceIndex;
+class WindingNumberIndex;
+
+// Approximate heap size of cached data, for memory accounting. Types that account for
+// themselves (the spatial indices) and unknown types count as 0.
+template <typename T>
+[[nodiscard]] std::size_t memoryFootprint(const T& value) {
+  if constexpr (std::is_base_of_v<Eigen::PlainObjectBase<T>, T>) {
+    return static_cast<std::size_t>(value.size()) * sizeof(typename T::Scalar);
+  } else {
+    return 0;
+  }
+}
+
+[[nodiscard]] std::size_t memoryFootprint(const SparseMatrixd& A);
+[[nodiscard]] std::size_t memoryFootprint(const AdjacencyList& list);
+[[nodiscard]] std::size_t memoryFootprint(const VertexTriangleAdjacency& adjacency);
+[[nodiscard]] std::size_t memoryFootprint(const TriangleTriangleAdjacency& adjacency);
+[[nodiscard]] std::size_t memoryFootprint(const EdgeNormals& normals);
+[[nodiscard]] std::size_t memoryFootprint(const LaplacianPattern& pattern);
+[[nodiscard]] std::size_t memoryFootprint(const Mesh& mesh);
+
+// Immutable mesh plus lazily computed derived data (normals, areas, adjacency, ...). Each
+// quantity is computed on first request and then shared by every later call on the same mesh.
+// Getters are thread-safe and return shared ownership, so a result stays valid even if the
+// cache is dropped meanwhile.
+//
+// The mesh itself never changes: a vertex update creates a new cache with withVertices(), which
+// carries over the entries that depend on the faces only and recomputes the rest on demand.
+class MeshCache {
+public:
+  // Cache slots. Entries before kFirstTopologyEntry depend on vertex positions and are dropped by
+  // withVertices(); the others depend on the faces (and vertex count) only.
+  enum class Entry : uint8_t {
+    FaceNormals,
+    VertexNormals,
+    EdgeNormalsUniform,
+    EdgeNormalsArea,
+    EdgeNormalsDefault,
+    DoubleArea,
+    AvgEdgeLength,
+    GaussianCurvature,
+    CotanLaplacian,
+    LumpedMass,
+    DistanceIndex,
+    WindingNumberIndex,
+
+    TriangleFaces,
+    VertexVertexAdjacency,
+    VertexTriangleAdjacency,
+    TriangleTriangleAdjacency,
+    BoundaryLoops,
+    LaplacianPattern,
+    LaplacianOrderings,
+
+    Count
+  };
+  static constexpr Entry kFirstTopologyEntry = Entry::TriangleFaces;
+
+  explicit MeshCache(std::shared_ptr<const Mesh> mesh);
+  MeshCache(const MeshCache&) = delete;
+  MeshCache& operator=(const MeshCache&) = delete;
+
+  [[nodiscard]] const Mesh& mesh() const noexcept {
+    return *mesh_;
+  }
+  [[nodiscard]] const std::shared_ptr<const Mesh>& meshPtr() const noexcept {
+    return mesh_;
+  }
+
+  // Faces with quads split into triangles (the mesh's own F for triangle meshes)
+  [[nodiscard]] std::shared_ptr<const Eigen::MatrixXi> triangleFaces() const;
+
+  [[nodiscard]] std::shared_ptr<const Eigen::MatrixXd> faceNormals() const;
+  [[nodiscard]] std::shared_ptr<const Eigen::MatrixXd> vertexNormals() const;
+  // weighting is an igl::PerEdgeNormalsWeightingType
+  [[nodiscard]] std::shared_ptr<const EdgeNormals> edgeNormals(int weighting) const;
+  [[nodiscard]] std::shared_ptr<const Eigen::VectorXd> doubleArea() const;
+  [[nodiscard]] double avgEdgeLength() const;
+  // Angle defect per vertex, on the triangulated mesh
+  [[nodiscard]] std::shared_ptr<const Eigen::VectorXd> gaussianCurvature() const;
+
+  [[nodiscard]] std::shared_ptr<const AdjacencyList> vertexVertexAdjacency() const;
+  [[nodiscard]] std::shared_ptr<const VertexTriangleAdjacency> vertexTriangleAdjacency() const;
+  [[nodiscard]] std::shared_ptr<const TriangleTriangleAdjacency> triangleTriangleAdjacency() const;
+  [[nodiscard]] std::shared_ptr<const AdjacencyList> boundaryLoops() const;
+
+  // Cotangent Laplacian and lumped mass of the triangulated mesh. The Laplacian is refilled into
+  // a sparsity pattern shared by every vertex update of the mesh.
+  [[nodiscard]] std::shared_ptr<const LaplacianPattern> laplacianPattern() const;
+  [[nodiscard]] std::shared_ptr<const SparseMatrixd> cotanLaplacian() const;
+  [[nodiscard]] std::shared_ptr<const Eigen::VectorXd> lumpedMass() const;
+  // Fill-reducing ordering for systems on the Laplacian pattern with the given vertices fixed.
+  // Isolated vertices are always added to the fixed set. Orderings are topology data, so they
+  // are shared across vertex updates too.
+  [[nodiscard]] std::shared_ptr<const LaplacianOrdering> laplacianOrdering(
+      std::vector<int> fixedVertices) const;
+
+  // AABB tree of the triangulated mesh for distance queries, and its fast winding number
+  // precompute with the default expansion order
+  [[nodiscard]] std::shared_ptr<const DistanceIndex> distanceIndex() const;
+  [[nodiscard]] std::shared_ptr<const WindingNumberIndex> windingNumberIndex() const;
+
+  // New cache for the same faces with moved vertices. Topology entries are shared with this
+  // cache, geometry entries start empty. Returns null if the vertex count differs.
+  [[nodiscard]] std::shared_ptr<MeshCache> withVertices(MatrixX3d V) const;
+
+  // Look up an entry, computing it with `compute()` on a miss. `compute()` returns either a T or,
+  // for types that cannot be moved, a std::shared_ptr<const T>. The computation
+  // runs outside the lock so independent entries build concurrently; if two threads race on
+  // the same entry, the first result is kept and returned to both.
+  template <typename T, typename Compute>
+  [[nodiscard]] std::shared_ptr<const T> getOrCompute(Entry entry, Compute&& compute) const {
+    const auto slot = static_cast<std::size_t>(entry);
+    {
+      std::lock_guard lock(mutex_);
+      if (entries_[slot]) {
+        return std::static_pointer_cast<const T>(entries_[slot]);
+      }
+    }
+
+    std::shared_ptr<const T> value;
+    if constexpr (std::is_same_v<std::invoke_result_t<Compute>, std::shared_ptr<const T>>) {
+      value = compute();
+    } else {
+      value = std::make_shared<const T>(compute());
+    }
+    if (value) {
+      const auto bytes = memoryFootprint(*value);
+      value = withMemoryCharge(std::move(value), MemorySubsystem::DerivedData, bytes);
+    }
+
+    std::lock_guard lock(mutex_);
+    if (!entries_[slot]) {
+      entries_[slot] = std::move(value);
+    }
+    return std::static_pointer_cast<const T>(entries_[slot]);
+  }
+
+private:
+  static constexpr std::size_t kEntryCount = static_cast<std::size_t>(Entry::Count);
+
+  // Entry holding an internally synchronized object, default-constructed on first request
+  template <typename T>
+  [[nodiscard]] std::shared_ptr<T> getOrCreate(Entry entry) const {
+    const auto slot = static_cast<std::size_t>(entry);
+    std::lock_guard lock(mutex_);
+    if (!entries_[slot]) {
+      entries_[slot] = std::make_shared<T>();
+    }
+    return std::const_pointer_cast<T>(std::static_pointer_cast<const T>(entries_[slot]));
+  }
+
+  std::shared_ptr<const Mesh> mesh_;
+  MemoryCharge meshCharge_;
+  mutable std::mutex mutex_;
+  mutable std::array<std::shared_ptr<const void>, kEntryCount> entries_;
+};
 }  // namespace GeoSharPlusCPP
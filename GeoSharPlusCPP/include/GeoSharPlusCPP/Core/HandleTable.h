@@ -0,0 +1,107 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace GeoSharPlusCPP {
+// Thread-safe table of shared objects addressed by opaque 64-bit handles, used to keep native
+// state (meshes, precomputed solver data, ...) alive between calls from C#.
+//
+// Handles are `(kind << kKindShift) | serial`: the kind tag makes a handle from one table invalid
+// in every other table, and serials are never reused, so a stale handle cannot alias a newer
+// object. All handles stay below 2^52 and survive a round trip through a double unchanged (the
+// legacy heat geodesics API passes its handle in a DoubleArray buffer). 0 is never a valid handle.
+//
+// Lookups return a shared_ptr, so releasing a handle while another thread is still using the
+// object only drops the table's reference; the object is destroyed when the last user finishes.
+template <typename T>
+class HandleTable {
+public:
+  using Handle = uint64_t;
+
+  static constexpr int kKindShift = 44;
+  static constexpr Handle kSerialMask = (Handle{1} << kKindShift) - 1;
+
+  explicit HandleTable(uint8_t kind) : kind_(kind) {}
+  HandleTable(const HandleTable&) = delete;
+  HandleTable& operator=(const HandleTable&) = delete;
+
+  // Store an object and return its new handle (0 if `object` is null)
+  [[nodiscard]] Handle insert(std::shared_ptr<T> object) {
+    if (!object) {
+      return 0;
+    }
+    const Handle handle = (Handle{kind_} << kKindShift) | (nextSerial_++ & kSerialMask);
+    std::unique_lock lock(mutex_);
+    objects_.emplace(handle, std::move(object));
+    return handle;
+  }
+
+  // Shared ownership of the object behind `handle`, or null if the handle is unknown/released
+  [[nodiscard]] std::shared_ptr<T> get(Handle handle) const {
+    if (!owns(handle)) {
+      return nullptr;
+    }
+    std::shared_lock lock(mutex_);
+    auto it = objects_.find(handle);
+    return it != objects_.end() ? it->second : nullptr;
+  }
+
+  // Replace the object behind a live handle; returns false if the handle is unknown
+  bool replace(Handle handle, std::shared_ptr<T> object) {
+    if (!owns(handle) || !object) {
+      return false;
+    }
+    std::unique_lock lock(mutex_);
+    auto it = objects_.find(handle);
+    if (it == objects_.end()) {
+      return false;
+    }
+    it->second = std::move(object);
+    return true;
+  }
+
+  // Drop the table's reference; returns false if the handle is unknown or already released
+  bool erase(Handle handle) {
+    if (!owns(handle)) {
+      return false;
+    }
+    std::shared_ptr<T> released;  // Destroyed after the lock is dropped
+    std::unique_lock lock(mutex_);
+    auto it = objects_.find(handle);
+    if (it == objects_.end()) {
+      return false;
+    }
+    released = std::move(it->second);
+    objects_.erase(it);
+    return true;
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    std::shared_lock lock(mutex_);
+    return objects_.size();
+  }
+
+  // True if `handle` carries this table's kind tag (it may still be released)
+  [[nodiscard]] bool owns(Handle handle) const noexcept {
+    return handle != 0 && (handle >> kKindShift) == kind_;
+  }
+
+private:
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<Handle, std::shared_ptr<T>> objects_;
+  std::atomic<Handle> nextSerial_{1};
+  const uint8_t kind_;
+};
+
+// Kind tags of the handle tables exported through the C API
+enum class HandleKind : uint8_t {
+  Mesh = 1,
+  HeatGeodesics = 2,
+  WindingNumber = 3,
+  Job = 4,
+};
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Geometry.h"
+#include "Laplacian.h"
+#include "MemoryTracker.h"
+
+namespace GeoSharPlusCPP {
+// Geodesic distances with the heat method (Crane, Weischedel and Wardetzky 2013), following
+// libigl's heat_geodesics: Voronoi mass matrix, time step t = h^2 with h the average edge length,
+// and on meshes with boundary the average of the Neumann and Dirichlet heat flows.
+//
+// The Poisson step differs in form only. libigl constrains the mass-weighted mean of the
+// distances with a Lagrange multiplier, which amounts to removing the mass-weighted mean of the
+// right-hand side; this is done explicitly here, per connected component, and the system is then
+// solved with one vertex per component pinned. After the final shift to zero at the sources,
+// both give the same distances on connected meshes, and these are also defined on meshes with
+// several components, where libigl's single constraint leaves the system singular.
+//
+// The three systems (heat flow, its Dirichlet variant, Poisson) reuse the mesh's Laplacian
+// pattern and cached orderings, so precomputing after a vertex-only update costs the numeric
+// factorizations only. Quads are split into triangles.
+class HeatGeodesics {
+public:
+  // Null if the mesh is empty, a system is not positive definite (e.g. degenerate faces) or the
+  // factorizations do not fit the memory budget
+  [[nodiscard]] static std::shared_ptr<const HeatGeodesics> precompute(
+      std::shared_ptr<const MeshCache> mesh);
+
+  // Distance of every vertex to the nearest source; empty if a source index is out of range
+  [[nodiscard]] Eigen::VectorXd distances(const std::vector<int>& sources) const;
+
+  // Approximate resident size of the factorizations
+  [[nodiscard]] std::size_t bytes() const;
+
+  [[nodiscard]] const MeshCache& mesh() const noexcept {
+    return *mesh_;
+  }
+
+private:
+  std::shared_ptr<const MeshCache> mesh_;
+  std::shared_ptr<const Eigen::MatrixXi> triF_;
+  std::shared_ptr<const SparseMatrixd> L_;
+  std::shared_ptr<const Eigen::VectorXd> M_;
+  SparseMatrixd heat_;     // M - t L
+  SparseMatrixd poisson_;  // -L
+  LaplacianFactorization neumann_;
+  LaplacianFactorization dirichlet_;  // Only factorized when the mesh has a boundary
+  LaplacianFactorization poissonFactor_;
+  VertexComponents components_;
+  bool hasBoundary_ = false;
+  MemoryCharge charge_;
+};
+}  // namespace GeoSharPlusCPP
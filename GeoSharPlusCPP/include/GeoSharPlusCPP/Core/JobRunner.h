@@ -0,0 +1,43 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+// Dedicated background threads running long operations off the caller's thread, first in first
+// out. Unlike ThreadPool tasks, jobs never run inline on the submitting thread, so submission
+// returns at once whatever the pool's thread count. Jobs still parallelize their own loops on the
+// ThreadPool.
+class JobRunner {
+public:
+  using Task = std::function<void()>;
+
+  explicit JobRunner(std::size_t threadCount);
+  JobRunner(const JobRunner&) = delete;
+  JobRunner& operator=(const JobRunner&) = delete;
+  ~JobRunner();  // Runs the queued jobs, then joins
+
+  // Starts the threads again if they were shut down
+  void post(Task task);
+
+  // Run the queued jobs, then join the threads. Call before the library is unloaded, on a regular
+  // thread; must not be called from a job.
+  void shutdown();
+
+private:
+  void startWorkers();  // Under mutex_
+  void workerLoop();
+
+  const std::size_t threadCount_;
+  std::mutex shutdownMutex_;  // Serializes shutdown calls
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::deque<Task> tasks_;
+  bool stopping_ = false;
+  std::vector<std::thread> workers_;  // Replaced under mutex_ while empty, cleared by shutdown
+};
+}  // namespace GeoSharPlusCPP
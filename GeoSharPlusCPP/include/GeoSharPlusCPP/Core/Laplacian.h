@@ -0,0 +1,125 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Eigen/Sparse>
+
+#include "MathTypes.h"
+#include "MemoryTracker.h"
+
+namespace GeoSharPlusCPP {
+using SparseMatrixd = Eigen::SparseMatrix<double>;  // Column-major, int indices
+
+// Sparsity pattern of the cotangent Laplacian of a triangle mesh. For each face, `slots` holds
+// the value-array positions of the twelve entries its three edges touch (per edge: ij, ji, ii,
+// jj), so the matrix can be refilled for new vertex positions without rebuilding or sorting.
+// Depends on the faces and vertex count only.
+struct LaplacianPattern {
+  SparseMatrixd L;  // Pattern, values zero
+  std::vector<int> slots;
+  std::vector<int> isolatedVertices;  // Vertices not referenced by any face
+};
+
+[[nodiscard]] LaplacianPattern buildLaplacianPattern(const Eigen::MatrixXi& F,
+                                                     Eigen::Index vertexCount);
+
+// Cotangent Laplacian with libigl's conventions (off-diagonal 0.5 * (cot a + cot b), rows sum
+// to zero, negative semi-definite), filled into `pattern`'s structure
+[[nodiscard]] SparseMatrixd assembleCotanLaplacian(const LaplacianPattern& pattern,
+                                                   const MatrixX3d& V,
+                                                   const Eigen::MatrixXi& F);
+
+// Voronoi lumped mass matrix diagonal, as libigl's massmatrix computes it by default for
+// triangles: each vertex gets the circumcentric cell of its incident triangles, or on obtuse
+// triangles half the area at the obtuse corner and a quarter at the others (Meyer et al. 2003)
+[[nodiscard]] Eigen::VectorXd lumpedMass(const MatrixX3d& V, const Eigen::MatrixXi& F);
+
+// Connected components of the pattern's graph (isolated vertices are components of their own)
+struct VertexComponents {
+  std::vector<int> label;            // Per vertex
+  std::vector<int> representatives;  // First vertex of each component
+};
+
+[[nodiscard]] VertexComponents connectedComponents(const LaplacianPattern& pattern);
+
+// The fill-reducing permutation is applied while reducing, so the solver keeps the given order
+using LaplacianLDLT =
+    Eigen::SimplicialLDLT<SparseMatrixd, Eigen::Lower, Eigen::NaturalOrdering<int>>;
+
+// Symbolic part of solving a system on the Laplacian pattern restricted to the free vertices:
+// the free/fixed split, a fill-reducing (AMD) ordering of the reduced pattern, and a solver
+// analyzed on the permuted reduced pattern. Depends on the topology and the fixed set only, so
+// it survives vertex position changes.
+struct LaplacianOrdering {
+  // Permuted lower triangle of A[free, free] and the solver analyzed on it, shared by every
+  // factorization on this ordering: each refills the values and factorizes under the lock. The
+  // solver holds a full numeric factor from the first factorization on, charged to Precomputes
+  // for as long as the ordering lives.
+  struct Analyzed {
+    std::mutex mutex;
+    SparseMatrixd reduced;
+    LaplacianLDLT ldlt;
+    MemoryCharge charge;
+  };
+
+  std::vector<int> fixedVertices;  // Sorted, unique
+  std::vector<int> freeVertices;   // Reduced index -> vertex
+  std::vector<int> reducedIndex;   // Vertex -> reduced index, -1 if fixed
+  Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic, int> P;
+  // Per value of the Laplacian pattern, its position in `analyzed->reduced` (-1 if dropped)
+  std::vector<int> reducedSlots;
+  std::unique_ptr<Analyzed> analyzed;
+};
+
+// `fixedVertices` must be sorted and unique
+[[nodiscard]] LaplacianOrdering computeLaplacianOrdering(const LaplacianPattern& pattern,
+                                                         std::vector<int> fixedVertices);
+
+// Orderings computed for a topology, keyed by fixed vertex set. Keeps the most recently used
+// few: workflows alternate between a handful of constraint sets at most.
+class LaplacianOrderingCache {
+public:
+  [[nodiscard]] std::shared_ptr<const LaplacianOrdering> get(const LaplacianPattern& pattern,
+                                                             std::vector<int> fixedVertices);
+
+private:
+  static constexpr std::size_t kMaxEntries = 8;
+
+  std::mutex mutex_;
+  std::list<std::shared_ptr<const LaplacianOrdering>> entries_;  // Most recently used first
+};
+
+// Numeric LDLT factorization of a symmetric positive definite matrix on the Laplacian pattern,
+// restricted to the free vertices of an ordering. The ordering's analyzed solver is refilled
+// through its slots and factorized, so only the numeric values are computed here; the factor is
+// then copied out, which keeps the solver free for the next factorization.
+class LaplacianFactorization {
+public:
+  // Factorize A[free, free]; returns false if it is not positive definite or A does not have
+  // the Laplacian pattern's structure (compressed, same entries)
+  bool factorize(std::shared_ptr<const LaplacianOrdering> ordering, const SparseMatrixd& A);
+
+  // Solve A x = rhs with x given on the fixed vertices. `rhs` and `fixedValues` hold one column
+  // per right-hand side and one row per vertex (rows of fixed vertices in `rhs` are ignored, rows
+  // of free vertices in `fixedValues` are ignored). Returns x for all vertices.
+  [[nodiscard]] Eigen::MatrixXd solve(const SparseMatrixd& A,
+                                      const Eigen::MatrixXd& rhs,
+                                      const Eigen::MatrixXd& fixedValues) const;
+
+  [[nodiscard]] const LaplacianOrdering& ordering() const noexcept {
+    return *ordering_;
+  }
+
+  // Approximate resident size of the factor
+  [[nodiscard]] std::size_t bytes() const;
+
+private:
+  std::shared_ptr<const LaplacianOrdering> ordering_;
+  SparseMatrixd L_;  // Unit lower factor, diagonal not stored
+  Eigen::VectorXd D_;
+};
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,166 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GeoSharPlusCPP/Core/HandleTable.h"
+#include "GeoSharPlusCPP/Core/MemoryTracker.h"
+
+namespace GeoSharPlusCPP {
+// Handle table for large, recomputable objects (factorizations, spatial indices, ...) with a
+// memory budget. Each object is stored with its approximate size in bytes; when the total goes
+// over the capacity, the least recently used objects are dropped. A dropped handle behaves like
+// a released one (get() returns null), so callers must be ready to recompute.
+//
+// Handles use the same encoding as HandleTable. The newest object is never evicted by its own
+// insertion, so a single object larger than the whole budget still works until the next insert.
+// Like HandleTable, lookups hand out shared ownership: eviction never pulls an object from under
+// a running call, it only stops the table from keeping it alive. Under process memory pressure
+// (see MemoryTracker) the table gives up least recently used objects as well, the newest too.
+template <typename T>
+class LruHandleTable {
+public:
+  using Handle = uint64_t;
+
+  static constexpr int kKindShift = HandleTable<T>::kKindShift;
+  static constexpr Handle kSerialMask = HandleTable<T>::kSerialMask;
+
+  // capacityBytes == 0 means no limit
+  LruHandleTable(uint8_t kind, std::size_t capacityBytes)
+      : kind_(kind), capacityBytes_(capacityBytes) {
+    reclaimer_ = MemoryTracker::instance().addReclaimer(
+        [this](std::size_t bytes) { return trim(bytes); });
+  }
+  LruHandleTable(const LruHandleTable&) = delete;
+  LruHandleTable& operator=(const LruHandleTable&) = delete;
+  ~LruHandleTable() {
+    MemoryTracker::instance().removeReclaimer(reclaimer_);
+  }
+
+  // Store an object as the most recently used one and return its new handle (0 if null)
+  [[nodiscard]] Handle insert(std::shared_ptr<T> object, std::size_t bytes) {
+    if (!object) {
+      return 0;
+    }
+    std::vector<std::shared_ptr<T>> evicted;  // Destroyed after the lock is dropped
+    std::lock_guard lock(mutex_);
+    const Handle handle = (Handle{kind_} << kKindShift) | (nextSerial_++ & kSerialMask);
+    order_.push_front(handle);
+    entries_.emplace(handle, Entry{std::move(object), bytes, order_.begin()});
+    usedBytes_ += bytes;
+    evictLocked(evicted);
+    return handle;
+  }
+
+  // Shared ownership of the object behind `handle` (marking it most recently used), or null if
+  // the handle is unknown, released or evicted
+  [[nodiscard]] std::shared_ptr<T> get(Handle handle) {
+    if (!owns(handle)) {
+      return nullptr;
+    }
+    std::lock_guard lock(mutex_);
+    auto it = entries_.find(handle);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    order_.splice(order_.begin(), order_, it->second.position);
+    return it->second.object;
+  }
+
+  // Drop the table's reference; returns false if the handle is unknown, released or evicted
+  bool erase(Handle handle) {
+    if (!owns(handle)) {
+      return false;
+    }
+    std::shared_ptr<T> released;  // Destroyed after the lock is dropped
+    std::lock_guard lock(mutex_);
+    auto it = entries_.find(handle);
+    if (it == entries_.end()) {
+      return false;
+    }
+    released = std::move(it->second.object);
+    removeLocked(it);
+    return true;
+  }
+
+  // Change the budget, evicting least recently used objects right away if needed
+  void setCapacity(std::size_t capacityBytes) {
+    std::vector<std::shared_ptr<T>> evicted;
+    std::lock_guard lock(mutex_);
+    capacityBytes_ = capacityBytes;
+    evictLocked(evicted);
+  }
+
+  // Evict least recently used objects totalling at least `bytes` (or all); returns the bytes
+  // evicted
+  std::size_t trim(std::size_t bytes) {
+    std::vector<std::shared_ptr<T>> evicted;
+    std::lock_guard lock(mutex_);
+    std::size_t dropped = 0;
+    while (!order_.empty() && dropped < bytes) {
+      auto it = entries_.find(order_.back());
+      dropped += it->second.bytes;
+      evicted.push_back(std::move(it->second.object));
+      removeLocked(it);
+    }
+    return dropped;
+  }
+
+  [[nodiscard]] std::size_t capacity() const {
+    std::lock_guard lock(mutex_);
+    return capacityBytes_;
+  }
+
+  [[nodiscard]] std::size_t usedBytes() const {
+    std::lock_guard lock(mutex_);
+    return usedBytes_;
+  }
+
+  [[nodiscard]] std::size_t size() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+  }
+
+  // True if `handle` carries this table's kind tag (it may still be released or evicted)
+  [[nodiscard]] bool owns(Handle handle) const noexcept {
+    return handle != 0 && (handle >> kKindShift) == kind_;
+  }
+
+private:
+  struct Entry {
+    std::shared_ptr<T> object;
+    std::size_t bytes;
+    typename std::list<Handle>::iterator position;
+  };
+  using EntryMap = std::unordered_map<Handle, Entry>;
+
+  void removeLocked(typename EntryMap::iterator it) {
+    usedBytes_ -= it->second.bytes;
+    order_.erase(it->second.position);
+    entries_.erase(it);
+  }
+
+  // Evict from the back of the LRU list, keeping at least the most recent object
+  void evictLocked(std::vector<std::shared_ptr<T>>& evicted) {
+    while (capacityBytes_ != 0 && usedBytes_ > capacityBytes_ && order_.size() > 1) {
+      auto it = entries_.find(order_.back());
+      evicted.push_back(std::move(it->second.object));
+      removeLocked(it);
+    }
+  }
+
+  mutable std::mutex mutex_;
+  EntryMap entries_;
+  std::list<Handle> order_;  // Most recently used first
+  std::size_t usedBytes_ = 0;
+  Handle nextSerial_ = 1;
+  const uint8_t kind_;
+  std::size_t capacityBytes_;
+  int reclaimer_ = 0;
+};
+}  // namespace GeoSharPlusCPP
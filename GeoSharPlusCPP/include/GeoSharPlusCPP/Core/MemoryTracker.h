@@ -0,0 +1,152 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+// Where tracked native memory lives
+enum class MemorySubsystem : int {
+  Interop = 0,      // FlatBuffers blocks being built for output buffers (until handed to C#)
+  Meshes = 1,       // Deserialized meshes held by caches, handles and jobs
+  DerivedData = 2,  // Per-mesh cached data: normals, areas, adjacency, Laplacians, ...
+  Precomputes = 3,  // Spatial indices, winding number expansions and factorizations
+};
+constexpr std::size_t kMemorySubsystemCount = 4;
+
+struct MemoryUsage {
+  std::size_t current = 0;
+  std::size_t peak = 0;
+};
+
+// Process-wide accounting of the large native allocations, per subsystem, with an optional
+// budget. Counting is lock-free. When an allocation checked against the budget does not fit,
+// the registered reclaimers (the caches) are asked to drop least recently used data first, and
+// the allocation fails only if that was not enough, so callers can report an error instead of
+// running the host out of memory. Unchecked allocations are always counted.
+class MemoryTracker {
+public:
+  // Asked to release about `bytes`; returns the bytes it expects to have released
+  using Reclaimer = std::function<std::size_t(std::size_t bytes)>;
+
+  [[nodiscard]] static MemoryTracker& instance();
+
+  MemoryTracker(const MemoryTracker&) = delete;
+  MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+  void add(MemorySubsystem subsystem, std::size_t bytes) noexcept;
+  void remove(MemorySubsystem subsystem, std::size_t bytes) noexcept;
+
+  // Count `bytes` if they fit the budget, reclaiming cached data first if needed
+  [[nodiscard]] bool tryAdd(MemorySubsystem subsystem, std::size_t bytes);
+  // Reclaim cached data until `bytes` more would fit the budget; false if they still do not
+  [[nodiscard]] bool makeRoom(std::size_t bytes);
+
+  [[nodiscard]] MemoryUsage usage() const noexcept;
+  [[nodiscard]] MemoryUsage usage(MemorySubsystem subsystem) const noexcept;
+  // Restart peak tracking from the current usage
+  void resetPeaks() noexcept;
+
+  // 0 = no limit
+  void setBudget(std::size_t bytes) noexcept {
+    budget_.store(bytes, std::memory_order_relaxed);
+  }
+  [[nodiscard]] std::size_t budget() const noexcept {
+    return budget_.load(std::memory_order_relaxed);
+  }
+
+  // Reclaimers must not be added or removed from inside a reclaimer
+  [[nodiscard]] int addReclaimer(Reclaimer reclaimer);
+  void removeReclaimer(int id);
+
+private:
+  MemoryTracker() = default;
+
+  struct Counter {
+    std::atomic<std::size_t> current{0};
+    std::atomic<std::size_t> peak{0};
+
+    void add(std::size_t bytes) noexcept;
+  };
+
+  [[nodiscard]] bool fits(std::size_t bytes) const noexcept;
+
+  Counter total_;
+  std::array<Counter, kMemorySubsystemCount> subsystems_;
+  std::atomic<std::size_t> budget_{0};
+
+  mutable std::shared_mutex reclaimersMutex_;  // Shared while reclaimers run
+  std::vector<std::pair<int, Reclaimer>> reclaimers_;
+  int nextReclaimerId_ = 1;
+};
+
+// Bytes counted against a subsystem for as long as the charge lives
+class MemoryCharge {
+public:
+  MemoryCharge() = default;
+  MemoryCharge(MemorySubsystem subsystem, std::size_t bytes) noexcept
+      : subsystem_(subsystem), bytes_(bytes) {
+    MemoryTracker::instance().add(subsystem_, bytes_);
+  }
+  MemoryCharge(MemoryCharge&& other) noexcept
+      : subsystem_(other.subsystem_), bytes_(std::exchange(other.bytes_, 0)) {}
+  MemoryCharge& operator=(MemoryCharge&& other) noexcept {
+    if (this != &other) {
+      release();
+      subsystem_ = other.subsystem_;
+      bytes_ = std::exchange(other.bytes_, 0);
+    }
+    return *this;
+  }
+  ~MemoryCharge() {
+    release();
+  }
+
+  // Charge `bytes` only if they fit the budget (see MemoryTracker::tryAdd)
+  [[nodiscard]] static bool tryCharge(MemorySubsystem subsystem,
+                                      std::size_t bytes,
+                                      MemoryCharge& charge) {
+    if (!MemoryTracker::instance().tryAdd(subsystem, bytes)) {
+      return false;
+    }
+    charge = MemoryCharge();
+    charge.subsystem_ = subsystem;
+    charge.bytes_ = bytes;
+    return true;
+  }
+
+  [[nodiscard]] std::size_t bytes() const noexcept {
+    return bytes_;
+  }
+
+private:
+  void release() noexcept {
+    if (bytes_ != 0) {
+      MemoryTracker::instance().remove(subsystem_, std::exchange(bytes_, 0));
+    }
+  }
+
+  MemorySubsystem subsystem_ = MemorySubsystem::Interop;
+  std::size_t bytes_ = 0;
+};
+
+// Pointer to the same object that also keeps a charge of `bytes` alive
+template <typename T>
+[[nodiscard]] std::shared_ptr<const T> withMemoryCharge(std::shared_ptr<const T> object,
+                                                        MemorySubsystem subsystem,
+                                                        std::size_t bytes) {
+  if (!object || bytes == 0) {
+    return object;
+  }
+  struct Charged {
+    std::shared_ptr<const T> object;
+    MemoryCharge charge;
+  };
+  auto charged = std::make_shared<Charged>(Charged{object, MemoryCharge(subsystem, bytes)});
+  return std::shared_ptr<const T>(charged, charged->object.get());
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Geometry.h"
+
+namespace GeoSharPlusCPP {
+// Operations a pipeline step can run, numbered as GSP::FB::PipelineOp
+enum class PipelineOp : uint8_t {
+  Mesh,               // Source mesh, from the description or a mesh handle
+  Values,             // Constant numbers from the description
+  VertexNormals,      // (mesh) -> per-vertex vectors
+  FaceNormals,        // (mesh) -> per-face vectors
+  Barycenters,        // (mesh) -> per-face points
+  GaussianCurvature,  // (mesh) -> per-vertex numbers
+  RemapVtoF,          // (mesh, per-vertex numbers) -> per-face numbers
+  RemapFtoV,          // (mesh, per-face numbers) -> per-vertex numbers
+  Isolines,           // (mesh, per-vertex numbers, iso values) -> points on the isolines
+
+  Count
+};
+
+// Inputs a step of `op` reads
+[[nodiscard]] int pipelineInputCount(PipelineOp op) noexcept;
+
+struct PipelineStep {
+  PipelineOp op = PipelineOp::Values;
+  std::vector<int> inputs;  // Indices of earlier steps, in the order listed above
+
+  // Mesh steps: either a view into the description buffer or an IGM_mesh_create handle
+  bool hasMesh = false;
+  MeshView mesh;
+  uint64_t meshHandle = 0;
+
+  std::vector<double> values;  // Values steps
+};
+
+// A DAG of steps in topological order: every step only reads steps listed before it
+struct Pipeline {
+  std::vector<PipelineStep> steps;
+  std::vector<int> outputs;  // Steps whose results are returned, in this order
+};
+
+// Result of a step: the mesh of a Mesh step, otherwise one row per element with one column
+// (numbers) or three (vectors and points)
+struct PipelineValue {
+  std::shared_ptr<const MeshCache> mesh;
+  Eigen::MatrixXd data;
+};
+
+// Inputs refer to earlier steps, their count matches the operation and outputs are not meshes
+[[nodiscard]] bool validatePipeline(const Pipeline& pipeline) noexcept;
+
+// Computes one step from the results of its inputs; false fails the whole run
+using PipelineStepRunner = std::function<bool(const PipelineStep& step,
+                                              const std::vector<const PipelineValue*>& inputs,
+                                              PipelineValue& result)>;
+
+// Run the steps the outputs depend on, and only those, in waves: every step of a wave has all its
+// inputs ready, and the steps of a wave run in parallel on the ThreadPool. Intermediate results
+// are dropped after the last wave reading them. Fails if the pipeline is invalid or a step fails.
+[[nodiscard]] bool runPipeline(const Pipeline& pipeline,
+                               const PipelineStepRunner& runStep,
+                               std::vector<PipelineValue>& outputs);
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,75 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+// Per-export profiling counters. Every bridge export opens a ProfileCall for its whole body;
+// (de)serialization code inside it opens ProfilePhaseScopes, and the rest of the call counts as
+// compute. Calls nested in another call (an export calling an export) fold into the outer one,
+// and so do nested phases. Counters are process-wide and always on: a call costs a few clock
+// reads and one short lock.
+enum class ProfilePhase : int {
+  Deserialize = 0,
+  Compute = 1,
+  Serialize = 2,
+};
+
+// Aggregated counters of one export since the last reset. Times in nanoseconds.
+struct ProfileEntry {
+  static constexpr std::size_t kPhaseCount = 3;
+
+  std::string name;
+  uint64_t calls = 0;
+  uint64_t totalNs = 0;
+  uint64_t maxNs = 0;
+  std::array<uint64_t, kPhaseCount> phaseNs{};     // Indexed by ProfilePhase
+  std::array<uint64_t, kPhaseCount> phaseMaxNs{};  // Slowest single call, per phase
+  uint64_t bytesIn = 0;
+  uint64_t bytesOut = 0;
+};
+
+class ProfileCall {
+public:
+  // `name` must outlive the process (a string literal or __func__)
+  explicit ProfileCall(const char* name) noexcept;
+  ProfileCall(const ProfileCall&) = delete;
+  ProfileCall& operator=(const ProfileCall&) = delete;
+  ~ProfileCall();
+
+private:
+  friend class ProfilePhaseScope;
+  friend void profileBytesOut(std::size_t bytes) noexcept;
+
+  const char* name_;
+  bool active_;  // False when nested in another call on the same thread
+  std::chrono::steady_clock::time_point start_;
+  std::array<uint64_t, ProfileEntry::kPhaseCount> phaseNs_{};
+  uint64_t bytesIn_ = 0;
+  uint64_t bytesOut_ = 0;
+};
+
+// Times a deserialize or serialize phase of the current call; no-op outside a call
+class ProfilePhaseScope {
+public:
+  explicit ProfilePhaseScope(ProfilePhase phase, std::size_t bytesIn = 0) noexcept;
+  ProfilePhaseScope(const ProfilePhaseScope&) = delete;
+  ProfilePhaseScope& operator=(const ProfilePhaseScope&) = delete;
+  ~ProfilePhaseScope();
+
+private:
+  ProfileCall* call_;  // Null when inactive
+  ProfilePhase phase_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+// Count an output buffer handed to the caller against the current call
+void profileBytesOut(std::size_t bytes) noexcept;
+
+// Counters of every export called since the last reset, sorted by name
+[[nodiscard]] std::vector<ProfileEntry> profileSnapshot();
+void profileReset();
+}  // namespace GeoSharPlusCPP
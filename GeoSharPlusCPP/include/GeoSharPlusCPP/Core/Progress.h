@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "Macro.h"
+
+namespace GeoSharPlusCPP {
+// Progress reporting and cooperative cancellation for long-running kernels. Kernels report the
+// fraction of their work done at chunk boundaries and stop early once cancelled, either through
+// cancel() or because the callback asked to. Safe to use from several threads at once: the
+// callback is never entered concurrently and is throttled to steps of kReportStep.
+class Progress {
+public:
+  // Called with the fraction done in [0, 1]; return false to cancel
+  using Callback = bool(GSP_CALL*)(void* context, double fraction);
+
+  static constexpr double kReportStep = 0.01;
+
+  Progress() = default;
+  Progress(Callback callback, void* context) : callback_(callback), context_(context) {}
+  Progress(const Progress&) = delete;
+  Progress& operator=(const Progress&) = delete;
+
+  // Record `fraction` (kept monotonic) and forward it to the callback; false once cancelled
+  bool report(double fraction);
+
+  void cancel() noexcept {
+    cancelled_.store(true, std::memory_order_relaxed);
+  }
+  [[nodiscard]] bool cancelled() const noexcept {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+  [[nodiscard]] double fraction() const noexcept {
+    return fraction_.load(std::memory_order_relaxed);
+  }
+
+private:
+  Callback callback_ = nullptr;
+  void* context_ = nullptr;
+  std::mutex callbackMutex_;
+  double reported_ = -1.0;  // Last fraction passed to the callback, guarded by callbackMutex_
+  std::atomic<double> fraction_{0.0};
+  std::atomic<bool> cancelled_{false};
+};
+
+// One stage of a kernel, covering [begin, end) of the overall progress and `total` work units
+// (points, faces, iterations). Tolerates a null Progress, so kernels can take `Progress*` as an
+// optional argument and use a span unconditionally.
+class ProgressSpan {
+public:
+  ProgressSpan(Progress* progress, std::ptrdiff_t total, double begin = 0.0, double end = 1.0)
+      : progress_(progress), total_(total), begin_(begin), width_(end - begin) {}
+  ProgressSpan(const ProgressSpan&) = delete;
+  ProgressSpan& operator=(const ProgressSpan&) = delete;
+
+  // Count `units` more as done; false once cancelled
+  bool advance(std::ptrdiff_t units);
+
+  [[nodiscard]] bool cancelled() const noexcept {
+    return progress_ && progress_->cancelled();
+  }
+
+private:
+  Progress* progress_;
+  std::ptrdiff_t total_;
+  double begin_;
+  double width_;
+  std::atomic<std::ptrdiff_t> done_{0};
+};
+}  // namespace GeoSharPlusCPP
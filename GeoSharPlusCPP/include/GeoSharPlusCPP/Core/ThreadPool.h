@@ -0,0 +1,151 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+// Process-wide work-stealing thread pool shared by every parallel kernel of the library. Each
+// worker owns a task deque: it runs its own tasks newest first and steals the oldest tasks of
+// the others when it runs dry. Tasks submitted from a worker go to that worker's deque, so
+// nested parallel loops stay cache-local and never wait on a sleeping queue.
+//
+// The thread count covers the calling thread, which always takes part in its own parallel loops:
+// with a count of 1 there are no workers and everything runs inline.
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+  [[nodiscard]] static ThreadPool& instance();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+  // 0 = one thread per hardware thread. Queued tasks finish on the old workers first; must not be
+  // called from a pool task.
+  void setThreadCount(std::size_t count);
+  [[nodiscard]] std::size_t threadCount() const noexcept {
+    return threadCount_.load(std::memory_order_relaxed);
+  }
+
+  // Stop the workers once the queued tasks have run; parallel loops then run inline until
+  // setThreadCount starts workers again. Call before the library is unloaded, on a regular
+  // thread; must not be called from a pool task.
+  void shutdown();
+
+  // Run `task` on a worker (inline if the pool has no workers)
+  void submit(Task task);
+
+  // Call body(begin, end) over [0, count) in consecutive chunks of `grain` items (the last one may
+  // be shorter), each chunk starting at a multiple of `grain`. Blocks until every chunk has run;
+  // the first exception thrown by `body` is rethrown here and skips the chunks not yet started.
+  template <typename Body>
+  void parallelFor(std::ptrdiff_t count, std::ptrdiff_t grain, Body&& body);
+
+private:
+  ThreadPool();
+
+  void startWorkers(std::size_t count);
+  void stopWorkers();
+  void workerLoop(std::size_t self);
+  [[nodiscard]] bool popTask(std::size_t self, Task& task);
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  mutable std::shared_mutex configMutex_;  // Exclusive while workers are replaced
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+
+  std::mutex sleepMutex_;
+  std::condition_variable wake_;
+  std::size_t pending_ = 0;  // Tasks in the queues; changed under sleepMutex_ and a queue's mutex
+  bool stopping_ = false;
+
+  std::atomic<std::size_t> threadCount_{1};
+  std::atomic<std::size_t> nextQueue_{0};
+};
+
+template <typename Body>
+void ThreadPool::parallelFor(std::ptrdiff_t count, std::ptrdiff_t grain, Body&& body) {
+  if (count <= 0) {
+    return;
+  }
+  grain = std::max<std::ptrdiff_t>(grain, 1);
+  const auto chunks = (count + grain - 1) / grain;
+  const auto helpers =
+      std::min<std::ptrdiff_t>(chunks, static_cast<std::ptrdiff_t>(threadCount())) - 1;
+  if (helpers <= 0) {
+    for (std::ptrdiff_t begin = 0; begin < count; begin += grain) {
+      body(begin, std::min(begin + grain, count));
+    }
+    return;
+  }
+
+  // Shared with the helper tasks, which may start after the loop is over (they then find no
+  // chunk left and return without touching `body`)
+  struct State {
+    std::atomic<std::ptrdiff_t> next{0};
+    std::atomic<std::ptrdiff_t> done{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  auto state = std::make_shared<State>();
+
+  const auto runChunks = [state, count, grain, &body] {
+    for (;;) {
+      const auto begin = state->next.fetch_add(grain, std::memory_order_relaxed);
+      if (begin >= count) {
+        return;
+      }
+      const auto end = std::min(begin + grain, count);
+      if (!state->failed.load(std::memory_order_relaxed)) {
+        try {
+          body(begin, end);
+        } catch (...) {
+          std::lock_guard lock(state->mutex);
+          if (!state->error) {
+            state->error = std::current_exception();
+          }
+          state->failed.store(true, std::memory_order_relaxed);
+        }
+      }
+      if (state->done.fetch_add(end - begin, std::memory_order_acq_rel) + (end - begin) == count) {
+        std::lock_guard lock(state->mutex);
+        state->finished.notify_all();
+      }
+    }
+  };
+
+  for (std::ptrdiff_t i = 0; i < helpers; ++i) {
+    submit(runChunks);
+  }
+  runChunks();
+
+  std::unique_lock lock(state->mutex);
+  state->finished.wait(lock, [&] { return state->done.load(std::memory_order_acquire) == count; });
+  if (state->error) {
+    std::rethrow_exception(state->error);
+  }
+}
+
+// Shorthand for ThreadPool::instance().parallelFor
+template <typename Body>
+void parallelFor(std::ptrdiff_t count, std::ptrdiff_t grain, Body&& body) {
+  ThreadPool::instance().parallelFor(count, grain, std::forward<Body>(body));
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+
+namespace GeoSharPlusCPP {
+// Opt-in event tracing. While tracing is on, every bridge call, (de)serialization phase, pool
+// task and job records begin/end events with its thread into a ring buffer; traceDump writes the
+// buffer as Chrome trace JSON (chrome://tracing, ui.perfetto.dev). Recording takes no lock: an
+// event is one atomic increment and a few stores. With tracing off each hook is a single load.
+constexpr std::size_t kDefaultTraceCapacity = std::size_t{1} << 16;
+
+// Start (or restart) recording into a ring buffer of `capacity` events, 0 = the default. Events
+// recorded before are dropped; once full, the oldest events are overwritten.
+void traceStart(std::size_t capacity = 0);
+void traceStop() noexcept;
+[[nodiscard]] bool traceEnabled() noexcept;
+
+// `name` must outlive the process (a string literal or __func__)
+void traceBegin(const char* name) noexcept;
+void traceEnd(const char* name) noexcept;
+
+// Label the calling thread in later dumps
+void traceThreadName(const char* name);
+
+// Write the recorded events to `path` as Chrome trace JSON; works while recording too
+[[nodiscard]] bool traceDump(const char* path);
+
+// Begin/end events around a scope
+class TraceScope {
+public:
+  explicit TraceScope(const char* name) noexcept : name_(name) {
+    traceBegin(name_);
+  }
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+  ~TraceScope() {
+    traceEnd(name_);
+  }
+
+private:
+  const char* name_;
+};
+}  // namespace GeoSharPlusCPP
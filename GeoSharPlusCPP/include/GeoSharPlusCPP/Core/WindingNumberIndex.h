@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+#include <igl/fast_winding_number.h>
+
+#include "Geometry.h"
+#include "MemoryTracker.h"
+#include "Progress.h"
+
+namespace GeoSharPlusCPP {
+// Precomputed fast winding number data of a triangulated mesh (Barill et al. 2018): the BVH over
+// its triangles and the per-node dipole expansion coefficients up to `order` (0, 1 or 2). Built
+// once, it answers inside/outside queries for any number of point batches at query cost only.
+class WindingNumberIndex {
+public:
+  static constexpr int kDefaultOrder = 2;          // As igl::fast_winding_number(V, F, Q, W)
+  static constexpr double kDefaultAccuracy = 2.0;  // Libigl's beta (accuracy_scale)
+
+  WindingNumberIndex(std::shared_ptr<const Mesh> mesh,
+                     std::shared_ptr<const Eigen::MatrixXi> triF,
+                     int order = kDefaultOrder);
+  WindingNumberIndex(const WindingNumberIndex&) = delete;
+  WindingNumberIndex& operator=(const WindingNumberIndex&) = delete;
+
+  // Winding number per query point. `accuracy` (beta) trades accuracy for speed: a node's
+  // expansion is used once the query is more than accuracy times the node's radius away.
+  // Chunks not started before `progress` is cancelled are left unset.
+  [[nodiscard]] Eigen::VectorXd query(const Eigen::MatrixXd& P,
+                                      double accuracy = kDefaultAccuracy,
+                                      ProgressSpan* progress = nullptr) const;
+
+  [[nodiscard]] int order() const noexcept {
+    return order_;
+  }
+
+  // Approximate resident size of the BVH and expansion coefficients
+  [[nodiscard]] std::size_t bytes() const;
+
+private:
+  std::shared_ptr<const Mesh> mesh_;
+  std::shared_ptr<const Eigen::MatrixXi> triF_;
+  int order_;
+  igl::FastWindingNumberBVH bvh_;
+  MemoryCharge charge_;
+};
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "GeoSharPlusCPP/Core/Geometry.h"
+
+namespace GeoSharPlusCPP::Serialization {
+// Deduplicates incoming mesh buffers by content. Each buffer is hashed; when an identical buffer
+// was seen recently, the MeshCache built for it (mesh plus any derived data computed since) is
+// returned instead of deserializing again. A hash match is confirmed by comparing the buffer's
+// vertices and faces with the cached mesh, so collisions can never return the wrong mesh.
+//
+// Recently used meshes are kept up to a byte budget counted on vertex and face storage; derived
+// data lives as long as its mesh. A capacity of 0 disables retention (every call is a miss).
+// Under memory pressure (see MemoryTracker) the least recently used meshes are dropped early,
+// and a new mesh that does not fit the process budget is rejected like an invalid buffer.
+class MeshRegistry {
+public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    std::size_t entries = 0;
+    std::size_t bytes = 0;
+  };
+
+  explicit MeshRegistry(std::size_t capacityBytes);
+  MeshRegistry(const MeshRegistry&) = delete;
+  MeshRegistry& operator=(const MeshRegistry&) = delete;
+  ~MeshRegistry();
+
+  // Mesh for a serialized mesh buffer, or null if the buffer is invalid or over the budget
+  [[nodiscard]] std::shared_ptr<const MeshCache> acquire(const uint8_t* data, int size);
+  // Same for a mesh mapped from elsewhere (one table of a batch buffer), keyed by its contents
+  [[nodiscard]] std::shared_ptr<const MeshCache> acquire(const MeshView& view);
+
+  void setCapacity(std::size_t capacityBytes);
+  void clear();
+  // Drop least recently used meshes totalling at least `bytes` (or all); returns the bytes dropped
+  std::size_t trim(std::size_t bytes);
+
+  [[nodiscard]] Stats stats() const;
+  void resetStats();
+
+private:
+  struct Entry {
+    uint64_t hash;
+    int bufferSize;  // 0 for meshes acquired from a view
+    std::size_t bytes;
+    std::shared_ptr<const MeshCache> cache;
+  };
+  using EntryList = std::list<Entry>;  // Most recently used first
+
+  // Lookup and insertion once the input is mapped; `bufferSize` must match on a hit
+  [[nodiscard]] std::shared_ptr<const MeshCache> acquireMapped(uint64_t hash,
+                                                               int bufferSize,
+                                                               const MeshView& view);
+
+  // Moves entries out of the list so the caller can destroy them outside the lock
+  void evictLocked(EntryList& evicted);
+
+  mutable std::mutex mutex_;
+  EntryList entries_;
+  std::unordered_map<uint64_t, EntryList::iterator> index_;
+  std::size_t capacityBytes_;
+  std::size_t usedBytes_ = 0;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  int reclaimer_ = 0;
+};
+}  // namespace GeoSharPlusCPP::Serialization
@@ -1,10 +1,51 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
+#include <variant>
 #include <vector>
 
 #include "GeoSharPlusCPP/Core/Geometry.h"
+#include "GeoSharPlusCPP/Core/MemoryTracker.h"
+#include "GeoSharPlusCPP/Core/Pipeline.h"
+#include "GeoSharPlusCPP/Core/Profiler.h"
 
 namespace GeoSharPlusCPP::Serialization {
+// ! Interop memory
+// Every output buffer handed to C# comes from this allocator (CoTaskMemAlloc on Windows, malloc
+// elsewhere) and is released there with Marshal.FreeCoTaskMem. FreeInteropMemory is only for
+// error paths where a buffer is dropped before it reaches C#.
+void* AllocateInteropMemory(size_t size);
+void FreeInteropMemory(void* ptr);
+
+// ! Caller-owned output buffers
+// Destination of the next output serialized on this thread, see CallerBufferScope
+struct CallerBuffer {
+  uint8_t* data = nullptr;
+  size_t capacity = 0;
+  bool claimed = false;   // Backs a builder
+  bool finished = false;  // An output was released; later ones go to interop memory again
+  size_t required = 0;    // Size of an output that did not fit
+};
+
+// While a scope is alive, the next output serialized on this thread is built directly in the
+// caller's `capacity` bytes at `buffer` instead of a new interop allocation, and returned as
+// `buffer` itself with the data at its start. An output that does not fit (or any output, with a
+// null buffer) fails its serialization and requiredSize() reports the size to retry with.
+// FreeInteropMemory ignores the caller's buffer, so error paths need no special case.
+class CallerBufferScope {
+public:
+  CallerBufferScope(uint8_t* buffer, int capacity) noexcept;
+  ~CallerBufferScope();
+  CallerBufferScope(const CallerBufferScope&) = delete;
+  CallerBufferScope& operator=(const CallerBufferScope&) = delete;
+
+  [[nodiscard]] int requiredSize() const noexcept;
+
+private:
+  CallerBuffer target_;
+  CallerBuffer* previous_;
+};
+
 // ! Basic Type
 // Unified number array serialization (handles both double and int)
 template <typename NumberContainer>
@@ -34,7 +75,8 @@ bool deserializeNestedIntArray(const uint8_t* data,
 bool serializePoint(const Vector3d& point, uint8_t*& resBuffer, int& resSize);
 bool deserializePoint(const uint8_t* buffer, int size, Vector3d& point);
 
-// Point array (de)serialization
+// Point array (de)serialization. Double containers (std::vector<Vector3d>, Eigen::MatrixXd) use
+// PointArrayData, float ones (std::vector<Vector3f>, MatrixX3f) PointArrayDataF.
 template <typename PointContainer>
 bool serializePointArray(const PointContainer& points, uint8_t*& resBuffer, int& resSize);
 
@@ -46,4 +88,56 @@ bool deserializePointArray(const uint8_t* data, int size, PointContainer& pointA
 bool serializeMesh(const Mesh& mesh, uint8_t*& resBuffer, int& resSize);
 bool deserializeMesh(const uint8_t* data, int size, Mesh& mesh);
 
+// Zero-copy mesh deserialization: verifies the buffer and maps its vertex/face vectors in place.
+// The view aliases `data`, so the buffer must stay alive (and unmodified) while the view is used.
+bool deserializeMeshView(const uint8_t* data, int size, MeshView& view);
+
+// deserializeMeshView for MeshDataF buffers, under the same lifetime rule
+bool deserializeMeshViewF(const uint8_t* data, int size, MeshViewF& view);
+
+// Zero-copy views of every mesh in a MeshArrayData buffer, in order, under the same lifetime rule.
+// Fails if any mesh has no faces.
+bool deserializeMeshArrayView(const uint8_t* data, int size, std::vector<MeshView>& views);
+
+// ! Pipelines
+// Steps and outputs of a PipelineData buffer. Meshes given as data are views into `data`, under
+// the same lifetime rule as deserializeMeshView.
+bool deserializePipeline(const uint8_t* data, int size, Pipeline& pipeline);
+
+// Pipeline outputs as a PipelineResultData table: three-column results as points, one-column
+// results as values
+bool serializePipelineResult(const std::vector<PipelineValue>& outputs,
+                             uint8_t*& resBuffer,
+                             int& resSize);
+
+// ! Result bundles
+// One named output of a multi-output export, pointing at data the caller keeps alive while it is
+// serialized. Three-column matrices are points, Nx2 integer matrices index pairs.
+struct ResultColumn {
+  using Data = std::variant<const Eigen::MatrixXd*,
+                            const Eigen::VectorXd*,
+                            const Eigen::VectorXi*,
+                            const std::vector<int>*,
+                            const Eigen::Matrix<int, Eigen::Dynamic, 2>*,
+                            const std::vector<std::vector<int>>*>;
+
+  const char* name;
+  Data data;
+};
+
+// A column on its own, in the buffer type of the export's separate-output variant (PointArrayData,
+// DoubleArrayData, IntArrayData, IntPairArrayData or IntNestedArrayData)
+bool serializeResultColumn(const ResultColumn& column, uint8_t*& resBuffer, int& resSize);
+
+// All columns, in order, as one ResultBundleData table sized up front
+bool serializeResultBundle(const std::vector<ResultColumn>& columns,
+                           uint8_t*& resBuffer,
+                           int& resSize);
+
+// ! Diagnostics
+// Profiler counters as a ProfileSnapshotData table
+bool serializeProfileSnapshot(const std::vector<ProfileEntry>& entries,
+                              uint8_t*& resBuffer,
+                              int& resSize);
+
 }  // namespace GeoSharPlusCPP::Serialization
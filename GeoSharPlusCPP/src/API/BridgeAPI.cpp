@@ -1,10 +1,18 @@
 #include "GeoSharPlusCPP/API/BridgeAPI.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <ranges>
+#include <span>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #define _USE_MATH_DEFINES
 #include <cmath>
@@ -12,17 +20,14 @@
 #include <igl/adjacency_list.h>
 #include <igl/average_onto_faces.h>
 #include <igl/average_onto_vertices.h>
-#include <igl/avg_edge_length.h>
 #include <igl/barycenter.h>
 #include <igl/blue_noise.h>
 #include <igl/boundary_facets.h>
 #include <igl/boundary_loop.h>
 #include <igl/centroid.h>
 #include <igl/doublearea.h>
-#include <igl/fast_winding_number.h>
 #include <igl/gaussian_curvature.h>
 #include <igl/harmonic.h>
-#include <igl/heat_geodesics.h>
 #include <igl/map_vertices_to_circle.h>
 #include <igl/per_corner_normals.h>
 #include <igl/per_edge_normals.h>
@@ -33,7 +38,6 @@
 #include <igl/quad_planarity.h>
 #include <igl/random_points_on_mesh.h>
 #include <igl/read_triangle_mesh.h>
-#include <igl/signed_distance.h>
 #include <igl/triangle_triangle_adjacency.h>
 #include <igl/vertex_triangle_adjacency.h>
 #include <igl/write_triangle_mesh.h>
@@ -42,49 +46,32 @@
 #include "GSP_FB/cpp/mesh_generated.h"
 #include "GSP_FB/cpp/pointArray_generated.h"
 #include "GSP_FB/cpp/point_generated.h"
+#include "GeoSharPlusCPP/Core/DistanceIndex.h"
+#include "GeoSharPlusCPP/Core/FloatKernels.h"
+#include "GeoSharPlusCPP/Core/HandleTable.h"
+#include "GeoSharPlusCPP/Core/HeatGeodesics.h"
+#include "GeoSharPlusCPP/Core/JobRunner.h"
+#include "GeoSharPlusCPP/Core/LruHandleTable.h"
 #include "GeoSharPlusCPP/Core/MathTypes.h"
+#include "GeoSharPlusCPP/Core/MemoryTracker.h"
+#include "GeoSharPlusCPP/Core/Pipeline.h"
+#include "GeoSharPlusCPP/Core/Profiler.h"
+#include "GeoSharPlusCPP/Core/Progress.h"
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+#include "GeoSharPlusCPP/Core/Trace.h"
+#include "GeoSharPlusCPP/Core/WindingNumberIndex.h"
+#include "GeoSharPlusCPP/Serialization/MeshRegistry.h"
 #include "GeoSharPlusCPP/Serialization/Serializer.h"
 
 namespace GS = GeoSharPlusCPP::Serialization;
 
 // Helper functions for mesh type handling
 namespace {
-// Check if mesh requires triangulation for triangle-only functions
-[[nodiscard]] constexpr bool requiresTriangulation(const GeoSharPlusCPP::Mesh& mesh) noexcept {
-  return mesh.F.cols() == 4;  // Quad mesh needs triangulation
-}
-
-// Triangulate a quad mesh by splitting each quad into 2 triangles
-[[nodiscard]] GeoSharPlusCPP::Mesh triangulate(const GeoSharPlusCPP::Mesh& mesh) {
-  if (mesh.F.cols() == 3) {
-    return mesh;  // Already triangulated
-  }
-
-  GeoSharPlusCPP::Mesh triMesh;
-  triMesh.V = mesh.V;
-
-  // Convert quads to triangles (split each quad into 2 triangles)
-  triMesh.F.resize(mesh.F.rows() * 2, 3);
-  for (int i = 0; i < mesh.F.rows(); ++i) {
-    // Triangle 1: vertices 0,1,2
-    triMesh.F(i * 2, 0) = mesh.F(i, 0);
-    triMesh.F(i * 2, 1) = mesh.F(i, 1);
-    triMesh.F(i * 2, 2) = mesh.F(i, 2);
-
-    // Triangle 2: vertices 0,2,3
-    triMesh.F(i * 2 + 1, 0) = mesh.F(i, 0);
-    triMesh.F(i * 2 + 1, 1) = mesh.F(i, 2);
-    triMesh.F(i * 2 + 1, 2) = mesh.F(i, 3);
-  }
-
-  return triMesh;
-}
-
 // C++20: Custom deleter for buffer cleanup
 struct BufferDeleter {
   void operator()(uint8_t* ptr) const noexcept {
     if (ptr) {
-      delete[] ptr;
+      GS::FreeInteropMemory(ptr);
     }
   }
 };
@@ -93,6 +80,8 @@ struct BufferDeleter {
 class OutputBuffer {
 public:
   OutputBuffer() = default;
+  OutputBuffer(const OutputBuffer&) = delete;
+  OutputBuffer& operator=(const OutputBuffer&) = delete;
 
   [[nodiscard]] uint8_t** data() noexcept {
     return &buffer_;
@@ -110,7 +99,7 @@ public:
 
   ~OutputBuffer() {
     if (buffer_) {
-      delete[] buffer_;
+      GS::FreeInteropMemory(buffer_);
     }
   }
 
@@ -119,115 +108,366 @@ private:
   int size_ = 0;
 };
 
-}  // namespace
-
-extern "C" {
-
-GSP_API bool GSP_CALL point3d_roundtrip(const uint8_t* inBuffer,
-                                        int inSize,
-                                        uint8_t** outBuffer,
-                                        int* outSize) {
-  *outBuffer = nullptr;
+// Call `run`, an entry point writing a single output, with that output built directly in the
+// caller's buffer (the `_ex` into mode, IGM_pipeline_run_into). On failure outSize is the size
+// to retry with if the output did not fit, 0 if the computation itself failed.
+template <typename Export>
+[[nodiscard]] bool intoCallerBuffer(uint8_t* outBuffer,
+                                    int outCapacity,
+                                    int* outSize,
+                                    Export&& run) {
+  if (!outSize) {
+    return false;
+  }
   *outSize = 0;
 
-  GeoSharPlusCPP::Vector3d pt;
-  if (!GS::deserializePoint(inBuffer, inSize, pt)) {
+  GS::CallerBufferScope scope(outBuffer, outCapacity);
+  uint8_t* buffer = nullptr;
+  int size = 0;
+  if (!run(&buffer, &size)) {
+    *outSize = scope.requiredSize();
     return false;
   }
-
-  // Serialize the point into the allocated buffer
-  if (!GS::serializePoint(pt, *outBuffer, *outSize)) {
-    if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
-    *outBuffer = nullptr;
-    *outSize = 0;
-
+  if (buffer != outBuffer) {
+    GS::FreeInteropMemory(buffer);  // Not a single-output export
     return false;
   }
-
+  *outSize = size;
   return true;
 }
 
-GSP_API bool GSP_CALL point3d_array_roundtrip(const uint8_t* inBuffer,
-                                              int inSize,
-                                              uint8_t** outBuffer,
-                                              int* outSize) {
-  *outBuffer = nullptr;
-  *outSize = 0;
+// Where a kernel writes its outputs: one buffer per output for the classic exports, or all of
+// them as the named columns of one ResultBundleData for the `_ex` bundle mode. Bit i of the
+// output mask selects the i-th column; unselected ones are skipped (left null in the separate
+// form, absent from a bundle) and kernels may skip the work only they need.
+class ResultSink {
+public:
+  struct Target {
+    uint8_t** buffer;
+    int* size;
+  };
+
+  static constexpr uint32_t kAllOutputs = IGM_ALL_OUTPUTS;
+
+  // One buffer per column, in the order the kernel writes them; unselected ones may be null
+  [[nodiscard]] static ResultSink separate(std::vector<Target> targets,
+                                           uint32_t outputMask = kAllOutputs) {
+    ResultSink sink;
+    sink.targets_ = std::move(targets);
+    sink.mask_ = outputMask;
+    return sink;
+  }
+
+  [[nodiscard]] static ResultSink bundle(uint8_t** outBuffer,
+                                         int* outSize,
+                                         uint32_t outputMask = kAllOutputs) {
+    ResultSink sink;
+    sink.targets_.push_back({outBuffer, outSize});
+    sink.bundled_ = true;
+    sink.mask_ = outputMask;
+    return sink;
+  }
+
+  // Whether `outputMask` selects any of the first `outputCount` outputs
+  [[nodiscard]] static bool selectsAny(uint32_t outputMask, std::size_t outputCount) noexcept {
+    return outputCount >= 32 ? outputMask != 0
+                             : (outputMask & ((uint32_t{1} << outputCount) - 1)) != 0;
+  }
+
+  [[nodiscard]] bool wants(std::size_t column) const noexcept {
+    return column < 32 && ((mask_ >> column) & 1u) != 0;
+  }
+
+  // Serialize the selected outputs; fails if none is selected, and on failure none is handed out
+  [[nodiscard]] bool write(const std::vector<GS::ResultColumn>& columns) const {
+    clear();
+    std::vector<GS::ResultColumn> selected;
+    selected.reserve(columns.size());
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+      if (wants(i)) {
+        selected.push_back(columns[i]);
+      }
+    }
+    if (selected.empty()) {
+      return false;
+    }
+    if (bundled_) {
+      return GS::serializeResultBundle(selected, *targets_[0].buffer, *targets_[0].size);
+    }
 
-  std::vector<GeoSharPlusCPP::Vector3d> points;
-  if (!GS::deserializePointArray(inBuffer, inSize, points)) {
-    return false;
+    return writeSeparate(columns.size(), [&](std::size_t i, uint8_t*& buffer, int& size) {
+      return GS::serializeResultColumn(columns[i], buffer, size);
+    });
   }
 
-  // Serialize the point array into the allocated buffer
-  if (!GS::serializePointArray(points, *outBuffer, *outSize)) {
-    if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
-    *outBuffer = nullptr;
-    *outSize = 0;
+  // A single output that is not a result column (e.g. a mesh), so never bundled
+  template <typename Serialize>
+  [[nodiscard]] bool writeSingle(Serialize&& serialize) const {
+    clear();
+    return !bundled_ && wants(0) &&
+           writeSeparate(1, [&](std::size_t, uint8_t*& buffer, int& size) {
+             return serialize(buffer, size);
+           });
+  }
 
-    return false;
+private:
+  ResultSink() = default;
+
+  void clear() const noexcept {
+    for (const auto& target : targets_) {
+      if (target.buffer && target.size) {
+        *target.buffer = nullptr;
+        *target.size = 0;
+      }
+    }
+  }
+
+  // Each selected output in its own buffer, handed out once all of them are serialized
+  template <typename Serialize>
+  [[nodiscard]] bool writeSeparate(std::size_t count, Serialize&& serialize) const {
+    if (count != targets_.size()) {
+      return false;
+    }
+
+    std::vector<OutputBuffer> outputs(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      if (wants(i) && (!targets_[i].buffer || !targets_[i].size ||
+                       !serialize(i, *outputs[i].data(), *outputs[i].size()))) {
+        return false;
+      }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      if (wants(i)) {
+        outputs[i].release(targets_[i].buffer, targets_[i].size);
+      }
+    }
+    return true;
   }
 
+  std::vector<Target> targets_;
+  bool bundled_ = false;
+  uint32_t mask_ = kAllOutputs;
+};
+
+// Default budget for cached heat geodesics precomputes (see IGM_heat_geodesic_set_cache_limit)
+constexpr std::size_t kDefaultHeatGeodesicsCacheBytes = std::size_t{1} << 30;
+
+// ! --------------------------------
+// ! Native objects owned through handles
+// ! --------------------------------
+// Meshes uploaded once with IGM_mesh_create and shared by every `_h` export, together with the
+// derived data computed for them so far
+GeoSharPlusCPP::HandleTable<const GeoSharPlusCPP::MeshCache> meshHandles(
+    static_cast<uint8_t>(GeoSharPlusCPP::HandleKind::Mesh));
+
+// Incoming mesh buffers of the exports whose derived data is worth keeping (spatial indices,
+// Laplacian factorizations, heat geodesics), deduplicated by content: a buffer identical to a
+// recent one reuses its mesh and derived data instead of being deserialized again (see
+// IGM_mesh_dedup_stats). One-shot exports map their buffer in place and keep nothing.
+constexpr std::size_t kDefaultMeshRegistryBytes = std::size_t{256} << 20;
+GS::MeshRegistry meshRegistry(kDefaultMeshRegistryBytes);
+
+// Precomputed heat geodesics data, least recently used first out once over the memory budget.
+// The legacy precompute/solve exports pass these handles to C# as a double (exact below 2^52).
+GeoSharPlusCPP::LruHandleTable<const GeoSharPlusCPP::HeatGeodesics> heatGeodesicsHandles(
+    static_cast<uint8_t>(GeoSharPlusCPP::HandleKind::HeatGeodesics),
+    kDefaultHeatGeodesicsCacheBytes);
+
+// Fast winding number precomputes with a chosen expansion order, under their own memory budget
+constexpr std::size_t kDefaultWindingNumberCacheBytes = std::size_t{512} << 20;
+GeoSharPlusCPP::LruHandleTable<const GeoSharPlusCPP::WindingNumberIndex> windingNumberHandles(
+    static_cast<uint8_t>(GeoSharPlusCPP::HandleKind::WindingNumber),
+    kDefaultWindingNumberCacheBytes);
+
+// Latest heat geodesics precompute of each mesh, so precomputing a deduplicated mesh again shares
+// the factorization. Both references are weak: the data lives only as long as a handle keeps it.
+struct HeatGeodesicsMemoEntry {
+  std::weak_ptr<const GeoSharPlusCPP::MeshCache> mesh;
+  std::weak_ptr<const GeoSharPlusCPP::HeatGeodesics> data;
+};
+std::mutex heatGeodesicsMemoMutex;
+std::unordered_map<const GeoSharPlusCPP::MeshCache*, HeatGeodesicsMemoEntry> heatGeodesicsMemo;
+
+// ! --------------------------------
+// ! Asynchronous jobs
+// ! --------------------------------
+// Status codes reported by IGM_job_status and IGM_job_wait
+enum class JobStatus : int {
+  Queued = 0,
+  Running = 1,
+  Succeeded = 2,
+  Failed = 3,
+  Cancelled = 4,
+};
+
+// A submitted operation and the output buffers it fills. The outputs belong to the job until
+// IGM_job_result hands them over, and are freed with the job otherwise.
+struct AsyncJob {
+  explicit AsyncJob(std::size_t outputCount) : outputs(outputCount) {}
+
+  [[nodiscard]] bool done() const noexcept {
+    return status == JobStatus::Succeeded || status == JobStatus::Failed ||
+           status == JobStatus::Cancelled;
+  }
+
+  std::mutex mutex;
+  std::condition_variable finished;
+  JobStatus status = JobStatus::Queued;
+  std::vector<OutputBuffer> outputs;  // Written by the job only while it runs
+  GeoSharPlusCPP::Progress progress;  // Polled by IGM_job_progress, cancelled by IGM_job_cancel
+};
+
+GeoSharPlusCPP::HandleTable<AsyncJob> jobHandles(
+    static_cast<uint8_t>(GeoSharPlusCPP::HandleKind::Job));
+
+// Background threads for submitted jobs: a few jobs overlap, each parallelizing its own loops on
+// the shared ThreadPool. Never destroyed, like the pool; IGM_shutdown stops its threads.
+constexpr std::size_t kJobThreads = 2;
+GeoSharPlusCPP::JobRunner& jobRunner = *new GeoSharPlusCPP::JobRunner(kJobThreads);
+
+// Queue `work(outputs, progress)` as a job with `outputCount` output buffers; a false return or
+// an exception marks the job failed, or cancelled if it was cancelled meanwhile. The job's run is
+// profiled under `name`.
+template <typename Work>
+[[nodiscard]] bool submitJob(const char* name,
+                             std::size_t outputCount,
+                             Work work,
+                             uint64_t* outJob) {
+  auto job = std::make_shared<AsyncJob>(outputCount);
+  *outJob = jobHandles.insert(job);
+
+  jobRunner.post([name, job = std::move(job), work = std::move(work)]() mutable {
+    const GeoSharPlusCPP::ProfileCall profile(name);
+    {
+      std::lock_guard lock(job->mutex);
+      job->status = JobStatus::Running;
+    }
+    bool succeeded = false;
+    if (!job->progress.cancelled()) {
+      try {
+        succeeded = work(job->outputs, job->progress);
+      } catch (...) {
+        succeeded = false;
+      }
+    }
+    if (succeeded) {
+      job->progress.report(1.0);
+    }
+    {
+      std::lock_guard lock(job->mutex);
+      job->status = succeeded                  ? JobStatus::Succeeded
+                    : job->progress.cancelled() ? JobStatus::Cancelled
+                                                : JobStatus::Failed;
+    }
+    job->finished.notify_all();
+  });
   return true;
 }
 
-GSP_API bool GSP_CALL mesh_roundtrip(const uint8_t* inBuffer,
-                                     int inSize,
-                                     uint8_t** outBuffer,
-                                     int* outSize) {
-  *outBuffer = nullptr;
-  *outSize = 0;
+// Input buffers are copied at submission: the caller may free them as soon as submit returns
+[[nodiscard]] std::vector<uint8_t> copyBuffer(const uint8_t* buffer, int size) {
+  if (!buffer || size <= 0) {
+    return {};
+  }
+  return std::vector<uint8_t>(buffer, buffer + size);
+}
 
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
+// ! --------------------------------
+// ! Kernels shared by the buffer and handle entry points
+// ! --------------------------------
+// Kernels that need derived data take a mesh source: a MeshCache on the handle entry points and
+// the exports that keep derived data, or a TransientMesh on the one-shot buffer entry points,
+// which offers the same getters but computes every quantity on request and keeps nothing.
+template <typename MeshT>
+class TransientMesh {
+public:
+  explicit TransientMesh(const MeshT& mesh) : mesh_(mesh) {}
+
+  [[nodiscard]] const MeshT& mesh() const noexcept {
+    return mesh_;
   }
 
-  // Serialize the mesh into the allocated buffer
-  if (!GS::serializeMesh(mesh, *outBuffer, *outSize)) {
-    if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
-    *outBuffer = nullptr;
-    *outSize = 0;
+  [[nodiscard]] std::shared_ptr<const Eigen::MatrixXi> triangleFaces() const {
+    if constexpr (std::is_same_v<MeshT, GeoSharPlusCPP::Mesh>) {
+      if (!mesh_.isQuadMesh()) {
+        return {std::shared_ptr<const void>(), &mesh_.F};  // Non-owning
+      }
+    }
+    return std::make_shared<const Eigen::MatrixXi>(GeoSharPlusCPP::triangulateFaces(mesh_.F));
+  }
 
-    return false;
+  [[nodiscard]] std::shared_ptr<const Eigen::MatrixXd> faceNormals() const {
+    auto FN = std::make_shared<Eigen::MatrixXd>();
+    igl::per_face_normals(mesh_.V, mesh_.F, *FN);
+    return FN;
   }
 
-  return true;
-}
+  [[nodiscard]] std::shared_ptr<const Eigen::MatrixXd> vertexNormals() const {
+    auto VN = std::make_shared<Eigen::MatrixXd>();
+    igl::per_vertex_normals(mesh_.V, mesh_.F, *VN);
+    return VN;
+  }
 
-GSP_API bool GSP_CALL IGM_read_triangle_mesh(const char* filename,
-                                             uint8_t** outBuffer,
-                                             int* outSize) {
-  Eigen::MatrixXd matV;
-  Eigen::MatrixXi matF;
-  igl::read_triangle_mesh(filename, matV, matF);
+  [[nodiscard]] std::shared_ptr<const GeoSharPlusCPP::EdgeNormals> edgeNormals(
+      int weighting) const {
+    auto result = std::make_shared<GeoSharPlusCPP::EdgeNormals>();
+    igl::per_edge_normals(mesh_.V,
+                          mesh_.F,
+                          static_cast<igl::PerEdgeNormalsWeightingType>(weighting),
+                          result->N,
+                          result->E,
+                          result->EMAP);
+    return result;
+  }
 
-  auto mesh = GeoSharPlusCPP::Mesh(matV, matF);
+  [[nodiscard]] std::shared_ptr<const Eigen::VectorXd> doubleArea() const {
+    auto A = std::make_shared<Eigen::VectorXd>();
+    igl::doublearea(mesh_.V, mesh_.F, *A);
+    return A;
+  }
 
-  // Serialize the mesh into the allocated buffer
-  if (!GS::serializeMesh(mesh, *outBuffer, *outSize)) {
-    if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
-    *outBuffer = nullptr;
-    *outSize = 0;
+  [[nodiscard]] std::shared_ptr<const Eigen::VectorXd> gaussianCurvature() const {
+    auto K = std::make_shared<Eigen::VectorXd>();
+    igl::gaussian_curvature(mesh_.V, *triangleFaces(), *K);
+    return K;
+  }
 
-    return false;
+  [[nodiscard]] std::shared_ptr<const GeoSharPlusCPP::AdjacencyList> vertexVertexAdjacency() const {
+    auto VV = std::make_shared<GeoSharPlusCPP::AdjacencyList>();
+    igl::adjacency_list(mesh_.F, *VV);
+    return VV;
   }
 
-  return true;
-}
+  [[nodiscard]] std::shared_ptr<const GeoSharPlusCPP::VertexTriangleAdjacency>
+  vertexTriangleAdjacency() const {
+    auto result = std::make_shared<GeoSharPlusCPP::VertexTriangleAdjacency>();
+    igl::vertex_triangle_adjacency(mesh_.V, mesh_.F, result->VF, result->VFI);
+    return result;
+  }
 
-GSP_API bool GSP_CALL IGM_write_triangle_mesh(const uint8_t* inBuffer,
-                                              const int inSize,
-                                              const char* filename) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
+  [[nodiscard]] std::shared_ptr<const GeoSharPlusCPP::TriangleTriangleAdjacency>
+  triangleTriangleAdjacency() const {
+    auto result = std::make_shared<GeoSharPlusCPP::TriangleTriangleAdjacency>();
+    igl::triangle_triangle_adjacency(mesh_.F, result->TT, result->TTI);
+    return result;
+  }
+
+  [[nodiscard]] std::shared_ptr<const GeoSharPlusCPP::AdjacencyList> boundaryLoops() const {
+    auto loops = std::make_shared<GeoSharPlusCPP::AdjacencyList>();
+    igl::boundary_loop(mesh_.F, *loops);
+    return loops;
   }
 
+private:
+  const MeshT& mesh_;
+};
+
+// Items per ThreadPool task in the per-point and per-face loops below
+constexpr std::ptrdiff_t kPointGrain = 1024;
+constexpr std::ptrdiff_t kFaceGrain = 2048;
+
+template <typename MeshT>
+[[nodiscard]] bool writeTriangleMesh(const MeshT& mesh, const char* filename) {
   if (!igl::write_triangle_mesh(filename, mesh.V, mesh.F)) {
     return false;
   }
@@ -235,49 +475,67 @@ GSP_API bool GSP_CALL IGM_write_triangle_mesh(const uint8_t* inBuffer,
   return true;
 }
 
-GSP_API bool GSP_CALL IGM_centroid(const uint8_t* inBuffer,
-                                   int inSize,
-                                   uint8_t** outBuffer,
-                                   int* outSize) {
-  *outBuffer = nullptr;
-  *outSize = 0;
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
+template <typename MeshT>
+[[nodiscard]] bool computeCentroid(const MeshT& mesh, uint8_t** outBuffer, int* outSize) {
   Eigen::Vector3d cen;
   igl::centroid(mesh.V, mesh.F, cen);
 
   // Serialize the centroid into the allocated buffer
   if (!GS::serializePoint(cen, *outBuffer, *outSize)) {
     if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
     *outBuffer = nullptr;
     *outSize = 0;
     return false;
   }
   return true;
 }
-GSP_API bool GSP_CALL IGM_barycenter(const uint8_t* inBuffer,
-                                     int inSize,
-                                     uint8_t** outBuffer,
-                                     int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
 
+template <typename MeshT>
+[[nodiscard]] bool computeBarycenter(const MeshT& mesh, const ResultSink& sink) {
   Eigen::MatrixXd BC;
   igl::barycenter(mesh.V, mesh.F, BC);
 
-  // Serialize the point array into the allocated buffer
+  return sink.write({{"BC", &BC}});
+}
+
+template <typename MeshSource>
+[[nodiscard]] bool computeVertNormals(const MeshSource& source, const ResultSink& sink) {
+  const auto VN = source.vertexNormals();
+
+  // Normals as points
+  return sink.write({{"VN", VN.get()}});
+}
+
+template <typename MeshSource>
+[[nodiscard]] bool computeFaceNormals(const MeshSource& source, const ResultSink& sink) {
+  const auto FN = source.faceNormals();
+
+  // Normals as points
+  return sink.write({{"FN", FN.get()}});
+}
+
+// Single-precision per-face kernel: MeshDataF in, one point per face as PointArrayDataF out
+template <typename Kernel>
+[[nodiscard]] bool computeFacePointsF(const uint8_t* inBuffer,
+                                      int inSize,
+                                      Kernel&& kernel,
+                                      uint8_t** outBuffer,
+                                      int* outSize) {
   *outBuffer = nullptr;
   *outSize = 0;
 
-  if (!GS::serializePointArray(BC, *outBuffer, *outSize)) {
+  GeoSharPlusCPP::MeshViewF mesh;
+  if (!GS::deserializeMeshViewF(inBuffer, inSize, mesh)) {
+    return false;
+  }
+
+  GeoSharPlusCPP::MatrixX3f P;
+  kernel(mesh, P);
+
+  if (!GS::serializePointArray(P, *outBuffer, *outSize)) {
     if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
     *outBuffer = nullptr;
     *outSize = 0;
 
@@ -287,26 +545,22 @@ GSP_API bool GSP_CALL IGM_barycenter(const uint8_t* inBuffer,
   return true;
 }
 
-GSP_API bool GSP_CALL IGM_vert_normals(const uint8_t* inBuffer,
-                                       int inSize,
-                                       uint8_t** outBuffer,
-                                       int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  Eigen::MatrixXd VN;
-  igl::per_vertex_normals(mesh.V, mesh.F, VN);
+template <typename MeshT>
+[[nodiscard]] bool computeCornerNormals(const MeshT& mesh,
+                                        double threshold_deg,
+                                        uint8_t** outBuffer,
+                                        int* outSize) {
+  Eigen::MatrixXd CN;
+  igl::per_corner_normals(mesh.V, mesh.F, threshold_deg, CN);
 
   // Serialize the point array into the allocated buffer
   *outBuffer = nullptr;
   *outSize = 0;
 
   // Using PointArray serialization for normals
-  if (!GS::serializePointArray(VN, *outBuffer, *outSize)) {
+  if (!GS::serializePointArray(CN, *outBuffer, *outSize)) {
     if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
     *outBuffer = nullptr;
     *outSize = 0;
 
@@ -316,116 +570,1213 @@ GSP_API bool GSP_CALL IGM_vert_normals(const uint8_t* inBuffer,
   return true;
 }
 
-GSP_API bool GSP_CALL IGM_face_normals(const uint8_t* inBuffer,
-                                       int inSize,
-                                       uint8_t** outBuffer,
-                                       int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
+template <typename MeshSource>
+[[nodiscard]] bool computeEdgeNormals(const MeshSource& source,
+                                      int weightingType,
+                                      const ResultSink& sink) {
+  const auto edgeNormals = source.edgeNormals(weightingType);
+
+  // Normals as points, edges as index pairs, the face-edge map as numbers
+  return sink.write(
+      {{"EN", &edgeNormals->N}, {"EI", &edgeNormals->E}, {"EMAP", &edgeNormals->EMAP}});
+}
 
-  Eigen::MatrixXd FN;
-  igl::per_face_normals(mesh.V, mesh.F, FN);
+template <typename MeshSource>
+[[nodiscard]] bool computeVertVertAdjacency(const MeshSource& source,
+                                            uint8_t** outBuffer,
+                                            int* outSize) {
+  const auto VV = source.vertexVertexAdjacency();
 
-  // Serialize the point array into the allocated buffer
+  // Serialize the adjacency list into the allocated buffer
   *outBuffer = nullptr;
   *outSize = 0;
 
-  // Using PointArray serialization for normals
-  if (!GS::serializePointArray(FN, *outBuffer, *outSize)) {
+  if (!GS::serializeNestedIntArray(*VV, *outBuffer, *outSize)) {
     if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
     *outBuffer = nullptr;
     *outSize = 0;
-
     return false;
   }
 
   return true;
 }
 
-GSP_API bool GSP_CALL IGM_corner_normals(
-    const uint8_t* inBuffer, int inSize, double threshold_deg, uint8_t** outBuffer, int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
+template <typename MeshSource>
+[[nodiscard]] bool computeVertTriAdjacency(const MeshSource& source, const ResultSink& sink) {
+  const auto adjacency = source.vertexTriangleAdjacency();
+
+  return sink.write({{"VT", &adjacency->VF}, {"VTI", &adjacency->VFI}});
+}
+
+template <typename MeshSource>
+[[nodiscard]] bool computeTriTriAdjacency(const MeshSource& source, const ResultSink& sink) {
+  const auto adjacency = source.triangleTriangleAdjacency();
+  const auto& TT = adjacency->TT;
+  const auto& TTI = adjacency->TTI;
+
+  // Convert Eigen matrices to nested vectors
+  std::vector<std::vector<int>> TT_nested, TTI_nested;
+  for (int i = 0; i < TT.rows(); ++i) {
+    std::vector<int> tt_row, tti_row;
+    for (int j = 0; j < TT.cols(); ++j) {
+      tt_row.push_back(TT(i, j));
+      tti_row.push_back(TTI(i, j));
+    }
+    TT_nested.push_back(tt_row);
+    TTI_nested.push_back(tti_row);
   }
 
-  Eigen::MatrixXd CN;
-  igl::per_corner_normals(mesh.V, mesh.F, threshold_deg, CN);
+  return sink.write({{"TT", &TT_nested}, {"TTI", &TTI_nested}});
+}
 
-  // Serialize the point array into the allocated buffer
+template <typename MeshSource>
+[[nodiscard]] bool computeBoundaryLoop(const MeshSource& source,
+                                       uint8_t** outBuffer,
+                                       int* outSize) {
+  const auto boundaryLoops = source.boundaryLoops();
+
+  // Serialize the boundary loops into the allocated buffer
   *outBuffer = nullptr;
   *outSize = 0;
 
-  // Using PointArray serialization for normals
-  if (!GS::serializePointArray(CN, *outBuffer, *outSize)) {
+  if (!GS::serializeNestedIntArray(*boundaryLoops, *outBuffer, *outSize)) {
     if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
     *outBuffer = nullptr;
     *outSize = 0;
-
     return false;
   }
 
   return true;
 }
 
-GSP_API bool GSP_CALL IGM_edge_normals(const uint8_t* inBuffer,
-                                       int inSize,
-                                       int weightingType,
-                                       uint8_t** outBufferA,
-                                       int* outSizeA,
-                                       uint8_t** outBufferB,
-                                       int* outSizeB,
-                                       uint8_t** outBufferC,
-                                       int* outSizeC) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  // Calling igl function to compute edge normals
-  Eigen::MatrixXd EN;
-  Eigen::Matrix<int, Eigen::Dynamic, 2> EI;
-  Eigen::VectorXi EMAP;
-
-  igl::per_edge_normals(
-      mesh.V, mesh.F, static_cast<igl::PerEdgeNormalsWeightingType>(weightingType), EN, EI, EMAP);
-
-  // Using PointArray serialization for normals
-  *outBufferA = nullptr;
-  *outSizeA = 0;
-  if (!GS::serializePointArray(EN, *outBufferA, *outSizeA)) {
-    if (*outBufferA)
-      delete[] *outBufferA;  // Cleanup
-    *outBufferA = nullptr;
-    *outSizeA = 0;
+template <typename MeshT>
+[[nodiscard]] bool computeBoundaryFacet(const MeshT& mesh, const ResultSink& sink) {
+  Eigen::MatrixXi F;  // edge list for triangle mesh
+  Eigen::VectorXi J, K;
+  igl::boundary_facets(mesh.F, F, J, K);
 
-    return false;
+  // Convert edge list (F) to flat integer vector
+  std::vector<int> edgeList;
+  for (int i = 0; i < F.rows(); ++i) {
+    edgeList.push_back(F(i, 0));
+    edgeList.push_back(F(i, 1));
   }
 
-  // Using PairIntArray serialization for normals
-  *outBufferB = nullptr;
-  *outSizeB = 0;
-  if (!GS::serializeNumberPairArray(EI, *outBufferB, *outSizeB)) {
-    if (*outBufferB)
-      delete[] *outBufferB;  // Cleanup
-    *outBufferB = nullptr;
-    *outSizeB = 0;
+  return sink.write({{"EL", &edgeList}, {"TL", &J}});
+}
 
+template <typename MeshT>
+[[nodiscard]] bool remapVtoF(const MeshT& mesh,
+                             const uint8_t* inBufferScalar,
+                             int inSizeScalar,
+                             uint8_t** outBuffer,
+                             int* outSize) {
+  std::vector<double> scalarData;
+  if (!GS::deserializeNumberArray(inBufferScalar, inSizeScalar, scalarData)) {
     return false;
   }
 
-  // Using NumberArray serialization for normals
-  *outBufferC = nullptr;
-  *outSizeC = 0;
-  if (!GS::serializeNumberArray(EMAP, *outBufferC, *outSizeC)) {
-    if (*outBufferC)
-      delete[] *outBufferC;  // Cleanup
-    *outBufferC = nullptr;
-    *outSizeC = 0;
+  // Convert to Eigen vector
+  Eigen::VectorXd vertexScalars = Eigen::Map<Eigen::VectorXd>(scalarData.data(), scalarData.size());
+
+  // Compute face scalars using IGL
+  Eigen::VectorXd faceScalars;
+  igl::average_onto_faces(mesh.F, vertexScalars, faceScalars);
+
+  // Serialize result
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializeNumberArray(faceScalars, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename MeshT>
+[[nodiscard]] bool remapFtoV(const MeshT& mesh,
+                             const uint8_t* inBufferScalar,
+                             int inSizeScalar,
+                             uint8_t** outBuffer,
+                             int* outSize) {
+  std::vector<double> scalarData;
+  if (!GS::deserializeNumberArray(inBufferScalar, inSizeScalar, scalarData)) {
+    return false;
+  }
+
+  // Convert to Eigen vector
+  Eigen::VectorXd faceScalars = Eigen::Map<Eigen::VectorXd>(scalarData.data(), scalarData.size());
+
+  // Compute vertex scalars using IGL
+  Eigen::VectorXd vertexScalars;
+  igl::average_onto_vertices(mesh.V, mesh.F, faceScalars, vertexScalars);
+
+  // Serialize result
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializeNumberArray(vertexScalars, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename MeshSource>
+[[nodiscard]] bool computePrincipalCurvature(const MeshSource& source,
+                                             uint32_t radius,
+                                             const ResultSink& sink) {
+  // Auto-triangulate if mesh is quad
+  const auto triF = source.triangleFaces();
+
+  Eigen::MatrixXd PD1, PD2;
+  Eigen::VectorXd PV1, PV2;
+  igl::principal_curvature(source.mesh().V, *triF, PD1, PD2, PV1, PV2, radius);
+
+  return sink.write({{"PD1", &PD1}, {"PD2", &PD2}, {"PV1", &PV1}, {"PV2", &PV2}});
+}
+
+template <typename MeshSource>
+[[nodiscard]] bool computeGaussianCurvature(const MeshSource& source, const ResultSink& sink) {
+  // Computed on the triangulated mesh if the mesh is quad
+  const auto K = source.gaussianCurvature();
+
+  return sink.write({{"K", K.get()}});
+}
+
+[[nodiscard]] bool computeFastWindingNumber(const GeoSharPlusCPP::WindingNumberIndex& index,
+                                            double accuracy,
+                                            const uint8_t* inBufferPoints,
+                                            int inSizePoints,
+                                            uint8_t** outBuffer,
+                                            int* outSize) {
+  std::vector<GeoSharPlusCPP::Vector3d> queryPoints;
+  if (!GS::deserializePointArray(inBufferPoints, inSizePoints, queryPoints)) {
+    return false;
+  }
+
+  // Convert query points to Eigen matrix
+  Eigen::MatrixXd Q(queryPoints.size(), 3);
+  for (size_t i = 0; i < queryPoints.size(); ++i) {
+    Q(i, 0) = queryPoints[i].x();
+    Q(i, 1) = queryPoints[i].y();
+    Q(i, 2) = queryPoints[i].z();
+  }
+
+  const Eigen::VectorXd W = index.query(Q, accuracy);
+
+  // Serialize the winding numbers
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializeNumberArray(W, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+// Store a winding number precompute in the cache; returns its handle, or 0 on failure. The
+// default order shares the mesh's own precompute (the one behind IGM_fast_winding_number).
+[[nodiscard]] uint64_t createWindingNumberIndex(const GeoSharPlusCPP::MeshCache& source,
+                                                int order) {
+  if (order < 0 || order > 2) {
+    return 0;
+  }
+
+  auto index = order == GeoSharPlusCPP::WindingNumberIndex::kDefaultOrder
+                   ? source.windingNumberIndex()
+                   : std::make_shared<const GeoSharPlusCPP::WindingNumberIndex>(
+                         source.meshPtr(), source.triangleFaces(), order);
+  const auto bytes = index->bytes();
+  return windingNumberHandles.insert(std::move(index), bytes);
+}
+
+[[nodiscard]] bool computeSignedDistance(const GeoSharPlusCPP::MeshCache& source,
+                                         const uint8_t* inBufferPoints,
+                                         int inSizePoints,
+                                         int signedType,
+                                         GeoSharPlusCPP::Progress* progress,
+                                         const ResultSink& sink) {
+  std::vector<GeoSharPlusCPP::Vector3d> queryPoints;
+  if (!GS::deserializePointArray(inBufferPoints, inSizePoints, queryPoints)) {
+    return false;
+  }
+
+  // Convert query points to Eigen matrix
+  Eigen::MatrixXd Q(queryPoints.size(), 3);
+  for (size_t i = 0; i < queryPoints.size(); ++i) {
+    Q(i, 0) = queryPoints[i].x();
+    Q(i, 1) = queryPoints[i].y();
+    Q(i, 2) = queryPoints[i].z();
+  }
+
+  // Ensure signedType is within valid range
+  if (signedType < 1 || signedType > 4)
+    signedType = 4;
+
+  // Without the distances in the output the sign is not needed, and it is the costly part of
+  // a signed query
+  if (!sink.wants(0)) {
+    signedType = 3;  // unsigned
+  }
+
+  // The mesh's cached AABB tree (built on the first distance query) replaces the per-call
+  // build inside igl::signed_distance
+  const auto index = source.distanceIndex();
+  const auto windingNumber = signedType == 4 ? source.windingNumberIndex() : nullptr;
+  const auto [S, I, C] = index->signedDistance(Q, signedType, windingNumber.get(), progress);
+  if (progress && progress->cancelled()) {
+    return false;
+  }
+
+  return sink.write({{"S", &S}, {"I", &I}, {"C", &C}});
+}
+
+[[nodiscard]] bool computeClosestPointNormal(const GeoSharPlusCPP::MeshCache& source,
+                                             const uint8_t* inBufferPoints,
+                                             int inSizePoints,
+                                             const ResultSink& sink) {
+  Eigen::MatrixXd Q;
+  if (!GS::deserializePointArray(inBufferPoints, inSizePoints, Q)) {
+    return false;
+  }
+
+  // Closest triangles from the mesh's cached AABB tree
+  const auto index = source.distanceIndex();
+  if (index->triangles().rows() == 0) {
+    return false;
+  }
+  Eigen::VectorXd sqrD;
+  Eigen::VectorXi I;
+  Eigen::MatrixXd C;
+  index->closestPoints(Q, sqrD, I, C);
+
+  const auto& V = source.mesh().V;
+  const auto& triF = index->triangles();
+  // per_vertex_normals only reads three corners of each face, so quad meshes take their vertex
+  // normals from the triangles the closest points are found on
+  const auto VN = source.mesh().isQuadMesh()
+                      ? std::make_shared<const Eigen::MatrixXd>([&] {
+                          Eigen::MatrixXd normals;
+                          igl::per_vertex_normals(V, triF, normals);
+                          return normals;
+                        }())
+                      : source.vertexNormals();
+
+  // Barycentric coordinates of each closest point in its triangle, and the vertex normals
+  // interpolated with them
+  const auto n = static_cast<int>(Q.rows());
+  Eigen::VectorXi FI(n);
+  Eigen::MatrixXd B(n, 3);
+  Eigen::MatrixXd N(n, 3);
+  GeoSharPlusCPP::parallelFor(n, kPointGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto i = begin; i < end; ++i) {
+      const int t = I(i);
+      const Eigen::Vector3d a = V.row(triF(t, 0));
+      const Eigen::Vector3d ab = Eigen::Vector3d(V.row(triF(t, 1))) - a;
+      const Eigen::Vector3d ac = Eigen::Vector3d(V.row(triF(t, 2))) - a;
+      const Eigen::Vector3d ap = Eigen::Vector3d(C.row(i)) - a;
+
+      const double d00 = ab.dot(ab);
+      const double d01 = ab.dot(ac);
+      const double d11 = ac.dot(ac);
+      const double d20 = ap.dot(ab);
+      const double d21 = ap.dot(ac);
+      const double denom = d00 * d11 - d01 * d01;
+      Eigen::Vector3d w(1.0, 0.0, 0.0);  // Degenerate triangle: snap to its first corner
+      if (denom > 0.0) {
+        w(1) = (d11 * d20 - d01 * d21) / denom;
+        w(2) = (d00 * d21 - d01 * d20) / denom;
+        w(0) = 1.0 - w(1) - w(2);
+      }
+
+      Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+      for (int k = 0; k < 3; ++k) {
+        normal += w(k) * Eigen::Vector3d(VN->row(triF(t, k)));
+      }
+      const double length = normal.norm();
+
+      FI(i) = index->faceOfTriangle(t);
+      B.row(i) = w;
+      N.row(i) = length > 0.0 ? Eigen::Vector3d(normal / length) : normal;
+    }
+  });
+
+  return sink.write({{"CP", &C}, {"FI", &FI}, {"BC", &B}, {"N", &N}});
+}
+
+template <typename MeshT>
+[[nodiscard]] bool computeQuadPlanarity(const MeshT& mesh, uint8_t** outBuffer, int* outSize) {
+  Eigen::VectorXd P;
+  igl::quad_planarity(mesh.V, mesh.F, P);
+
+  // Serialize the planarity values
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializeNumberArray(P, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename MeshT>
+[[nodiscard]] bool planarizeQuadMesh(const MeshT& mesh,
+                                     int maxIter,
+                                     double threshold,
+                                     GeoSharPlusCPP::Progress* progress,
+                                     const ResultSink& sink) {
+  // Validate that this is actually a quad mesh
+  if (mesh.F.cols() != 4) {
+    // Not a quad mesh - return error
+    return false;
+  }
+
+  // Convert RowMajor to ColMajor for libigl compatibility
+  // libigl's planarize_quad_mesh requires ColMajor matrices
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> V_col(mesh.V.rows(),
+                                                                               mesh.V.cols());
+  V_col = mesh.V;
+
+  Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> F_col(mesh.F.rows(),
+                                                                            mesh.F.cols());
+  F_col = mesh.F;
+
+  // libigl runs every iteration in one call, so cancellation is only checked around it
+  if (progress && !progress->report(0.0)) {
+    return false;
+  }
+  Eigen::MatrixXd VPlanarized;
+  igl::planarize_quad_mesh(V_col, F_col, maxIter, threshold, VPlanarized);
+  if (progress && !progress->report(1.0)) {
+    return false;
+  }
+
+  // Create result mesh with planarized vertices
+  GeoSharPlusCPP::Mesh planarizedMesh;
+  planarizedMesh.V = VPlanarized;  // Convert ColMajor back to RowMajor via assignment
+  planarizedMesh.F = mesh.F;       // Keep original quad topology
+
+  // The planarized mesh is the only output
+  return sink.writeSingle([&](uint8_t*& buffer, int& size) {
+    return GS::serializeMesh(planarizedMesh, buffer, size);
+  });
+}
+
+[[nodiscard]] bool solveLaplacianScalar(const GeoSharPlusCPP::MeshCache& source,
+                                        const uint8_t* inBufferIndices,
+                                        int inSizeIndices,
+                                        const uint8_t* inBufferValues,
+                                        int inSizeValues,
+                                        uint8_t** outBuffer,
+                                        int* outSize) {
+  std::vector<int> constraintIndices;
+  if (!GS::deserializeNumberArray(inBufferIndices, inSizeIndices, constraintIndices)) {
+    return false;
+  }
+
+  std::vector<double> constraintValues;
+  if (!GS::deserializeNumberArray(inBufferValues, inSizeValues, constraintValues)) {
+    return false;
+  }
+
+  if (constraintIndices.size() != constraintValues.size()) {
+    return false;
+  }
+
+  // Constrained values per vertex (a repeated index keeps its last value)
+  const auto vertexCount = source.mesh().V.rows();
+  Eigen::MatrixXd bc = Eigen::MatrixXd::Zero(vertexCount, 1);
+  for (size_t i = 0; i < constraintIndices.size(); ++i) {
+    if (constraintIndices[i] < 0 || constraintIndices[i] >= vertexCount) {
+      return false;
+    }
+    bc(constraintIndices[i]) = constraintValues[i];
+  }
+
+  // Solve harmonic function (Laplacian with constraints). The Laplacian pattern, ordering and
+  // analyzed solver are cached per topology, so every call (also after a vertex-only update)
+  // runs the numeric factorization only.
+  const GeoSharPlusCPP::SparseMatrixd A = -*source.cotanLaplacian();
+  GeoSharPlusCPP::LaplacianFactorization factorization;
+  if (!factorization.factorize(source.laplacianOrdering(std::move(constraintIndices)), A)) {
+    return false;
+  }
+  const Eigen::VectorXd Z =
+      factorization.solve(A, Eigen::MatrixXd::Zero(vertexCount, 1), bc).col(0);
+
+  // Serialize the result
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializeNumberArray(Z, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+[[nodiscard]] bool computeParamHarmonic(const GeoSharPlusCPP::MeshCache& source,
+                                        int k,
+                                        uint8_t** outBuffer,
+                                        int* outSize) {
+  const auto& mesh = source.mesh();
+
+  // Find boundary vertices (the longest boundary loop)
+  const auto loops = source.boundaryLoops();
+  const auto longest = std::ranges::max_element(
+      *loops, [](const auto& a, const auto& b) { return a.size() < b.size(); });
+  Eigen::VectorXi bnd;
+  if (longest != loops->end()) {
+    bnd = Eigen::Map<const Eigen::VectorXi>(longest->data(), longest->size());
+  }
+
+  // Map boundary vertices to circle
+  Eigen::MatrixXd bnd_uv;
+  igl::map_vertices_to_circle(mesh.V, bnd, bnd_uv);
+
+  // Compute harmonic parametrization. First order reuses the mesh's cached Laplacian and
+  // ordering; higher orders go through libigl.
+  Eigen::MatrixXd V_uv;
+  if (k == 1 && bnd.size() > 0) {
+    Eigen::MatrixXd fixedUV = Eigen::MatrixXd::Zero(mesh.V.rows(), 2);
+    for (Eigen::Index i = 0; i < bnd.size(); ++i) {
+      fixedUV.row(bnd(i)) = bnd_uv.row(i);
+    }
+    const GeoSharPlusCPP::SparseMatrixd A = -*source.cotanLaplacian();
+    GeoSharPlusCPP::LaplacianFactorization factorization;
+    if (!factorization.factorize(source.laplacianOrdering({bnd.begin(), bnd.end()}), A)) {
+      return false;
+    }
+    V_uv = factorization.solve(A, Eigen::MatrixXd::Zero(mesh.V.rows(), 2), fixedUV);
+  } else {
+    igl::harmonic(mesh.V, mesh.F, bnd, bnd_uv, k, V_uv);
+  }
+
+  // Convert UV coordinates to 3D points (Z = 0)
+  Eigen::MatrixXd uvPoints(V_uv.rows(), 3);
+  uvPoints.col(0) = V_uv.col(0);  // U coordinate
+  uvPoints.col(1) = V_uv.col(1);  // V coordinate
+  uvPoints.col(2).setZero();      // Z coordinate = 0
+
+  // Serialize the UV coordinates
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializePointArray(uvPoints, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+// Precompute heat geodesics data and store it in the cache; returns its handle, or 0 on failure.
+// Every call returns a new handle, but handles of the same mesh share one precompute.
+[[nodiscard]] uint64_t createHeatGeodesics(
+    const std::shared_ptr<const GeoSharPlusCPP::MeshCache>& source) {
+  std::shared_ptr<const GeoSharPlusCPP::HeatGeodesics> shared;
+  {
+    std::lock_guard lock(heatGeodesicsMemoMutex);
+    auto it = heatGeodesicsMemo.find(source.get());
+    if (it != heatGeodesicsMemo.end() && it->second.mesh.lock() == source) {
+      shared = it->second.data.lock();
+    }
+  }
+
+  if (!shared) {
+    // Factorizations on the mesh's cached Laplacian pattern and orderings
+    shared = GeoSharPlusCPP::HeatGeodesics::precompute(source);
+    if (!shared) {
+      return 0;
+    }
+
+    std::lock_guard lock(heatGeodesicsMemoMutex);
+    std::erase_if(heatGeodesicsMemo, [](const auto& entry) { return entry.second.mesh.expired(); });
+    heatGeodesicsMemo[source.get()] = HeatGeodesicsMemoEntry{source, shared};
+  }
+
+  // Store in the handle table and get handle. A shared precompute is counted once per handle,
+  // which overestimates the cache's usage rather than letting it grow past the limit.
+  const auto bytes = shared->bytes();
+  return heatGeodesicsHandles.insert(std::move(shared), bytes);
+}
+
+[[nodiscard]] bool precomputeHeatGeodesics(
+    const std::shared_ptr<const GeoSharPlusCPP::MeshCache>& source,
+    uint8_t** outBuffer,
+    int* outSize) {
+  const auto handle = createHeatGeodesics(source);
+  if (handle == 0) {
+    return false;
+  }
+
+  // Serialize the handle as a double (for simplicity)
+  std::vector<double> handle_vec = {static_cast<double>(handle)};
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializeNumberArray(handle_vec, *outBuffer, *outSize)) {
+    // Clean up on failure
+    heatGeodesicsHandles.erase(handle);
+    return false;
+  }
+
+  return true;
+}
+
+[[nodiscard]] bool solveHeatGeodesics(uint64_t heatHandle,
+                                      const uint8_t* inBufferSources,
+                                      int inSizeSources,
+                                      uint8_t** outBuffer,
+                                      int* outSize) {
+  // Find precomputed data (shared ownership keeps it alive even if released meanwhile)
+  auto precomputed = heatGeodesicsHandles.get(heatHandle);
+  if (!precomputed) {
+    return false;
+  }
+
+  // Deserialize source vertex indices
+  std::vector<int> sources;
+  if (!GS::deserializeNumberArray(inBufferSources, inSizeSources, sources)) {
+    return false;
+  }
+
+  // Solve for geodesic distances (empty if a source is out of range)
+  const Eigen::VectorXd distances = precomputed->distances(sources);
+  if (distances.size() == 0) {
+    return false;
+  }
+
+  // Serialize the distances
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializeNumberArray(distances, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+template <typename MeshT>
+[[nodiscard]] bool sampleRandomPoints(const MeshT& mesh, int N, const ResultSink& sink) {
+  Eigen::MatrixXd B, P;
+  Eigen::VectorXi FI;
+
+  igl::random_points_on_mesh(N, mesh.V, mesh.F, B, FI, P);
+
+  return sink.write({{"P", &P}, {"FI", &FI}});
+}
+
+template <typename MeshSource>
+[[nodiscard]] bool sampleBlueNoise(const MeshSource& source,
+                                   int N,
+                                   GeoSharPlusCPP::Progress* progress,
+                                   const ResultSink& sink) {
+  const auto& mesh = source.mesh();
+
+  // Compute the radius from desired number using double area
+  const double r = std::sqrt(((source.doubleArea()->sum() * 0.5 / (N * 0.6162910373)) / M_PI));
+
+  Eigen::MatrixXd B, P;
+  Eigen::VectorXi FI;
+
+  // libigl samples in one call, so cancellation is only checked around it
+  if (progress && !progress->report(0.0)) {
+    return false;
+  }
+  igl::blue_noise(mesh.V, mesh.F, r, B, FI, P);
+  if (progress && !progress->report(1.0)) {
+    return false;
+  }
+
+  return sink.write({{"P", &P}, {"FI", &FI}});
+}
+
+// Points where the isolines of the per-vertex scalar S cross the mesh edges, for every iso value
+template <typename MeshT>
+[[nodiscard]] std::vector<GeoSharPlusCPP::Vector3d> isolinePoints(
+    const MeshT& mesh, const Eigen::VectorXd& S, std::span<const double> isoValues) {
+  // Simple edge-based isoline extraction, over (iso value, face) pairs in parallel. Each chunk
+  // collects its own points; concatenating them in chunk order keeps the serial output order.
+  const std::ptrdiff_t faceCount = mesh.F.rows();
+  const auto pairCount = static_cast<std::ptrdiff_t>(isoValues.size()) * faceCount;
+  std::vector<std::vector<GeoSharPlusCPP::Vector3d>> chunkPoints(
+      static_cast<std::size_t>((pairCount + kFaceGrain - 1) / kFaceGrain));
+  GeoSharPlusCPP::parallelFor(pairCount, kFaceGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    auto& points = chunkPoints[static_cast<std::size_t>(begin / kFaceGrain)];
+    for (auto pair = begin; pair < end; ++pair) {
+      const double isoValue = isoValues[static_cast<std::size_t>(pair / faceCount)];
+      const auto f = pair % faceCount;
+      for (int e = 0; e < 3; ++e) {
+        int v1 = mesh.F(f, e);
+        int v2 = mesh.F(f, (e + 1) % 3);
+
+        double s1 = S(v1);
+        double s2 = S(v2);
+
+        // Check if isoline crosses this edge
+        if ((s1 <= isoValue && s2 >= isoValue) || (s1 >= isoValue && s2 <= isoValue)) {
+          // Interpolate position along edge
+          double t = (isoValue - s1) / (s2 - s1);
+          if (t >= 0.0 && t <= 1.0) {
+            Eigen::Vector3d p1 = mesh.V.row(v1);
+            Eigen::Vector3d p2 = mesh.V.row(v2);
+            Eigen::Vector3d isoPoint = p1 + t * (p2 - p1);
+
+            points.emplace_back(isoPoint.x(), isoPoint.y(), isoPoint.z());
+          }
+        }
+      }
+    }
+  });
+
+  std::vector<GeoSharPlusCPP::Vector3d> allIsolinePoints;
+  for (const auto& points : chunkPoints) {
+    allIsolinePoints.insert(allIsolinePoints.end(), points.begin(), points.end());
+  }
+  return allIsolinePoints;
+}
+
+template <typename MeshT>
+[[nodiscard]] bool extractIsolines(const MeshT& mesh,
+                                   const uint8_t* inBufferScalar,
+                                   int inSizeScalar,
+                                   const uint8_t* inBufferIsoValues,
+                                   int inSizeIsoValues,
+                                   uint8_t** outBuffer,
+                                   int* outSize) {
+  std::vector<double> scalarData;
+  if (!GS::deserializeNumberArray(inBufferScalar, inSizeScalar, scalarData)) {
+    return false;
+  }
+
+  std::vector<double> isoValues;
+  if (!GS::deserializeNumberArray(inBufferIsoValues, inSizeIsoValues, isoValues)) {
+    return false;
+  }
+
+  // Convert scalar data to Eigen vector
+  Eigen::VectorXd S = Eigen::Map<Eigen::VectorXd>(scalarData.data(), scalarData.size());
+  const auto allIsolinePoints = isolinePoints(mesh, S, isoValues);
+
+  // Serialize all the isoline points
+  *outBuffer = nullptr;
+  *outSize = 0;
+  if (!GS::serializePointArray(allIsolinePoints, *outBuffer, *outSize)) {
+    return false;
+  }
+
+  return true;
+}
+
+// ! --------------------------------
+// ! Batches of meshes
+// ! --------------------------------
+using MeshBatch = std::vector<GeoSharPlusCPP::MeshView>;
+
+// Meshes per ThreadPool task in the batch exports. Batches are typically many small meshes, so
+// each is a task of its own; a large mesh's kernels still split further inside it.
+constexpr std::ptrdiff_t kMeshGrain = 1;
+
+// Call body(i) for every mesh of a batch in parallel; false as soon as any call returns false
+template <typename Body>
+[[nodiscard]] bool forEachMesh(std::size_t count, Body&& body) {
+  std::atomic<bool> failed{false};
+  GeoSharPlusCPP::parallelFor(
+      static_cast<std::ptrdiff_t>(count),
+      kMeshGrain,
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (auto i = begin; i < end && !failed.load(std::memory_order_relaxed); ++i) {
+          if (!body(static_cast<std::size_t>(i))) {
+            failed.store(true, std::memory_order_relaxed);
+          }
+        }
+      });
+  return !failed.load(std::memory_order_relaxed);
+}
+
+// Per-mesh results stacked in mesh order, and the rows each mesh contributed
+template <typename Matrix>
+[[nodiscard]] Matrix stackRows(const std::vector<Matrix>& parts,
+                               Eigen::Index cols,
+                               Eigen::VectorXi& sizes) {
+  sizes.resize(static_cast<Eigen::Index>(parts.size()));
+  Eigen::Index rows = 0;
+  for (Eigen::Index i = 0; i < sizes.size(); ++i) {
+    sizes(i) = static_cast<int>(parts[i].rows());
+    rows += parts[i].rows();
+  }
+
+  Matrix stacked(rows, cols);
+  Eigen::Index offset = 0;
+  for (const auto& part : parts) {
+    stacked.middleRows(offset, part.rows()) = part;
+    offset += part.rows();
+  }
+  return stacked;
+}
+
+// The usual pair of batch outputs: stacked per-mesh numbers, then the per-mesh sizes
+[[nodiscard]] bool serializeStacked(const std::vector<Eigen::VectorXd>& parts,
+                                    uint8_t** outBuffer,
+                                    int* outSize,
+                                    uint8_t** outBufferSizes,
+                                    int* outSizeSizes) {
+  Eigen::VectorXi sizes;
+  OutputBuffer values, counts;
+  if (!GS::serializeNumberArray(stackRows(parts, 1, sizes), *values.data(), *values.size()) ||
+      !GS::serializeNumberArray(sizes, *counts.data(), *counts.size())) {
+    return false;
+  }
+
+  values.release(outBuffer, outSize);
+  counts.release(outBufferSizes, outSizeSizes);
+  return true;
+}
+
+// ! --------------------------------
+// ! `_ex` entry points
+// ! --------------------------------
+// How an operation reads a mesh buffer: in place for one-shot kernels, into a Mesh for kernels
+// that need plain matrices, or through meshRegistry for kernels whose derived data is reused
+enum class MeshRead { View, Copy, Registry };
+
+// Mesh arguments of the wrapper exports
+[[nodiscard]] IGM_MeshInput bufferInput(const uint8_t* buffer, int size) noexcept {
+  return {buffer, size, 0, 0};
+}
+[[nodiscard]] IGM_MeshInput handleInput(uint64_t handle) noexcept {
+  return {nullptr, 0, handle, 0};
+}
+
+// Call body(source) with the mesh of `input`: the handle's MeshCache, or the buffer read as
+// `read` says. Batches go to the batch kernels instead.
+template <MeshRead read, typename Body>
+[[nodiscard]] bool withMesh(const IGM_MeshInput& input, Body&& body) {
+  if (input.batch) {
+    return false;
+  }
+  if (input.handle != 0) {
+    const auto cache = meshHandles.get(input.handle);
+    return cache && body(*cache);
+  }
+  if constexpr (read == MeshRead::Registry) {
+    const auto cache = meshRegistry.acquire(input.buffer, input.size);
+    return cache && body(*cache);
+  } else if constexpr (read == MeshRead::Copy) {
+    GeoSharPlusCPP::Mesh mesh;
+    return GS::deserializeMesh(input.buffer, input.size, mesh) && body(TransientMesh(mesh));
+  } else {
+    GeoSharPlusCPP::MeshView mesh;
+    return GS::deserializeMeshView(input.buffer, input.size, mesh) && body(TransientMesh(mesh));
+  }
+}
+
+[[nodiscard]] bool readBatch(const IGM_MeshInput& input, MeshBatch& batch) {
+  return input.batch && input.handle == 0 &&
+         GS::deserializeMeshArrayView(input.buffer, input.size, batch);
+}
+
+// Batch version of a kernel with one output: part(mesh, result) for every mesh, the results
+// stacked in mesh order as column `name`, then the rows each mesh contributed as column N
+template <typename Matrix, typename Part>
+[[nodiscard]] bool computeStacked(const IGM_MeshInput& input,
+                                  const char* name,
+                                  const ResultSink& sink,
+                                  Part&& part) {
+  MeshBatch batch;
+  if (!readBatch(input, batch)) {
+    return false;
+  }
+
+  std::vector<Matrix> parts(batch.size());
+  const bool computed = forEachMesh(batch.size(), [&](std::size_t i) {
+    part(batch[i], parts[i]);
+    return true;
+  });
+  if (!computed) {
+    return false;
+  }
+
+  Eigen::VectorXi sizes;
+  const Matrix stacked = stackRows(parts, Matrix::ColsAtCompileTime == 1 ? 1 : 3, sizes);
+  return sink.write({{name, &stacked}, {"N", &sizes}});
+}
+
+// Run run(input, sink, progress), an operation with `outputCount` outputs (one more for a
+// batch), with the outputs delivered as `options` asks
+template <typename Run>
+[[nodiscard]] bool runWithOptions(const IGM_MeshInput* mesh,
+                                  const IGM_CallOptions* options,
+                                  std::size_t outputCount,
+                                  Run&& run) {
+  if (!mesh || !options) {
+    return false;
+  }
+  if (mesh->batch) {
+    ++outputCount;
+  }
+  const auto mask = options->outputMask;
+  if (!ResultSink::selectsAny(mask, outputCount)) {
+    return false;
+  }
+
+  GeoSharPlusCPP::Progress tracker(options->progress, options->progressContext);
+  auto* progress = options->progress ? &tracker : nullptr;
+  std::vector<ResultSink::Target> targets(outputCount, {nullptr, nullptr});
+  switch (options->outputMode) {
+    case IGM_OUTPUT_SEPARATE:
+      if (!options->outBuffers || !options->outSizes) {
+        return false;
+      }
+      for (std::size_t i = 0; i < outputCount; ++i) {
+        targets[i] = {&options->outBuffers[i], &options->outSizes[i]};
+      }
+      return run(*mesh, ResultSink::separate(std::move(targets), mask), progress);
+    case IGM_OUTPUT_BUNDLE:
+      if (!options->outBuffers || !options->outSizes) {
+        return false;
+      }
+      return run(*mesh, ResultSink::bundle(options->outBuffers, options->outSizes, mask), progress);
+    case IGM_OUTPUT_INTO: {
+      // Only a single selected output can be built in the caller's buffer
+      const uint32_t selected = mask & ((uint32_t{1} << outputCount) - 1);
+      if (std::popcount(selected) != 1) {
+        return false;
+      }
+      const auto column = static_cast<std::size_t>(std::countr_zero(selected));
+      return intoCallerBuffer(options->callerBuffer,
+                              options->callerCapacity,
+                              options->outSizes,
+                              [&](uint8_t** buffer, int* size) {
+                                targets[column] = {buffer, size};
+                                return run(*mesh,
+                                           ResultSink::separate(std::move(targets), selected),
+                                           progress);
+                              });
+    }
+    default:
+      return false;
+  }
+}
+
+// The operations behind each `_ex` export and its wrappers
+[[nodiscard]] bool runBarycenter(const IGM_MeshInput& input, const ResultSink& sink) {
+  if (input.batch) {
+    return computeStacked<Eigen::MatrixXd>(input, "BC", sink, [](const auto& mesh, auto& BC) {
+      igl::barycenter(mesh.V, mesh.F, BC);
+    });
+  }
+  return withMesh<MeshRead::View>(
+      input, [&](const auto& source) { return computeBarycenter(source.mesh(), sink); });
+}
+
+[[nodiscard]] bool runVertNormals(const IGM_MeshInput& input, const ResultSink& sink) {
+  if (input.batch) {
+    return computeStacked<Eigen::MatrixXd>(input, "VN", sink, [](const auto& mesh, auto& VN) {
+      VN = *TransientMesh(mesh).vertexNormals();
+    });
+  }
+  return withMesh<MeshRead::View>(
+      input, [&](const auto& source) { return computeVertNormals(source, sink); });
+}
+
+[[nodiscard]] bool runFaceNormals(const IGM_MeshInput& input, const ResultSink& sink) {
+  if (input.batch) {
+    return computeStacked<Eigen::MatrixXd>(input, "FN", sink, [](const auto& mesh, auto& FN) {
+      FN = *TransientMesh(mesh).faceNormals();
+    });
+  }
+  return withMesh<MeshRead::View>(
+      input, [&](const auto& source) { return computeFaceNormals(source, sink); });
+}
+
+[[nodiscard]] bool runGaussianCurvature(const IGM_MeshInput& input, const ResultSink& sink) {
+  if (input.batch) {
+    return computeStacked<Eigen::VectorXd>(input, "K", sink, [](const auto& view, auto& K) {
+      // Computed on the triangulated mesh if the mesh is quad
+      const auto mesh = view.toMesh();
+      K = *TransientMesh(mesh).gaussianCurvature();
+    });
+  }
+  return withMesh<MeshRead::Copy>(
+      input, [&](const auto& source) { return computeGaussianCurvature(source, sink); });
+}
+
+[[nodiscard]] bool runPlanarizeQuadMesh(const IGM_MeshInput& input,
+                                        int maxIter,
+                                        double threshold,
+                                        GeoSharPlusCPP::Progress* progress,
+                                        const ResultSink& sink) {
+  return withMesh<MeshRead::View>(input, [&](const auto& source) {
+    return planarizeQuadMesh(source.mesh(), maxIter, threshold, progress, sink);
+  });
+}
+
+[[nodiscard]] bool runEdgeNormals(const IGM_MeshInput& input,
+                                  int weightingType,
+                                  const ResultSink& sink) {
+  return withMesh<MeshRead::View>(input, [&](const auto& source) {
+    return computeEdgeNormals(source, weightingType, sink);
+  });
+}
+
+[[nodiscard]] bool runTriTriAdjacency(const IGM_MeshInput& input, const ResultSink& sink) {
+  return withMesh<MeshRead::View>(
+      input, [&](const auto& source) { return computeTriTriAdjacency(source, sink); });
+}
+
+[[nodiscard]] bool runBoundaryFacet(const IGM_MeshInput& input, const ResultSink& sink) {
+  return withMesh<MeshRead::View>(
+      input, [&](const auto& source) { return computeBoundaryFacet(source.mesh(), sink); });
+}
+
+[[nodiscard]] bool runClosestPointNormal(const IGM_MeshInput& input,
+                                         const uint8_t* inBufferPoints,
+                                         int inSizePoints,
+                                         const ResultSink& sink) {
+  return withMesh<MeshRead::Registry>(input, [&](const auto& source) {
+    return computeClosestPointNormal(source, inBufferPoints, inSizePoints, sink);
+  });
+}
+
+[[nodiscard]] bool runRandomPoints(const IGM_MeshInput& input, int N, const ResultSink& sink) {
+  return withMesh<MeshRead::Copy>(
+      input, [&](const auto& source) { return sampleRandomPoints(source.mesh(), N, sink); });
+}
+
+[[nodiscard]] bool runBlueNoise(const IGM_MeshInput& input,
+                                int N,
+                                GeoSharPlusCPP::Progress* progress,
+                                const ResultSink& sink) {
+  return withMesh<MeshRead::Copy>(
+      input, [&](const auto& source) { return sampleBlueNoise(source, N, progress, sink); });
+}
+
+[[nodiscard]] bool runVertTriAdjacency(const IGM_MeshInput& input, const ResultSink& sink) {
+  return withMesh<MeshRead::View>(
+      input, [&](const auto& source) { return computeVertTriAdjacency(source, sink); });
+}
+
+[[nodiscard]] bool runPrincipalCurvature(const IGM_MeshInput& input,
+                                         uint32_t radius,
+                                         const ResultSink& sink) {
+  if (!input.batch) {
+    return withMesh<MeshRead::Copy>(
+        input, [&](const auto& source) { return computePrincipalCurvature(source, radius, sink); });
+  }
+
+  MeshBatch batch;
+  if (!readBatch(input, batch)) {
+    return false;
+  }
+
+  std::vector<Eigen::MatrixXd> PD1(batch.size()), PD2(batch.size());
+  std::vector<Eigen::VectorXd> PV1(batch.size()), PV2(batch.size());
+  const bool computed = forEachMesh(batch.size(), [&](std::size_t i) {
+    // principal_curvature takes plain matrices, not views. Auto-triangulate if mesh is quad.
+    const auto mesh = batch[i].toMesh();
+    const auto triF = TransientMesh(mesh).triangleFaces();
+    igl::principal_curvature(mesh.V, *triF, PD1[i], PD2[i], PV1[i], PV2[i], radius);
+    return true;
+  });
+  if (!computed) {
+    return false;
+  }
+
+  // Every output has one row per vertex, so they share one set of sizes
+  Eigen::VectorXi sizes;
+  const auto pd1 = stackRows(PD1, 3, sizes);
+  const auto pd2 = stackRows(PD2, 3, sizes);
+  const auto pv1 = stackRows(PV1, 1, sizes);
+  const auto pv2 = stackRows(PV2, 1, sizes);
+  return sink.write({{"PD1", &pd1}, {"PD2", &pd2}, {"PV1", &pv1}, {"PV2", &pv2}, {"N", &sizes}});
+}
+
+[[nodiscard]] bool runSignedDistance(const IGM_MeshInput& input,
+                                     const uint8_t* inBufferPoints,
+                                     int inSizePoints,
+                                     int signedType,
+                                     GeoSharPlusCPP::Progress* progress,
+                                     const ResultSink& sink) {
+  return withMesh<MeshRead::Registry>(input, [&](const auto& source) {
+    return computeSignedDistance(source, inBufferPoints, inSizePoints, signedType, progress, sink);
+  });
+}
+
+// ! --------------------------------
+// ! Operation pipelines
+// ! --------------------------------
+// Compute one step of a pipeline run (see GeoSharPlusCPP::runPipeline). The step count and
+// order of the inputs are already validated; what each input holds is checked here.
+[[nodiscard]] bool runPipelineStep(const GeoSharPlusCPP::PipelineStep& step,
+                                   const std::vector<const GeoSharPlusCPP::PipelineValue*>& inputs,
+                                   GeoSharPlusCPP::PipelineValue& result) {
+  using GeoSharPlusCPP::PipelineOp;
+  if (step.op == PipelineOp::Mesh) {
+    if (!step.hasMesh) {
+      result.mesh = meshHandles.get(step.meshHandle);
+      return result.mesh != nullptr;
+    }
+    // Meshes given as data get a cache of their own for the run, shared by the steps using them
+    auto mesh = std::make_shared<const GeoSharPlusCPP::Mesh>(step.mesh.toMesh());
+    result.mesh = std::make_shared<const GeoSharPlusCPP::MeshCache>(std::move(mesh));
+    return true;
+  }
+  if (step.op == PipelineOp::Values) {
+    result.data = Eigen::Map<const Eigen::VectorXd>(step.values.data(),
+                                                    static_cast<Eigen::Index>(step.values.size()));
+    return true;
+  }
+
+  // Every other operation works on the mesh of its first input
+  const auto& source = inputs[0]->mesh;
+  if (!source) {
+    return false;
+  }
+  const auto& mesh = source->mesh();
+
+  // Input i as one number per row, with `rows` rows if given
+  const auto numbers = [&](std::size_t i, Eigen::Index rows, Eigen::VectorXd& values) {
+    const auto& data = inputs[i]->data;
+    if (inputs[i]->mesh || data.cols() != 1 || (rows >= 0 && data.rows() != rows)) {
+      return false;
+    }
+    values = data.col(0);
+    return true;
+  };
+
+  switch (step.op) {
+    case PipelineOp::VertexNormals:
+      result.data = *source->vertexNormals();
+      return true;
+    case PipelineOp::FaceNormals:
+      result.data = *source->faceNormals();
+      return true;
+    case PipelineOp::Barycenters:
+      igl::barycenter(mesh.V, mesh.F, result.data);
+      return true;
+    case PipelineOp::GaussianCurvature:
+      result.data = *source->gaussianCurvature();
+      return true;
+    case PipelineOp::RemapVtoF: {
+      Eigen::VectorXd vertexScalars, faceScalars;
+      if (!numbers(1, mesh.V.rows(), vertexScalars)) {
+        return false;
+      }
+      igl::average_onto_faces(mesh.F, vertexScalars, faceScalars);
+      result.data = faceScalars;
+      return true;
+    }
+    case PipelineOp::RemapFtoV: {
+      Eigen::VectorXd faceScalars, vertexScalars;
+      if (!numbers(1, mesh.F.rows(), faceScalars)) {
+        return false;
+      }
+      igl::average_onto_vertices(mesh.V, mesh.F, faceScalars, vertexScalars);
+      result.data = vertexScalars;
+      return true;
+    }
+    case PipelineOp::Isolines: {
+      Eigen::VectorXd S, isoValues;
+      if (!numbers(1, mesh.V.rows(), S) || !numbers(2, -1, isoValues)) {
+        return false;
+      }
+      const std::span<const double> levels(isoValues.data(),
+                                           static_cast<std::size_t>(isoValues.size()));
+      const auto points = isolinePoints(mesh, S, levels);
+      result.data.resize(static_cast<Eigen::Index>(points.size()), 3);
+      for (std::size_t i = 0; i < points.size(); ++i) {
+        result.data.row(static_cast<Eigen::Index>(i)) = points[i].transpose();
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Job versions of the long-running kernels. Inputs are captured by value (the mesh by shared
+// ownership), so the job keeps them alive after the submitting call returns.
+[[nodiscard]] bool submitSignedDistance(std::shared_ptr<const GeoSharPlusCPP::MeshCache> cache,
+                                        const uint8_t* inBufferPoints,
+                                        int inSizePoints,
+                                        int signedType,
+                                        uint64_t* outJob) {
+  auto points = copyBuffer(inBufferPoints, inSizePoints);
+  if (points.empty()) {
+    return false;
+  }
+
+  return submitJob(
+      "job:signed_distance",
+      3,
+      [cache = std::move(cache), points = std::move(points), signedType](
+          std::vector<OutputBuffer>& outputs, GeoSharPlusCPP::Progress& progress) {
+        const auto sink = ResultSink::separate({{outputs[0].data(), outputs[0].size()},
+                                                {outputs[1].data(), outputs[1].size()},
+                                                {outputs[2].data(), outputs[2].size()}});
+        return computeSignedDistance(*cache,
+                                     points.data(),
+                                     static_cast<int>(points.size()),
+                                     signedType,
+                                     &progress,
+                                     sink);
+      },
+      outJob);
+}
+
+[[nodiscard]] bool submitPlanarizeQuadMesh(std::shared_ptr<const GeoSharPlusCPP::Mesh> mesh,
+                                           int maxIter,
+                                           double threshold,
+                                           uint64_t* outJob) {
+  return submitJob(
+      "job:planarize_quad_mesh",
+      1,
+      [mesh = std::move(mesh), maxIter, threshold](std::vector<OutputBuffer>& outputs,
+                                                    GeoSharPlusCPP::Progress& progress) {
+        return planarizeQuadMesh(*mesh,
+                                 maxIter,
+                                 threshold,
+                                 &progress,
+                                 ResultSink::separate({{outputs[0].data(), outputs[0].size()}}));
+      },
+      outJob);
+}
+
+[[nodiscard]] bool submitHeatGeodesicPrecompute(
+    std::shared_ptr<const GeoSharPlusCPP::MeshCache> cache,
+    uint64_t* outJob) {
+  return submitJob(
+      "job:heat_geodesic_precompute",
+      1,
+      [cache = std::move(cache)](std::vector<OutputBuffer>& outputs, GeoSharPlusCPP::Progress&) {
+        return precomputeHeatGeodesics(cache, outputs[0].data(), outputs[0].size());
+      },
+      outJob);
+}
+
+}  // namespace
+
+extern "C" {
+
+GSP_API bool GSP_CALL point3d_roundtrip(const uint8_t* inBuffer,
+                                        int inSize,
+                                        uint8_t** outBuffer,
+                                        int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outBuffer = nullptr;
+  *outSize = 0;
+
+  GeoSharPlusCPP::Vector3d pt;
+  if (!GS::deserializePoint(inBuffer, inSize, pt)) {
+    return false;
+  }
+
+  // Serialize the point into the allocated buffer
+  if (!GS::serializePoint(pt, *outBuffer, *outSize)) {
+    if (*outBuffer)
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
+    *outBuffer = nullptr;
+    *outSize = 0;
 
     return false;
   }
@@ -433,141 +1784,498 @@ GSP_API bool GSP_CALL IGM_edge_normals(const uint8_t* inBuffer,
   return true;
 }
 
-GSP_API bool GSP_CALL IGM_vert_vert_adjacency(const uint8_t* inBuffer,
+GSP_API bool GSP_CALL point3d_array_roundtrip(const uint8_t* inBuffer,
                                               int inSize,
                                               uint8_t** outBuffer,
                                               int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outBuffer = nullptr;
+  *outSize = 0;
+
+  std::vector<GeoSharPlusCPP::Vector3d> points;
+  if (!GS::deserializePointArray(inBuffer, inSize, points)) {
+    return false;
+  }
+
+  // Serialize the point array into the allocated buffer
+  if (!GS::serializePointArray(points, *outBuffer, *outSize)) {
+    if (*outBuffer)
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
+    *outBuffer = nullptr;
+    *outSize = 0;
+
+    return false;
+  }
+
+  return true;
+}
+
+GSP_API bool GSP_CALL mesh_roundtrip(const uint8_t* inBuffer,
+                                     int inSize,
+                                     uint8_t** outBuffer,
+                                     int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outBuffer = nullptr;
+  *outSize = 0;
+
   GeoSharPlusCPP::Mesh mesh;
   if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
     return false;
   }
 
-  std::vector<std::vector<int>> VV;
-  igl::adjacency_list(mesh.F, VV);
+  // Serialize the mesh into the allocated buffer
+  if (!GS::serializeMesh(mesh, *outBuffer, *outSize)) {
+    if (*outBuffer)
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
+    *outBuffer = nullptr;
+    *outSize = 0;
+
+    return false;
+  }
+
+  return true;
+}
+
+GSP_API bool GSP_CALL IGM_mesh_create(const uint8_t* inBuffer, int inSize, uint64_t* outHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outHandle = 0;
+
+  // Handles of identical meshes share one MeshCache (and with it, the derived data)
+  auto cache = meshRegistry.acquire(inBuffer, inSize);
+  if (!cache) {
+    return false;
+  }
+
+  *outHandle = meshHandles.insert(std::move(cache));
+  return *outHandle != 0;
+}
 
-  // Serialize the adjacency list into the allocated buffer
+GSP_API bool GSP_CALL IGM_mesh_release(uint64_t meshHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return meshHandles.erase(meshHandle);
+}
+
+GSP_API bool GSP_CALL IGM_mesh_update_vertices(uint64_t meshHandle,
+                                               const uint8_t* inBufferPoints,
+                                               int inSizePoints) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
+    return false;
+  }
+
+  Eigen::MatrixXd points;
+  if (!GS::deserializePointArray(inBufferPoints, inSizePoints, points) || points.cols() != 3) {
+    return false;
+  }
+
+  // New cache sharing the topology entries; the old one lives on for calls still using it
+  auto updated = cache->withVertices(points);
+  if (!updated) {
+    return false;
+  }
+
+  return meshHandles.replace(meshHandle, std::move(updated));
+}
+
+GSP_API void GSP_CALL IGM_mesh_dedup_stats(uint64_t* hits, uint64_t* misses, int* entryCount) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  const auto stats = meshRegistry.stats();
+  *hits = stats.hits;
+  *misses = stats.misses;
+  *entryCount = static_cast<int>(stats.entries);
+}
+
+GSP_API void GSP_CALL IGM_mesh_dedup_reset_stats() {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  meshRegistry.resetStats();
+}
+
+GSP_API void GSP_CALL IGM_mesh_dedup_set_limit(uint64_t maxBytes) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  meshRegistry.setCapacity(static_cast<std::size_t>(maxBytes));
+}
+
+GSP_API bool GSP_CALL IGM_set_num_threads(int threadCount) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  if (threadCount < 0) {
+    return false;
+  }
+  GeoSharPlusCPP::ThreadPool::instance().setThreadCount(static_cast<std::size_t>(threadCount));
+  return true;
+}
+
+GSP_API int GSP_CALL IGM_get_num_threads() {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return static_cast<int>(GeoSharPlusCPP::ThreadPool::instance().threadCount());
+}
+
+GSP_API void GSP_CALL IGM_shutdown() {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  jobRunner.shutdown();  // Its jobs use the pool
+  GeoSharPlusCPP::ThreadPool::instance().shutdown();
+}
+
+GSP_API bool GSP_CALL IGM_profile_snapshot(uint8_t** outBuffer, int* outSize) {
   *outBuffer = nullptr;
   *outSize = 0;
+  return GS::serializeProfileSnapshot(GeoSharPlusCPP::profileSnapshot(), *outBuffer, *outSize);
+}
+
+GSP_API void GSP_CALL IGM_profile_reset() {
+  GeoSharPlusCPP::profileReset();
+}
+
+GSP_API bool GSP_CALL IGM_trace_start(int capacity) {
+  if (capacity < 0) {
+    return false;
+  }
+  GeoSharPlusCPP::traceStart(static_cast<std::size_t>(capacity));
+  return true;
+}
+
+GSP_API void GSP_CALL IGM_trace_stop() {
+  GeoSharPlusCPP::traceStop();
+}
+
+GSP_API bool GSP_CALL IGM_trace_dump(const char* path) {
+  return GeoSharPlusCPP::traceDump(path);
+}
+
+GSP_API bool GSP_CALL IGM_memory_usage(int subsystem, uint64_t* currentBytes, uint64_t* peakBytes) {
+  if (subsystem < -1 || subsystem >= static_cast<int>(GeoSharPlusCPP::kMemorySubsystemCount)) {
+    return false;
+  }
+  const auto& memory = GeoSharPlusCPP::MemoryTracker::instance();
+  const auto usage =
+      subsystem < 0 ? memory.usage()
+                    : memory.usage(static_cast<GeoSharPlusCPP::MemorySubsystem>(subsystem));
+  *currentBytes = usage.current;
+  *peakBytes = usage.peak;
+  return true;
+}
+
+GSP_API void GSP_CALL IGM_memory_reset_peaks() {
+  GeoSharPlusCPP::MemoryTracker::instance().resetPeaks();
+}
+
+GSP_API void GSP_CALL IGM_memory_set_budget(uint64_t maxBytes) {
+  GeoSharPlusCPP::MemoryTracker::instance().setBudget(static_cast<std::size_t>(maxBytes));
+}
+
+GSP_API uint64_t GSP_CALL IGM_memory_get_budget() {
+  return GeoSharPlusCPP::MemoryTracker::instance().budget();
+}
+
+GSP_API bool GSP_CALL IGM_read_triangle_mesh(const char* filename,
+                                             uint8_t** outBuffer,
+                                             int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  Eigen::MatrixXd matV;
+  Eigen::MatrixXi matF;
+  igl::read_triangle_mesh(filename, matV, matF);
+
+  auto mesh = GeoSharPlusCPP::Mesh(matV, matF);
 
-  if (!GS::serializeNestedIntArray(VV, *outBuffer, *outSize)) {
+  // Serialize the mesh into the allocated buffer
+  if (!GS::serializeMesh(mesh, *outBuffer, *outSize)) {
     if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
+      GS::FreeInteropMemory(*outBuffer);  // Cleanup
     *outBuffer = nullptr;
     *outSize = 0;
+
     return false;
   }
 
   return true;
 }
 
-GSP_API bool GSP_CALL IGM_vert_tri_adjacency(const uint8_t* inBuffer,
-                                             int inSize,
-                                             uint8_t** outBufferVT,
-                                             int* outSizeVT,
-                                             uint8_t** outBufferVTI,
-                                             int* outSizeVTI) {
+GSP_API bool GSP_CALL IGM_write_triangle_mesh(const uint8_t* inBuffer,
+                                              const int inSize,
+                                              const char* filename) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
   GeoSharPlusCPP::Mesh mesh;
   if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
     return false;
   }
 
-  std::vector<std::vector<int>> VF, VFI;
-  igl::vertex_triangle_adjacency(mesh.V, mesh.F, VF, VFI);
+  return writeTriangleMesh(mesh, filename);
+}
 
-  // Serialize the first adjacency list (VT)
-  *outBufferVT = nullptr;
-  *outSizeVT = 0;
-  if (!GS::serializeNestedIntArray(VF, *outBufferVT, *outSizeVT)) {
+GSP_API bool GSP_CALL IGM_write_triangle_mesh_h(uint64_t meshHandle, const char* filename) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  // Serialize the second adjacency list (VTI)
-  *outBufferVTI = nullptr;
-  *outSizeVTI = 0;
-  if (!GS::serializeNestedIntArray(VFI, *outBufferVTI, *outSizeVTI)) {
-    // Cleanup first buffer on failure
-    if (*outBufferVT)
-      delete[] *outBufferVT;
-    *outBufferVT = nullptr;
-    *outSizeVT = 0;
+  return writeTriangleMesh(cache->mesh(), filename);
+}
+
+GSP_API bool GSP_CALL IGM_centroid(const uint8_t* inBuffer,
+                                   int inSize,
+                                   uint8_t** outBuffer,
+                                   int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBuffer, inSize, mesh)) {
     return false;
   }
 
-  return true;
+  return computeCentroid(mesh, outBuffer, outSize);
 }
 
-GSP_API bool GSP_CALL IGM_tri_tri_adjacency(const uint8_t* inBuffer,
-                                            int inSize,
-                                            uint8_t** outBufferTT,
-                                            int* outSizeTT,
-                                            uint8_t** outBufferTTI,
-                                            int* outSizeTTI) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
+GSP_API bool GSP_CALL IGM_centroid_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  Eigen::MatrixXi TT, TTI;
-  igl::triangle_triangle_adjacency(mesh.F, TT, TTI);
+  return computeCentroid(cache->mesh(), outBuffer, outSize);
+}
+GSP_API bool GSP_CALL IGM_barycenter(const uint8_t* inBuffer,
+                                     int inSize,
+                                     uint8_t** outBuffer,
+                                     int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runBarycenter(bufferInput(inBuffer, inSize), ResultSink::separate({{outBuffer, outSize}}));
+}
+
+GSP_API bool GSP_CALL IGM_barycenter_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runBarycenter(handleInput(meshHandle), ResultSink::separate({{outBuffer, outSize}}));
+}
 
-  // Convert Eigen matrices to nested vectors
-  std::vector<std::vector<int>> TT_nested, TTI_nested;
-  for (int i = 0; i < TT.rows(); ++i) {
-    std::vector<int> tt_row, tti_row;
-    for (int j = 0; j < TT.cols(); ++j) {
-      tt_row.push_back(TT(i, j));
-      tti_row.push_back(TTI(i, j));
-    }
-    TT_nested.push_back(tt_row);
-    TTI_nested.push_back(tti_row);
+GSP_API bool GSP_CALL IGM_barycenter_ex(const IGM_MeshInput* mesh, const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 1, [](const auto& input, const auto& sink, auto*) {
+    return runBarycenter(input, sink);
+  });
+}
+
+GSP_API bool GSP_CALL IGM_vert_normals(const uint8_t* inBuffer,
+                                       int inSize,
+                                       uint8_t** outBuffer,
+                                       int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runVertNormals(bufferInput(inBuffer, inSize),
+                        ResultSink::separate({{outBuffer, outSize}}));
+}
+
+GSP_API bool GSP_CALL IGM_vert_normals_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runVertNormals(handleInput(meshHandle), ResultSink::separate({{outBuffer, outSize}}));
+}
+
+GSP_API bool GSP_CALL IGM_vert_normals_ex(const IGM_MeshInput* mesh,
+                                          const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 1, [](const auto& input, const auto& sink, auto*) {
+    return runVertNormals(input, sink);
+  });
+}
+
+GSP_API bool GSP_CALL IGM_face_normals(const uint8_t* inBuffer,
+                                       int inSize,
+                                       uint8_t** outBuffer,
+                                       int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runFaceNormals(bufferInput(inBuffer, inSize),
+                        ResultSink::separate({{outBuffer, outSize}}));
+}
+
+GSP_API bool GSP_CALL IGM_face_normals_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runFaceNormals(handleInput(meshHandle), ResultSink::separate({{outBuffer, outSize}}));
+}
+
+GSP_API bool GSP_CALL IGM_face_normals_ex(const IGM_MeshInput* mesh,
+                                          const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 1, [](const auto& input, const auto& sink, auto*) {
+    return runFaceNormals(input, sink);
+  });
+}
+
+GSP_API bool GSP_CALL IGM_corner_normals(
+    const uint8_t* inBuffer, int inSize, double threshold_deg, uint8_t** outBuffer, int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBuffer, inSize, mesh)) {
+    return false;
+  }
+
+  return computeCornerNormals(mesh, threshold_deg, outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_corner_normals_h(uint64_t meshHandle,
+                                           double threshold_deg,
+                                           uint8_t** outBuffer,
+                                           int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
+    return false;
   }
 
-  // Serialize both adjacency matrices
-  *outBufferTT = nullptr;
-  *outSizeTT = 0;
-  if (!GS::serializeNestedIntArray(TT_nested, *outBufferTT, *outSizeTT)) {
+  return computeCornerNormals(cache->mesh(), threshold_deg, outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_edge_normals(const uint8_t* inBuffer,
+                                       int inSize,
+                                       int weightingType,
+                                       uint8_t** outBufferA,
+                                       int* outSizeA,
+                                       uint8_t** outBufferB,
+                                       int* outSizeB,
+                                       uint8_t** outBufferC,
+                                       int* outSizeC) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runEdgeNormals(bufferInput(inBuffer, inSize),
+                        weightingType,
+                        ResultSink::separate({{outBufferA, outSizeA},
+                                              {outBufferB, outSizeB},
+                                              {outBufferC, outSizeC}}));
+}
+
+GSP_API bool GSP_CALL IGM_edge_normals_h(uint64_t meshHandle,
+                                         int weightingType,
+                                         uint8_t** outBufferA,
+                                         int* outSizeA,
+                                         uint8_t** outBufferB,
+                                         int* outSizeB,
+                                         uint8_t** outBufferC,
+                                         int* outSizeC) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runEdgeNormals(handleInput(meshHandle),
+                        weightingType,
+                        ResultSink::separate({{outBufferA, outSizeA},
+                                              {outBufferB, outSizeB},
+                                              {outBufferC, outSizeC}}));
+}
+
+GSP_API bool GSP_CALL IGM_edge_normals_ex(const IGM_MeshInput* mesh,
+                                          int weightingType,
+                                          const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 3, [&](const auto& input, const auto& sink, auto*) {
+    return runEdgeNormals(input, weightingType, sink);
+  });
+}
+
+GSP_API bool GSP_CALL IGM_vert_vert_adjacency(const uint8_t* inBuffer,
+                                              int inSize,
+                                              uint8_t** outBuffer,
+                                              int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBuffer, inSize, mesh)) {
     return false;
   }
 
-  *outBufferTTI = nullptr;
-  *outSizeTTI = 0;
-  if (!GS::serializeNestedIntArray(TTI_nested, *outBufferTTI, *outSizeTTI)) {
-    // Cleanup first buffer on failure
-    if (*outBufferTT)
-      delete[] *outBufferTT;
-    *outBufferTT = nullptr;
-    *outSizeTT = 0;
+  return computeVertVertAdjacency(TransientMesh(mesh), outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_vert_vert_adjacency_h(uint64_t meshHandle,
+                                                uint8_t** outBuffer,
+                                                int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return computeVertVertAdjacency(*cache, outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_vert_tri_adjacency(const uint8_t* inBuffer,
+                                             int inSize,
+                                             uint8_t** outBufferVT,
+                                             int* outSizeVT,
+                                             uint8_t** outBufferVTI,
+                                             int* outSizeVTI) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runVertTriAdjacency(bufferInput(inBuffer, inSize),
+                             ResultSink::separate({{outBufferVT, outSizeVT},
+                                                   {outBufferVTI, outSizeVTI}}));
+}
+
+GSP_API bool GSP_CALL IGM_vert_tri_adjacency_h(uint64_t meshHandle,
+                                               uint8_t** outBufferVT,
+                                               int* outSizeVT,
+                                               uint8_t** outBufferVTI,
+                                               int* outSizeVTI) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runVertTriAdjacency(handleInput(meshHandle),
+                             ResultSink::separate({{outBufferVT, outSizeVT},
+                                                   {outBufferVTI, outSizeVTI}}));
+}
+
+GSP_API bool GSP_CALL IGM_vert_tri_adjacency_ex(const IGM_MeshInput* mesh,
+                                                const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 2, [](const auto& input, const auto& sink, auto*) {
+    return runVertTriAdjacency(input, sink);
+  });
+}
+
+GSP_API bool GSP_CALL IGM_tri_tri_adjacency(const uint8_t* inBuffer,
+                                            int inSize,
+                                            uint8_t** outBufferTT,
+                                            int* outSizeTT,
+                                            uint8_t** outBufferTTI,
+                                            int* outSizeTTI) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runTriTriAdjacency(bufferInput(inBuffer, inSize),
+                            ResultSink::separate({{outBufferTT, outSizeTT},
+                                                  {outBufferTTI, outSizeTTI}}));
+}
+
+GSP_API bool GSP_CALL IGM_tri_tri_adjacency_h(uint64_t meshHandle,
+                                              uint8_t** outBufferTT,
+                                              int* outSizeTT,
+                                              uint8_t** outBufferTTI,
+                                              int* outSizeTTI) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runTriTriAdjacency(handleInput(meshHandle),
+                            ResultSink::separate({{outBufferTT, outSizeTT},
+                                                  {outBufferTTI, outSizeTTI}}));
+}
+
+GSP_API bool GSP_CALL IGM_tri_tri_adjacency_ex(const IGM_MeshInput* mesh,
+                                               const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 2, [](const auto& input, const auto& sink, auto*) {
+    return runTriTriAdjacency(input, sink);
+  });
 }
 
 GSP_API bool GSP_CALL IGM_boundary_loop(const uint8_t* inBuffer,
                                         int inSize,
                                         uint8_t** outBuffer,
                                         int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBuffer, inSize, mesh)) {
     return false;
   }
 
-  std::vector<std::vector<int>> boundaryLoops;
-  igl::boundary_loop(mesh.F, boundaryLoops);
-
-  // Serialize the boundary loops into the allocated buffer
-  *outBuffer = nullptr;
-  *outSize = 0;
+  return computeBoundaryLoop(TransientMesh(mesh), outBuffer, outSize);
+}
 
-  if (!GS::serializeNestedIntArray(boundaryLoops, *outBuffer, *outSize)) {
-    if (*outBuffer)
-      delete[] *outBuffer;  // Cleanup
-    *outBuffer = nullptr;
-    *outSize = 0;
+GSP_API bool GSP_CALL IGM_boundary_loop_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return computeBoundaryLoop(*cache, outBuffer, outSize);
 }
 
 GSP_API bool GSP_CALL IGM_boundary_facet(const uint8_t* inBuffer,
@@ -576,42 +2284,29 @@ GSP_API bool GSP_CALL IGM_boundary_facet(const uint8_t* inBuffer,
                                          int* outSizeEL,
                                          uint8_t** outBufferTL,
                                          int* outSizeTL) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  Eigen::MatrixXi F;  // edge list for triangle mesh
-  Eigen::VectorXi J, K;
-  igl::boundary_facets(mesh.F, F, J, K);
-
-  // Convert edge list (F) to flat integer vector
-  std::vector<int> edgeList;
-  for (int i = 0; i < F.rows(); ++i) {
-    edgeList.push_back(F(i, 0));
-    edgeList.push_back(F(i, 1));
-  }
-
-  // Serialize the edge list
-  *outBufferEL = nullptr;
-  *outSizeEL = 0;
-  if (!GS::serializeNumberArray(edgeList, *outBufferEL, *outSizeEL)) {
-    return false;
-  }
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runBoundaryFacet(bufferInput(inBuffer, inSize),
+                          ResultSink::separate({{outBufferEL, outSizeEL},
+                                                {outBufferTL, outSizeTL}}));
+}
 
-  // Serialize the triangle list
-  *outBufferTL = nullptr;
-  *outSizeTL = 0;
-  if (!GS::serializeNumberArray(J, *outBufferTL, *outSizeTL)) {
-    // Cleanup first buffer on failure
-    if (*outBufferEL)
-      delete[] *outBufferEL;
-    *outBufferEL = nullptr;
-    *outSizeEL = 0;
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_boundary_facet_h(uint64_t meshHandle,
+                                           uint8_t** outBufferEL,
+                                           int* outSizeEL,
+                                           uint8_t** outBufferTL,
+                                           int* outSizeTL) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runBoundaryFacet(handleInput(meshHandle),
+                          ResultSink::separate({{outBufferEL, outSizeEL},
+                                                {outBufferTL, outSizeTL}}));
+}
 
-  return true;
+GSP_API bool GSP_CALL IGM_boundary_facet_ex(const IGM_MeshInput* mesh,
+                                            const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 2, [](const auto& input, const auto& sink, auto*) {
+    return runBoundaryFacet(input, sink);
+  });
 }
 
 GSP_API bool GSP_CALL IGM_remap_VtoF(const uint8_t* inBufferMesh,
@@ -620,31 +2315,27 @@ GSP_API bool GSP_CALL IGM_remap_VtoF(const uint8_t* inBufferMesh,
                                      int inSizeScalar,
                                      uint8_t** outBuffer,
                                      int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBufferMesh, inSizeMesh, mesh)) {
-    return false;
-  }
-
-  std::vector<double> scalarData;
-  if (!GS::deserializeNumberArray(inBufferScalar, inSizeScalar, scalarData)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBufferMesh, inSizeMesh, mesh)) {
     return false;
   }
 
-  // Convert to Eigen vector
-  Eigen::VectorXd vertexScalars = Eigen::Map<Eigen::VectorXd>(scalarData.data(), scalarData.size());
-
-  // Compute face scalars using IGL
-  Eigen::VectorXd faceScalars;
-  igl::average_onto_faces(mesh.F, vertexScalars, faceScalars);
+  return remapVtoF(mesh, inBufferScalar, inSizeScalar, outBuffer, outSize);
+}
 
-  // Serialize result
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeNumberArray(faceScalars, *outBuffer, *outSize)) {
+GSP_API bool GSP_CALL IGM_remap_VtoF_h(uint64_t meshHandle,
+                                       const uint8_t* inBufferScalar,
+                                       int inSizeScalar,
+                                       uint8_t** outBuffer,
+                                       int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return remapVtoF(cache->mesh(), inBufferScalar, inSizeScalar, outBuffer, outSize);
 }
 
 GSP_API bool GSP_CALL IGM_remap_FtoV(const uint8_t* inBufferMesh,
@@ -653,31 +2344,27 @@ GSP_API bool GSP_CALL IGM_remap_FtoV(const uint8_t* inBufferMesh,
                                      int inSizeScalar,
                                      uint8_t** outBuffer,
                                      int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBufferMesh, inSizeMesh, mesh)) {
-    return false;
-  }
-
-  std::vector<double> scalarData;
-  if (!GS::deserializeNumberArray(inBufferScalar, inSizeScalar, scalarData)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBufferMesh, inSizeMesh, mesh)) {
     return false;
   }
 
-  // Convert to Eigen vector
-  Eigen::VectorXd faceScalars = Eigen::Map<Eigen::VectorXd>(scalarData.data(), scalarData.size());
-
-  // Compute vertex scalars using IGL
-  Eigen::VectorXd vertexScalars;
-  igl::average_onto_vertices(mesh.V, mesh.F, faceScalars, vertexScalars);
+  return remapFtoV(mesh, inBufferScalar, inSizeScalar, outBuffer, outSize);
+}
 
-  // Serialize result
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeNumberArray(vertexScalars, *outBuffer, *outSize)) {
+GSP_API bool GSP_CALL IGM_remap_FtoV_h(uint64_t meshHandle,
+                                       const uint8_t* inBufferScalar,
+                                       int inSizeScalar,
+                                       uint8_t** outBuffer,
+                                       int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return remapFtoV(cache->mesh(), inBufferScalar, inSizeScalar, outBuffer, outSize);
 }
 
 GSP_API bool GSP_CALL IGM_principal_curvature(const uint8_t* inBuffer,
@@ -691,100 +2378,66 @@ GSP_API bool GSP_CALL IGM_principal_curvature(const uint8_t* inBuffer,
                                               int* outSizePV1,
                                               uint8_t** outBufferPV2,
                                               int* outSizePV2) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  // Auto-triangulate if mesh is quad
-  if (requiresTriangulation(mesh)) {
-    mesh = triangulate(mesh);
-  }
-
-  Eigen::MatrixXd PD1, PD2;
-  Eigen::VectorXd PV1, PV2;
-  igl::principal_curvature(mesh.V, mesh.F, PD1, PD2, PV1, PV2, radius);
-
-  // Serialize PD1
-  *outBufferPD1 = nullptr;
-  *outSizePD1 = 0;
-  if (!GS::serializePointArray(PD1, *outBufferPD1, *outSizePD1)) {
-    return false;
-  }
-
-  // Serialize PD2
-  *outBufferPD2 = nullptr;
-  *outSizePD2 = 0;
-  if (!GS::serializePointArray(PD2, *outBufferPD2, *outSizePD2)) {
-    if (*outBufferPD1)
-      delete[] *outBufferPD1;
-    *outBufferPD1 = nullptr;
-    *outSizePD1 = 0;
-    return false;
-  }
-
-  // Serialize PV1
-  *outBufferPV1 = nullptr;
-  *outSizePV1 = 0;
-  if (!GS::serializeNumberArray(PV1, *outBufferPV1, *outSizePV1)) {
-    if (*outBufferPD1)
-      delete[] *outBufferPD1;
-    if (*outBufferPD2)
-      delete[] *outBufferPD2;
-    *outBufferPD1 = nullptr;
-    *outBufferPD2 = nullptr;
-    *outSizePD1 = 0;
-    *outSizePD2 = 0;
-    return false;
-  }
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runPrincipalCurvature(bufferInput(inBuffer, inSize),
+                               radius,
+                               ResultSink::separate({{outBufferPD1, outSizePD1},
+                                                     {outBufferPD2, outSizePD2},
+                                                     {outBufferPV1, outSizePV1},
+                                                     {outBufferPV2, outSizePV2}}));
+}
 
-  // Serialize PV2
-  *outBufferPV2 = nullptr;
-  *outSizePV2 = 0;
-  if (!GS::serializeNumberArray(PV2, *outBufferPV2, *outSizePV2)) {
-    if (*outBufferPD1)
-      delete[] *outBufferPD1;
-    if (*outBufferPD2)
-      delete[] *outBufferPD2;
-    if (*outBufferPV1)
-      delete[] *outBufferPV1;
-    *outBufferPD1 = nullptr;
-    *outBufferPD2 = nullptr;
-    *outBufferPV1 = nullptr;
-    *outSizePD1 = 0;
-    *outSizePD2 = 0;
-    *outSizePV1 = 0;
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_principal_curvature_h(uint64_t meshHandle,
+                                                uint32_t radius,
+                                                uint8_t** outBufferPD1,
+                                                int* outSizePD1,
+                                                uint8_t** outBufferPD2,
+                                                int* outSizePD2,
+                                                uint8_t** outBufferPV1,
+                                                int* outSizePV1,
+                                                uint8_t** outBufferPV2,
+                                                int* outSizePV2) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runPrincipalCurvature(handleInput(meshHandle),
+                               radius,
+                               ResultSink::separate({{outBufferPD1, outSizePD1},
+                                                     {outBufferPD2, outSizePD2},
+                                                     {outBufferPV1, outSizePV1},
+                                                     {outBufferPV2, outSizePV2}}));
+}
 
-  return true;
+GSP_API bool GSP_CALL IGM_principal_curvature_ex(const IGM_MeshInput* mesh,
+                                                 uint32_t radius,
+                                                 const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 4, [&](const auto& input, const auto& sink, auto*) {
+    return runPrincipalCurvature(input, radius, sink);
+  });
 }
 
 GSP_API bool GSP_CALL IGM_gaussian_curvature(const uint8_t* inBuffer,
                                              int inSize,
                                              uint8_t** outBuffer,
                                              int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  // Auto-triangulate if mesh is quad
-  if (requiresTriangulation(mesh)) {
-    mesh = triangulate(mesh);
-  }
-
-  Eigen::VectorXd K;
-  igl::gaussian_curvature(mesh.V, mesh.F, K);
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runGaussianCurvature(bufferInput(inBuffer, inSize),
+                              ResultSink::separate({{outBuffer, outSize}}));
+}
 
-  // Serialize the curvature values
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeNumberArray(K, *outBuffer, *outSize)) {
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_gaussian_curvature_h(uint64_t meshHandle,
+                                               uint8_t** outBuffer,
+                                               int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runGaussianCurvature(handleInput(meshHandle),
+                              ResultSink::separate({{outBuffer, outSize}}));
+}
 
-  return true;
+GSP_API bool GSP_CALL IGM_gaussian_curvature_ex(const IGM_MeshInput* mesh,
+                                                const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 1, [](const auto& input, const auto& sink, auto*) {
+    return runGaussianCurvature(input, sink);
+  });
 }
 
 GSP_API bool GSP_CALL IGM_fast_winding_number(const uint8_t* inBufferMesh,
@@ -793,35 +2446,89 @@ GSP_API bool GSP_CALL IGM_fast_winding_number(const uint8_t* inBufferMesh,
                                               int inSizePoints,
                                               uint8_t** outBuffer,
                                               int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBufferMesh, inSizeMesh, mesh)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshRegistry.acquire(inBufferMesh, inSizeMesh);
+  if (!cache) {
     return false;
   }
 
-  std::vector<GeoSharPlusCPP::Vector3d> queryPoints;
-  if (!GS::deserializePointArray(inBufferPoints, inSizePoints, queryPoints)) {
+  return computeFastWindingNumber(*cache->windingNumberIndex(),
+                                  GeoSharPlusCPP::WindingNumberIndex::kDefaultAccuracy,
+                                  inBufferPoints,
+                                  inSizePoints,
+                                  outBuffer,
+                                  outSize);
+}
+
+GSP_API bool GSP_CALL IGM_fast_winding_number_h(uint64_t meshHandle,
+                                                const uint8_t* inBufferPoints,
+                                                int inSizePoints,
+                                                uint8_t** outBuffer,
+                                                int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  // Convert query points to Eigen matrix
-  Eigen::MatrixXd Q(queryPoints.size(), 3);
-  for (size_t i = 0; i < queryPoints.size(); ++i) {
-    Q(i, 0) = queryPoints[i].x();
-    Q(i, 1) = queryPoints[i].y();
-    Q(i, 2) = queryPoints[i].z();
+  return computeFastWindingNumber(*cache->windingNumberIndex(),
+                                  GeoSharPlusCPP::WindingNumberIndex::kDefaultAccuracy,
+                                  inBufferPoints,
+                                  inSizePoints,
+                                  outBuffer,
+                                  outSize);
+}
+
+GSP_API bool GSP_CALL IGM_fast_winding_number_create(const uint8_t* inBufferMesh,
+                                                     int inSizeMesh,
+                                                     int order,
+                                                     uint64_t* outHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outHandle = 0;
+
+  auto cache = meshRegistry.acquire(inBufferMesh, inSizeMesh);
+  if (!cache) {
+    return false;
   }
 
-  Eigen::VectorXd W;
-  igl::fast_winding_number(mesh.V, mesh.F, Q, W);
+  *outHandle = createWindingNumberIndex(*cache, order);
+  return *outHandle != 0;
+}
 
-  // Serialize the winding numbers
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeNumberArray(W, *outBuffer, *outSize)) {
+GSP_API bool GSP_CALL IGM_fast_winding_number_create_h(uint64_t meshHandle,
+                                                       int order,
+                                                       uint64_t* outHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outHandle = 0;
+
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  *outHandle = createWindingNumberIndex(*cache, order);
+  return *outHandle != 0;
+}
+
+GSP_API bool GSP_CALL IGM_fast_winding_number_query(uint64_t windingNumberHandle,
+                                                    double accuracy,
+                                                    const uint8_t* inBufferPoints,
+                                                    int inSizePoints,
+                                                    uint8_t** outBuffer,
+                                                    int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto index = windingNumberHandles.get(windingNumberHandle);
+  if (!index) {
+    return false;
+  }
+
+  return computeFastWindingNumber(
+      *index, accuracy, inBufferPoints, inSizePoints, outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_fast_winding_number_release(uint64_t windingNumberHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return windingNumberHandles.erase(windingNumberHandle);
 }
 
 GSP_API bool GSP_CALL IGM_signed_distance(const uint8_t* inBufferMesh,
@@ -835,92 +2542,166 @@ GSP_API bool GSP_CALL IGM_signed_distance(const uint8_t* inBufferMesh,
                                           int* outSizeFI,
                                           uint8_t** outBufferCP,
                                           int* outSizeCP) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBufferMesh, inSizeMesh, mesh)) {
-    return false;
-  }
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runSignedDistance(bufferInput(inBufferMesh, inSizeMesh),
+                           inBufferPoints,
+                           inSizePoints,
+                           signedType,
+                           nullptr,
+                           ResultSink::separate({{outBufferSD, outSizeSD},
+                                                 {outBufferFI, outSizeFI},
+                                                 {outBufferCP, outSizeCP}}));
+}
 
-  std::vector<GeoSharPlusCPP::Vector3d> queryPoints;
-  if (!GS::deserializePointArray(inBufferPoints, inSizePoints, queryPoints)) {
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_signed_distance_h(uint64_t meshHandle,
+                                            const uint8_t* inBufferPoints,
+                                            int inSizePoints,
+                                            int signedType,
+                                            uint8_t** outBufferSD,
+                                            int* outSizeSD,
+                                            uint8_t** outBufferFI,
+                                            int* outSizeFI,
+                                            uint8_t** outBufferCP,
+                                            int* outSizeCP) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runSignedDistance(handleInput(meshHandle),
+                           inBufferPoints,
+                           inSizePoints,
+                           signedType,
+                           nullptr,
+                           ResultSink::separate({{outBufferSD, outSizeSD},
+                                                 {outBufferFI, outSizeFI},
+                                                 {outBufferCP, outSizeCP}}));
+}
 
-  // Convert query points to Eigen matrix
-  Eigen::MatrixXd Q(queryPoints.size(), 3);
-  for (size_t i = 0; i < queryPoints.size(); ++i) {
-    Q(i, 0) = queryPoints[i].x();
-    Q(i, 1) = queryPoints[i].y();
-    Q(i, 2) = queryPoints[i].z();
-  }
+GSP_API bool GSP_CALL IGM_signed_distance_ex(const IGM_MeshInput* mesh,
+                                             const uint8_t* inBufferPoints,
+                                             int inSizePoints,
+                                             int signedType,
+                                             const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 3, [&](const auto& input, const auto& sink, auto* progress) {
+    return runSignedDistance(input, inBufferPoints, inSizePoints, signedType, progress, sink);
+  });
+}
 
-  // Ensure signedType is within valid range
-  if (signedType < 1 || signedType > 4)
-    signedType = 4;
+GSP_API bool GSP_CALL IGM_closest_point_normal(const uint8_t* inBufferMesh,
+                                               int inSizeMesh,
+                                               const uint8_t* inBufferPoints,
+                                               int inSizePoints,
+                                               uint8_t** outBufferCP,
+                                               int* outSizeCP,
+                                               uint8_t** outBufferFI,
+                                               int* outSizeFI,
+                                               uint8_t** outBufferBC,
+                                               int* outSizeBC,
+                                               uint8_t** outBufferN,
+                                               int* outSizeN) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runClosestPointNormal(bufferInput(inBufferMesh, inSizeMesh),
+                               inBufferPoints,
+                               inSizePoints,
+                               ResultSink::separate({{outBufferCP, outSizeCP},
+                                                     {outBufferFI, outSizeFI},
+                                                     {outBufferBC, outSizeBC},
+                                                     {outBufferN, outSizeN}}));
+}
 
-  Eigen::VectorXd S;
-  Eigen::VectorXi I;
-  Eigen::MatrixXd C;
-  Eigen::MatrixXd N;  // temporary variable
+GSP_API bool GSP_CALL IGM_closest_point_normal_h(uint64_t meshHandle,
+                                                 const uint8_t* inBufferPoints,
+                                                 int inSizePoints,
+                                                 uint8_t** outBufferCP,
+                                                 int* outSizeCP,
+                                                 uint8_t** outBufferFI,
+                                                 int* outSizeFI,
+                                                 uint8_t** outBufferBC,
+                                                 int* outSizeBC,
+                                                 uint8_t** outBufferN,
+                                                 int* outSizeN) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runClosestPointNormal(handleInput(meshHandle),
+                               inBufferPoints,
+                               inSizePoints,
+                               ResultSink::separate({{outBufferCP, outSizeCP},
+                                                     {outBufferFI, outSizeFI},
+                                                     {outBufferBC, outSizeBC},
+                                                     {outBufferN, outSizeN}}));
+}
 
-  igl::signed_distance(
-      Q, mesh.V, mesh.F, static_cast<igl::SignedDistanceType>(signedType), S, I, C, N);
+GSP_API bool GSP_CALL IGM_closest_point_normal_ex(const IGM_MeshInput* mesh,
+                                                  const uint8_t* inBufferPoints,
+                                                  int inSizePoints,
+                                                  const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 4, [&](const auto& input, const auto& sink, auto*) {
+    return runClosestPointNormal(input, inBufferPoints, inSizePoints, sink);
+  });
+}
 
-  // Serialize signed distances
-  *outBufferSD = nullptr;
-  *outSizeSD = 0;
-  if (!GS::serializeNumberArray(S, *outBufferSD, *outSizeSD)) {
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_distance_index_build(const uint8_t* inBufferMesh,
+                                               int inSizeMesh,
+                                               int signedType,
+                                               uint64_t* outHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outHandle = 0;
 
-  // Serialize face indices
-  *outBufferFI = nullptr;
-  *outSizeFI = 0;
-  if (!GS::serializeNumberArray(I, *outBufferFI, *outSizeFI)) {
-    if (*outBufferSD)
-      delete[] *outBufferSD;
-    *outBufferSD = nullptr;
-    *outSizeSD = 0;
+  auto cache = meshRegistry.acquire(inBufferMesh, inSizeMesh);
+  if (!cache) {
     return false;
   }
 
-  // Serialize closest points
-  *outBufferCP = nullptr;
-  *outSizeCP = 0;
-  if (!GS::serializePointArray(C, *outBufferCP, *outSizeCP)) {
-    if (*outBufferSD)
-      delete[] *outBufferSD;
-    if (*outBufferFI)
-      delete[] *outBufferFI;
-    *outBufferSD = nullptr;
-    *outBufferFI = nullptr;
-    *outSizeSD = 0;
-    *outSizeFI = 0;
-    return false;
+  static_cast<void>(cache->distanceIndex());
+  // Out-of-range types fall back to fast winding number signing, as in IGM_signed_distance
+  if (signedType < 1 || signedType >= 4) {
+    static_cast<void>(cache->windingNumberIndex());
   }
 
-  return true;
+  *outHandle = meshHandles.insert(std::move(cache));
+  return *outHandle != 0;
+}
+
+GSP_API bool GSP_CALL IGM_signed_distance_query(uint64_t indexHandle,
+                                                const uint8_t* inBufferPoints,
+                                                int inSizePoints,
+                                                int signedType,
+                                                uint8_t** outBufferSD,
+                                                int* outSizeSD,
+                                                uint8_t** outBufferFI,
+                                                int* outSizeFI,
+                                                uint8_t** outBufferCP,
+                                                int* outSizeCP) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runSignedDistance(handleInput(indexHandle),
+                           inBufferPoints,
+                           inSizePoints,
+                           signedType,
+                           nullptr,
+                           ResultSink::separate({{outBufferSD, outSizeSD},
+                                                 {outBufferFI, outSizeFI},
+                                                 {outBufferCP, outSizeCP}}));
 }
 
 GSP_API bool GSP_CALL IGM_quad_planarity(const uint8_t* inBuffer,
                                          int inSize,
                                          uint8_t** outBuffer,
                                          int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBuffer, inSize, mesh)) {
     return false;
   }
 
-  Eigen::VectorXd P;
-  igl::quad_planarity(mesh.V, mesh.F, P);
+  return computeQuadPlanarity(mesh, outBuffer, outSize);
+}
 
-  // Serialize the planarity values
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeNumberArray(P, *outBuffer, *outSize)) {
+GSP_API bool GSP_CALL IGM_quad_planarity_h(uint64_t meshHandle, uint8_t** outBuffer, int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return computeQuadPlanarity(cache->mesh(), outBuffer, outSize);
 }
 
 GSP_API bool GSP_CALL IGM_planarize_quad_mesh(const uint8_t* inBuffer,
@@ -929,43 +2710,36 @@ GSP_API bool GSP_CALL IGM_planarize_quad_mesh(const uint8_t* inBuffer,
                                               double threshold,
                                               uint8_t** outBuffer,
                                               int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  // Validate that this is actually a quad mesh
-  if (mesh.F.cols() != 4) {
-    // Not a quad mesh - return error
-    return false;
-  }
-
-  // Convert RowMajor to ColMajor for libigl compatibility
-  // libigl's planarize_quad_mesh requires ColMajor matrices
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> V_col(mesh.V.rows(),
-                                                                               mesh.V.cols());
-  V_col = mesh.V;
-
-  Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> F_col(mesh.F.rows(),
-                                                                            mesh.F.cols());
-  F_col = mesh.F;
-
-  Eigen::MatrixXd VPlanarized;
-  igl::planarize_quad_mesh(V_col, F_col, maxIter, threshold, VPlanarized);
-
-  // Create result mesh with planarized vertices
-  GeoSharPlusCPP::Mesh planarizedMesh;
-  planarizedMesh.V = VPlanarized;  // Convert ColMajor back to RowMajor via assignment
-  planarizedMesh.F = mesh.F;       // Keep original quad topology
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runPlanarizeQuadMesh(bufferInput(inBuffer, inSize),
+                              maxIter,
+                              threshold,
+                              nullptr,
+                              ResultSink::separate({{outBuffer, outSize}}));
+}
 
-  // Serialize the planarized mesh
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeMesh(planarizedMesh, *outBuffer, *outSize)) {
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_planarize_quad_mesh_h(uint64_t meshHandle,
+                                                int maxIter,
+                                                double threshold,
+                                                uint8_t** outBuffer,
+                                                int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runPlanarizeQuadMesh(handleInput(meshHandle),
+                              maxIter,
+                              threshold,
+                              nullptr,
+                              ResultSink::separate({{outBuffer, outSize}}));
+}
 
-  return true;
+GSP_API bool GSP_CALL IGM_planarize_quad_mesh_ex(const IGM_MeshInput* mesh,
+                                                 int maxIter,
+                                                 double threshold,
+                                                 const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(
+      mesh, options, 1, [&](const auto& input, const auto& sink, auto* progress) {
+        return runPlanarizeQuadMesh(input, maxIter, threshold, progress, sink);
+      });
 }
 
 GSP_API bool GSP_CALL IGM_laplacian_scalar(const uint8_t* inBufferMesh,
@@ -976,134 +2750,90 @@ GSP_API bool GSP_CALL IGM_laplacian_scalar(const uint8_t* inBufferMesh,
                                            int inSizeValues,
                                            uint8_t** outBuffer,
                                            int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBufferMesh, inSizeMesh, mesh)) {
-    return false;
-  }
-
-  std::vector<int> constraintIndices;
-  if (!GS::deserializeNumberArray(inBufferIndices, inSizeIndices, constraintIndices)) {
-    return false;
-  }
-
-  std::vector<double> constraintValues;
-  if (!GS::deserializeNumberArray(inBufferValues, inSizeValues, constraintValues)) {
-    return false;
-  }
-
-  if (constraintIndices.size() != constraintValues.size()) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshRegistry.acquire(inBufferMesh, inSizeMesh);
+  if (!cache) {
     return false;
   }
 
-  // Convert to Eigen types
-  Eigen::VectorXi b(constraintIndices.size());
-  Eigen::VectorXd bc(constraintValues.size());
-
-  for (size_t i = 0; i < constraintIndices.size(); ++i) {
-    b(i) = constraintIndices[i];
-    bc(i) = constraintValues[i];
-  }
-
-  // Solve harmonic function (Laplacian with constraints)
-  Eigen::VectorXd Z;
-  igl::harmonic(mesh.V, mesh.F, b, bc, 1, Z);
+  return solveLaplacianScalar(*cache,
+                              inBufferIndices,
+                              inSizeIndices,
+                              inBufferValues,
+                              inSizeValues,
+                              outBuffer,
+                              outSize);
+}
 
-  // Serialize the result
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeNumberArray(Z, *outBuffer, *outSize)) {
+GSP_API bool GSP_CALL IGM_laplacian_scalar_h(uint64_t meshHandle,
+                                             const uint8_t* inBufferIndices,
+                                             int inSizeIndices,
+                                             const uint8_t* inBufferValues,
+                                             int inSizeValues,
+                                             uint8_t** outBuffer,
+                                             int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return solveLaplacianScalar(*cache,
+                              inBufferIndices,
+                              inSizeIndices,
+                              inBufferValues,
+                              inSizeValues,
+                              outBuffer,
+                              outSize);
 }
 
 GSP_API bool GSP_CALL
 IGM_param_harmonic(const uint8_t* inBuffer, int inSize, int k, uint8_t** outBuffer, int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshRegistry.acquire(inBuffer, inSize);
+  if (!cache) {
     return false;
   }
 
-  // Find boundary vertices
-  Eigen::VectorXi bnd;
-  igl::boundary_loop(mesh.F, bnd);
-
-  // Map boundary vertices to circle
-  Eigen::MatrixXd bnd_uv;
-  igl::map_vertices_to_circle(mesh.V, bnd, bnd_uv);
-
-  // Compute harmonic parametrization
-  Eigen::MatrixXd V_uv;
-  igl::harmonic(mesh.V, mesh.F, bnd, bnd_uv, k, V_uv);
-
-  // Convert UV coordinates to 3D points (Z = 0)
-  Eigen::MatrixXd uvPoints(V_uv.rows(), 3);
-  uvPoints.col(0) = V_uv.col(0);  // U coordinate
-  uvPoints.col(1) = V_uv.col(1);  // V coordinate
-  uvPoints.col(2).setZero();      // Z coordinate = 0
+  return computeParamHarmonic(*cache, k, outBuffer, outSize);
+}
 
-  // Serialize the UV coordinates
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializePointArray(uvPoints, *outBuffer, *outSize)) {
+GSP_API bool GSP_CALL IGM_param_harmonic_h(uint64_t meshHandle,
+                                           int k,
+                                           uint8_t** outBuffer,
+                                           int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return computeParamHarmonic(*cache, k, outBuffer, outSize);
 }
 
-// Heat geodesics data structure - we'll use a simple approach with global storage
-// In production, you might want a better memory management system
-struct HeatGeodesicsPrecomputedData {
-  igl::HeatGeodesicsData<double> data;
-  bool is_valid;
-
-  HeatGeodesicsPrecomputedData() : is_valid(false) {}
-};
-
-// Global storage for precomputed data (simplified approach)
-static std::unordered_map<std::size_t, std::unique_ptr<HeatGeodesicsPrecomputedData>>
-    heat_geodesics_cache;
-static std::size_t next_handle = 1;
-
 GSP_API bool GSP_CALL IGM_heat_geodesic_precompute(const uint8_t* inBuffer,
                                                    int inSize,
                                                    uint8_t** outBuffer,
                                                    int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  // Create precomputed data structure
-  auto precomputed = std::make_unique<HeatGeodesicsPrecomputedData>();
-
-  // Compute average edge length for time parameter
-  double t = std::pow(igl::avg_edge_length(mesh.V, mesh.F), 2);
-
-  // Precompute heat geodesics data
-  if (!igl::heat_geodesics_precompute(mesh.V, mesh.F, t, precomputed->data)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshRegistry.acquire(inBuffer, inSize);
+  if (!cache) {
     return false;
   }
 
-  precomputed->is_valid = true;
-
-  // Store in cache and get handle
-  std::size_t handle = next_handle++;
-  heat_geodesics_cache[handle] = std::move(precomputed);
+  return precomputeHeatGeodesics(cache, outBuffer, outSize);
+}
 
-  // Serialize the handle as a double (for simplicity)
-  std::vector<double> handle_vec = {static_cast<double>(handle)};
-  *outBuffer = nullptr;
-  *outSize = 0;
-  if (!GS::serializeNumberArray(handle_vec, *outBuffer, *outSize)) {
-    // Clean up on failure
-    heat_geodesics_cache.erase(handle);
+GSP_API bool GSP_CALL IGM_heat_geodesic_precompute_h(uint64_t meshHandle,
+                                                     uint8_t** outBuffer,
+                                                     int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  return true;
+  return precomputeHeatGeodesics(cache, outBuffer, outSize);
 }
 
 GSP_API bool GSP_CALL IGM_heat_geodesic_solve(const uint8_t* inBuffer,
@@ -1112,41 +2842,71 @@ GSP_API bool GSP_CALL IGM_heat_geodesic_solve(const uint8_t* inBuffer,
                                               int inSizeSources,
                                               uint8_t** outBuffer,
                                               int* outSize) {
-  // Deserialize handle as double and convert to size_t
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  // Deserialize handle as double and convert to uint64_t
   std::vector<double> handle_vec;
   if (!GS::deserializeNumberArray(inBuffer, inSize, handle_vec) || handle_vec.empty()) {
     return false;
   }
 
-  std::size_t handle = static_cast<std::size_t>(handle_vec[0]);
+  const auto handle = static_cast<uint64_t>(handle_vec[0]);
+  return solveHeatGeodesics(handle, inBufferSources, inSizeSources, outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_heat_geodesic_create(const uint8_t* inBuffer,
+                                               int inSize,
+                                               uint64_t* outHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outHandle = 0;
 
-  // Find precomputed data
-  auto it = heat_geodesics_cache.find(handle);
-  if (it == heat_geodesics_cache.end() || !it->second->is_valid) {
+  auto cache = meshRegistry.acquire(inBuffer, inSize);
+  if (!cache) {
     return false;
   }
 
-  // Deserialize source vertex indices
-  std::vector<int> sources;
-  if (!GS::deserializeNumberArray(inBufferSources, inSizeSources, sources)) {
+  *outHandle = createHeatGeodesics(cache);
+  return *outHandle != 0;
+}
+
+GSP_API bool GSP_CALL IGM_heat_geodesic_create_h(uint64_t meshHandle, uint64_t* outHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outHandle = 0;
+
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  // Convert to Eigen vector
-  Eigen::VectorXi gamma = Eigen::Map<Eigen::VectorXi>(sources.data(), sources.size());
-
-  // Solve for geodesic distances
-  Eigen::VectorXd distances;
-  igl::heat_geodesics_solve(it->second->data, gamma, distances);
+  *outHandle = createHeatGeodesics(cache);
+  return *outHandle != 0;
+}
 
-  // Serialize the distances
+GSP_API bool GSP_CALL IGM_heat_geodesic_distance(uint64_t heatHandle,
+                                                 const uint8_t* inBufferSources,
+                                                 int inSizeSources,
+                                                 uint8_t** outBuffer,
+                                                 int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
   *outBuffer = nullptr;
   *outSize = 0;
-  if (!GS::serializeNumberArray(distances, *outBuffer, *outSize)) {
-    return false;
-  }
 
-  return true;
+  return solveHeatGeodesics(heatHandle, inBufferSources, inSizeSources, outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_heat_geodesic_release(uint64_t heatHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return heatGeodesicsHandles.erase(heatHandle);
+}
+
+GSP_API void GSP_CALL IGM_heat_geodesic_set_cache_limit(uint64_t maxBytes) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  heatGeodesicsHandles.setCapacity(static_cast<std::size_t>(maxBytes));
+}
+
+GSP_API void GSP_CALL IGM_heat_geodesic_cache_usage(uint64_t* usedBytes, int* entryCount) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *usedBytes = heatGeodesicsHandles.usedBytes();
+  *entryCount = static_cast<int>(heatGeodesicsHandles.size());
 }
 
 GSP_API bool GSP_CALL IGM_random_point_on_mesh(const uint8_t* inBuffer,
@@ -1156,36 +2916,33 @@ GSP_API bool GSP_CALL IGM_random_point_on_mesh(const uint8_t* inBuffer,
                                                int* outSizePoints,
                                                uint8_t** outBufferFI,
                                                int* outSizeFI) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  Eigen::MatrixXd B, P;
-  Eigen::VectorXi FI;
-
-  igl::random_points_on_mesh(N, mesh.V, mesh.F, B, FI, P);
-
-  // Serialize the points
-  *outBufferPoints = nullptr;
-  *outSizePoints = 0;
-  if (!GS::serializePointArray(P, *outBufferPoints, *outSizePoints)) {
-    return false;
-  }
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runRandomPoints(bufferInput(inBuffer, inSize),
+                         N,
+                         ResultSink::separate({{outBufferPoints, outSizePoints},
+                                               {outBufferFI, outSizeFI}}));
+}
 
-  // Serialize the face indices
-  *outBufferFI = nullptr;
-  *outSizeFI = 0;
-  if (!GS::serializeNumberArray(FI, *outBufferFI, *outSizeFI)) {
-    // Cleanup on failure
-    if (*outBufferPoints)
-      delete[] *outBufferPoints;
-    *outBufferPoints = nullptr;
-    *outSizePoints = 0;
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_random_point_on_mesh_h(uint64_t meshHandle,
+                                                 int N,
+                                                 uint8_t** outBufferPoints,
+                                                 int* outSizePoints,
+                                                 uint8_t** outBufferFI,
+                                                 int* outSizeFI) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runRandomPoints(handleInput(meshHandle),
+                         N,
+                         ResultSink::separate({{outBufferPoints, outSizePoints},
+                                               {outBufferFI, outSizeFI}}));
+}
 
-  return true;
+GSP_API bool GSP_CALL IGM_random_point_on_mesh_ex(const IGM_MeshInput* mesh,
+                                                  int N,
+                                                  const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 2, [&](const auto& input, const auto& sink, auto*) {
+    return runRandomPoints(input, N, sink);
+  });
 }
 
 GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh(const uint8_t* inBuffer,
@@ -1195,41 +2952,35 @@ GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh(const uint8_t* inBuffer,
                                                       int* outSizePoints,
                                                       uint8_t** outBufferFI,
                                                       int* outSizeFI) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBuffer, inSize, mesh)) {
-    return false;
-  }
-
-  // Compute the radius from desired number using double area
-  Eigen::VectorXd A;
-  igl::doublearea(mesh.V, mesh.F, A);
-  const double r = std::sqrt(((A.sum() * 0.5 / (N * 0.6162910373)) / M_PI));
-
-  Eigen::MatrixXd B, P;
-  Eigen::VectorXi FI;
-
-  igl::blue_noise(mesh.V, mesh.F, r, B, FI, P);
-
-  // Serialize the points
-  *outBufferPoints = nullptr;
-  *outSizePoints = 0;
-  if (!GS::serializePointArray(P, *outBufferPoints, *outSizePoints)) {
-    return false;
-  }
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runBlueNoise(bufferInput(inBuffer, inSize),
+                      N,
+                      nullptr,
+                      ResultSink::separate({{outBufferPoints, outSizePoints},
+                                            {outBufferFI, outSizeFI}}));
+}
 
-  // Serialize the face indices
-  *outBufferFI = nullptr;
-  *outSizeFI = 0;
-  if (!GS::serializeNumberArray(FI, *outBufferFI, *outSizeFI)) {
-    // Cleanup on failure
-    if (*outBufferPoints)
-      delete[] *outBufferPoints;
-    *outBufferPoints = nullptr;
-    *outSizePoints = 0;
-    return false;
-  }
+GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh_h(uint64_t meshHandle,
+                                                        int N,
+                                                        uint8_t** outBufferPoints,
+                                                        int* outSizePoints,
+                                                        uint8_t** outBufferFI,
+                                                        int* outSizeFI) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runBlueNoise(handleInput(meshHandle),
+                      N,
+                      nullptr,
+                      ResultSink::separate({{outBufferPoints, outSizePoints},
+                                            {outBufferFI, outSizeFI}}));
+}
 
-  return true;
+GSP_API bool GSP_CALL IGM_blue_noise_sampling_on_mesh_ex(const IGM_MeshInput* mesh,
+                                                         int N,
+                                                         const IGM_CallOptions* options) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return runWithOptions(mesh, options, 2, [&](const auto& input, const auto& sink, auto* progress) {
+    return runBlueNoise(input, N, progress, sink);
+  });
 }
 
 GSP_API bool GSP_CALL IGM_constrained_scalar(const uint8_t* inBufferMesh,
@@ -1240,6 +2991,7 @@ GSP_API bool GSP_CALL IGM_constrained_scalar(const uint8_t* inBufferMesh,
                                              int inSizeValues,
                                              uint8_t** outBuffer,
                                              int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
   // This is essentially the same as IGM_laplacian_scalar, so we can delegate to it
   return IGM_laplacian_scalar(inBufferMesh,
                               inSizeMesh,
@@ -1251,6 +3003,23 @@ GSP_API bool GSP_CALL IGM_constrained_scalar(const uint8_t* inBufferMesh,
                               outSize);
 }
 
+GSP_API bool GSP_CALL IGM_constrained_scalar_h(uint64_t meshHandle,
+                                               const uint8_t* inBufferIndices,
+                                               int inSizeIndices,
+                                               const uint8_t* inBufferValues,
+                                               int inSizeValues,
+                                               uint8_t** outBuffer,
+                                               int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return IGM_laplacian_scalar_h(meshHandle,
+                                inBufferIndices,
+                                inSizeIndices,
+                                inBufferValues,
+                                inSizeValues,
+                                outBuffer,
+                                outSize);
+}
+
 GSP_API bool GSP_CALL IGM_extract_isoline_from_scalar(const uint8_t* inBufferMesh,
                                                       int inSizeMesh,
                                                       const uint8_t* inBufferScalar,
@@ -1259,64 +3028,357 @@ GSP_API bool GSP_CALL IGM_extract_isoline_from_scalar(const uint8_t* inBufferMes
                                                       int inSizeIsoValues,
                                                       uint8_t** outBuffer,
                                                       int* outSize) {
-  GeoSharPlusCPP::Mesh mesh;
-  if (!GS::deserializeMesh(inBufferMesh, inSizeMesh, mesh)) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::MeshView mesh;
+  if (!GS::deserializeMeshView(inBufferMesh, inSizeMesh, mesh)) {
     return false;
   }
 
-  std::vector<double> scalarData;
-  if (!GS::deserializeNumberArray(inBufferScalar, inSizeScalar, scalarData)) {
+  return extractIsolines(mesh,
+                         inBufferScalar,
+                         inSizeScalar,
+                         inBufferIsoValues,
+                         inSizeIsoValues,
+                         outBuffer,
+                         outSize);
+}
+
+GSP_API bool GSP_CALL IGM_extract_isoline_from_scalar_h(uint64_t meshHandle,
+                                                        const uint8_t* inBufferScalar,
+                                                        int inSizeScalar,
+                                                        const uint8_t* inBufferIsoValues,
+                                                        int inSizeIsoValues,
+                                                        uint8_t** outBuffer,
+                                                        int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
+    return false;
+  }
+
+  return extractIsolines(cache->mesh(),
+                         inBufferScalar,
+                         inSizeScalar,
+                         inBufferIsoValues,
+                         inSizeIsoValues,
+                         outBuffer,
+                         outSize);
+}
+
+GSP_API bool GSP_CALL IGM_submit_signed_distance(const uint8_t* inBufferMesh,
+                                                 int inSizeMesh,
+                                                 const uint8_t* inBufferPoints,
+                                                 int inSizePoints,
+                                                 int signedType,
+                                                 uint64_t* outJob) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outJob = 0;
+
+  auto cache = meshRegistry.acquire(inBufferMesh, inSizeMesh);
+  if (!cache) {
     return false;
   }
 
-  std::vector<double> isoValues;
-  if (!GS::deserializeNumberArray(inBufferIsoValues, inSizeIsoValues, isoValues)) {
+  return submitSignedDistance(std::move(cache), inBufferPoints, inSizePoints, signedType, outJob);
+}
+
+GSP_API bool GSP_CALL IGM_submit_signed_distance_h(uint64_t meshHandle,
+                                                   const uint8_t* inBufferPoints,
+                                                   int inSizePoints,
+                                                   int signedType,
+                                                   uint64_t* outJob) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outJob = 0;
+
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
     return false;
   }
 
-  // Convert scalar data to Eigen vector
-  Eigen::VectorXd S = Eigen::Map<Eigen::VectorXd>(scalarData.data(), scalarData.size());
+  return submitSignedDistance(std::move(cache), inBufferPoints, inSizePoints, signedType, outJob);
+}
 
-  // For now, we'll return a simplified implementation that just serializes all isolevel points
-  // This would need a proper isoline extraction algorithm like marching triangles
-  // For this implementation, we'll create placeholder points along mesh edges where isolevels occur
+GSP_API bool GSP_CALL IGM_submit_planarize_quad_mesh(const uint8_t* inBuffer,
+                                                     int inSize,
+                                                     int maxIter,
+                                                     double threshold,
+                                                     uint64_t* outJob) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outJob = 0;
 
-  std::vector<GeoSharPlusCPP::Vector3d> allIsolinePoints;
+  // Planarization keeps no derived data, so the mesh is copied out of the buffer, not registered
+  auto mesh = std::make_shared<GeoSharPlusCPP::Mesh>();
+  if (!GS::deserializeMesh(inBuffer, inSize, *mesh)) {
+    return false;
+  }
 
-  // Simple edge-based isoline extraction
-  for (double isoValue : isoValues) {
-    for (int f = 0; f < mesh.F.rows(); ++f) {
-      for (int e = 0; e < 3; ++e) {
-        int v1 = mesh.F(f, e);
-        int v2 = mesh.F(f, (e + 1) % 3);
+  return submitPlanarizeQuadMesh(std::move(mesh), maxIter, threshold, outJob);
+}
 
-        double s1 = S(v1);
-        double s2 = S(v2);
+GSP_API bool GSP_CALL IGM_submit_planarize_quad_mesh_h(uint64_t meshHandle,
+                                                       int maxIter,
+                                                       double threshold,
+                                                       uint64_t* outJob) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outJob = 0;
 
-        // Check if isoline crosses this edge
-        if ((s1 <= isoValue && s2 >= isoValue) || (s1 >= isoValue && s2 <= isoValue)) {
-          // Interpolate position along edge
-          double t = (isoValue - s1) / (s2 - s1);
-          if (t >= 0.0 && t <= 1.0) {
-            Eigen::Vector3d p1 = mesh.V.row(v1);
-            Eigen::Vector3d p2 = mesh.V.row(v2);
-            Eigen::Vector3d isoPoint = p1 + t * (p2 - p1);
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
+    return false;
+  }
 
-            allIsolinePoints.emplace_back(isoPoint.x(), isoPoint.y(), isoPoint.z());
-          }
-        }
-      }
-    }
+  return submitPlanarizeQuadMesh(cache->meshPtr(), maxIter, threshold, outJob);
+}
+
+GSP_API bool GSP_CALL IGM_submit_heat_geodesic_precompute(const uint8_t* inBuffer,
+                                                          int inSize,
+                                                          uint64_t* outJob) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outJob = 0;
+
+  auto cache = meshRegistry.acquire(inBuffer, inSize);
+  if (!cache) {
+    return false;
   }
 
-  // Serialize all the isoline points
+  return submitHeatGeodesicPrecompute(std::move(cache), outJob);
+}
+
+GSP_API bool GSP_CALL IGM_submit_heat_geodesic_precompute_h(uint64_t meshHandle, uint64_t* outJob) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outJob = 0;
+
+  auto cache = meshHandles.get(meshHandle);
+  if (!cache) {
+    return false;
+  }
+
+  return submitHeatGeodesicPrecompute(std::move(cache), outJob);
+}
+
+GSP_API bool GSP_CALL IGM_job_status(uint64_t jobHandle, int* outStatus) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto job = jobHandles.get(jobHandle);
+  if (!job) {
+    return false;
+  }
+
+  std::lock_guard lock(job->mutex);
+  *outStatus = static_cast<int>(job->status);
+  return true;
+}
+
+GSP_API bool GSP_CALL IGM_job_wait(uint64_t jobHandle, int timeoutMs, int* outStatus) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto job = jobHandles.get(jobHandle);
+  if (!job) {
+    return false;
+  }
+
+  std::unique_lock lock(job->mutex);
+  if (timeoutMs < 0) {
+    job->finished.wait(lock, [&] { return job->done(); });
+  } else {
+    job->finished.wait_for(lock, std::chrono::milliseconds(timeoutMs), [&] { return job->done(); });
+  }
+  *outStatus = static_cast<int>(job->status);
+  return true;
+}
+
+GSP_API bool GSP_CALL IGM_job_result(uint64_t jobHandle,
+                                     int outputIndex,
+                                     uint8_t** outBuffer,
+                                     int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
   *outBuffer = nullptr;
   *outSize = 0;
-  if (!GS::serializePointArray(allIsolinePoints, *outBuffer, *outSize)) {
+
+  auto job = jobHandles.get(jobHandle);
+  if (!job) {
+    return false;
+  }
+
+  std::lock_guard lock(job->mutex);
+  if (job->status != JobStatus::Succeeded || outputIndex < 0 ||
+      outputIndex >= static_cast<int>(job->outputs.size())) {
+    return false;
+  }
+  auto& output = job->outputs[outputIndex];
+  if (!*output.data()) {
+    return false;  // Already handed over
+  }
+  output.release(outBuffer, outSize);
+  return true;
+}
+
+GSP_API bool GSP_CALL IGM_job_release(uint64_t jobHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return jobHandles.erase(jobHandle);
+}
+
+GSP_API bool GSP_CALL IGM_job_cancel(uint64_t jobHandle) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto job = jobHandles.get(jobHandle);
+  if (!job) {
+    return false;
+  }
+
+  job->progress.cancel();
+  return true;
+}
+
+GSP_API bool GSP_CALL IGM_job_progress(uint64_t jobHandle, double* outFraction) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  auto job = jobHandles.get(jobHandle);
+  if (!job) {
+    return false;
+  }
+
+  *outFraction = job->progress.fraction();
+  return true;
+}
+
+GSP_API bool GSP_CALL IGM_centroid_batch(const uint8_t* inBuffer,
+                                         int inSize,
+                                         uint8_t** outBuffer,
+                                         int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  *outBuffer = nullptr;
+  *outSize = 0;
+  MeshBatch batch;
+  if (!GS::deserializeMeshArrayView(inBuffer, inSize, batch)) {
+    return false;
+  }
+
+  Eigen::MatrixXd centroids(static_cast<Eigen::Index>(batch.size()), 3);
+  const bool computed = forEachMesh(batch.size(), [&](std::size_t i) {
+    Eigen::Vector3d cen;
+    igl::centroid(batch[i].V, batch[i].F, cen);
+    centroids.row(static_cast<Eigen::Index>(i)) = cen;
+    return true;
+  });
+
+  OutputBuffer points;
+  if (!computed || !GS::serializePointArray(centroids, *points.data(), *points.size())) {
+    return false;
+  }
+
+  points.release(outBuffer, outSize);
+  return true;
+}
+
+GSP_API bool GSP_CALL IGM_boundary_loop_batch(const uint8_t* inBuffer,
+                                              int inSize,
+                                              uint8_t** outBuffer,
+                                              int* outSize,
+                                              uint8_t** outBufferSizes,
+                                              int* outSizeSizes) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  MeshBatch batch;
+  if (!GS::deserializeMeshArrayView(inBuffer, inSize, batch)) {
+    return false;
+  }
+
+  std::vector<std::shared_ptr<const GeoSharPlusCPP::AdjacencyList>> loops(batch.size());
+  const bool computed = forEachMesh(batch.size(), [&](std::size_t i) {
+    loops[i] = TransientMesh(batch[i]).boundaryLoops();
+    return loops[i] != nullptr;
+  });
+  if (!computed) {
+    return false;
+  }
+
+  // Loops of every mesh in one nested array, and how many of them each mesh has
+  GeoSharPlusCPP::AdjacencyList allLoops;
+  Eigen::VectorXi loopCounts(static_cast<Eigen::Index>(batch.size()));
+  for (std::size_t i = 0; i < loops.size(); ++i) {
+    allLoops.insert(allLoops.end(), loops[i]->begin(), loops[i]->end());
+    loopCounts(static_cast<Eigen::Index>(i)) = static_cast<int>(loops[i]->size());
+  }
+
+  OutputBuffer nested, counts;
+  if (!GS::serializeNestedIntArray(allLoops, *nested.data(), *nested.size()) ||
+      !GS::serializeNumberArray(loopCounts, *counts.data(), *counts.size())) {
     return false;
   }
 
+  nested.release(outBuffer, outSize);
+  counts.release(outBufferSizes, outSizeSizes);
   return true;
 }
 
+GSP_API bool GSP_CALL IGM_quad_planarity_batch(const uint8_t* inBuffer,
+                                               int inSize,
+                                               uint8_t** outBuffer,
+                                               int* outSize,
+                                               uint8_t** outBufferSizes,
+                                               int* outSizeSizes) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  MeshBatch batch;
+  if (!GS::deserializeMeshArrayView(inBuffer, inSize, batch)) {
+    return false;
+  }
+
+  std::vector<Eigen::VectorXd> planarity(batch.size());
+  const bool computed = forEachMesh(batch.size(), [&](std::size_t i) {
+    const auto& mesh = batch[i];
+    if (mesh.isQuadMesh()) {
+      igl::quad_planarity(mesh.V, mesh.F, planarity[i]);
+    } else {
+      planarity[i] = Eigen::VectorXd::Zero(mesh.F.rows());  // Triangles are always planar
+    }
+    return true;
+  });
+
+  return computed &&
+         serializeStacked(planarity, outBuffer, outSize, outBufferSizes, outSizeSizes);
+}
+
+GSP_API bool GSP_CALL IGM_pipeline_run(const uint8_t* inBuffer,
+                                       int inSize,
+                                       uint8_t** outBuffer,
+                                       int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  GeoSharPlusCPP::Pipeline pipeline;
+  if (!GS::deserializePipeline(inBuffer, inSize, pipeline)) {
+    return false;
+  }
+
+  // The mesh views alias inBuffer, which outlives the run
+  std::vector<GeoSharPlusCPP::PipelineValue> outputs;
+  if (!GeoSharPlusCPP::runPipeline(pipeline, runPipelineStep, outputs)) {
+    return false;
+  }
+
+  *outBuffer = nullptr;
+  *outSize = 0;
+  return GS::serializePipelineResult(outputs, *outBuffer, *outSize);
+}
+
+GSP_API bool GSP_CALL IGM_pipeline_run_into(const uint8_t* inBuffer,
+                                            int inSize,
+                                            uint8_t* outBuffer,
+                                            int outCapacity,
+                                            int* outSize) {
+  return intoCallerBuffer(outBuffer, outCapacity, outSize, [&](uint8_t** buffer, int* size) {
+    return IGM_pipeline_run(inBuffer, inSize, buffer, size);
+  });
+}
+
+GSP_API bool GSP_CALL IGM_barycenter_f(const uint8_t* inBuffer,
+                                       int inSize,
+                                       uint8_t** outBuffer,
+                                       int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return computeFacePointsF(inBuffer, inSize, GeoSharPlusCPP::barycentersF, outBuffer, outSize);
+}
+
+GSP_API bool GSP_CALL IGM_face_normals_f(const uint8_t* inBuffer,
+                                         int inSize,
+                                         uint8_t** outBuffer,
+                                         int* outSize) {
+  const GeoSharPlusCPP::ProfileCall profile(__func__);
+  return computeFacePointsF(inBuffer, inSize, GeoSharPlusCPP::faceNormalsF, outBuffer, outSize);
+}
+
 }  // extern "C"
@@ -0,0 +1,108 @@
+#include "GeoSharPlusCPP/Core/DistanceIndex.h"
+
+#include <utility>
+
+#include <igl/WindingNumberAABB.h>
+
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+constexpr int kSignWindingNumber = 1;
+constexpr int kSignDefault = 2;
+constexpr int kSignUnsigned = 3;
+
+constexpr std::ptrdiff_t kQueryGrain = 256;  // Query points per pool task
+}  // namespace
+
+DistanceIndex::DistanceIndex(std::shared_ptr<const Mesh> mesh,
+                             std::shared_ptr<const Eigen::MatrixXi> triF)
+    : mesh_(std::move(mesh)), triF_(std::move(triF)) {
+  tree_.init(mesh_->V, *triF_);
+  charge_ = MemoryCharge(MemorySubsystem::Precomputes, bytes());
+}
+
+std::size_t DistanceIndex::bytes() const {
+  // A balanced tree over the triangles: about two nodes per triangle
+  return sizeof(DistanceIndex) +
+         2 * static_cast<std::size_t>(triF_->rows()) * sizeof(igl::AABB<MatrixX3d, 3>);
+}
+
+void DistanceIndex::closestPoints(const Eigen::MatrixXd& P,
+                                  Eigen::VectorXd& sqrD,
+                                  Eigen::VectorXi& I,
+                                  Eigen::MatrixXd& C,
+                                  ProgressSpan* progress) const {
+  const auto n = P.rows();
+  sqrD.resize(n);
+  I.resize(n);
+  C.resize(n, 3);
+  parallelFor(n, kQueryGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    if (progress && progress->cancelled()) {
+      return;
+    }
+    Eigen::RowVector3d closest;
+    for (auto i = begin; i < end; ++i) {
+      int triangle = -1;
+      sqrD(i) = tree_.squared_distance(mesh_->V, *triF_, Eigen::RowVector3d(P.row(i)), triangle,
+                                       closest);
+      I(i) = triangle;
+      C.row(i) = closest;
+    }
+    if (progress) {
+      progress->advance(end - begin);
+    }
+  });
+}
+
+DistanceIndex::SignedDistanceResult DistanceIndex::signedDistance(
+    const Eigen::MatrixXd& P,
+    int signType,
+    const WindingNumberIndex* windingNumber,
+    Progress* progress) const {
+  // Closest points take the first half of the progress when a sign is computed
+  const bool isSigned = signType != kSignUnsigned;
+  SignedDistanceResult result;
+  Eigen::VectorXd sqrD;
+  ProgressSpan closestProgress(progress, P.rows(), 0.0, isSigned ? 0.5 : 1.0);
+  closestPoints(P, sqrD, result.I, result.C, &closestProgress);
+  result.S = sqrD.cwiseSqrt();
+  if (closestProgress.cancelled()) {
+    return result;
+  }
+
+  // Sign by winding number: s = 1 - 2|w| is -1 inside a closed mesh and 1 outside
+  if (isSigned) {
+    ProgressSpan signProgress(progress, P.rows(), 0.5, 1.0);
+    Eigen::VectorXd W;
+    if (signType == kSignWindingNumber || signType == kSignDefault) {
+      // The hierarchy igl::winding_number builds internally, queried on the ThreadPool
+      igl::WindingNumberAABB<Eigen::RowVector3d, MatrixX3d, Eigen::MatrixXi> hierarchy(mesh_->V,
+                                                                                       *triF_);
+      hierarchy.grow();
+      W.resize(P.rows());
+      parallelFor(P.rows(), kQueryGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        if (signProgress.cancelled()) {
+          return;
+        }
+        for (auto i = begin; i < end; ++i) {
+          W(i) = hierarchy.winding_number(Eigen::RowVector3d(P.row(i)));
+        }
+        signProgress.advance(end - begin);
+      });
+    } else if (windingNumber) {
+      W = windingNumber->query(P, WindingNumberIndex::kDefaultAccuracy, &signProgress);
+    } else {
+      W = Eigen::VectorXd::Zero(P.rows());
+    }
+    result.S.array() *= 1.0 - 2.0 * W.array().abs();
+  }
+
+  if (mesh_->isQuadMesh()) {
+    for (Eigen::Index i = 0; i < result.I.size(); ++i) {
+      result.I(i) = faceOfTriangle(result.I(i));
+    }
+  }
+  return result;
+}
+}  // namespace GeoSharPlusCPP
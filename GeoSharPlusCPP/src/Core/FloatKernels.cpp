@@ -0,0 +1,105 @@
+#include "GeoSharPlusCPP/Core/FloatKernels.h"
+
+#include <cstddef>
+
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// Faces per block and pool task: a multiple of every SIMD width, and small enough for the nine
+// coordinate arrays of a block to stay in L1
+constexpr Eigen::Index kBlock = 256;
+using Lane = Eigen::Array<float, kBlock, 1>;
+
+constexpr float kDegenerateSine = 1e-6f;
+
+struct Corners {
+  Lane x, y, z;
+};
+
+// Corner `corner` of the faces [first, first + count); the rest of a short last block is zeroed
+// so it stays finite
+void gather(const MeshViewF& mesh,
+            Eigen::Index first,
+            Eigen::Index count,
+            Eigen::Index corner,
+            Corners& out) {
+  for (Eigen::Index k = 0; k < count; ++k) {
+    const auto v = mesh.F(first + k, corner);
+    out.x(k) = mesh.V(v, 0);
+    out.y(k) = mesh.V(v, 1);
+    out.z(k) = mesh.V(v, 2);
+  }
+  out.x.tail(kBlock - count).setZero();
+  out.y.tail(kBlock - count).setZero();
+  out.z.tail(kBlock - count).setZero();
+}
+
+void scatter(const Corners& in, Eigen::Index first, Eigen::Index count, MatrixX3f& out) {
+  for (Eigen::Index k = 0; k < count; ++k) {
+    out(first + k, 0) = in.x(k);
+    out(first + k, 1) = in.y(k);
+    out(first + k, 2) = in.z(k);
+  }
+}
+
+// Call body(first, count) for each block of faces, in parallel
+template <typename Body>
+void forEachBlock(Eigen::Index faceCount, Body&& body) {
+  parallelFor(faceCount, kBlock, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    body(static_cast<Eigen::Index>(begin), static_cast<Eigen::Index>(end - begin));
+  });
+}
+}  // namespace
+
+void faceNormalsF(const MeshViewF& mesh, MatrixX3f& N) {
+  N.resize(mesh.F.rows(), 3);
+  forEachBlock(mesh.F.rows(), [&](Eigen::Index first, Eigen::Index count) {
+    Corners a, b, c;
+    gather(mesh, first, count, 0, a);
+    gather(mesh, first, count, 1, b);
+    gather(mesh, first, count, 2, c);
+
+    // (b - a) x (c - a), normalized
+    const Lane ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+    const Lane vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+    Corners n;
+    n.x = uy * vz - uz * vy;
+    n.y = uz * vx - ux * vz;
+    n.z = ux * vy - uy * vx;
+    // Degenerate up to float rounding (a fused multiply-add leaves a residue even for repeated
+    // corners) when the sine of the corner angle is below kDegenerateSine
+    const Lane length = (n.x.square() + n.y.square() + n.z.square()).sqrt();
+    const Lane limit = kDegenerateSine * (ux.square() + uy.square() + uz.square()).sqrt() *
+                       (vx.square() + vy.square() + vz.square()).sqrt();
+    const Lane scale = (length > limit).select(length.inverse(), 0.0f);
+    n.x *= scale;
+    n.y *= scale;
+    n.z *= scale;
+
+    scatter(n, first, count, N);
+  });
+}
+
+void barycentersF(const MeshViewF& mesh, MatrixX3f& BC) {
+  BC.resize(mesh.F.rows(), 3);
+  const auto cornerCount = mesh.F.cols();
+  forEachBlock(mesh.F.rows(), [&](Eigen::Index first, Eigen::Index count) {
+    Corners sum{Lane::Zero(), Lane::Zero(), Lane::Zero()};
+    Corners corner;
+    for (Eigen::Index i = 0; i < cornerCount; ++i) {
+      gather(mesh, first, count, i, corner);
+      sum.x += corner.x;
+      sum.y += corner.y;
+      sum.z += corner.z;
+    }
+
+    const auto scale = 1.0f / static_cast<float>(cornerCount);
+    sum.x *= scale;
+    sum.y *= scale;
+    sum.z *= scale;
+
+    scatter(sum, first, count, BC);
+  });
+}
+}  // namespace GeoSharPlusCPP
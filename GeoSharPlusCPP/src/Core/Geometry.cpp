@@ -1,5 +1,21 @@
 #include "GeoSharPlusCPP/Core/Geometry.h"
 
+#include <algorithm>
+
+#include <igl/adjacency_list.h>
+#include <igl/avg_edge_length.h>
+#include <igl/boundary_loop.h>
+#include <igl/doublearea.h>
+#include <igl/gaussian_curvature.h>
+#include <igl/per_edge_normals.h>
+#include <igl/per_face_normals.h>
+#include <igl/per_vertex_normals.h>
+#include <igl/triangle_triangle_adjacency.h>
+#include <igl/vertex_triangle_adjacency.h>
+
+#include "GeoSharPlusCPP/Core/DistanceIndex.h"
+#include "GeoSharPlusCPP/Core/WindingNumberIndex.h"
+
 namespace GeoSharPlusCPP {  // Corrected namespace name to match the header file
 
 // Polyline operations
@@ -69,4 +85,221 @@ std::pair<Vector3d, Vector3d> Mesh::boundingBox() const {
       V.colwise().maxCoeff();  // Corrected to use V instead of vertices
   return {min, max};
 }
+
+Mesh MeshView::toMesh() const {
+  Mesh mesh;
+  mesh.V = V;
+  mesh.F = F;
+  return mesh;
+}
+
+// Memory footprints
+std::size_t memoryFootprint(const SparseMatrixd& A) {
+  return static_cast<std::size_t>(A.nonZeros()) * (sizeof(double) + sizeof(int)) +
+         static_cast<std::size_t>(A.outerSize() + 1) * sizeof(int);
+}
+
+std::size_t memoryFootprint(const AdjacencyList& list) {
+  std::size_t bytes = list.capacity() * sizeof(std::vector<int>);
+  for (const auto& entry : list) {
+    bytes += entry.capacity() * sizeof(int);
+  }
+  return bytes;
+}
+
+std::size_t memoryFootprint(const VertexTriangleAdjacency& adjacency) {
+  return memoryFootprint(adjacency.VF) + memoryFootprint(adjacency.VFI);
+}
+
+std::size_t memoryFootprint(const TriangleTriangleAdjacency& adjacency) {
+  return memoryFootprint(adjacency.TT) + memoryFootprint(adjacency.TTI);
+}
+
+std::size_t memoryFootprint(const EdgeNormals& normals) {
+  return memoryFootprint(normals.N) + memoryFootprint(normals.E) + memoryFootprint(normals.EMAP);
+}
+
+std::size_t memoryFootprint(const LaplacianPattern& pattern) {
+  return memoryFootprint(pattern.L) + pattern.slots.capacity() * sizeof(int) +
+         pattern.isolatedVertices.capacity() * sizeof(int);
+}
+
+std::size_t memoryFootprint(const Mesh& mesh) {
+  return memoryFootprint(mesh.V) + memoryFootprint(mesh.F) + memoryFootprint(mesh.C);
+}
+
+// MeshCache
+MeshCache::MeshCache(std::shared_ptr<const Mesh> mesh)
+    : mesh_(std::move(mesh)), meshCharge_(MemorySubsystem::Meshes, memoryFootprint(*mesh_)) {}
+
+std::shared_ptr<const Eigen::MatrixXi> MeshCache::triangleFaces() const {
+  if (!mesh_->isQuadMesh()) {
+    // Alias the mesh's own faces; the pointer keeps the mesh alive
+    return std::shared_ptr<const Eigen::MatrixXi>(mesh_, &mesh_->F);
+  }
+  return getOrCompute<Eigen::MatrixXi>(Entry::TriangleFaces,
+                                       [&] { return triangulateFaces(mesh_->F); });
+}
+
+std::shared_ptr<const Eigen::MatrixXd> MeshCache::faceNormals() const {
+  return getOrCompute<Eigen::MatrixXd>(Entry::FaceNormals, [&] {
+    Eigen::MatrixXd FN;
+    igl::per_face_normals(mesh_->V, mesh_->F, FN);
+    return FN;
+  });
+}
+
+std::shared_ptr<const Eigen::MatrixXd> MeshCache::vertexNormals() const {
+  return getOrCompute<Eigen::MatrixXd>(Entry::VertexNormals, [&] {
+    Eigen::MatrixXd VN;
+    igl::per_vertex_normals(mesh_->V, mesh_->F, VN);
+    return VN;
+  });
+}
+
+std::shared_ptr<const EdgeNormals> MeshCache::edgeNormals(int weighting) const {
+  const auto compute = [&] {
+    // Reuse the cached face normals instead of letting libigl recompute them
+    auto FN = faceNormals();
+    EdgeNormals result;
+    igl::per_edge_normals(mesh_->V,
+                          mesh_->F,
+                          static_cast<igl::PerEdgeNormalsWeightingType>(weighting),
+                          *FN,
+                          result.N,
+                          result.E,
+                          result.EMAP);
+    return result;
+  };
+
+  switch (weighting) {
+    case igl::PER_EDGE_NORMALS_WEIGHTING_TYPE_UNIFORM:
+      return getOrCompute<EdgeNormals>(Entry::EdgeNormalsUniform, compute);
+    case igl::PER_EDGE_NORMALS_WEIGHTING_TYPE_AREA:
+      return getOrCompute<EdgeNormals>(Entry::EdgeNormalsArea, compute);
+    case igl::PER_EDGE_NORMALS_WEIGHTING_TYPE_DEFAULT:
+      return getOrCompute<EdgeNormals>(Entry::EdgeNormalsDefault, compute);
+    default:
+      return std::make_shared<const EdgeNormals>(compute());  // Not cached
+  }
+}
+
+std::shared_ptr<const Eigen::VectorXd> MeshCache::doubleArea() const {
+  return getOrCompute<Eigen::VectorXd>(Entry::DoubleArea, [&] {
+    Eigen::VectorXd A;
+    igl::doublearea(mesh_->V, mesh_->F, A);
+    return A;
+  });
+}
+
+double MeshCache::avgEdgeLength() const {
+  return *getOrCompute<double>(Entry::AvgEdgeLength,
+                               [&] { return igl::avg_edge_length(mesh_->V, mesh_->F); });
+}
+
+std::shared_ptr<const Eigen::VectorXd> MeshCache::gaussianCurvature() const {
+  return getOrCompute<Eigen::VectorXd>(Entry::GaussianCurvature, [&] {
+    auto triF = triangleFaces();
+    Eigen::VectorXd K;
+    igl::gaussian_curvature(mesh_->V, *triF, K);
+    return K;
+  });
+}
+
+std::shared_ptr<const AdjacencyList> MeshCache::vertexVertexAdjacency() const {
+  return getOrCompute<AdjacencyList>(Entry::VertexVertexAdjacency, [&] {
+    AdjacencyList VV;
+    igl::adjacency_list(mesh_->F, VV);
+    return VV;
+  });
+}
+
+std::shared_ptr<const VertexTriangleAdjacency> MeshCache::vertexTriangleAdjacency() const {
+  return getOrCompute<VertexTriangleAdjacency>(Entry::VertexTriangleAdjacency, [&] {
+    VertexTriangleAdjacency result;
+    igl::vertex_triangle_adjacency(mesh_->V, mesh_->F, result.VF, result.VFI);
+    return result;
+  });
+}
+
+std::shared_ptr<const TriangleTriangleAdjacency> MeshCache::triangleTriangleAdjacency() const {
+  return getOrCompute<TriangleTriangleAdjacency>(Entry::TriangleTriangleAdjacency, [&] {
+    TriangleTriangleAdjacency result;
+    igl::triangle_triangle_adjacency(mesh_->F, result.TT, result.TTI);
+    return result;
+  });
+}
+
+std::shared_ptr<const AdjacencyList> MeshCache::boundaryLoops() const {
+  return getOrCompute<AdjacencyList>(Entry::BoundaryLoops, [&] {
+    AdjacencyList loops;
+    igl::boundary_loop(mesh_->F, loops);
+    return loops;
+  });
+}
+
+std::shared_ptr<const LaplacianPattern> MeshCache::laplacianPattern() const {
+  return getOrCompute<LaplacianPattern>(Entry::LaplacianPattern, [&] {
+    auto triF = triangleFaces();
+    return buildLaplacianPattern(*triF, mesh_->V.rows());
+  });
+}
+
+std::shared_ptr<const SparseMatrixd> MeshCache::cotanLaplacian() const {
+  return getOrCompute<SparseMatrixd>(Entry::CotanLaplacian, [&] {
+    auto pattern = laplacianPattern();
+    auto triF = triangleFaces();
+    return assembleCotanLaplacian(*pattern, mesh_->V, *triF);
+  });
+}
+
+std::shared_ptr<const Eigen::VectorXd> MeshCache::lumpedMass() const {
+  return getOrCompute<Eigen::VectorXd>(Entry::LumpedMass, [&] {
+    auto triF = triangleFaces();
+    return GeoSharPlusCPP::lumpedMass(mesh_->V, *triF);
+  });
+}
+
+std::shared_ptr<const LaplacianOrdering> MeshCache::laplacianOrdering(
+    std::vector<int> fixedVertices) const {
+  auto pattern = laplacianPattern();
+  fixedVertices.insert(
+      fixedVertices.end(), pattern->isolatedVertices.begin(), pattern->isolatedVertices.end());
+  std::sort(fixedVertices.begin(), fixedVertices.end());
+  fixedVertices.erase(std::unique(fixedVertices.begin(), fixedVertices.end()),
+                      fixedVertices.end());
+
+  auto orderings = getOrCreate<LaplacianOrderingCache>(Entry::LaplacianOrderings);
+  return orderings->get(*pattern, std::move(fixedVertices));
+}
+
+std::shared_ptr<const DistanceIndex> MeshCache::distanceIndex() const {
+  return getOrCompute<DistanceIndex>(Entry::DistanceIndex, [&] {
+    return std::make_shared<const DistanceIndex>(mesh_, triangleFaces());
+  });
+}
+
+std::shared_ptr<const WindingNumberIndex> MeshCache::windingNumberIndex() const {
+  return getOrCompute<WindingNumberIndex>(Entry::WindingNumberIndex, [&] {
+    return std::make_shared<const WindingNumberIndex>(mesh_, triangleFaces());
+  });
+}
+
+std::shared_ptr<MeshCache> MeshCache::withVertices(MatrixX3d V) const {
+  if (V.rows() != mesh_->V.rows()) {
+    return nullptr;
+  }
+
+  auto mesh = std::make_shared<Mesh>();
+  mesh->V = std::move(V);
+  mesh->F = mesh_->F;
+  mesh->C = mesh_->C;
+
+  auto updated = std::make_shared<MeshCache>(std::move(mesh));
+  std::lock_guard lock(mutex_);
+  for (auto slot = static_cast<std::size_t>(kFirstTopologyEntry); slot < kEntryCount; ++slot) {
+    updated->entries_[slot] = entries_[slot];
+  }
+  return updated;
+}
 }  // namespace GeoSharPlusCPP
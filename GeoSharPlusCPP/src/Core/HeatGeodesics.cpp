@@ -0,0 +1,174 @@
+#include "GeoSharPlusCPP/Core/HeatGeodesics.h"
+
+#include <cmath>
+
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+constexpr std::ptrdiff_t kFaceGrain = 4096;  // Faces per ThreadPool task
+}  // namespace
+
+std::shared_ptr<const HeatGeodesics> HeatGeodesics::precompute(
+    std::shared_ptr<const MeshCache> mesh) {
+  if (!mesh || mesh->mesh().V.rows() == 0 || mesh->mesh().F.rows() == 0) {
+    return nullptr;
+  }
+
+  auto result = std::make_shared<HeatGeodesics>();
+  result->triF_ = mesh->triangleFaces();
+  result->L_ = mesh->cotanLaplacian();
+  result->M_ = mesh->lumpedMass();
+
+  const double h = mesh->avgEdgeLength();
+  const double t = h * h;
+  result->heat_ = -t * *result->L_;
+  result->heat_.diagonal() += *result->M_;
+  result->poisson_ = -*result->L_;
+
+  if (!result->neumann_.factorize(mesh->laplacianOrdering({}), result->heat_)) {
+    return nullptr;
+  }
+
+  std::vector<int> boundary;
+  for (const auto& loop : *mesh->boundaryLoops()) {
+    boundary.insert(boundary.end(), loop.begin(), loop.end());
+  }
+  result->hasBoundary_ = !boundary.empty();
+  if (result->hasBoundary_ &&
+      !result->dirichlet_.factorize(mesh->laplacianOrdering(std::move(boundary)), result->heat_)) {
+    return nullptr;
+  }
+
+  // The Poisson system is singular up to a constant per component: pin one vertex of each
+  result->components_ = connectedComponents(*mesh->laplacianPattern());
+  if (!result->poissonFactor_.factorize(
+          mesh->laplacianOrdering(result->components_.representatives), result->poisson_)) {
+    return nullptr;
+  }
+
+  if (!MemoryCharge::tryCharge(MemorySubsystem::Precomputes, result->bytes(), result->charge_)) {
+    return nullptr;
+  }
+
+  result->mesh_ = std::move(mesh);
+  return result;
+}
+
+Eigen::VectorXd HeatGeodesics::distances(const std::vector<int>& sources) const {
+  const auto& V = mesh_->mesh().V;
+  const auto& F = *triF_;
+  const auto n = V.rows();
+
+  Eigen::MatrixXd u0 = Eigen::MatrixXd::Zero(n, 1);
+  for (const int s : sources) {
+    if (s < 0 || s >= n) {
+      return {};
+    }
+    u0(s) = 1.0;
+  }
+  if (sources.empty()) {
+    return {};
+  }
+
+  // Heat flow, averaged with the zero-boundary flow on open meshes
+  const Eigen::MatrixXd zeros = Eigen::MatrixXd::Zero(n, 1);
+  Eigen::VectorXd u = neumann_.solve(heat_, u0, zeros);
+  if (hasBoundary_) {
+    u = 0.5 * (u + dirichlet_.solve(heat_, u0, zeros));
+  }
+
+  // Normalized negative gradient per face and its divergence at the face's corners, in parallel;
+  // then summed per vertex serially, since faces share vertices
+  Eigen::MatrixX3d corner = Eigen::MatrixX3d::Zero(F.rows(), 3);
+  parallelFor(F.rows(), kFaceGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto f = begin; f < end; ++f) {
+      const int i[3] = {F(f, 0), F(f, 1), F(f, 2)};
+      const Eigen::Vector3d p[3] = {V.row(i[0]), V.row(i[1]), V.row(i[2])};
+      const Eigen::Vector3d normal = (p[1] - p[0]).cross(p[2] - p[0]);
+      const double doubleArea = normal.norm();
+      if (doubleArea <= 0.0) {
+        continue;
+      }
+      const Eigen::Vector3d unitNormal = normal / doubleArea;
+
+      // grad u = sum_k u_k (N x e_k) / 2A, with e_k the edge opposite corner k (counter-clockwise)
+      Eigen::Vector3d grad = Eigen::Vector3d::Zero();
+      for (int k = 0; k < 3; ++k) {
+        grad += u(i[k]) * unitNormal.cross(p[(k + 2) % 3] - p[(k + 1) % 3]);
+      }
+      const double gradNorm = grad.norm();
+      if (gradNorm <= 0.0) {
+        continue;
+      }
+      const Eigen::Vector3d X = -grad / gradNorm;
+
+      // div X at corner k: 1/2 (cot(theta1) <e1, X> + cot(theta2) <e2, X>), e1/e2 leaving corner k
+      for (int k = 0; k < 3; ++k) {
+        const int k1 = (k + 1) % 3;
+        const int k2 = (k + 2) % 3;
+        const Eigen::Vector3d e1 = p[k1] - p[k];
+        const Eigen::Vector3d e2 = p[k2] - p[k];
+        const Eigen::Vector3d a1 = p[k] - p[k2];
+        const Eigen::Vector3d b1 = p[k1] - p[k2];
+        const Eigen::Vector3d a2 = p[k] - p[k1];
+        const Eigen::Vector3d b2 = p[k2] - p[k1];
+        const double cot1 = a1.dot(b1) / doubleArea;  // Angle at k2, opposite e1
+        const double cot2 = a2.dot(b2) / doubleArea;  // Angle at k1, opposite e2
+        corner(f, k) = 0.5 * (cot1 * e1.dot(X) + cot2 * e2.dot(X));
+      }
+    }
+  });
+
+  Eigen::VectorXd div = Eigen::VectorXd::Zero(n);
+  for (Eigen::Index f = 0; f < F.rows(); ++f) {
+    for (int k = 0; k < 3; ++k) {
+      div(F(f, k)) += corner(f, k);
+    }
+  }
+
+  // L phi = div X. Remove the incompatible part of the right-hand side per component first
+  // (its mass-weighted mean, what libigl's Lagrange multiplier absorbs), then solve with one
+  // vertex per component pinned to zero.
+  const auto& M = *M_;
+  const auto& label = components_.label;
+  const auto componentCount = components_.representatives.size();
+  std::vector<double> divSum(componentCount, 0.0);
+  std::vector<double> massSum(componentCount, 0.0);
+  for (Eigen::Index v = 0; v < n; ++v) {
+    divSum[label[v]] += div(v);
+    massSum[label[v]] += M(v);
+  }
+  for (Eigen::Index v = 0; v < n; ++v) {
+    if (massSum[label[v]] > 0.0) {
+      div(v) -= divSum[label[v]] / massSum[label[v]] * M(v);
+    }
+  }
+
+  Eigen::VectorXd D = poissonFactor_.solve(poisson_, -div, zeros);
+
+  // Distances are relative: shift the sources to zero and make them grow away from them
+  double sourceMean = 0.0;
+  for (const int s : sources) {
+    sourceMean += D(s);
+  }
+  D.array() -= sourceMean / static_cast<double>(sources.size());
+  if (D.mean() < 0.0) {
+    D = -D;
+  }
+  return D;
+}
+
+std::size_t HeatGeodesics::bytes() const {
+  const auto sparseBytes = [](const SparseMatrixd& A) {
+    return static_cast<std::size_t>(A.nonZeros()) * (sizeof(double) + sizeof(int)) +
+           static_cast<std::size_t>(A.outerSize() + 1) * sizeof(int);
+  };
+  std::size_t bytes = sizeof(HeatGeodesics) + sparseBytes(heat_) + sparseBytes(poisson_) +
+                      neumann_.bytes() + poissonFactor_.bytes();
+  if (hasBoundary_) {
+    bytes += dirichlet_.bytes();
+  }
+  return bytes;
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,74 @@
+#include "GeoSharPlusCPP/Core/JobRunner.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/Trace.h"
+
+namespace GeoSharPlusCPP {
+JobRunner::JobRunner(std::size_t threadCount)
+    : threadCount_(std::max<std::size_t>(threadCount, 1)) {
+  std::lock_guard lock(mutex_);
+  startWorkers();
+}
+
+JobRunner::~JobRunner() {
+  shutdown();
+}
+
+void JobRunner::post(Task task) {
+  {
+    std::lock_guard lock(mutex_);
+    tasks_.push_back(std::move(task));
+    if (workers_.empty()) {
+      startWorkers();
+    }
+  }
+  wake_.notify_one();
+}
+
+void JobRunner::shutdown() {
+  std::lock_guard serial(shutdownMutex_);
+  {
+    std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+
+  // Jobs posted meanwhile still run on the exiting threads, as long as one is left; workers_ is
+  // not resized before the join, since post only starts threads when it is empty
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+
+  std::lock_guard lock(mutex_);
+  workers_.clear();
+  stopping_ = false;
+  if (!tasks_.empty()) {
+    startWorkers();  // Posted after the last thread exited
+  }
+}
+
+void JobRunner::startWorkers() {
+  for (std::size_t i = 0; i < threadCount_; ++i) {
+    workers_.emplace_back([this] { workerLoop(); });
+  }
+}
+
+void JobRunner::workerLoop() {
+  traceThreadName("job runner");
+  for (;;) {
+    Task task;
+    {
+      std::unique_lock lock(mutex_);
+      wake_.wait(lock, [this] { return !tasks_.empty() || stopping_; });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,375 @@
+#include "GeoSharPlusCPP/Core/Laplacian.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <Eigen/OrderingMethods>
+
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// Edges of a triangle, each with the corner opposite to it
+constexpr int kEdges[3][3] = {{1, 2, 0}, {2, 0, 1}, {0, 1, 2}};
+
+constexpr std::ptrdiff_t kFaceGrain = 4096;  // Faces per ThreadPool task
+
+[[nodiscard]] int valueSlot(const SparseMatrixd& A, int row, int col) {
+  const int* begin = A.innerIndexPtr() + A.outerIndexPtr()[col];
+  const int* end = A.innerIndexPtr() + A.outerIndexPtr()[col + 1];
+  const int* it = std::lower_bound(begin, end, row);
+  return static_cast<int>(it - A.innerIndexPtr());
+}
+
+// Approximate resident size of a compressed sparse matrix
+[[nodiscard]] std::size_t sparseBytes(const SparseMatrixd& A) {
+  return static_cast<std::size_t>(A.nonZeros()) * (sizeof(double) + sizeof(int)) +
+         static_cast<std::size_t>(A.outerSize() + 1) * sizeof(int);
+}
+
+// The reduced pattern and the solver's factor, elimination tree and column counts
+[[nodiscard]] std::size_t analyzedBytes(const LaplacianOrdering::Analyzed& analyzed) {
+  const auto n = static_cast<std::size_t>(analyzed.reduced.rows());
+  return sparseBytes(analyzed.reduced) + sparseBytes(analyzed.ldlt.matrixL().nestedExpression()) +
+         n * (sizeof(double) + 2 * sizeof(int));
+}
+}  // namespace
+
+LaplacianPattern buildLaplacianPattern(const Eigen::MatrixXi& F, Eigen::Index vertexCount) {
+  const auto n = static_cast<int>(vertexCount);
+
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(static_cast<std::size_t>(F.rows()) * 12 + n);
+  for (int v = 0; v < n; ++v) {
+    triplets.emplace_back(v, v, 0.0);  // Keep the diagonal even for isolated vertices
+  }
+  for (Eigen::Index f = 0; f < F.rows(); ++f) {
+    for (const auto& edge : kEdges) {
+      const int i = F(f, edge[0]);
+      const int j = F(f, edge[1]);
+      triplets.emplace_back(i, j, 0.0);
+      triplets.emplace_back(j, i, 0.0);
+    }
+  }
+
+  LaplacianPattern pattern;
+  pattern.L.resize(n, n);
+  pattern.L.setFromTriplets(triplets.begin(), triplets.end());
+  pattern.L.makeCompressed();
+
+  pattern.slots.resize(static_cast<std::size_t>(F.rows()) * 12);
+  std::vector<bool> referenced(n, false);
+  for (Eigen::Index f = 0; f < F.rows(); ++f) {
+    int* slot = pattern.slots.data() + f * 12;
+    for (const auto& edge : kEdges) {
+      const int i = F(f, edge[0]);
+      const int j = F(f, edge[1]);
+      *slot++ = valueSlot(pattern.L, i, j);
+      *slot++ = valueSlot(pattern.L, j, i);
+      *slot++ = valueSlot(pattern.L, i, i);
+      *slot++ = valueSlot(pattern.L, j, j);
+      referenced[i] = true;
+    }
+  }
+  for (int v = 0; v < n; ++v) {
+    if (!referenced[v]) {
+      pattern.isolatedVertices.push_back(v);
+    }
+  }
+  return pattern;
+}
+
+SparseMatrixd assembleCotanLaplacian(const LaplacianPattern& pattern,
+                                     const MatrixX3d& V,
+                                     const Eigen::MatrixXi& F) {
+  SparseMatrixd L = pattern.L;
+  double* values = L.valuePtr();
+  std::fill(values, values + L.nonZeros(), 0.0);
+
+  // Cotangent weights per face in parallel, then scattered serially: faces share matrix entries
+  Eigen::MatrixX3d weights(F.rows(), 3);
+  parallelFor(F.rows(), kFaceGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto f = begin; f < end; ++f) {
+      for (int e = 0; e < 3; ++e) {
+        const auto& edge = kEdges[e];
+        const Eigen::Vector3d o = V.row(F(f, edge[2]));
+        const Eigen::Vector3d a = V.row(F(f, edge[0])) - o.transpose();
+        const Eigen::Vector3d b = V.row(F(f, edge[1])) - o.transpose();
+        const double crossNorm = a.cross(b).norm();
+        // Degenerate triangles contribute nothing instead of infinities
+        weights(f, e) = crossNorm > 0.0 ? 0.5 * a.dot(b) / crossNorm : 0.0;
+      }
+    }
+  });
+
+  for (Eigen::Index f = 0; f < F.rows(); ++f) {
+    const int* slot = pattern.slots.data() + f * 12;
+    for (int e = 0; e < 3; ++e) {
+      const double w = weights(f, e);
+      values[slot[0]] += w;
+      values[slot[1]] += w;
+      values[slot[2]] -= w;
+      values[slot[3]] -= w;
+      slot += 4;
+    }
+  }
+  return L;
+}
+
+Eigen::VectorXd lumpedMass(const MatrixX3d& V, const Eigen::MatrixXi& F) {
+  // Area each face gives to each of its corners, in parallel; then summed per vertex serially
+  Eigen::MatrixX3d corner(F.rows(), 3);
+  parallelFor(F.rows(), kFaceGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto f = begin; f < end; ++f) {
+      const Eigen::Vector3d p[3] = {V.row(F(f, 0)), V.row(F(f, 1)), V.row(F(f, 2))};
+      const double area = 0.5 * (p[1] - p[0]).cross(p[2] - p[0]).norm();
+      if (area <= 0.0) {
+        corner.row(f).setZero();  // Degenerate triangles contribute nothing instead of NaNs
+        continue;
+      }
+
+      // Edge lengths and angle cosines, index k for the edge or angle opposite corner k
+      double l2[3], l[3], cosine[3];
+      for (int k = 0; k < 3; ++k) {
+        l2[k] = (p[(k + 2) % 3] - p[(k + 1) % 3]).squaredNorm();
+        l[k] = std::sqrt(l2[k]);
+      }
+      for (int k = 0; k < 3; ++k) {
+        const int k1 = (k + 1) % 3;
+        const int k2 = (k + 2) % 3;
+        cosine[k] = (l2[k1] + l2[k2] - l2[k]) / (2.0 * l[k1] * l[k2]);
+      }
+
+      // Obtuse triangles: half the area to the obtuse corner, a quarter to the others
+      const int obtuse = cosine[0] < 0.0 ? 0 : cosine[1] < 0.0 ? 1 : cosine[2] < 0.0 ? 2 : -1;
+      if (obtuse >= 0) {
+        for (int k = 0; k < 3; ++k) {
+          corner(f, k) = k == obtuse ? 0.5 * area : 0.25 * area;
+        }
+        continue;
+      }
+
+      // Otherwise the circumcentric cells: the circumcenter splits the triangle into three parts
+      // with areas proportional to its barycentric coordinates, each shared by the two corners
+      // of its edge
+      double part[3], sum = 0.0;
+      for (int k = 0; k < 3; ++k) {
+        part[k] = cosine[k] * l[k];
+        sum += part[k];
+      }
+      for (int k = 0; k < 3; ++k) {
+        corner(f, k) = 0.5 * area * (part[(k + 1) % 3] + part[(k + 2) % 3]) / sum;
+      }
+    }
+  });
+
+  Eigen::VectorXd M = Eigen::VectorXd::Zero(V.rows());
+  for (Eigen::Index f = 0; f < F.rows(); ++f) {
+    for (int k = 0; k < 3; ++k) {
+      M(F(f, k)) += corner(f, k);
+    }
+  }
+  return M;
+}
+
+VertexComponents connectedComponents(const LaplacianPattern& pattern) {
+  const auto n = static_cast<int>(pattern.L.rows());
+  VertexComponents components;
+  components.label.assign(n, -1);
+  std::vector<int> stack;
+
+  for (int root = 0; root < n; ++root) {
+    if (components.label[root] >= 0) {
+      continue;
+    }
+    const auto id = static_cast<int>(components.representatives.size());
+    components.representatives.push_back(root);
+    components.label[root] = id;
+    stack.push_back(root);
+    while (!stack.empty()) {
+      const int v = stack.back();
+      stack.pop_back();
+      for (SparseMatrixd::InnerIterator it(pattern.L, v); it; ++it) {
+        const auto u = static_cast<int>(it.row());
+        if (components.label[u] < 0) {
+          components.label[u] = id;
+          stack.push_back(u);
+        }
+      }
+    }
+  }
+  return components;
+}
+
+LaplacianOrdering computeLaplacianOrdering(const LaplacianPattern& pattern,
+                                           std::vector<int> fixedVertices) {
+  const auto n = static_cast<int>(pattern.L.rows());
+
+  LaplacianOrdering ordering;
+  ordering.fixedVertices = std::move(fixedVertices);
+  ordering.reducedIndex.assign(n, 0);
+  for (const int v : ordering.fixedVertices) {
+    ordering.reducedIndex[v] = -1;
+  }
+  for (int v = 0; v < n; ++v) {
+    if (ordering.reducedIndex[v] == 0) {
+      ordering.reducedIndex[v] = static_cast<int>(ordering.freeVertices.size());
+      ordering.freeVertices.push_back(v);
+    } else {
+      ordering.reducedIndex[v] = -1;
+    }
+  }
+
+  // Reduced pattern, then AMD on it (the same ordering SimplicialLDLT would pick by default)
+  const auto m = static_cast<int>(ordering.freeVertices.size());
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(pattern.L.nonZeros());
+  for (int c = 0; c < m; ++c) {
+    for (SparseMatrixd::InnerIterator it(pattern.L, ordering.freeVertices[c]); it; ++it) {
+      const int r = ordering.reducedIndex[it.row()];
+      if (r >= 0) {
+        triplets.emplace_back(r, c, 1.0);
+      }
+    }
+  }
+  SparseMatrixd reduced(m, m);
+  reduced.setFromTriplets(triplets.begin(), triplets.end());
+
+  Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic, int> Pinv;
+  Eigen::AMDOrdering<int> amd;
+  amd(reduced, Pinv);
+  ordering.P = Pinv.inverse();
+
+  // Permuted lower triangle of the reduced pattern, analyzed once for every factorization
+  const auto& perm = ordering.P.indices();
+  triplets.clear();
+  for (int c = 0; c < m; ++c) {
+    const int pc = perm[c];
+    for (SparseMatrixd::InnerIterator it(pattern.L, ordering.freeVertices[c]); it; ++it) {
+      const int r = ordering.reducedIndex[it.row()];
+      if (r >= 0 && perm[r] >= pc) {
+        triplets.emplace_back(perm[r], pc, 0.0);
+      }
+    }
+  }
+  ordering.analyzed = std::make_unique<LaplacianOrdering::Analyzed>();
+  auto& analyzed = *ordering.analyzed;
+  analyzed.reduced.resize(m, m);
+  analyzed.reduced.setFromTriplets(triplets.begin(), triplets.end());
+  analyzed.ldlt.analyzePattern(analyzed.reduced);
+
+  // Where each value of the full pattern goes in it
+  ordering.reducedSlots.assign(static_cast<std::size_t>(pattern.L.nonZeros()), -1);
+  for (int col = 0; col < n; ++col) {
+    const int c = ordering.reducedIndex[col];
+    if (c < 0) {
+      continue;
+    }
+    for (int k = pattern.L.outerIndexPtr()[col]; k < pattern.L.outerIndexPtr()[col + 1]; ++k) {
+      const int r = ordering.reducedIndex[pattern.L.innerIndexPtr()[k]];
+      if (r >= 0 && perm[r] >= perm[c]) {
+        ordering.reducedSlots[k] = valueSlot(analyzed.reduced, perm[r], perm[c]);
+      }
+    }
+  }
+  return ordering;
+}
+
+std::shared_ptr<const LaplacianOrdering> LaplacianOrderingCache::get(
+    const LaplacianPattern& pattern,
+    std::vector<int> fixedVertices) {
+  {
+    std::lock_guard lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if ((*it)->fixedVertices == fixedVertices) {
+        entries_.splice(entries_.begin(), entries_, it);
+        return entries_.front();
+      }
+    }
+  }
+
+  // Compute outside the lock; a racing thread may add the same set, which is harmless
+  auto ordering = std::make_shared<const LaplacianOrdering>(
+      computeLaplacianOrdering(pattern, std::move(fixedVertices)));
+
+  std::lock_guard lock(mutex_);
+  entries_.push_front(ordering);
+  if (entries_.size() > kMaxEntries) {
+    entries_.pop_back();
+  }
+  return ordering;
+}
+
+bool LaplacianFactorization::factorize(std::shared_ptr<const LaplacianOrdering> ordering,
+                                       const SparseMatrixd& A) {
+  ordering_ = std::move(ordering);
+  const auto& slots = ordering_->reducedSlots;
+  if (!A.isCompressed() || static_cast<std::size_t>(A.nonZeros()) != slots.size()) {
+    return false;
+  }
+
+  auto& analyzed = *ordering_->analyzed;
+  std::lock_guard lock(analyzed.mutex);
+  double* values = analyzed.reduced.valuePtr();
+  const double* source = A.valuePtr();
+  for (std::size_t k = 0; k < slots.size(); ++k) {
+    if (slots[k] >= 0) {
+      values[slots[k]] = source[k];
+    }
+  }
+
+  analyzed.ldlt.factorize(analyzed.reduced);
+  if (analyzed.ldlt.info() != Eigen::Success || (analyzed.ldlt.vectorD().array() <= 0.0).any()) {
+    return false;
+  }
+  if (analyzed.charge.bytes() == 0) {
+    analyzed.charge = MemoryCharge(MemorySubsystem::Precomputes, analyzedBytes(analyzed));
+  }
+  L_ = analyzed.ldlt.matrixL().nestedExpression();
+  D_ = analyzed.ldlt.vectorD();
+  return true;
+}
+
+Eigen::MatrixXd LaplacianFactorization::solve(const SparseMatrixd& A,
+                                              const Eigen::MatrixXd& rhs,
+                                              const Eigen::MatrixXd& fixedValues) const {
+  const auto& free = ordering_->freeVertices;
+  const auto& fixed = ordering_->fixedVertices;
+  const auto& reducedIndex = ordering_->reducedIndex;
+  const auto& perm = ordering_->P.indices();
+  const auto cols = rhs.cols();
+
+  // Permuted reduced right-hand side, minus the coupling to the fixed values
+  Eigen::MatrixXd b(free.size(), cols);
+  for (std::size_t r = 0; r < free.size(); ++r) {
+    b.row(perm[r]) = rhs.row(free[r]);
+  }
+  for (const int v : fixed) {
+    for (SparseMatrixd::InnerIterator it(A, v); it; ++it) {
+      const int r = reducedIndex[it.row()];
+      if (r >= 0) {
+        b.row(perm[r]) -= it.value() * fixedValues.row(v);  // A is symmetric: A(r, v) = A(v, r)
+      }
+    }
+  }
+
+  // L D L^T y = b, in place
+  L_.triangularView<Eigen::UnitLower>().solveInPlace(b);
+  b = D_.asDiagonal().inverse() * b;
+  L_.transpose().triangularView<Eigen::UnitUpper>().solveInPlace(b);
+
+  Eigen::MatrixXd x(A.rows(), cols);
+  for (std::size_t r = 0; r < free.size(); ++r) {
+    x.row(free[r]) = b.row(perm[r]);
+  }
+  for (const int v : fixed) {
+    x.row(v) = fixedValues.row(v);
+  }
+  return x;
+}
+
+std::size_t LaplacianFactorization::bytes() const {
+  return sparseBytes(L_) + static_cast<std::size_t>(D_.size()) * sizeof(double);
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,107 @@
+#include "GeoSharPlusCPP/Core/MemoryTracker.h"
+
+#include <mutex>
+
+namespace GeoSharPlusCPP {
+namespace {
+// Set while this thread runs the reclaimers, so allocations they make do not reclaim again
+thread_local bool reclaiming = false;
+}  // namespace
+
+MemoryTracker& MemoryTracker::instance() {
+  static MemoryTracker tracker;
+  return tracker;
+}
+
+void MemoryTracker::Counter::add(std::size_t bytes) noexcept {
+  const auto now = current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto previous = peak.load(std::memory_order_relaxed);
+  while (previous < now &&
+         !peak.compare_exchange_weak(previous, now, std::memory_order_relaxed)) {
+  }
+}
+
+void MemoryTracker::add(MemorySubsystem subsystem, std::size_t bytes) noexcept {
+  subsystems_[static_cast<std::size_t>(subsystem)].add(bytes);
+  total_.add(bytes);
+}
+
+void MemoryTracker::remove(MemorySubsystem subsystem, std::size_t bytes) noexcept {
+  subsystems_[static_cast<std::size_t>(subsystem)].current.fetch_sub(bytes,
+                                                                     std::memory_order_relaxed);
+  total_.current.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool MemoryTracker::fits(std::size_t bytes) const noexcept {
+  const auto limit = budget();
+  const auto current = total_.current.load(std::memory_order_relaxed);
+  return limit == 0 || (bytes <= limit && current <= limit - bytes);
+}
+
+bool MemoryTracker::tryAdd(MemorySubsystem subsystem, std::size_t bytes) {
+  if (!makeRoom(bytes)) {
+    return false;
+  }
+  add(subsystem, bytes);
+  return true;
+}
+
+bool MemoryTracker::makeRoom(std::size_t bytes) {
+  if (fits(bytes)) {
+    return true;
+  }
+  if (reclaiming || bytes > budget()) {
+    return false;  // Nested in a reclaimer, or could never fit: keep the caches
+  }
+
+  reclaiming = true;
+  {
+    std::shared_lock lock(reclaimersMutex_);
+    for (const auto& [id, reclaimer] : reclaimers_) {
+      const auto limit = budget();
+      if (limit == 0 || fits(bytes)) {
+        break;
+      }
+      // Ask for the overshoot; releases show up in the counters once the data is destroyed
+      const auto current = total_.current.load(std::memory_order_relaxed);
+      try {
+        reclaimer(current + bytes - limit);
+      } catch (...) {
+        // A failing cache just frees nothing
+      }
+    }
+  }
+  reclaiming = false;
+  return fits(bytes);
+}
+
+MemoryUsage MemoryTracker::usage() const noexcept {
+  return MemoryUsage{total_.current.load(std::memory_order_relaxed),
+                     total_.peak.load(std::memory_order_relaxed)};
+}
+
+MemoryUsage MemoryTracker::usage(MemorySubsystem subsystem) const noexcept {
+  const auto& counter = subsystems_[static_cast<std::size_t>(subsystem)];
+  return MemoryUsage{counter.current.load(std::memory_order_relaxed),
+                     counter.peak.load(std::memory_order_relaxed)};
+}
+
+void MemoryTracker::resetPeaks() noexcept {
+  total_.peak.store(total_.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  for (auto& counter : subsystems_) {
+    counter.peak.store(counter.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+}
+
+int MemoryTracker::addReclaimer(Reclaimer reclaimer) {
+  std::unique_lock lock(reclaimersMutex_);
+  const int id = nextReclaimerId_++;
+  reclaimers_.emplace_back(id, std::move(reclaimer));
+  return id;
+}
+
+void MemoryTracker::removeReclaimer(int id) {
+  std::unique_lock lock(reclaimersMutex_);
+  std::erase_if(reclaimers_, [id](const auto& entry) { return entry.first == id; });
+}
+}  // namespace GeoSharPlusCPP
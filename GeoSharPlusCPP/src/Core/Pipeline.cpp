@@ -0,0 +1,189 @@
+#include "GeoSharPlusCPP/Core/Pipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+#include "GeoSharPlusCPP/Core/Trace.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// Trace event names of the steps
+[[nodiscard]] const char* traceName(PipelineOp op) noexcept {
+  switch (op) {
+    case PipelineOp::Mesh:
+      return "pipeline Mesh";
+    case PipelineOp::Values:
+      return "pipeline Values";
+    case PipelineOp::VertexNormals:
+      return "pipeline VertexNormals";
+    case PipelineOp::FaceNormals:
+      return "pipeline FaceNormals";
+    case PipelineOp::Barycenters:
+      return "pipeline Barycenters";
+    case PipelineOp::GaussianCurvature:
+      return "pipeline GaussianCurvature";
+    case PipelineOp::RemapVtoF:
+      return "pipeline RemapVtoF";
+    case PipelineOp::RemapFtoV:
+      return "pipeline RemapFtoV";
+    case PipelineOp::Isolines:
+      return "pipeline Isolines";
+    case PipelineOp::Count:
+      break;
+  }
+  return "pipeline step";
+}
+}  // namespace
+
+int pipelineInputCount(PipelineOp op) noexcept {
+  switch (op) {
+    case PipelineOp::Mesh:
+    case PipelineOp::Values:
+      return 0;
+    case PipelineOp::VertexNormals:
+    case PipelineOp::FaceNormals:
+    case PipelineOp::Barycenters:
+    case PipelineOp::GaussianCurvature:
+      return 1;
+    case PipelineOp::RemapVtoF:
+    case PipelineOp::RemapFtoV:
+      return 2;
+    case PipelineOp::Isolines:
+      return 3;
+    case PipelineOp::Count:
+      break;
+  }
+  return -1;
+}
+
+bool validatePipeline(const Pipeline& pipeline) noexcept {
+  const auto stepCount = static_cast<int>(pipeline.steps.size());
+  for (int i = 0; i < stepCount; ++i) {
+    const auto& step = pipeline.steps[static_cast<std::size_t>(i)];
+    if (pipelineInputCount(step.op) != static_cast<int>(step.inputs.size())) {
+      return false;
+    }
+    if (step.op == PipelineOp::Mesh && !step.hasMesh && step.meshHandle == 0) {
+      return false;
+    }
+    for (const int input : step.inputs) {
+      if (input < 0 || input >= i) {
+        return false;
+      }
+    }
+  }
+
+  for (const int output : pipeline.outputs) {
+    if (output < 0 || output >= stepCount ||
+        pipeline.steps[static_cast<std::size_t>(output)].op == PipelineOp::Mesh) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool runPipeline(const Pipeline& pipeline,
+                 const PipelineStepRunner& runStep,
+                 std::vector<PipelineValue>& outputs) {
+  if (!validatePipeline(pipeline)) {
+    return false;
+  }
+  const auto& steps = pipeline.steps;
+  const auto stepCount = steps.size();
+
+  // Steps the outputs depend on; inputs always come first, so one backward pass finds them all
+  std::vector<bool> needed(stepCount, false);
+  for (const int output : pipeline.outputs) {
+    needed[static_cast<std::size_t>(output)] = true;
+  }
+  for (auto i = stepCount; i-- > 0;) {
+    if (needed[i]) {
+      for (const int input : steps[i].inputs) {
+        needed[static_cast<std::size_t>(input)] = true;
+      }
+    }
+  }
+
+  // Each step runs in the wave after its latest input, and its result is dropped after the last
+  // wave reading it (outputs are kept to the end)
+  std::vector<int> wave(stepCount, 0);
+  std::vector<int> lastUse(stepCount, -1);
+  int waveCount = 0;
+  for (std::size_t i = 0; i < stepCount; ++i) {
+    if (!needed[i]) {
+      continue;
+    }
+    for (const int input : steps[i].inputs) {
+      wave[i] = std::max(wave[i], wave[static_cast<std::size_t>(input)] + 1);
+    }
+    for (const int input : steps[i].inputs) {
+      auto& use = lastUse[static_cast<std::size_t>(input)];
+      use = std::max(use, wave[i]);
+    }
+    waveCount = std::max(waveCount, wave[i] + 1);
+  }
+  for (const int output : pipeline.outputs) {
+    lastUse[static_cast<std::size_t>(output)] = waveCount;
+  }
+
+  std::vector<std::vector<std::size_t>> waves(static_cast<std::size_t>(waveCount));
+  for (std::size_t i = 0; i < stepCount; ++i) {
+    if (needed[i]) {
+      waves[static_cast<std::size_t>(wave[i])].push_back(i);
+    }
+  }
+
+  std::vector<PipelineValue> results(stepCount);
+  for (int w = 0; w < waveCount; ++w) {
+    const auto& members = waves[static_cast<std::size_t>(w)];
+    std::atomic<bool> failed{false};
+    parallelFor(static_cast<std::ptrdiff_t>(members.size()),
+                1,
+                [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                  for (auto k = begin; k < end && !failed.load(std::memory_order_relaxed); ++k) {
+                    const auto index = members[static_cast<std::size_t>(k)];
+                    const auto& step = steps[index];
+                    const TraceScope trace(traceName(step.op));
+
+                    std::vector<const PipelineValue*> inputs;
+                    inputs.reserve(step.inputs.size());
+                    for (const int input : step.inputs) {
+                      inputs.push_back(&results[static_cast<std::size_t>(input)]);
+                    }
+                    if (!runStep(step, inputs, results[index])) {
+                      failed.store(true, std::memory_order_relaxed);
+                    }
+                  }
+                });
+    if (failed.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    for (std::size_t i = 0; i < stepCount; ++i) {
+      if (lastUse[i] == w) {
+        results[i] = PipelineValue{};
+      }
+    }
+  }
+
+  // A step listed several times is copied for all but its last listing
+  std::vector<int> remaining(stepCount, 0);
+  for (const int output : pipeline.outputs) {
+    ++remaining[static_cast<std::size_t>(output)];
+  }
+  outputs.clear();
+  outputs.reserve(pipeline.outputs.size());
+  for (const int output : pipeline.outputs) {
+    auto& result = results[static_cast<std::size_t>(output)];
+    if (--remaining[static_cast<std::size_t>(output)] == 0) {
+      outputs.push_back(std::move(result));
+    } else {
+      outputs.push_back(result);
+    }
+  }
+  return true;
+}
+}  // namespace GeoSharPlusCPP
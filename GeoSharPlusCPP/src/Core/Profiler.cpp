@@ -0,0 +1,114 @@
+#include "GeoSharPlusCPP/Core/Profiler.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "GeoSharPlusCPP/Core/Trace.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+thread_local ProfileCall* currentCall = nullptr;
+thread_local int phaseDepth = 0;
+
+std::mutex profileMutex;
+std::unordered_map<std::string_view, ProfileEntry> profileEntries;  // Keys point at call names
+
+[[nodiscard]] uint64_t elapsedNs(std::chrono::steady_clock::time_point start) noexcept {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count());
+}
+
+[[nodiscard]] const char* phaseName(ProfilePhase phase) noexcept {
+  switch (phase) {
+    case ProfilePhase::Deserialize:
+      return "deserialize";
+    case ProfilePhase::Compute:
+      return "compute";
+    case ProfilePhase::Serialize:
+      return "serialize";
+  }
+  return "phase";
+}
+}  // namespace
+
+ProfileCall::ProfileCall(const char* name) noexcept
+    : name_(name), active_(currentCall == nullptr), start_(std::chrono::steady_clock::now()) {
+  if (active_) {
+    currentCall = this;
+  }
+  traceBegin(name_);
+}
+
+ProfileCall::~ProfileCall() {
+  traceEnd(name_);
+  if (!active_) {
+    return;
+  }
+  currentCall = nullptr;
+
+  const auto totalNs = elapsedNs(start_);
+  auto phaseNs = phaseNs_;
+  const auto ioNs = phaseNs[static_cast<int>(ProfilePhase::Deserialize)] +
+                    phaseNs[static_cast<int>(ProfilePhase::Serialize)];
+  phaseNs[static_cast<int>(ProfilePhase::Compute)] = totalNs > ioNs ? totalNs - ioNs : 0;
+
+  std::lock_guard lock(profileMutex);
+  auto& entry = profileEntries[name_];
+  ++entry.calls;
+  entry.totalNs += totalNs;
+  entry.maxNs = std::max(entry.maxNs, totalNs);
+  for (std::size_t p = 0; p < ProfileEntry::kPhaseCount; ++p) {
+    entry.phaseNs[p] += phaseNs[p];
+    entry.phaseMaxNs[p] = std::max(entry.phaseMaxNs[p], phaseNs[p]);
+  }
+  entry.bytesIn += bytesIn_;
+  entry.bytesOut += bytesOut_;
+}
+
+ProfilePhaseScope::ProfilePhaseScope(ProfilePhase phase, std::size_t bytesIn) noexcept
+    : call_(phaseDepth++ == 0 ? currentCall : nullptr), phase_(phase) {
+  if (call_) {
+    call_->bytesIn_ += bytesIn;
+    start_ = std::chrono::steady_clock::now();
+  }
+  traceBegin(phaseName(phase_));
+}
+
+ProfilePhaseScope::~ProfilePhaseScope() {
+  traceEnd(phaseName(phase_));
+  --phaseDepth;
+  if (call_) {
+    call_->phaseNs_[static_cast<int>(phase_)] += elapsedNs(start_);
+  }
+}
+
+void profileBytesOut(std::size_t bytes) noexcept {
+  if (currentCall) {
+    currentCall->bytesOut_ += bytes;
+  }
+}
+
+std::vector<ProfileEntry> profileSnapshot() {
+  std::vector<ProfileEntry> entries;
+  {
+    std::lock_guard lock(profileMutex);
+    entries.reserve(profileEntries.size());
+    for (const auto& [name, entry] : profileEntries) {
+      entries.push_back(entry);
+      entries.back().name = name;
+    }
+  }
+  std::sort(entries.begin(), entries.end(), [](const ProfileEntry& a, const ProfileEntry& b) {
+    return a.name < b.name;
+  });
+  return entries;
+}
+
+void profileReset() {
+  std::lock_guard lock(profileMutex);
+  profileEntries.clear();
+}
+}  // namespace GeoSharPlusCPP
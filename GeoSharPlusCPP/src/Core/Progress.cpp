@@ -0,0 +1,34 @@
+#include "GeoSharPlusCPP/Core/Progress.h"
+
+#include <algorithm>
+
+namespace GeoSharPlusCPP {
+bool Progress::report(double fraction) {
+  fraction = std::clamp(fraction, 0.0, 1.0);
+  auto previous = fraction_.load(std::memory_order_relaxed);
+  while (previous < fraction &&
+         !fraction_.compare_exchange_weak(previous, fraction, std::memory_order_relaxed)) {
+  }
+
+  if (callback_ && !cancelled()) {
+    std::lock_guard lock(callbackMutex_);
+    const double current = fraction_.load(std::memory_order_relaxed);
+    if (current >= 1.0 ? reported_ < 1.0 : current - reported_ >= kReportStep) {
+      reported_ = current;
+      if (!callback_(context_, current)) {
+        cancel();
+      }
+    }
+  }
+  return !cancelled();
+}
+
+bool ProgressSpan::advance(std::ptrdiff_t units) {
+  if (!progress_) {
+    return true;
+  }
+  const auto done = done_.fetch_add(units, std::memory_order_relaxed) + units;
+  const double stage = total_ > 0 ? static_cast<double>(done) / static_cast<double>(total_) : 1.0;
+  return progress_->report(begin_ + width_ * std::min(stage, 1.0));
+}
+}  // namespace GeoSharPlusCPP
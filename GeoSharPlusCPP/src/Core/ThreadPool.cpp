@@ -0,0 +1,145 @@
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+
+#include <string>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/Trace.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// Index of the current thread's queue in its pool, or npos on threads outside the pool
+thread_local std::size_t currentWorker = static_cast<std::size_t>(-1);
+thread_local const void* currentPool = nullptr;
+
+[[nodiscard]] std::size_t hardwareThreads() noexcept {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+}  // namespace
+
+ThreadPool& ThreadPool::instance() {
+  // Never destroyed: a static destructor would join the workers while the library is unloaded,
+  // under the loader lock on Windows, which can deadlock. shutdown() stops them beforehand.
+  static ThreadPool* const pool = new ThreadPool();
+  return *pool;
+}
+
+ThreadPool::ThreadPool() {
+  const auto count = hardwareThreads();
+  threadCount_.store(count, std::memory_order_relaxed);
+  startWorkers(count - 1);
+}
+
+ThreadPool::~ThreadPool() {
+  stopWorkers();
+}
+
+void ThreadPool::setThreadCount(std::size_t count) {
+  if (count == 0) {
+    count = hardwareThreads();
+  }
+
+  std::unique_lock config(configMutex_);
+  if (count == threadCount()) {
+    return;
+  }
+  stopWorkers();
+  threadCount_.store(count, std::memory_order_relaxed);
+  startWorkers(count - 1);
+}
+
+void ThreadPool::shutdown() {
+  std::unique_lock config(configMutex_);
+  stopWorkers();
+  threadCount_.store(1, std::memory_order_relaxed);
+}
+
+void ThreadPool::submit(Task task) {
+  // Tasks still draining during setThreadCount must not wait on it: they run their subtasks inline
+  std::shared_lock config(configMutex_, std::try_to_lock);
+  if (!config.owns_lock() || queues_.empty()) {
+    config.unlock();
+    task();
+    return;
+  }
+
+  // Own deque from a worker, round robin from anywhere else
+  const auto queue = currentPool == this
+                         ? currentWorker
+                         : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+  {
+    std::lock_guard lock(queues_[queue]->mutex);
+    queues_[queue]->tasks.push_back(std::move(task));
+    std::lock_guard sleep(sleepMutex_);
+    ++pending_;
+  }
+  wake_.notify_one();
+}
+
+void ThreadPool::startWorkers(std::size_t count) {
+  stopping_ = false;
+  queues_.clear();
+  for (std::size_t i = 0; i < count; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    workers_.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+void ThreadPool::stopWorkers() {
+  {
+    std::lock_guard lock(sleepMutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+  queues_.clear();
+}
+
+bool ThreadPool::popTask(std::size_t self, Task& task) {
+  // Newest own task first, then the oldest task of the next busy worker
+  for (std::size_t offset = 0; offset < queues_.size(); ++offset) {
+    auto& queue = *queues_[(self + offset) % queues_.size()];
+    std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      continue;
+    }
+    if (offset == 0) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    std::lock_guard sleep(sleepMutex_);
+    --pending_;
+    return true;
+  }
+  return false;
+}
+
+void ThreadPool::workerLoop(std::size_t self) {
+  currentWorker = self;
+  currentPool = this;
+  traceThreadName(("pool worker " + std::to_string(self)).c_str());
+
+  for (;;) {
+    Task task;
+    if (!popTask(self, task)) {
+      // Sleep until a task is queued. Another worker may take it first, in which case this one
+      // looks again or goes back to sleep. Queued tasks are drained before a stop takes effect.
+      std::unique_lock lock(sleepMutex_);
+      wake_.wait(lock, [this] { return pending_ > 0 || stopping_; });
+      if (pending_ == 0) {
+        return;
+      }
+      continue;
+    }
+    const TraceScope trace("pool task");
+    task();
+  }
+}
+}  // namespace GeoSharPlusCPP
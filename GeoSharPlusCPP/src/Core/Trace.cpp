@@ -0,0 +1,223 @@
+#include "GeoSharPlusCPP/Core/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GeoSharPlusCPP {
+namespace {
+enum class TraceEventType : char {
+  Begin = 'B',
+  End = 'E',
+};
+
+// One ring buffer entry, written like a seqlock: `sequence` is 0 while the entry is being
+// written and the event index + 1 once it is complete, so a dump running alongside the writers
+// can tell finished entries from torn ones.
+struct TraceSlot {
+  std::atomic<uint64_t> sequence{0};
+  std::atomic<const char*> name{nullptr};
+  std::atomic<uint64_t> timeNs{0};
+  std::atomic<uint32_t> thread{0};
+  std::atomic<char> type{0};
+};
+
+struct TraceBuffer {
+  explicit TraceBuffer(std::size_t capacity)
+      : capacity(capacity), slots(std::make_unique<TraceSlot[]>(capacity)) {}
+
+  const std::size_t capacity;
+  std::unique_ptr<TraceSlot[]> slots;
+  std::atomic<uint64_t> head{0};   // Index of the next event
+  std::atomic<uint64_t> first{0};  // Events before this index belong to an earlier recording
+};
+
+struct TraceEvent {
+  const char* name;
+  uint64_t timeNs;
+  uint32_t thread;
+  TraceEventType type;
+};
+
+std::atomic<bool> tracing{false};
+std::atomic<TraceBuffer*> activeBuffer{nullptr};
+
+std::mutex controlMutex;
+// Every buffer ever allocated: a writer may still hold a replaced buffer, so none is freed
+std::vector<std::unique_ptr<TraceBuffer>> buffers;
+std::map<uint32_t, std::string> threadNames;
+
+const auto traceEpoch = std::chrono::steady_clock::now();
+
+std::atomic<uint32_t> nextThreadId{1};
+thread_local const uint32_t currentThreadId =
+    nextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+void record(const char* name, TraceEventType type) noexcept {
+  if (!tracing.load(std::memory_order_relaxed)) {
+    return;
+  }
+  auto* buffer = activeBuffer.load(std::memory_order_acquire);
+  if (!buffer) {
+    return;
+  }
+
+  const auto timeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                std::chrono::steady_clock::now() - traceEpoch)
+                                                .count());
+  const auto index = buffer->head.fetch_add(1, std::memory_order_relaxed);
+  auto& slot = buffer->slots[index % buffer->capacity];
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.timeNs.store(timeNs, std::memory_order_relaxed);
+  slot.thread.store(currentThreadId, std::memory_order_relaxed);
+  slot.type.store(static_cast<char>(type), std::memory_order_relaxed);
+  slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+// Complete events of the current recording, oldest first
+[[nodiscard]] std::vector<TraceEvent> collectEvents(const TraceBuffer& buffer) {
+  const auto head = buffer.head.load(std::memory_order_acquire);
+  const auto first = std::max(buffer.first.load(std::memory_order_relaxed),
+                              head > buffer.capacity ? head - buffer.capacity : 0);
+
+  std::vector<TraceEvent> events;
+  events.reserve(static_cast<std::size_t>(head - first));
+  for (auto index = first; index < head; ++index) {
+    const auto& slot = buffer.slots[index % buffer.capacity];
+    const auto sequence = slot.sequence.load(std::memory_order_acquire);
+    TraceEvent event{slot.name.load(std::memory_order_relaxed),
+                     slot.timeNs.load(std::memory_order_relaxed),
+                     slot.thread.load(std::memory_order_relaxed),
+                     static_cast<TraceEventType>(slot.type.load(std::memory_order_relaxed))};
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence != index + 1 || slot.sequence.load(std::memory_order_relaxed) != sequence) {
+      continue;  // Still being written, or already overwritten
+    }
+    events.push_back(event);
+  }
+  return events;
+}
+
+void writeJsonString(std::ostream& out, const char* text) {
+  out << '"';
+  for (; text && *text; ++text) {
+    const char c = *text;
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) >= 0x20) {
+      out << c;
+    }
+  }
+  out << '"';
+}
+}  // namespace
+
+void traceStart(std::size_t capacity) {
+  if (capacity == 0) {
+    capacity = kDefaultTraceCapacity;
+  }
+
+  std::lock_guard lock(controlMutex);
+  auto* buffer = activeBuffer.load(std::memory_order_relaxed);
+  if (buffer && buffer->capacity == capacity) {
+    buffer->first.store(buffer->head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  } else {
+    buffers.push_back(std::make_unique<TraceBuffer>(capacity));
+    activeBuffer.store(buffers.back().get(), std::memory_order_release);
+  }
+  tracing.store(true, std::memory_order_relaxed);
+}
+
+void traceStop() noexcept {
+  tracing.store(false, std::memory_order_relaxed);
+}
+
+bool traceEnabled() noexcept {
+  return tracing.load(std::memory_order_relaxed);
+}
+
+void traceBegin(const char* name) noexcept {
+  record(name, TraceEventType::Begin);
+}
+
+void traceEnd(const char* name) noexcept {
+  record(name, TraceEventType::End);
+}
+
+void traceThreadName(const char* name) {
+  std::lock_guard lock(controlMutex);
+  threadNames[currentThreadId] = name ? name : "";
+}
+
+bool traceDump(const char* path) {
+  if (!path) {
+    return false;
+  }
+
+  std::vector<TraceEvent> events;
+  std::map<uint32_t, std::string> names;
+  {
+    std::lock_guard lock(controlMutex);
+    if (const auto* buffer = activeBuffer.load(std::memory_order_relaxed)) {
+      events = collectEvents(*buffer);
+    }
+    names = threadNames;
+  }
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    return false;
+  }
+
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool firstEvent = true;
+  const auto separator = [&] {
+    out << (firstEvent ? "\n" : ",\n");
+    firstEvent = false;
+  };
+
+  for (const auto& [thread, name] : names) {
+    separator();
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+        << ",\"args\":{\"name\":";
+    writeJsonString(out, name.c_str());
+    out << "}}";
+  }
+
+  // The ring may have overwritten the begin event of a scope whose end is still in it; those
+  // unmatched ends are dropped so the viewer's per-thread stacks stay balanced
+  std::map<uint32_t, std::size_t> depth;
+  out << std::fixed << std::setprecision(3);
+  for (const auto& event : events) {
+    auto& threadDepth = depth[event.thread];
+    if (event.type == TraceEventType::End) {
+      if (threadDepth == 0) {
+        continue;
+      }
+      --threadDepth;
+    } else {
+      ++threadDepth;
+    }
+
+    separator();
+    out << "{\"name\":";
+    writeJsonString(out, event.name);
+    out << ",\"ph\":\"" << static_cast<char>(event.type) << "\",\"ts\":"
+        << static_cast<double>(event.timeNs) / 1000.0 << ",\"pid\":1,\"tid\":" << event.thread
+        << "}";
+  }
+  out << "\n]}\n";
+
+  return static_cast<bool>(out.flush());
+}
+}  // namespace GeoSharPlusCPP
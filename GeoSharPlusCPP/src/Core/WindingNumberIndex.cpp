@@ -0,0 +1,52 @@
+#include "GeoSharPlusCPP/Core/WindingNumberIndex.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "GeoSharPlusCPP/Core/ThreadPool.h"
+
+namespace GeoSharPlusCPP {
+namespace {
+// Query points per pool task; below libigl's own parallel threshold, so each chunk runs serially
+constexpr std::ptrdiff_t kQueryGrain = 512;
+}  // namespace
+
+WindingNumberIndex::WindingNumberIndex(std::shared_ptr<const Mesh> mesh,
+                                       std::shared_ptr<const Eigen::MatrixXi> triF,
+                                       int order)
+    : mesh_(std::move(mesh)), triF_(std::move(triF)), order_(std::clamp(order, 0, 2)) {
+  igl::fast_winding_number(mesh_->V, *triF_, order_, bvh_);
+  charge_ = MemoryCharge(MemorySubsystem::Precomputes, bytes());
+}
+
+Eigen::VectorXd WindingNumberIndex::query(const Eigen::MatrixXd& P,
+                                          double accuracy,
+                                          ProgressSpan* progress) const {
+  Eigen::VectorXd W(P.rows());
+  parallelFor(P.rows(), kQueryGrain, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    if (progress && progress->cancelled()) {
+      return;
+    }
+    Eigen::VectorXd chunk;
+    igl::fast_winding_number(bvh_, static_cast<float>(accuracy), P.middleRows(begin, end - begin),
+                             chunk);
+    W.segment(begin, end - begin) = chunk;
+    if (progress) {
+      progress->advance(end - begin);
+    }
+  });
+  return W;
+}
+
+std::size_t WindingNumberIndex::bytes() const {
+  // Float copies of the vertices and triangles, plus per BVH node (about one per triangle) the
+  // bounding box, centre, radius and the expansion coefficients, which grow with the order
+  constexpr std::size_t kCoefficientFloats[3] = {3, 12, 39};
+  constexpr std::size_t kNodeFloats = 6 + 3 + 1;
+  const auto vertexCount = static_cast<std::size_t>(mesh_->V.rows());
+  const auto triangleCount = static_cast<std::size_t>(triF_->rows());
+  return sizeof(WindingNumberIndex) + vertexCount * 3 * sizeof(float) +
+         triangleCount * 3 * sizeof(int) +
+         triangleCount * (kNodeFloats + kCoefficientFloats[order_]) * sizeof(float);
+}
+}  // namespace GeoSharPlusCPP
@@ -0,0 +1,172 @@
+#include "GeoSharPlusCPP/Serialization/MeshRegistry.h"
+
+#include <cstring>
+#include <iterator>
+
+#include <xxhash.h>
+
+#include "GeoSharPlusCPP/Serialization/Serializer.h"
+
+namespace GeoSharPlusCPP::Serialization {
+namespace {
+[[nodiscard]] std::size_t meshBytes(const Mesh& mesh) noexcept {
+  return static_cast<std::size_t>(mesh.V.size()) * sizeof(double) +
+         static_cast<std::size_t>(mesh.F.size()) * sizeof(int);
+}
+
+// True if the buffer mapped by `view` holds exactly the vertices and faces of `mesh`
+[[nodiscard]] bool sameMesh(const MeshView& view, const Mesh& mesh) {
+  if (view.V.rows() != mesh.V.rows() || view.F.rows() != mesh.F.rows() ||
+      view.F.cols() != mesh.F.cols()) {
+    return false;
+  }
+  // Both vertex matrices are row-major, so the doubles can be compared bit for bit
+  if (std::memcmp(view.V.data(), mesh.V.data(), sizeof(double) * mesh.V.size()) != 0) {
+    return false;
+  }
+  return view.F == mesh.F;
+}
+}  // namespace
+
+MeshRegistry::MeshRegistry(std::size_t capacityBytes) : capacityBytes_(capacityBytes) {
+  reclaimer_ = MemoryTracker::instance().addReclaimer(
+      [this](std::size_t bytes) { return trim(bytes); });
+}
+
+MeshRegistry::~MeshRegistry() {
+  MemoryTracker::instance().removeReclaimer(reclaimer_);
+}
+
+std::shared_ptr<const MeshCache> MeshRegistry::acquire(const uint8_t* data, int size) {
+  if (!data || size <= 0) {
+    return nullptr;
+  }
+  // Hashing, the cache lookup and the copy on a miss all count as deserialization
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, static_cast<std::size_t>(size));
+
+  const uint64_t hash = XXH3_64bits(data, static_cast<std::size_t>(size));
+
+  MeshView view;
+  if (!deserializeMeshView(data, size, view)) {
+    return nullptr;
+  }
+  return acquireMapped(hash, size, view);
+}
+
+std::shared_ptr<const MeshCache> MeshRegistry::acquire(const MeshView& view) {
+  // Keyed by content rather than by buffer: the vertices, then the faces and their width
+  const auto vertexBytes = static_cast<std::size_t>(view.V.size()) * sizeof(double);
+  const auto faceBytes = static_cast<std::size_t>(view.F.size()) * sizeof(int);
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, vertexBytes + faceBytes);
+
+  const uint64_t vertexHash = XXH3_64bits(view.V.data(), vertexBytes);
+  const uint64_t hash = XXH3_64bits_withSeed(view.F.data(),
+                                             faceBytes,
+                                             vertexHash + static_cast<uint64_t>(view.F.cols()));
+  return acquireMapped(hash, 0, view);
+}
+
+std::shared_ptr<const MeshCache> MeshRegistry::acquireMapped(uint64_t hash,
+                                                             int bufferSize,
+                                                             const MeshView& view) {
+  std::shared_ptr<const MeshCache> candidate;
+  {
+    std::lock_guard lock(mutex_);
+    auto it = index_.find(hash);
+    if (it != index_.end() && it->second->bufferSize == bufferSize) {
+      candidate = it->second->cache;
+    }
+  }
+
+  if (candidate && sameMesh(view, candidate->mesh())) {
+    std::lock_guard lock(mutex_);
+    ++hits_;
+    auto it = index_.find(hash);
+    if (it != index_.end() && it->second->cache == candidate) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+    }
+    return candidate;
+  }
+
+  const auto viewBytes = static_cast<std::size_t>(view.V.size()) * sizeof(double) +
+                         static_cast<std::size_t>(view.F.size()) * sizeof(int);
+  if (!MemoryTracker::instance().makeRoom(viewBytes)) {
+    return nullptr;
+  }
+
+  auto mesh = std::make_shared<Mesh>();
+  mesh->V = view.V;
+  mesh->F = view.F;
+  const std::size_t bytes = meshBytes(*mesh);
+  auto cache = std::make_shared<const MeshCache>(std::move(mesh));
+
+  EntryList evicted;  // Destroyed after the lock is dropped
+  std::lock_guard lock(mutex_);
+  ++misses_;
+  if (capacityBytes_ == 0) {
+    return cache;
+  }
+
+  // Replace any entry under the same hash (an older mesh, or a collision)
+  if (auto it = index_.find(hash); it != index_.end()) {
+    usedBytes_ -= it->second->bytes;
+    evicted.splice(evicted.end(), entries_, it->second);
+    index_.erase(it);
+  }
+  entries_.push_front(Entry{hash, bufferSize, bytes, cache});
+  index_.emplace(hash, entries_.begin());
+  usedBytes_ += bytes;
+  evictLocked(evicted);
+  return cache;
+}
+
+void MeshRegistry::setCapacity(std::size_t capacityBytes) {
+  EntryList evicted;
+  std::lock_guard lock(mutex_);
+  capacityBytes_ = capacityBytes;
+  evictLocked(evicted);
+}
+
+void MeshRegistry::clear() {
+  EntryList released;  // Meshes are destroyed after the lock is dropped
+  std::lock_guard lock(mutex_);
+  released.swap(entries_);
+  index_.clear();
+  usedBytes_ = 0;
+}
+
+std::size_t MeshRegistry::trim(std::size_t bytes) {
+  EntryList evicted;  // Destroyed after the lock is dropped
+  std::lock_guard lock(mutex_);
+  std::size_t dropped = 0;
+  while (!entries_.empty() && dropped < bytes) {
+    const auto last = std::prev(entries_.end());
+    dropped += last->bytes;
+    usedBytes_ -= last->bytes;
+    index_.erase(last->hash);
+    evicted.splice(evicted.begin(), entries_, last);
+  }
+  return dropped;
+}
+
+MeshRegistry::Stats MeshRegistry::stats() const {
+  std::lock_guard lock(mutex_);
+  return Stats{hits_, misses_, entries_.size(), usedBytes_};
+}
+
+void MeshRegistry::resetStats() {
+  std::lock_guard lock(mutex_);
+  hits_ = 0;
+  misses_ = 0;
+}
+
+// Evict least recently used meshes until under budget; with no budget, keep nothing
+void MeshRegistry::evictLocked(EntryList& evicted) {
+  while (!entries_.empty() && (capacityBytes_ == 0 || usedBytes_ > capacityBytes_)) {
+    const auto last = std::prev(entries_.end());
+    usedBytes_ -= last->bytes;
+    index_.erase(last->hash);
+    evicted.splice(evicted.begin(), entries_, last);
+  }
+}
+}  // namespace GeoSharPlusCPP::Serialization
@@ -4,17 +4,30 @@
   #include <combaseapi.h>  // Windows: CoTaskMemAlloc for COM interop
 #else
   #include <cstdlib>  // Unix/macOS: use malloc/free
-  #include <cstring>  // Unix/macOS: use memcpy
 #endif
+#ifdef GEOSHARPLUS_SERIALIZER_BENCH
+  #include <atomic>
+#endif
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <new>
 
 #include "GSP_FB/cpp/doubleArray_generated.h"
 #include "GSP_FB/cpp/doublePairArray_generated.h"
 #include "GSP_FB/cpp/intArray_generated.h"
 #include "GSP_FB/cpp/intNestedArray_generated.h"
 #include "GSP_FB/cpp/intPairArray_generated.h"
+#include "GSP_FB/cpp/meshArray_generated.h"
+#include "GSP_FB/cpp/meshF_generated.h"
 #include "GSP_FB/cpp/mesh_generated.h"
+#include "GSP_FB/cpp/pipelineResult_generated.h"
+#include "GSP_FB/cpp/pipeline_generated.h"
+#include "GSP_FB/cpp/pointArrayF_generated.h"
 #include "GSP_FB/cpp/pointArray_generated.h"
 #include "GSP_FB/cpp/point_generated.h"
+#include "GSP_FB/cpp/profile_generated.h"
+#include "GSP_FB/cpp/resultBundle_generated.h"
 #include "GeoSharPlusCPP/Core/MathTypes.h"
 #include "flatbuffers/flatbuffers.h"
 
@@ -24,7 +37,7 @@ namespace GeoSharPlusCPP::Serialization {
 // On Unix/macOS: Use standard malloc - .NET Core will handle it correctly with
 // Marshal.FreeCoTaskMem Note: On .NET Core/5+, Marshal.FreeCoTaskMem on Unix calls free()
 // internally, which properly pairs with malloc()
-inline void* AllocateInteropMemory(size_t size) {
+void* AllocateInteropMemory(size_t size) {
 #ifdef _WIN32
   return CoTaskMemAlloc(size);
 #else
@@ -34,10 +47,18 @@ inline void* AllocateInteropMemory(size_t size) {
 #endif
 }
 
+namespace {
+// Output destination set by the innermost CallerBufferScope of this thread
+thread_local CallerBuffer* callerBuffer = nullptr;
+}  // namespace
+
 // Cross-platform memory deallocation for C# interop
 // This should only be used in error paths before the buffer is returned to C#
 // Once returned to C#, the memory MUST be freed by Marshal.FreeCoTaskMem
-inline void FreeInteropMemory(void* ptr) {
+void FreeInteropMemory(void* ptr) {
+  if (ptr && callerBuffer && ptr == callerBuffer->data) {
+    return;  // Owned by the caller of a CallerBufferScope
+  }
 #ifdef _WIN32
   CoTaskMemFree(ptr);
 #else
@@ -45,6 +66,196 @@ inline void FreeInteropMemory(void* ptr) {
 #endif
 }
 
+namespace {
+// FlatBuffers allocator that takes its blocks from the interop heap, so the finished buffer can
+// be handed to C# as-is instead of being copied into a second allocation. Blocks count against
+// the memory budget until they are handed over; one that does not fit fails the serialization.
+// A CallerBufferScope's buffer backs the first block that fits it instead; that block is neither
+// counted nor freed here.
+class InteropAllocator final : public flatbuffers::Allocator {
+public:
+  uint8_t* allocate(size_t size) override {
+    if (callerBuffer && !callerBuffer->claimed && !callerBuffer->finished && callerBuffer->data &&
+        size <= callerBuffer->capacity) {
+      callerBuffer->claimed = true;
+      return callerBuffer->data;
+    }
+    auto& memory = MemoryTracker::instance();
+    if (!memory.tryAdd(MemorySubsystem::Interop, size)) {
+      throw std::bad_alloc();
+    }
+    auto* ptr = static_cast<uint8_t*>(AllocateInteropMemory(size));
+    if (!ptr) {
+      memory.remove(MemorySubsystem::Interop, size);
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  void deallocate(uint8_t* p, size_t size) override {
+    if (callerBuffer && p == callerBuffer->data) {
+      return;
+    }
+    FreeInteropMemory(p);
+    MemoryTracker::instance().remove(MemorySubsystem::Interop, size);
+  }
+};
+
+InteropAllocator interopAllocator;  // Stateless, shared by every builder
+
+// Room for the root offset, vtable, table, vector length prefixes and alignment padding on top of
+// the raw payload. Generous enough that a correctly sized builder never has to grow.
+constexpr size_t kBuilderOverhead = 256;
+
+// Builder whose initial block already fits `payloadBytes` of vector data, or is the whole buffer
+// of an unclaimed CallerBufferScope (rounded down to the builder's alignment, which the block size
+// is rounded up to)
+flatbuffers::FlatBufferBuilder makeInteropBuilder(size_t payloadBytes) {
+  if (callerBuffer && !callerBuffer->claimed && !callerBuffer->finished &&
+      callerBuffer->capacity >= alignof(std::max_align_t)) {
+    const auto capacity = callerBuffer->capacity & ~(alignof(std::max_align_t) - 1);
+    return flatbuffers::FlatBufferBuilder(capacity, &interopAllocator);
+  }
+  return flatbuffers::FlatBufferBuilder(payloadBytes + kBuilderOverhead, &interopAllocator);
+}
+
+// Take ownership of a finished builder's block and return it as the output buffer. FlatBuffers
+// fills its block back to front and the builder is sized with headroom, so the data almost never
+// starts at the block base; it is slid there with one in-place memmove over the whole output,
+// because C# frees the pointer it receives, which therefore has to be the allocation base. That
+// O(n) pass remains, only the second allocation and copy are saved. The buffer size is a multiple
+// of the builder's alignment, so the move keeps every field aligned.
+//
+// Inside a CallerBufferScope the output must have been built in the caller's buffer; one that
+// outgrew it is dropped and its size recorded for the caller to retry with.
+bool releaseToInterop(flatbuffers::FlatBufferBuilder& builder, uint8_t*& resBuffer, int& resSize) {
+  const size_t size = builder.GetSize();
+  size_t reserved = 0;
+  size_t offset = 0;
+  uint8_t* block = builder.ReleaseRaw(reserved, offset);
+  if (!block) {
+    return false;
+  }
+  if (auto* target = callerBuffer; target && !target->finished) {
+    target->finished = true;
+    if (block != target->data) {
+      FreeInteropMemory(block);
+      MemoryTracker::instance().remove(MemorySubsystem::Interop, reserved);
+      target->required = size;
+      return false;
+    }
+    if (offset != 0) {
+      std::memmove(block, block + offset, size);
+    }
+    resBuffer = block;
+    resSize = static_cast<int>(size);  // Fits: the capacity came from an int
+    profileBytesOut(size);
+    return true;
+  }
+  MemoryTracker::instance().remove(MemorySubsystem::Interop, reserved);  // C# owns it from here
+  if (size > static_cast<size_t>(INT_MAX)) {
+    FreeInteropMemory(block);
+    return false;  // Does not fit the int size of the C ABI
+  }
+
+  if (offset != 0) {
+    std::memmove(block, block + offset, size);
+  }
+  resBuffer = block;
+  resSize = static_cast<int>(size);
+  profileBytesOut(size);
+  return true;
+}
+
+}  // namespace
+
+CallerBufferScope::CallerBufferScope(uint8_t* buffer, int capacity) noexcept
+    : previous_(callerBuffer) {
+  target_.data = buffer;
+  target_.capacity = buffer && capacity > 0 ? static_cast<size_t>(capacity) : 0;
+  callerBuffer = &target_;
+}
+
+CallerBufferScope::~CallerBufferScope() {
+  callerBuffer = previous_;
+}
+
+int CallerBufferScope::requiredSize() const noexcept {
+  return target_.required <= static_cast<size_t>(INT_MAX) ? static_cast<int>(target_.required) : 0;
+}
+
+namespace {
+// Input size for the profiler; negative sizes are rejected by the verifier anyway
+std::size_t inputBytes(int size) {
+  return size > 0 ? static_cast<std::size_t>(size) : 0;
+}
+
+#ifdef GEOSHARPLUS_SERIALIZER_BENCH
+// serializer_bench compiles these sources in and turns the verifier off to measure its share of
+// deserialization; the library always verifies
+std::atomic<bool> verifyInputs{true};
+#endif
+
+// Check that an input buffer holds a well-formed `Table` before any field is read
+template <typename Table>
+bool verifyInput(const uint8_t* data, int size) {
+  if (!data || size <= 0) {
+    return false;
+  }
+#ifdef GEOSHARPLUS_SERIALIZER_BENCH
+  if (!verifyInputs.load(std::memory_order_relaxed)) {
+    return true;
+  }
+#endif
+  flatbuffers::Verifier verifier(data, static_cast<size_t>(size));
+  return verifier.VerifyBuffer<Table>();
+}
+
+// Map the vertex and face vectors of a verified MeshData (MeshDataF) table into a MeshView
+// (MeshViewF)
+template <typename Table, typename View>
+bool mapMeshView(const Table* meshData, View& view) {
+  if (!meshData) {
+    return false;
+  }
+
+  auto vertices = meshData->vertices();
+  if (!vertices) {
+    return false;
+  }
+  using Scalar = typename View::VertexMap::Scalar;
+  const auto* vertexData = reinterpret_cast<const Scalar*>(vertices->Data());
+
+  // Map faces - check if we have triangle or quad faces
+  auto triFaces = meshData->faces();
+  auto quadFaces = meshData->quad_faces();
+
+  if (quadFaces && quadFaces->size() > 0) {
+    view.reset(vertexData,
+               vertices->size(),
+               reinterpret_cast<const int*>(quadFaces->Data()),
+               quadFaces->size(),
+               4);
+  } else if (triFaces && triFaces->size() > 0) {
+    view.reset(vertexData,
+               vertices->size(),
+               reinterpret_cast<const int*>(triFaces->Data()),
+               triFaces->size(),
+               3);
+  } else {
+    return false;  // No faces found
+  }
+
+  return true;
+}
+}  // namespace
+
+#ifdef GEOSHARPLUS_SERIALIZER_BENCH
+void setBenchInputVerification(bool enabled) noexcept {
+  verifyInputs.store(enabled, std::memory_order_relaxed);
+}
+#endif
+
 // Helper template to get the element type of a container
 template <typename Container>
 struct element_type {
@@ -70,6 +281,39 @@ struct element_type<Eigen::MatrixXd> {
   using type = double;
 };
 
+// Helper to get the coordinate type of a point container
+template <typename PointContainer>
+struct point_scalar {
+  // Default for vectors of Eigen points
+  using type = typename PointContainer::value_type::Scalar;
+};
+
+template <>
+struct point_scalar<Eigen::MatrixXd> {
+  using type = double;
+};
+
+template <>
+struct point_scalar<MatrixX3f> {
+  using type = float;
+};
+
+// FlatBuffers point struct and table for each coordinate type
+template <typename Scalar>
+struct point_buffer;
+
+template <>
+struct point_buffer<double> {
+  using Vec = GSP::FB::Vec3;
+  using Table = GSP::FB::PointArrayData;
+};
+
+template <>
+struct point_buffer<float> {
+  using Vec = GSP::FB::Vec3f;
+  using Table = GSP::FB::PointArrayDataF;
+};
+
 // Helper to get the pair element type
 template <typename PairContainer>
 struct pair_element_type {
@@ -91,60 +335,43 @@ struct pair_element_type<Eigen::Matrix<double, Eigen::Dynamic, 2>> {
 // Unified number array serialization - detects both container and element types
 template <typename NumberContainer>
 bool serializeNumberArray(const NumberContainer& numbers, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
-
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
   // Extract value type from container
   using ValueType = typename element_type<NumberContainer>::type;
 
-  if constexpr (std::is_same_v<ValueType, double>) {
-    // Handle double values
-    std::vector<double> valueVector;
-
-    if constexpr (std::is_same_v<NumberContainer, std::vector<double>>) {
-      valueVector = numbers;
-    } else if constexpr (std::is_same_v<NumberContainer, Eigen::VectorXd>) {
-      valueVector = std::vector<double>(numbers.data(), numbers.data() + numbers.size());
-    }
-
-    auto valuesVector = builder.CreateVector(valueVector);
-    auto arrayOffset = GSP::FB::CreateDoubleArrayData(builder, valuesVector);
-    builder.Finish(arrayOffset);
-  } else if constexpr (std::is_same_v<ValueType, int>) {
-    // Handle integer values
-    std::vector<int32_t> valueVector;
-
-    if constexpr (std::is_same_v<NumberContainer, std::vector<int>>) {
-      valueVector = numbers;
-    } else if constexpr (std::is_same_v<NumberContainer, Eigen::VectorXi>) {
-      valueVector = std::vector<int>(numbers.data(), numbers.data() + numbers.size());
+  // Both std::vector and Eigen vectors are contiguous, so the values go straight into the builder
+  const auto count = static_cast<size_t>(numbers.size());
+  try {
+    auto builder = makeInteropBuilder(count * sizeof(ValueType));
+
+    if constexpr (std::is_same_v<ValueType, double>) {
+      // Handle double values
+      auto valuesVector = builder.CreateVector(numbers.data(), count);
+      auto arrayOffset = GSP::FB::CreateDoubleArrayData(builder, valuesVector);
+      builder.Finish(arrayOffset);
+    } else if constexpr (std::is_same_v<ValueType, int>) {
+      // Handle integer values
+      auto valuesVector = builder.CreateVector(numbers.data(), count);
+      auto arrayOffset = GSP::FB::CreateIntArrayData(builder, valuesVector);
+      builder.Finish(arrayOffset);
     }
 
-    auto valuesVector = builder.CreateVector(valueVector);
-    auto arrayOffset = GSP::FB::CreateIntArrayData(builder, valuesVector);
-    builder.Finish(arrayOffset);
-  }
-
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
     return false;  // Handle allocation failure
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
-
-  return true;
 }
 
 // Unified number array deserialization - detects container and element types
 template <typename NumberContainer>
 bool deserializeNumberArray(const uint8_t* data, int size, NumberContainer& numberArray) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
   // Extract value type from container
   using ValueType = typename element_type<NumberContainer>::type;
 
   if constexpr (std::is_same_v<ValueType, double>) {
     // Handle double values
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::DoubleArrayData>()) {
+    if (!verifyInput<GSP::FB::DoubleArrayData>(data, size)) {
       return false;
     }
 
@@ -169,8 +396,7 @@ bool deserializeNumberArray(const uint8_t* data, int size, NumberContainer& numb
     }
   } else if constexpr (std::is_same_v<ValueType, int>) {
     // Handle integer values
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::IntArrayData>()) {
+    if (!verifyInput<GSP::FB::IntArrayData>(data, size)) {
       return false;
     }
 
@@ -201,76 +427,63 @@ bool deserializeNumberArray(const uint8_t* data, int size, NumberContainer& numb
 // Unified number pair array serialization
 template <typename PairContainer>
 bool serializeNumberPairArray(const PairContainer& pairs, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
-
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
   // Extract element type from container
   using ElementType = typename pair_element_type<PairContainer>::type;
+  using StructType =
+      std::conditional_t<std::is_same_v<ElementType, int>, GSP::FB::Vec2i, GSP::FB::Vec2>;
 
-  if constexpr (std::is_same_v<ElementType, int>) {
-    // Handle integer pairs
-    std::vector<GSP::FB::Vec2i> pairVector;
+  size_t count = 0;
+  if constexpr (std::is_same_v<PairContainer, std::vector<std::pair<ElementType, ElementType>>>) {
+    count = pairs.size();
+  } else {
+    count = static_cast<size_t>(pairs.rows());
+  }
 
-    if constexpr (std::is_same_v<PairContainer, std::vector<std::pair<int, int>>>) {
-      // Handle std::vector<std::pair<int, int>>
-      pairVector.reserve(pairs.size());
-      for (const auto& p : pairs) {
-        pairVector.emplace_back(GSP::FB::Vec2i(p.first, p.second));
+  try {
+    auto builder = makeInteropBuilder(count * sizeof(StructType));
+
+    // Write the pairs directly into the builder's vector storage
+    StructType* dst = nullptr;
+    auto pairsVector = builder.CreateUninitializedVectorOfStructs(count, &dst);
+    if constexpr (std::is_same_v<PairContainer,
+                                 std::vector<std::pair<ElementType, ElementType>>>) {
+      // Handle std::vector<std::pair<T, T>>
+      for (size_t i = 0; i < count; ++i) {
+        dst[i] = StructType(pairs[i].first, pairs[i].second);
       }
-    } else if constexpr (std::is_same_v<PairContainer, Eigen::Matrix<int, Eigen::Dynamic, 2>>) {
-      // Handle Eigen::Matrix<int, Dynamic, 2>
-      pairVector.reserve(pairs.rows());
-      for (Eigen::Index i = 0; i < pairs.rows(); ++i) {
-        pairVector.emplace_back(GSP::FB::Vec2i(pairs(i, 0), pairs(i, 1)));
+    } else {
+      // Handle Eigen::Matrix<T, Dynamic, 2>
+      for (size_t i = 0; i < count; ++i) {
+        const auto row = static_cast<Eigen::Index>(i);
+        dst[i] = StructType(pairs(row, 0), pairs(row, 1));
       }
     }
 
-    auto pairsVector = builder.CreateVectorOfStructs(pairVector);
-    auto arrayOffset = GSP::FB::CreateIntPairArrayData(builder, pairsVector);
-    builder.Finish(arrayOffset);
-  } else if constexpr (std::is_same_v<ElementType, double>) {
-    // Handle double pairs
-    std::vector<GSP::FB::Vec2> pairVector;
-
-    if constexpr (std::is_same_v<PairContainer, std::vector<std::pair<double, double>>>) {
-      // Handle std::vector<std::pair<double, double>>
-      pairVector.reserve(pairs.size());
-      for (const auto& p : pairs) {
-        pairVector.emplace_back(GSP::FB::Vec2(p.first, p.second));
-      }
-    } else if constexpr (std::is_same_v<PairContainer, Eigen::Matrix<double, Eigen::Dynamic, 2>>) {
-      // Handle Eigen::Matrix<double, Dynamic, 2>
-      pairVector.reserve(pairs.rows());
-      for (Eigen::Index i = 0; i < pairs.rows(); ++i) {
-        pairVector.emplace_back(GSP::FB::Vec2(pairs(i, 0), pairs(i, 1)));
-      }
+    if constexpr (std::is_same_v<ElementType, int>) {
+      auto arrayOffset = GSP::FB::CreateIntPairArrayData(builder, pairsVector);
+      builder.Finish(arrayOffset);
+    } else if constexpr (std::is_same_v<ElementType, double>) {
+      auto arrayOffset = GSP::FB::CreateDoublePairArrayData(builder, pairsVector);
+      builder.Finish(arrayOffset);
     }
 
-    auto pairsVector = builder.CreateVectorOfStructs(pairVector);
-    auto arrayOffset = GSP::FB::CreateDoublePairArrayData(builder, pairsVector);
-    builder.Finish(arrayOffset);
-  }
-
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
     return false;  // Handle allocation failure
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
-
-  return true;
 }
 
 // Unified number pair array deserialization
 template <typename PairContainer>
 bool deserializeNumberPairArray(const uint8_t* data, int size, PairContainer& pairArray) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
   // Extract element type from container
   using ElementType = typename pair_element_type<PairContainer>::type;
 
   if constexpr (std::is_same_v<ElementType, int>) {
     // Handle integer pairs
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::IntPairArrayData>()) {
+    if (!verifyInput<GSP::FB::IntPairArrayData>(data, size)) {
       return false;
     }
 
@@ -304,8 +517,7 @@ bool deserializeNumberPairArray(const uint8_t* data, int size, PairContainer& pa
     }
   } else if constexpr (std::is_same_v<ElementType, double>) {
     // Handle double pairs
-    flatbuffers::Verifier verifier(data, size);
-    if (!verifier.VerifyBuffer<GSP::FB::DoublePairArrayData>()) {
+    if (!verifyInput<GSP::FB::DoublePairArrayData>(data, size)) {
       return false;
     }
 
@@ -343,26 +555,23 @@ bool deserializeNumberPairArray(const uint8_t* data, int size, PairContainer& pa
 }
 
 bool serializePoint(const Vector3d& point, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
+  try {
+    auto builder = makeInteropBuilder(sizeof(GSP::FB::Vec3));
 
-  auto vec = GSP::FB::Vec3(point[0], point[1], point[2]);
-  auto ptOffset = GSP::FB::CreatePointData(builder, &vec);
-  builder.Finish(ptOffset);
+    auto vec = GSP::FB::Vec3(point[0], point[1], point[2]);
+    auto ptOffset = GSP::FB::CreatePointData(builder, &vec);
+    builder.Finish(ptOffset);
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
     return false;  // Handle allocation failure
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
-
-  return true;
 }
 
 bool deserializePoint(const uint8_t* buffer, int size, Vector3d& point) {
-  flatbuffers::Verifier verifier(buffer, size);
-  if (!verifier.VerifyBuffer<GSP::FB::PointData>()) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
+  if (!verifyInput<GSP::FB::PointData>(buffer, size)) {
     return false;
   }
 
@@ -375,69 +584,90 @@ bool deserializePoint(const uint8_t* buffer, int size, Vector3d& point) {
   return true;
 }
 
-// Template function to handle both vector<Vector3d> and MatrixXd
+// Point lists and matrices of either precision; the coordinate type picks the table
 template <typename PointContainer>
 bool serializePointArray(const PointContainer& points, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
+  using Buffer = point_buffer<typename point_scalar<PointContainer>::type>;
+  using Vec = typename Buffer::Vec;
+  constexpr bool isList = std::is_same_v<PointContainer, std::vector<Vector3d>> ||
+                          std::is_same_v<PointContainer, std::vector<Vector3f>>;
+  size_t count = 0;
+  if constexpr (isList) {
+    count = points.size();
+  } else {
+    count = static_cast<size_t>(points.rows());
+  }
 
-  // Convert data to FlatBuffer vectors
-  std::vector<GSP::FB::Vec3> pointVector;
-  if constexpr (std::is_same_v<PointContainer, std::vector<Vector3d>>) {
-    // Handle std::vector<Vector3d>
-    pointVector.reserve(points.size());
-    for (const auto& p : points) {
-      pointVector.emplace_back(p.x(), p.y(), p.z());
-    }
-  } else if constexpr (std::is_same_v<PointContainer, Eigen::MatrixXd>) {
-    // Handle Eigen::MatrixXd
-    pointVector.reserve(points.rows());
-    for (Eigen::Index i = 0; i < points.rows(); ++i) {
-      pointVector.emplace_back(points(i, 0), points(i, 1), points(i, 2));
+  try {
+    auto builder = makeInteropBuilder(count * sizeof(Vec));
+
+    // Write the points directly into the builder's vector storage
+    Vec* dst = nullptr;
+    auto vecVector = builder.CreateUninitializedVectorOfStructs(count, &dst);
+    if constexpr (isList) {
+      // Handle std::vector<Vector3d> / std::vector<Vector3f>
+      for (size_t i = 0; i < count; ++i) {
+        dst[i] = Vec(points[i].x(), points[i].y(), points[i].z());
+      }
+    } else if constexpr (std::is_same_v<PointContainer, MatrixX3f>) {
+      // The row-major MatrixX3f already has the packed Vec3f layout
+      if (count > 0) {
+        std::memcpy(dst, points.data(), count * sizeof(Vec));
+      }
+    } else {
+      // Handle Eigen::MatrixXd (column-major, so gather each row)
+      for (size_t i = 0; i < count; ++i) {
+        const auto row = static_cast<Eigen::Index>(i);
+        dst[i] = Vec(points(row, 0), points(row, 1), points(row, 2));
+      }
     }
-  }
 
-  auto vecVector = builder.CreateVectorOfStructs(pointVector);
-  auto ptArray = GSP::FB::CreatePointArrayData(builder, vecVector);
-  builder.Finish(ptArray);
+    typename Buffer::Table::Builder ptArray(builder);
+    ptArray.add_points(vecVector);
+    builder.Finish(ptArray.Finish());
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
     return false;  // Handle allocation failure
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
-
-  return true;
 }
-// Template function to handle both vector<Vector3d> and MatrixXd output types
+// Point lists and matrices of either precision, from the table of that precision
 template <typename PointContainer>
 bool deserializePointArray(const uint8_t* data, int size, PointContainer& pointArray) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
+  using Table = typename point_buffer<typename point_scalar<PointContainer>::type>::Table;
   // Verify the buffer integrity
-  flatbuffers::Verifier verifier(data, size);
-  if (!verifier.VerifyBuffer<GSP::FB::PointArrayData>()) {
+  if (!verifyInput<Table>(data, size)) {
     return false;
   }
 
   // Get the vector from the buffer
-  auto ptArrayData = GSP::FB::GetPointArrayData(data);
-  if (!ptArrayData) {
+  auto ptArrayData = flatbuffers::GetRoot<Table>(data);
+  if (!ptArrayData || !ptArrayData->points()) {
     return false;
   }
 
   auto points = ptArrayData->points();
 
-  if constexpr (std::is_same_v<PointContainer, std::vector<Vector3d>>) {
+  if constexpr (std::is_same_v<PointContainer, std::vector<Vector3d>> ||
+                std::is_same_v<PointContainer, std::vector<Vector3f>>) {
     // Clear the output vector and reserve space for better performance
     pointArray.clear();
     pointArray.reserve(points->size());
 
-    // Convert each FlatBuffers Vec3 to an Eigen Vector3d
+    // Convert each FlatBuffers point to an Eigen vector
     for (size_t i = 0; i < points->size(); i++) {
       auto point = points->Get(i);
       pointArray.emplace_back(point->x(), point->y(), point->z());
     }
-  } else if constexpr (std::is_same_v<PointContainer, Eigen::MatrixXd>) {
+  } else if constexpr (std::is_same_v<PointContainer, MatrixX3f>) {
+    // Copy the packed Vec3f structs in bulk
+    pointArray.resize(points->size(), 3);
+    if (points->size() > 0) {
+      std::memcpy(pointArray.data(), points->Data(), points->size() * sizeof(GSP::FB::Vec3f));
+    }
+  } else {
     // Resize the matrix to hold all points
     pointArray.resize(points->size(), 3);
 
@@ -452,120 +682,126 @@ bool deserializePointArray(const uint8_t* data, int size, PointContainer& pointA
 }
 
 bool serializeMesh(const Mesh& mesh, uint8_t*& resBuffer, int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
-
-  // Convert vertices to flatbuffers compatible format
-  std::vector<GSP::FB::Vec3> vertices;
-  vertices.reserve(mesh.V.rows());
-  for (size_t i = 0; i < mesh.V.rows(); i++) {
-    vertices.emplace_back(mesh.V(i, 0), mesh.V(i, 1), mesh.V(i, 2));
-  }
-
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
   // Determine if this is a triangle or quad mesh
-  int faceCols = mesh.F.cols();
-  
-  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec3i*>> facesVector;
-  flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec4i*>> quadFacesVector;
-  
-  if (faceCols == 3) {
-    // Triangle mesh - use existing Vec3i format
-    std::vector<GSP::FB::Vec3i> faces;
-    faces.reserve(mesh.F.rows());
-    for (size_t i = 0; i < mesh.F.rows(); i++) {
-      faces.emplace_back(mesh.F(i, 0), mesh.F(i, 1), mesh.F(i, 2));
-    }
-    facesVector = builder.CreateVectorOfStructs(faces);
-  } else if (faceCols == 4) {
-    // Quad mesh - use Vec4i format
-    std::vector<GSP::FB::Vec4i> quadFaces;
-    quadFaces.reserve(mesh.F.rows());
-    for (size_t i = 0; i < mesh.F.rows(); i++) {
-      quadFaces.emplace_back(mesh.F(i, 0), mesh.F(i, 1), mesh.F(i, 2), mesh.F(i, 3));
-    }
-    quadFacesVector = builder.CreateVectorOfStructs(quadFaces);
-  } else {
-    // Invalid face count
-    return false;
+  const auto faceCols = mesh.F.cols();
+  if (faceCols != 3 && faceCols != 4) {
+    return false;  // Invalid face count
   }
 
-  // Create vertices vector
-  auto verticesVector = builder.CreateVectorOfStructs(vertices);
+  const auto numVertices = static_cast<size_t>(mesh.V.rows());
+  const auto numFaces = static_cast<size_t>(mesh.F.rows());
+
+  try {
+    auto builder = makeInteropBuilder(numVertices * sizeof(GSP::FB::Vec3) +
+                                      numFaces * faceCols * sizeof(int32_t));
+
+    // Faces: Eigen::MatrixXi is column-major, so gather each row into the packed structs
+    flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec3i*>> facesVector;
+    flatbuffers::Offset<flatbuffers::Vector<const GSP::FB::Vec4i*>> quadFacesVector;
+    if (faceCols == 3) {
+      // Triangle mesh - use existing Vec3i format
+      GSP::FB::Vec3i* faces = nullptr;
+      facesVector = builder.CreateUninitializedVectorOfStructs(numFaces, &faces);
+      for (size_t i = 0; i < numFaces; ++i) {
+        const auto f = static_cast<Eigen::Index>(i);
+        faces[i] = GSP::FB::Vec3i(mesh.F(f, 0), mesh.F(f, 1), mesh.F(f, 2));
+      }
+    } else {
+      // Quad mesh - use Vec4i format
+      GSP::FB::Vec4i* quadFaces = nullptr;
+      quadFacesVector = builder.CreateUninitializedVectorOfStructs(numFaces, &quadFaces);
+      for (size_t i = 0; i < numFaces; ++i) {
+        const auto f = static_cast<Eigen::Index>(i);
+        quadFaces[i] = GSP::FB::Vec4i(mesh.F(f, 0), mesh.F(f, 1), mesh.F(f, 2), mesh.F(f, 3));
+      }
+    }
+
+    // Vertices: the row-major MatrixX3d already has the packed Vec3 layout
+    GSP::FB::Vec3* vertices = nullptr;
+    auto verticesVector = builder.CreateUninitializedVectorOfStructs(numVertices, &vertices);
+    if (numVertices > 0) {
+      std::memcpy(vertices, mesh.V.data(), numVertices * sizeof(GSP::FB::Vec3));
+    }
 
-  // Create the mesh with appropriate face data
-  GSP::FB::MeshDataBuilder meshBuilder(builder);
-  meshBuilder.add_vertices(verticesVector);
-  
-  if (faceCols == 3) {
-    meshBuilder.add_faces(facesVector);
-  } else if (faceCols == 4) {
-    meshBuilder.add_quad_faces(quadFacesVector);
-  }
-  
-  auto meshOffset = meshBuilder.Finish();
-  builder.Finish(meshOffset);
+    // Create the mesh with appropriate face data
+    GSP::FB::MeshDataBuilder meshBuilder(builder);
+    meshBuilder.add_vertices(verticesVector);
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
+    if (faceCols == 3) {
+      meshBuilder.add_faces(facesVector);
+    } else {
+      meshBuilder.add_quad_faces(quadFacesVector);
+    }
+
+    auto meshOffset = meshBuilder.Finish();
+    builder.Finish(meshOffset);
+
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
     return false;  // Handle allocation failure
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
-
-  return true;
 }
 
-bool deserializeMesh(const uint8_t* data, int size, Mesh& mesh) {
+// FlatBuffers stores structs packed and little-endian, so a vector of Vec3 / Vec3i / Vec4i has
+// exactly the layout of a row-major Eigen matrix with 3 or 4 columns and can be mapped in place.
+static_assert(FLATBUFFERS_LITTLEENDIAN, "Mesh views require a little-endian target");
+static_assert(sizeof(GSP::FB::Vec3) == 3 * sizeof(double), "Vec3 must be 3 packed doubles");
+static_assert(sizeof(GSP::FB::Vec3f) == 3 * sizeof(float), "Vec3f must be 3 packed floats");
+static_assert(sizeof(GSP::FB::Vec3i) == 3 * sizeof(int), "Vec3i must be 3 packed ints");
+static_assert(sizeof(GSP::FB::Vec4i) == 4 * sizeof(int), "Vec4i must be 4 packed ints");
+
+bool deserializeMeshView(const uint8_t* data, int size, MeshView& view) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
   // Verify the buffer integrity
-  flatbuffers::Verifier verifier(data, size);
-  if (!verifier.VerifyBuffer<GSP::FB::MeshData>()) {
+  if (!verifyInput<GSP::FB::MeshData>(data, size)) {
     return false;
   }
 
   // Get the mesh data from the buffer
-  auto meshData = GSP::FB::GetMeshData(data);
-  if (!meshData) {
+  return mapMeshView(GSP::FB::GetMeshData(data), view);
+}
+
+bool deserializeMeshViewF(const uint8_t* data, int size, MeshViewF& view) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
+  if (!verifyInput<GSP::FB::MeshDataF>(data, size)) {
     return false;
   }
 
-  // Extract vertices
-  auto vertices = meshData->vertices();
-  if (!vertices) {
+  return mapMeshView(GSP::FB::GetMeshDataF(data), view);
+}
+
+bool deserializeMeshArrayView(const uint8_t* data, int size, std::vector<MeshView>& views) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
+  // One verifier pass covers every nested mesh
+  if (!verifyInput<GSP::FB::MeshArrayData>(data, size)) {
     return false;
   }
-  mesh.V.resize(vertices->size(), 3);
-  for (size_t i = 0; i < vertices->size(); i++) {
-    auto vertex = vertices->Get(i);
-    mesh.V.row(i) = Eigen::Vector3d(vertex->x(), vertex->y(), vertex->z()).transpose();
-  }
 
-  // Extract faces - check if we have triangle or quad faces
-  auto triFaces = meshData->faces();
-  auto quadFaces = meshData->quad_faces();
-  
-  if (quadFaces && quadFaces->size() > 0) {
-    // Quad mesh
-    mesh.F.resize(quadFaces->size(), 4);
-    for (size_t i = 0; i < quadFaces->size(); i++) {
-      auto face = quadFaces->Get(i);
-      mesh.F(i, 0) = face->x();
-      mesh.F(i, 1) = face->y();
-      mesh.F(i, 2) = face->z();
-      mesh.F(i, 3) = face->w();
-    }
-  } else if (triFaces && triFaces->size() > 0) {
-    // Triangle mesh
-    mesh.F.resize(triFaces->size(), 3);
-    for (size_t i = 0; i < triFaces->size(); i++) {
-      auto face = triFaces->Get(i);
-      mesh.F(i, 0) = face->x();
-      mesh.F(i, 1) = face->y();
-      mesh.F(i, 2) = face->z();
+  const auto* meshes = GSP::FB::GetMeshArrayData(data)->meshes();
+  if (!meshes) {
+    return false;
+  }
+  views.clear();
+  views.resize(meshes->size());
+  for (flatbuffers::uoffset_t i = 0; i < meshes->size(); ++i) {
+    if (!mapMeshView(meshes->Get(i), views[i])) {
+      return false;
     }
-  } else {
-    return false;  // No faces found
+  }
+  return true;
+}
+
+bool deserializeMesh(const uint8_t* data, int size, Mesh& mesh) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
+  // Map the buffer first, then copy V and F in bulk instead of element by element
+  MeshView view;
+  if (!deserializeMeshView(data, size, view)) {
+    return false;
   }
 
+  mesh.V = view.V;
+  mesh.F = view.F;
   return true;
 }
 
@@ -613,55 +849,65 @@ template bool deserializeNumberPairArray(const uint8_t* data,
 template bool
 serializePointArray(const std::vector<Vector3d>& points, uint8_t*& resBuffer, int& resSize);
 template bool serializePointArray(const Eigen::MatrixXd& points, uint8_t*& resBuffer, int& resSize);
+template bool
+serializePointArray(const std::vector<Vector3f>& points, uint8_t*& resBuffer, int& resSize);
+template bool serializePointArray(const MatrixX3f& points, uint8_t*& resBuffer, int& resSize);
 
 // Explicit instantiations to ensure the template is compiled for these types
 template bool
 deserializePointArray(const uint8_t* data, int size, std::vector<Vector3d>& pointArray);
 template bool deserializePointArray(const uint8_t* data, int size, Eigen::MatrixXd& pointArray);
+template bool
+deserializePointArray(const uint8_t* data, int size, std::vector<Vector3f>& pointArray);
+template bool deserializePointArray(const uint8_t* data, int size, MatrixX3f& pointArray);
 
 // Serialize nested integer arrays (vector<vector<int>>)
 bool serializeNestedIntArray(const std::vector<std::vector<int>>& nestedArray,
                              uint8_t*& resBuffer,
                              int& resSize) {
-  flatbuffers::FlatBufferBuilder builder;
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
+  size_t totalValues = 0;
+  for (const auto& subArray : nestedArray) {
+    totalValues += subArray.size();
+  }
 
-  // Flatten the nested array and keep track of sizes
-  std::vector<int> flatArray;
-  std::vector<int> sizes;
+  try {
+    auto builder = makeInteropBuilder((totalValues + nestedArray.size()) * sizeof(int32_t));
 
-  for (const auto& subArray : nestedArray) {
-    sizes.push_back(static_cast<int>(subArray.size()));
-    for (int value : subArray) {
-      flatArray.push_back(value);
+    // Flatten the nested array straight into the builder
+    int32_t* values = nullptr;
+    auto valuesVector = builder.CreateUninitializedVector(totalValues, &values);
+    for (const auto& subArray : nestedArray) {
+      if (!subArray.empty()) {
+        std::memcpy(values, subArray.data(), subArray.size() * sizeof(int32_t));
+        values += subArray.size();
+      }
     }
-  }
 
-  // Create vectors in flatbuffers
-  auto valuesVector = builder.CreateVector(flatArray);
-  auto sizesVector = builder.CreateVector(sizes);
+    // Record the sub-array sizes
+    int32_t* sizes = nullptr;
+    auto sizesVector = builder.CreateUninitializedVector(nestedArray.size(), &sizes);
+    for (size_t i = 0; i < nestedArray.size(); ++i) {
+      sizes[i] = static_cast<int32_t>(nestedArray[i].size());
+    }
 
-  // Create the nested array data
-  auto nestedArrayOffset = GSP::FB::CreateIntNestedArrayData(builder, valuesVector, sizesVector);
-  builder.Finish(nestedArrayOffset);
+    // Create the nested array data
+    auto nestedArrayOffset = GSP::FB::CreateIntNestedArrayData(builder, valuesVector, sizesVector);
+    builder.Finish(nestedArrayOffset);
 
-  // Copy the serialized data to the provided buffer
-  resSize = builder.GetSize();
-  resBuffer = static_cast<uint8_t*>(AllocateInteropMemory(resSize));
-  if (!resBuffer) {
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
     return false;  // Handle allocation failure
   }
-  std::memcpy(resBuffer, builder.GetBufferPointer(), resSize);
-
-  return true;
 }
 
 // Deserialize nested integer arrays
 bool deserializeNestedIntArray(const uint8_t* data,
                                int size,
                                std::vector<std::vector<int>>& nestedArray) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
   // Verify the buffer integrity
-  flatbuffers::Verifier verifier(data, size);
-  if (!verifier.VerifyBuffer<GSP::FB::IntNestedArrayData>()) {
+  if (!verifyInput<GSP::FB::IntNestedArrayData>(data, size)) {
     return false;
   }
 
@@ -695,4 +941,270 @@ bool deserializeNestedIntArray(const uint8_t* data,
 
   return true;
 }
+
+// ! Pipelines
+static_assert(static_cast<int>(PipelineOp::Count) ==
+                  static_cast<int>(GSP::FB::PipelineOp::MAX) + 1,
+              "PipelineOp must match the schema");
+
+bool deserializePipeline(const uint8_t* data, int size, Pipeline& pipeline) {
+  const ProfilePhaseScope phase(ProfilePhase::Deserialize, inputBytes(size));
+  if (!verifyInput<GSP::FB::PipelineData>(data, size)) {
+    return false;
+  }
+
+  const auto* pipelineData = GSP::FB::GetPipelineData(data);
+  const auto* steps = pipelineData->steps();
+  if (!steps) {
+    return false;
+  }
+  pipeline.steps.clear();
+  pipeline.steps.resize(steps->size());
+  for (flatbuffers::uoffset_t i = 0; i < steps->size(); ++i) {
+    const auto* stepData = steps->Get(i);
+    auto& step = pipeline.steps[i];
+    if (stepData->op() > GSP::FB::PipelineOp::MAX) {
+      return false;  // Written against a newer schema
+    }
+    step.op = static_cast<PipelineOp>(stepData->op());
+    if (const auto* inputs = stepData->inputs()) {
+      step.inputs.assign(inputs->begin(), inputs->end());
+    }
+    if (const auto* values = stepData->values()) {
+      step.values.assign(values->begin(), values->end());
+    }
+    step.meshHandle = stepData->mesh_handle();
+    step.hasMesh = stepData->mesh() != nullptr;
+    if (step.hasMesh && !mapMeshView(stepData->mesh(), step.mesh)) {
+      return false;
+    }
+  }
+
+  pipeline.outputs.clear();
+  if (const auto* outputs = pipelineData->outputs()) {
+    pipeline.outputs.assign(outputs->begin(), outputs->end());
+  }
+  return true;
+}
+
+bool serializePipelineResult(const std::vector<PipelineValue>& outputs,
+                             uint8_t*& resBuffer,
+                             int& resSize) {
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
+  size_t payloadBytes = 0;
+  for (const auto& output : outputs) {
+    if (output.data.cols() != 1 && output.data.cols() != 3) {
+      return false;
+    }
+    payloadBytes += static_cast<size_t>(output.data.size()) * sizeof(double) + 32;
+  }
+
+  try {
+    auto builder = makeInteropBuilder(payloadBytes);
+
+    std::vector<flatbuffers::Offset<GSP::FB::PipelineOutputData>> outputOffsets;
+    outputOffsets.reserve(outputs.size());
+    for (const auto& output : outputs) {
+      const auto& M = output.data;
+      const auto count = static_cast<size_t>(M.rows());
+      if (M.cols() == 3) {
+        GSP::FB::Vec3* dst = nullptr;
+        auto points = builder.CreateUninitializedVectorOfStructs(count, &dst);
+        for (size_t i = 0; i < count; ++i) {
+          const auto row = static_cast<Eigen::Index>(i);
+          dst[i] = GSP::FB::Vec3(M(row, 0), M(row, 1), M(row, 2));
+        }
+        outputOffsets.push_back(GSP::FB::CreatePipelineOutputData(builder, points));
+      } else {
+        auto values = builder.CreateVector(M.data(), count);
+        outputOffsets.push_back(GSP::FB::CreatePipelineOutputData(builder, 0, values));
+      }
+    }
+
+    auto resultOffset = GSP::FB::CreatePipelineResultDataDirect(builder, &outputOffsets);
+    builder.Finish(resultOffset);
+
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
+    return false;  // Handle allocation failure
+  }
+}
+
+// ! Result bundles
+namespace {
+using PairMatrix = Eigen::Matrix<int, Eigen::Dynamic, 2>;
+using NestedInts = std::vector<std::vector<int>>;
+
+// Room for a column's table, vtable and name on top of its vector data
+constexpr size_t kColumnOverhead = 64;
+
+template <typename Data>
+size_t columnBytes(const Data& data) {
+  if constexpr (std::is_same_v<Data, Eigen::MatrixXd>) {
+    return static_cast<size_t>(data.rows()) * sizeof(GSP::FB::Vec3);
+  } else if constexpr (std::is_same_v<Data, PairMatrix>) {
+    return static_cast<size_t>(data.rows()) * sizeof(GSP::FB::Vec2i);
+  } else if constexpr (std::is_same_v<Data, NestedInts>) {
+    size_t values = data.size();
+    for (const auto& subArray : data) {
+      values += subArray.size();
+    }
+    return values * sizeof(int32_t);
+  } else {
+    return static_cast<size_t>(data.size()) * sizeof(typename element_type<Data>::type);
+  }
+}
+
+template <typename Data>
+flatbuffers::Offset<GSP::FB::ResultColumnData>
+createResultColumn(flatbuffers::FlatBufferBuilder& builder, const char* name, const Data& data) {
+  const auto nameOffset = builder.CreateString(name ? name : "");
+  if constexpr (std::is_same_v<Data, Eigen::MatrixXd>) {
+    const auto count = static_cast<size_t>(data.rows());
+    GSP::FB::Vec3* dst = nullptr;
+    auto points = builder.CreateUninitializedVectorOfStructs(count, &dst);
+    for (size_t i = 0; i < count; ++i) {
+      const auto row = static_cast<Eigen::Index>(i);
+      dst[i] = GSP::FB::Vec3(data(row, 0), data(row, 1), data(row, 2));
+    }
+    return GSP::FB::CreateResultColumnData(
+        builder, nameOffset, GSP::FB::ResultColumnType::Points, points);
+  } else if constexpr (std::is_same_v<Data, PairMatrix>) {
+    const auto count = static_cast<size_t>(data.rows());
+    GSP::FB::Vec2i* dst = nullptr;
+    auto pairs = builder.CreateUninitializedVectorOfStructs(count, &dst);
+    for (size_t i = 0; i < count; ++i) {
+      const auto row = static_cast<Eigen::Index>(i);
+      dst[i] = GSP::FB::Vec2i(data(row, 0), data(row, 1));
+    }
+    return GSP::FB::CreateResultColumnData(
+        builder, nameOffset, GSP::FB::ResultColumnType::IntPairs, 0, 0, 0, pairs);
+  } else if constexpr (std::is_same_v<Data, NestedInts>) {
+    size_t totalValues = 0;
+    for (const auto& subArray : data) {
+      totalValues += subArray.size();
+    }
+    int32_t* values = nullptr;
+    auto valuesVector = builder.CreateUninitializedVector(totalValues, &values);
+    for (const auto& subArray : data) {
+      if (!subArray.empty()) {
+        std::memcpy(values, subArray.data(), subArray.size() * sizeof(int32_t));
+        values += subArray.size();
+      }
+    }
+    int32_t* sizes = nullptr;
+    auto sizesVector = builder.CreateUninitializedVector(data.size(), &sizes);
+    for (size_t i = 0; i < data.size(); ++i) {
+      sizes[i] = static_cast<int32_t>(data[i].size());
+    }
+    return GSP::FB::CreateResultColumnData(builder,
+                                           nameOffset,
+                                           GSP::FB::ResultColumnType::NestedInts,
+                                           0,
+                                           0,
+                                           valuesVector,
+                                           0,
+                                           sizesVector);
+  } else if constexpr (std::is_same_v<typename element_type<Data>::type, double>) {
+    auto values = builder.CreateVector(data.data(), static_cast<size_t>(data.size()));
+    return GSP::FB::CreateResultColumnData(
+        builder, nameOffset, GSP::FB::ResultColumnType::Doubles, 0, values);
+  } else {
+    auto values = builder.CreateVector(data.data(), static_cast<size_t>(data.size()));
+    return GSP::FB::CreateResultColumnData(
+        builder, nameOffset, GSP::FB::ResultColumnType::Ints, 0, 0, values);
+  }
+}
+}  // namespace
+
+bool serializeResultColumn(const ResultColumn& column, uint8_t*& resBuffer, int& resSize) {
+  return std::visit(
+      [&](const auto* data) {
+        using Data = std::remove_cvref_t<decltype(*data)>;
+        if (!data) {
+          return false;
+        }
+        if constexpr (std::is_same_v<Data, Eigen::MatrixXd>) {
+          return serializePointArray(*data, resBuffer, resSize);
+        } else if constexpr (std::is_same_v<Data, PairMatrix>) {
+          return serializeNumberPairArray(*data, resBuffer, resSize);
+        } else if constexpr (std::is_same_v<Data, NestedInts>) {
+          return serializeNestedIntArray(*data, resBuffer, resSize);
+        } else {
+          return serializeNumberArray(*data, resBuffer, resSize);
+        }
+      },
+      column.data);
+}
+
+bool serializeResultBundle(const std::vector<ResultColumn>& columns,
+                           uint8_t*& resBuffer,
+                           int& resSize) {
+  const ProfilePhaseScope phase(ProfilePhase::Serialize);
+  size_t payloadBytes = 0;
+  for (const auto& column : columns) {
+    if (std::visit([](const auto* data) { return data == nullptr; }, column.data)) {
+      return false;
+    }
+    payloadBytes +=
+        std::visit([](const auto* data) { return columnBytes(*data); }, column.data) +
+        kColumnOverhead;
+  }
+
+  try {
+    auto builder = makeInteropBuilder(payloadBytes);
+
+    std::vector<flatbuffers::Offset<GSP::FB::ResultColumnData>> columnOffsets;
+    columnOffsets.reserve(columns.size());
+    for (const auto& column : columns) {
+      columnOffsets.push_back(std::visit(
+          [&](const auto* data) { return createResultColumn(builder, column.name, *data); },
+          column.data));
+    }
+
+    auto bundleOffset = GSP::FB::CreateResultBundleDataDirect(builder, &columnOffsets);
+    builder.Finish(bundleOffset);
+
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
+    return false;  // Handle allocation failure
+  }
+}
+
+// ! Diagnostics
+bool serializeProfileSnapshot(const std::vector<ProfileEntry>& entries,
+                              uint8_t*& resBuffer,
+                              int& resSize) {
+  try {
+    auto builder = makeInteropBuilder(entries.size() * (sizeof(ProfileEntry) + 32));
+
+    std::vector<flatbuffers::Offset<GSP::FB::ProfileEntryData>> entryOffsets;
+    entryOffsets.reserve(entries.size());
+    for (const auto& entry : entries) {
+      const auto deserialize = static_cast<int>(ProfilePhase::Deserialize);
+      const auto compute = static_cast<int>(ProfilePhase::Compute);
+      const auto serialize = static_cast<int>(ProfilePhase::Serialize);
+      entryOffsets.push_back(GSP::FB::CreateProfileEntryDataDirect(builder,
+                                                                   entry.name.c_str(),
+                                                                   entry.calls,
+                                                                   entry.totalNs,
+                                                                   entry.maxNs,
+                                                                   entry.phaseNs[deserialize],
+                                                                   entry.phaseMaxNs[deserialize],
+                                                                   entry.phaseNs[compute],
+                                                                   entry.phaseMaxNs[compute],
+                                                                   entry.phaseNs[serialize],
+                                                                   entry.phaseMaxNs[serialize],
+                                                                   entry.bytesIn,
+                                                                   entry.bytesOut));
+    }
+
+    auto snapshotOffset = GSP::FB::CreateProfileSnapshotDataDirect(builder, &entryOffsets);
+    builder.Finish(snapshotOffset);
+
+    return releaseToInterop(builder, resBuffer, resSize);
+  } catch (const std::bad_alloc&) {
+    return false;  // Handle allocation failure
+  }
+}
 }  // namespace GeoSharPlusCPP::Serialization
@@ -0,0 +1,91 @@
+using Rhino.Geometry;
+
+namespace GSP {
+/// <summary>
+/// Owns a mesh uploaded to the native library with IGM_mesh_create. Pass <see cref="Value"/> to
+/// the `_h` functions of <see cref="NativeBridge"/> to reuse the mesh across calls without
+/// serializing it again. The native mesh is released on Dispose (or by the finalizer).
+/// </summary>
+public sealed class MeshHandle : IDisposable {
+  private ulong _handle;
+
+  private MeshHandle(ulong handle) {
+    _handle = handle;
+  }
+
+  /// <summary>
+  /// Native handle value; 0 once the handle has been disposed
+  /// </summary>
+  public ulong Value => _handle;
+
+  public bool IsValid => _handle != 0;
+
+  /// <summary>
+  /// Serializes the mesh once and uploads it to the native library.
+  /// </summary>
+  public static MeshHandle FromMesh(Mesh mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBuffer(mesh);
+    if (!NativeBridge.IGM_mesh_create(meshBuffer, meshBuffer.Length, out ulong handle)) {
+      throw new InvalidOperationException("Failed to create a native mesh handle.");
+    }
+
+    return new MeshHandle(handle);
+  }
+
+  /// <summary>
+  /// Uploads the mesh and builds its distance index (AABB tree, plus the fast winding number BVH
+  /// for signedType 4) so that signed distance queries on the handle skip the build.
+  /// </summary>
+  public static MeshHandle ForDistanceQueries(Mesh mesh, int signedType = 4) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBuffer(mesh);
+    if (!NativeBridge.IGM_distance_index_build(
+            meshBuffer, meshBuffer.Length, signedType, out ulong handle)) {
+      throw new InvalidOperationException("Failed to build a native distance index.");
+    }
+
+    return new MeshHandle(handle);
+  }
+
+  /// <summary>
+  /// Moves the vertices of the native mesh, keeping its faces and the topology data computed so
+  /// far. The point count must match the mesh's vertex count.
+  /// </summary>
+  public bool UpdateVertices(Point3d[] vertices) {
+    if (vertices == null)
+      throw new ArgumentNullException(nameof(vertices));
+    if (_handle == 0)
+      throw new ObjectDisposedException(nameof(MeshHandle));
+
+    var pointsBuffer = Wrapper.ToPointArrayBuffer(vertices);
+    return NativeBridge.IGM_mesh_update_vertices(_handle, pointsBuffer, pointsBuffer.Length);
+  }
+
+  public bool UpdateVertices(Mesh mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    return UpdateVertices(mesh.Vertices.ToPoint3dArray());
+  }
+
+  public void Dispose() {
+    Release();
+    GC.SuppressFinalize(this);
+  }
+
+  ~MeshHandle() {
+    Release();
+  }
+
+  private void Release() {
+    var handle = Interlocked.Exchange(ref _handle, 0);
+    if (handle != 0)
+      NativeBridge.IGM_mesh_release(handle);
+  }
+}
+}
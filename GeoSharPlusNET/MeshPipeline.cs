@@ -0,0 +1,186 @@
+using System.Runtime.InteropServices;
+using Google.FlatBuffers;
+using Rhino.Geometry;
+
+namespace GSP {
+/// <summary>
+/// One output of <see cref="MeshPipeline.Run"/>: points or vectors for Normals, Barycenters and
+/// Isolines steps, numbers for the others.
+/// </summary>
+public sealed class PipelineOutput {
+  public Point3d[] Points { get; init; } = Array.Empty<Point3d>();
+  public double[] Values { get; init; } = Array.Empty<double>();
+}
+
+/// <summary>
+/// Chains mesh operations that run natively in one IGM_pipeline_run call: intermediate results
+/// stay in native memory, independent branches run in parallel and only the steps marked with
+/// <see cref="Output"/> are serialized back. Each method adds a step and returns its index, to
+/// be passed as the input of later steps.
+/// </summary>
+public sealed class MeshPipeline {
+  private sealed class Step {
+    public FB.PipelineOp Op;
+    public int[] Inputs = Array.Empty<int>();
+    public double[]? Values;
+    public Mesh? Mesh;
+    public ulong MeshHandle;
+  }
+
+  private readonly List<Step> _steps = new List<Step>();
+  private readonly List<int> _outputs = new List<int>();
+
+  /// <summary>
+  /// Source mesh, serialized into the pipeline description
+  /// </summary>
+  public int Mesh(Mesh mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    return Add(new Step { Op = FB.PipelineOp.Mesh, Mesh = mesh });
+  }
+
+  /// <summary>
+  /// Source mesh already uploaded to the native library
+  /// </summary>
+  public int Mesh(MeshHandle mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+    if (!mesh.IsValid)
+      throw new ObjectDisposedException(nameof(MeshHandle));
+
+    return Add(new Step { Op = FB.PipelineOp.Mesh, MeshHandle = mesh.Value });
+  }
+
+  /// <summary>
+  /// Constant numbers, e.g. the iso values of <see cref="Isolines"/>
+  /// </summary>
+  public int Values(IEnumerable<double> values) {
+    if (values == null)
+      throw new ArgumentNullException(nameof(values));
+
+    return Add(new Step { Op = FB.PipelineOp.Values, Values = values.ToArray() });
+  }
+
+  public int VertexNormals(int mesh) => Add(FB.PipelineOp.VertexNormals, mesh);
+
+  public int FaceNormals(int mesh) => Add(FB.PipelineOp.FaceNormals, mesh);
+
+  public int Barycenters(int mesh) => Add(FB.PipelineOp.Barycenters, mesh);
+
+  public int GaussianCurvature(int mesh) => Add(FB.PipelineOp.GaussianCurvature, mesh);
+
+  /// <summary>
+  /// Per-vertex numbers averaged onto the faces
+  /// </summary>
+  public int RemapVtoF(int mesh, int vertexValues) =>
+      Add(FB.PipelineOp.RemapVtoF, mesh, vertexValues);
+
+  /// <summary>
+  /// Per-face numbers averaged onto the vertices
+  /// </summary>
+  public int RemapFtoV(int mesh, int faceValues) =>
+      Add(FB.PipelineOp.RemapFtoV, mesh, faceValues);
+
+  /// <summary>
+  /// Points on the isolines of a per-vertex scalar field, as IGM_extract_isolines
+  /// </summary>
+  public int Isolines(int mesh, int scalarField, int isoValues) =>
+      Add(FB.PipelineOp.Isolines, mesh, scalarField, isoValues);
+
+  /// <summary>
+  /// Returns the result of `step` from <see cref="Run"/>, at the position of this call among the
+  /// outputs. Mesh steps cannot be outputs.
+  /// </summary>
+  public MeshPipeline Output(int step) {
+    CheckStep(step);
+    if (_steps[step].Op == FB.PipelineOp.Mesh)
+      throw new ArgumentException("Mesh steps cannot be outputs.", nameof(step));
+
+    _outputs.Add(step);
+    return this;
+  }
+
+  /// <summary>
+  /// Runs the pipeline and returns one result per <see cref="Output"/> call, in order.
+  /// </summary>
+  public List<PipelineOutput> Run() {
+    var inBuffer = ToPipelineBuffer();
+    if (!NativeBridge.IGM_pipeline_run(
+            inBuffer, inBuffer.Length, out IntPtr outBuffer, out int outSize) ||
+        outBuffer == IntPtr.Zero) {
+      throw new InvalidOperationException("Failed to run the native pipeline.");
+    }
+
+    var byteArray = new byte[outSize];
+    Marshal.Copy(outBuffer, byteArray, 0, outSize);
+    Marshal.FreeCoTaskMem(outBuffer);
+
+    var result = FB.PipelineResultData.GetRootAsPipelineResultData(new ByteBuffer(byteArray));
+    var outputs = new List<PipelineOutput>(result.OutputsLength);
+    for (int i = 0; i < result.OutputsLength; i++) {
+      var output = result.Outputs(i);
+      if (!output.HasValue) {
+        outputs.Add(new PipelineOutput());
+        continue;
+      }
+
+      var points = new Point3d[output.Value.PointsLength];
+      for (int j = 0; j < points.Length; j++) {
+        var point = output.Value.Points(j);
+        if (point.HasValue) {
+          points[j] = new Point3d(point.Value.X, point.Value.Y, point.Value.Z);
+        }
+      }
+      outputs.Add(new PipelineOutput {
+        Points = points,
+        Values = output.Value.GetValuesArray() ?? Array.Empty<double>(),
+      });
+    }
+
+    return outputs;
+  }
+
+  private int Add(Step step) {
+    _steps.Add(step);
+    return _steps.Count - 1;
+  }
+
+  private int Add(FB.PipelineOp op, params int[] inputs) {
+    foreach (var input in inputs) {
+      CheckStep(input);
+    }
+
+    return Add(new Step { Op = op, Inputs = inputs });
+  }
+
+  private void CheckStep(int step) {
+    if (step < 0 || step >= _steps.Count)
+      throw new ArgumentOutOfRangeException(nameof(step));
+  }
+
+  private byte[] ToPipelineBuffer() {
+    var builder = new FlatBufferBuilder(1024);
+
+    var stepOffsets = new Offset<FB.PipelineStepData>[_steps.Count];
+    for (int i = 0; i < _steps.Count; i++) {
+      var step = _steps[i];
+      var meshOffset = step.Mesh != null ? Wrapper.AddMeshData(builder, step.Mesh, false)
+                                         : default(Offset<FB.MeshData>);
+      var inputsOffset = FB.PipelineStepData.CreateInputsVector(builder, step.Inputs);
+      var valuesOffset = step.Values != null
+                             ? FB.PipelineStepData.CreateValuesVector(builder, step.Values)
+                             : default(VectorOffset);
+      stepOffsets[i] = FB.PipelineStepData.CreatePipelineStepData(
+          builder, step.Op, inputsOffset, valuesOffset, meshOffset, step.MeshHandle);
+    }
+
+    var stepsOffset = FB.PipelineData.CreateStepsVector(builder, stepOffsets);
+    var outputsOffset = FB.PipelineData.CreateOutputsVector(builder, _outputs.ToArray());
+    var pipelineOffset = FB.PipelineData.CreatePipelineData(builder, stepsOffset, outputsOffset);
+    builder.Finish(pipelineOffset.Value);
+
+    return builder.SizedByteArray();
+  }
+}
+}
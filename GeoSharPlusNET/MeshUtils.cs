@@ -1,4 +1,5 @@
 ﻿using Rhino.Geometry;
+using System.Buffers;
 using System.Runtime.InteropServices;
 
 namespace GSP {
@@ -92,17 +93,11 @@ public static class MeshUtils {
       throw new ArgumentNullException(nameof(rMesh));
 
     var meshBuffer = Wrapper.ToMeshBuffer(rMesh);
-    NativeBridge.IGM_barycenter(
-        meshBuffer, meshBuffer.Length, out IntPtr outBuffer, out int outSize);
-
-    // Copy the result from unmanaged memory to a managed byte array
-    var byteArray = new byte[outSize];
-    Marshal.Copy(outBuffer, byteArray, 0, outSize);
-    Marshal.FreeCoTaskMem(outBuffer);  // Free the unmanaged memory
+    var outPt = CallInto(IntoEx(NativeBridge.IGM_barycenter_ex, meshBuffer),
+                         IntoCapacity(TriangleCount(rMesh), 24),
+                         Wrapper.FromPointArrayBufferToList);
 
-    var outPt = Wrapper.FromPointArrayBuffer(byteArray).ToList();
-
-    return outPt;
+    return outPt ?? new List<Point3d>();
   }
 
   /// <summary>
@@ -117,23 +112,12 @@ public static class MeshUtils {
     // Serialize mesh to buffer
     var meshBuffer = Wrapper.ToMeshBuffer(mesh);
 
-    // Call the native function
-    var success = NativeBridge.IGM_vert_normals(
-        meshBuffer, meshBuffer.Length, out IntPtr outBuffer, out int outSize);
-
-    if (!success || outBuffer == IntPtr.Zero) {
-      return new List<Vector3d>();
-    }
-
-    // Copy the result from unmanaged memory to a managed byte array
-    var byteArray = new byte[outSize];
-    Marshal.Copy(outBuffer, byteArray, 0, outSize);
-    Marshal.FreeCoTaskMem(outBuffer);  // Free the unmanaged memory
-
-    // Deserialize the result
-    var normals = Wrapper.FromVector3dArrayBuffer(byteArray).ToList();
+    // Call the native function, deserializing straight from the pooled output buffer
+    var normals = CallInto(IntoEx(NativeBridge.IGM_vert_normals_ex, meshBuffer),
+                           IntoCapacity(mesh.Vertices.Count, 24),
+                           Wrapper.FromVector3dArrayBufferToList);
 
-    return normals;
+    return normals ?? new List<Vector3d>();
   }
 
   /// <summary>
@@ -148,23 +132,59 @@ public static class MeshUtils {
     // Serialize mesh to buffer
     var meshBuffer = Wrapper.ToMeshBuffer(mesh);
 
-    // Call the native function
-    var success = NativeBridge.IGM_face_normals(
-        meshBuffer, meshBuffer.Length, out IntPtr outBuffer, out int outSize);
+    // Call the native function, deserializing straight from the pooled output buffer
+    var normals = CallInto(IntoEx(NativeBridge.IGM_face_normals_ex, meshBuffer),
+                           IntoCapacity(TriangleCount(mesh), 24),
+                           Wrapper.FromVector3dArrayBufferToList);
+
+    return normals ?? new List<Vector3d>();
+  }
 
+  /// <summary>
+  /// Computes the barycenter of each face in single precision, sending and receiving half the
+  /// bytes of <see cref="GetBarycenter"/>; for display and other uses that do not need doubles.
+  /// </summary>
+  /// <param name="mesh">Input mesh</param>
+  /// <returns>Face barycenters</returns>
+  public static Point3f[] GetBarycenterF(ref Mesh mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBufferF(mesh);
+    var success = NativeBridge.IGM_barycenter_f(
+        meshBuffer, meshBuffer.Length, out IntPtr outBuffer, out int outSize);
     if (!success || outBuffer == IntPtr.Zero) {
-      return new List<Vector3d>();
+      return Array.Empty<Point3f>();
     }
 
-    // Copy the result from unmanaged memory to a managed byte array
     var byteArray = new byte[outSize];
     Marshal.Copy(outBuffer, byteArray, 0, outSize);
     Marshal.FreeCoTaskMem(outBuffer);  // Free the unmanaged memory
 
-    // Deserialize the result
-    var normals = Wrapper.FromVector3dArrayBuffer(byteArray).ToList();
+    return Wrapper.FromPointArrayFBuffer(byteArray);
+  }
+
+  /// <summary>
+  /// Computes per-face normals in single precision, as <see cref="GetBarycenterF"/>.
+  /// </summary>
+  /// <param name="mesh">Input mesh</param>
+  /// <returns>Unit face normals; zero for degenerate faces</returns>
+  public static Vector3f[] GetNormalFaceF(ref Mesh mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBufferF(mesh);
+    var success = NativeBridge.IGM_face_normals_f(
+        meshBuffer, meshBuffer.Length, out IntPtr outBuffer, out int outSize);
+    if (!success || outBuffer == IntPtr.Zero) {
+      return Array.Empty<Vector3f>();
+    }
+
+    var byteArray = new byte[outSize];
+    Marshal.Copy(outBuffer, byteArray, 0, outSize);
+    Marshal.FreeCoTaskMem(outBuffer);  // Free the unmanaged memory
 
-    return normals;
+    return Wrapper.FromVector3fArrayBuffer(byteArray);
   }
 
   /// <summary>
@@ -226,44 +246,19 @@ public static class MeshUtils {
     // Serialize mesh to buffer
     var meshBuffer = Wrapper.ToMeshBuffer(mesh);
 
-    // Call the native function with multiple outputs
-    var success = NativeBridge.IGM_edge_normals(meshBuffer,
-                                                meshBuffer.Length,
-                                                weightingType,
-                                                out IntPtr enBuffer,
-                                                out int enSize,
-                                                out IntPtr eiBuffer,
-                                                out int eiSize,
-                                                out IntPtr emapBuffer,
-                                                out int emapSize);
-
-    if (!success) {
+    // All three outputs come back in one buffer
+    var bundle = CallExBundle(
+        (ref NativeBridge.MeshInput input, ref NativeBridge.CallOptions options) =>
+            NativeBridge.IGM_edge_normals_ex(ref input, weightingType, ref options),
+        meshBuffer);
+    if (bundle == null) {
       return (new List<Vector3d>(), new List<List<int>>(), new List<int>());
     }
 
-    // Process edge normals
-    var enBytes = new byte[enSize];
-    Marshal.Copy(enBuffer, enBytes, 0, enSize);
-    Marshal.FreeCoTaskMem(enBuffer);
-    var edgeNormals = Wrapper.FromVector3dArrayBuffer(enBytes).ToList();
-
-    // Process edge indices
-    var eiBytes = new byte[eiSize];
-    Marshal.Copy(eiBuffer, eiBytes, 0, eiSize);
-    Marshal.FreeCoTaskMem(eiBuffer);
-    var indices = Wrapper.FromIntPairArrayBufferToList(eiBytes);
-
-    // Convert to the expected List<List<int>> format
-    var edgeIndices = new List<List<int>>();
-    foreach (var pair in indices) {
-      edgeIndices.Add(new List<int> { pair.Item1, pair.Item2 });
-    }
-
-    // Process edge map
-    var emapBytes = new byte[emapSize];
-    Marshal.Copy(emapBuffer, emapBytes, 0, emapSize);
-    Marshal.FreeCoTaskMem(emapBuffer);
-    var edgeMap = Wrapper.FromIntArrayBufferToList(emapBytes);
+    var edgeNormals = bundle.Vectors("EN");
+    var edgeIndices =
+        bundle.IntPairs("EI").ConvertAll(pair => new List<int> { pair.Item1, pair.Item2 });
+    var edgeMap = bundle.Ints("EMAP");
 
     return (edgeNormals, edgeIndices, edgeMap);
   }
@@ -302,41 +297,26 @@ public static class MeshUtils {
   /// Gets the vertex-triangle adjacency for a mesh.
   /// /// </summary>
   /// <param name="mesh">Input mesh</param>
+  /// <param name="outputs">Outputs to compute; the others are returned empty</param>
   /// <returns>Tuple containing vertex-triangle adjacency and vertex-triangle
   /// indices</returns> <exception cref="ArgumentNullException"></exception>
-  public static (List<List<int>> VT, List<List<int>> VTI) GetAdjacencyVT(ref Mesh mesh) {
+  public static (List<List<int>> VT, List<List<int>> VTI)
+      GetAdjacencyVT(ref Mesh mesh, VertexTriangleOutputs outputs = VertexTriangleOutputs.All) {
     if (mesh == null)
       throw new ArgumentNullException(nameof(mesh));
 
     // Serialize mesh to buffer
     var meshBuffer = Wrapper.ToMeshBuffer(mesh);
 
-    // Call the native function to get vertex-triangle adjacency
-    var success = NativeBridge.IGM_vert_tri_adjacency(meshBuffer,
-                                                      meshBuffer.Length,
-                                                      out IntPtr outBufferVT,
-                                                      out int outSizeVT,
-                                                      out IntPtr outBufferVTI,
-                                                      out int outSizeVTI);
-    if (!success || outBufferVT == IntPtr.Zero || outBufferVTI == IntPtr.Zero) {
+    // Only the selected outputs come back, in one buffer
+    var bundle =
+        CallExBundle(NativeBridge.IGM_vert_tri_adjacency_ex, meshBuffer, mask: (uint)outputs);
+    if (bundle == null) {
       return (new List<List<int>>(), new List<List<int>>());
     }
 
-    // Copy the VT result from unmanaged memory to a managed byte array
-    var byteArrayVT = new byte[outSizeVT];
-    Marshal.Copy(outBufferVT, byteArrayVT, 0, outSizeVT);
-    Marshal.FreeCoTaskMem(outBufferVT);  // Free the unmanaged memory
-
-    // Copy the VTI result from unmanaged memory to a managed byte array
-    var byteArrayVTI = new byte[outSizeVTI];
-    Marshal.Copy(outBufferVTI, byteArrayVTI, 0, outSizeVTI);
-    Marshal.FreeCoTaskMem(outBufferVTI);  // Free the unmanaged memory
-
-    // Deserialize the results into lists of lists of integers
-    var vtAdjacency = Wrapper.FromNestedIntArrayBuffer(byteArrayVT);
-    var vtiAdjacency = Wrapper.FromNestedIntArrayBuffer(byteArrayVTI);
-
-    return (vtAdjacency, vtiAdjacency);
+    return (bundle.Contains("VT") ? bundle.NestedInts("VT") : new List<List<int>>(),
+            bundle.Contains("VTI") ? bundle.NestedInts("VTI") : new List<List<int>>());
   }
 
   /// <summary>
@@ -552,58 +532,34 @@ public static class MeshUtils {
   /// /// </summary>
   /// <param name="mesh">Input mesh</param>
   /// <param name="radius">Radius parameter for curvature computation</param>
+  /// <param name="outputs">Outputs to return; the others are returned empty</param>
   /// <returns>Tuple containing principal directions and values</returns>
   /// <exception cref="ArgumentNullException"></exception>
   public static (List<Vector3d> PD1, List<Vector3d> PD2, List<double> PV1, List<double> PV2)
-      GetPrincipalCurvature(ref Mesh mesh, uint radius = 5) {
+      GetPrincipalCurvature(ref Mesh mesh,
+                            uint radius = 5,
+                            PrincipalCurvatureOutputs outputs = PrincipalCurvatureOutputs.All) {
     if (mesh == null)
       throw new ArgumentNullException(nameof(mesh));
 
     // Serialize mesh to buffer
     var meshBuffer = Wrapper.ToMeshBuffer(mesh);
 
-    // Call the native function
-    var success = NativeBridge.IGM_principal_curvature(meshBuffer,
-                                                       meshBuffer.Length,
-                                                       radius,
-                                                       out IntPtr obPD1,
-                                                       out int obsPD1,
-                                                       out IntPtr obPD2,
-                                                       out int obsPD2,
-                                                       out IntPtr obPV1,
-                                                       out int obsPV1,
-                                                       out IntPtr obPV2,
-                                                       out int obsPV2);
+    // Only the selected outputs come back, in one buffer
+    var bundle = CallExBundle(
+        (ref NativeBridge.MeshInput input, ref NativeBridge.CallOptions options) =>
+            NativeBridge.IGM_principal_curvature_ex(ref input, radius, ref options),
+        meshBuffer,
+        mask: (uint)outputs);
 
-    if (!success) {
+    if (bundle == null) {
       return (new List<Vector3d>(), new List<Vector3d>(), new List<double>(), new List<double>());
     }
 
-    // Process PD1 (principal direction 1)
-    var pd1Bytes = new byte[obsPD1];
-    Marshal.Copy(obPD1, pd1Bytes, 0, obsPD1);
-    Marshal.FreeCoTaskMem(obPD1);
-    var pd1 = Wrapper.FromVector3dArrayBuffer(pd1Bytes).ToList();
-
-    // Process PD2 (principal direction 2)
-    var pd2Bytes = new byte[obsPD2];
-    Marshal.Copy(obPD2, pd2Bytes, 0, obsPD2);
-    Marshal.FreeCoTaskMem(obPD2);
-    var pd2 = Wrapper.FromVector3dArrayBuffer(pd2Bytes).ToList();
-
-    // Process PV1 (principal value 1)
-    var pv1Bytes = new byte[obsPV1];
-    Marshal.Copy(obPV1, pv1Bytes, 0, obsPV1);
-    Marshal.FreeCoTaskMem(obPV1);
-    var pv1 = Wrapper.FromDoubleArrayBufferToList(pv1Bytes);
-
-    // Process PV2 (principal value 2)
-    var pv2Bytes = new byte[obsPV2];
-    Marshal.Copy(obPV2, pv2Bytes, 0, obsPV2);
-    Marshal.FreeCoTaskMem(obPV2);
-    var pv2 = Wrapper.FromDoubleArrayBufferToList(pv2Bytes);
-
-    return (pd1, pd2, pv1, pv2);
+    return (bundle.Contains("PD1") ? bundle.Vectors("PD1") : new List<Vector3d>(),
+            bundle.Contains("PD2") ? bundle.Vectors("PD2") : new List<Vector3d>(),
+            bundle.Contains("PV1") ? bundle.Doubles("PV1") : new List<double>(),
+            bundle.Contains("PV2") ? bundle.Doubles("PV2") : new List<double>());
   }
 
   /// <summary>
@@ -619,22 +575,12 @@ public static class MeshUtils {
     // Serialize mesh to buffer
     var meshBuffer = Wrapper.ToMeshBuffer(mesh);
 
-    // Call the native function
-    var success = NativeBridge.IGM_gaussian_curvature(
-        meshBuffer, meshBuffer.Length, out IntPtr outBuffer, out int outSize);
+    // Call the native function, deserializing straight from the pooled output buffer
+    var curvatures = CallInto(IntoEx(NativeBridge.IGM_gaussian_curvature_ex, meshBuffer),
+                              IntoCapacity(mesh.Vertices.Count, 8),
+                              Wrapper.FromDoubleArrayBufferToList);
 
-    if (!success || outBuffer == IntPtr.Zero) {
-      return new List<double>();
-    }
-
-    // Copy the result from unmanaged memory to a managed byte array
-    var byteArray = new byte[outSize];
-    Marshal.Copy(outBuffer, byteArray, 0, outSize);
-    Marshal.FreeCoTaskMem(outBuffer);  // Free the unmanaged memory
-
-    // Deserialize the result
-    var curvatures = Wrapper.FromDoubleArrayBufferToList(byteArray);
-    return curvatures;
+    return curvatures ?? new List<double>();
   }
 
   /// <summary>
@@ -679,16 +625,87 @@ public static class MeshUtils {
     return windingNumbers;
   }
 
+  /// <summary>
+  /// Precomputes fast winding number data (BVH and expansion coefficients) for repeated
+  /// inside/outside queries, kept in a memory-bounded native cache.
+  /// </summary>
+  /// <param name="mesh">Input mesh</param>
+  /// <param name="order">Expansion order: 0, 1 or 2 (most accurate)</param>
+  /// <returns>Handle for the precomputed data, or 0 on failure</returns>
+  /// <exception cref="ArgumentNullException"></exception>
+  public static ulong CreateFastWindingNumber(ref Mesh mesh, int order = 2) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBuffer(mesh);
+    if (!NativeBridge.IGM_fast_winding_number_create(
+            meshBuffer, meshBuffer.Length, order, out ulong handle))
+      return 0;
+
+    return handle;
+  }
+
+  /// <summary>
+  /// Computes winding numbers with a handle from CreateFastWindingNumber.
+  /// </summary>
+  /// <param name="windingNumberHandle">Handle from CreateFastWindingNumber</param>
+  /// <param name="queryPoints">Points to query</param>
+  /// <param name="windingNumbers">Winding number of each point</param>
+  /// <param name="accuracy">Accuracy parameter (beta); larger is more accurate and slower</param>
+  /// <returns>False if the handle was released or evicted from the cache</returns>
+  /// <exception cref="ArgumentNullException"></exception>
+  public static bool TryGetFastWindingNumber(ulong windingNumberHandle,
+                                             ref List<Point3d> queryPoints,
+                                             out List<double> windingNumbers,
+                                             double accuracy = 2.0) {
+    if (queryPoints == null)
+      throw new ArgumentNullException(nameof(queryPoints));
+
+    windingNumbers = new List<double>();
+    var pointsBuffer = Wrapper.ToPointArrayBuffer(queryPoints);
+    var success = NativeBridge.IGM_fast_winding_number_query(windingNumberHandle,
+                                                             accuracy,
+                                                             pointsBuffer,
+                                                             pointsBuffer.Length,
+                                                             out IntPtr outBuffer,
+                                                             out int outSize);
+
+    if (!success || outBuffer == IntPtr.Zero) {
+      return false;
+    }
+
+    // Copy the result from unmanaged memory to a managed byte array
+    var byteArray = new byte[outSize];
+    Marshal.Copy(outBuffer, byteArray, 0, outSize);
+    Marshal.FreeCoTaskMem(outBuffer);  // Free the unmanaged memory
+
+    windingNumbers = Wrapper.FromDoubleArrayBufferToList(byteArray);
+    return true;
+  }
+
+  /// <summary>
+  /// Releases fast winding number data created with CreateFastWindingNumber.
+  /// </summary>
+  public static void ReleaseFastWindingNumber(ulong windingNumberHandle) {
+    if (windingNumberHandle != 0)
+      NativeBridge.IGM_fast_winding_number_release(windingNumberHandle);
+  }
+
   /// <summary>
   /// Computes signed distance from query points to a mesh.
   /// /// </summary>
   /// <param name="mesh">Input mesh</param>
   /// <param name="queryPoints">Points to query</param>
   /// <param name="signedType">Method for computing signed distance (1-4)</param>
+  /// <param name="outputs">Outputs to compute; the others are returned empty. Without
+  /// Distance the sign is not computed.</param>
   /// <returns>Tuple containing signed distances, face indices, and closest points</returns>
   /// <exception cref="ArgumentNullException"></exception>
   public static (List<double> SignedDistances, List<int> FaceIndices, List<Point3d> ClosestPoints)
-      GetSignedDistance(ref Mesh mesh, ref List<Point3d> queryPoints, int signedType = 4) {
+      GetSignedDistance(ref Mesh mesh,
+                        ref List<Point3d> queryPoints,
+                        int signedType = 4,
+                        SignedDistanceOutputs outputs = SignedDistanceOutputs.All) {
     if (mesh == null)
       throw new ArgumentNullException(nameof(mesh));
     if (queryPoints == null)
@@ -701,42 +718,97 @@ public static class MeshUtils {
     var queryVector3ds = queryPoints.ConvertAll(p => new Vector3d(p.X, p.Y, p.Z));
     var pointsBuffer = Wrapper.ToPointArrayBuffer(queryVector3ds);
 
-    // Call the native function
-    var success = NativeBridge.IGM_signed_distance(meshBuffer,
-                                                   meshBuffer.Length,
-                                                   pointsBuffer,
-                                                   pointsBuffer.Length,
-                                                   signedType,
-                                                   out IntPtr sdBuffer,
-                                                   out int sdSize,
-                                                   out IntPtr fiBuffer,
-                                                   out int fiSize,
-                                                   out IntPtr cpBuffer,
-                                                   out int cpSize);
+    // Only the selected outputs come back, in one buffer
+    var bundle = CallExBundle(SignedDistanceEx(pointsBuffer, signedType),
+                              meshBuffer,
+                              mask: (uint)outputs);
 
-    if (!success) {
+    if (bundle == null) {
       return (new List<double>(), new List<int>(), new List<Point3d>());
     }
 
-    // Process signed distances
-    var sdBytes = new byte[sdSize];
-    Marshal.Copy(sdBuffer, sdBytes, 0, sdSize);
-    Marshal.FreeCoTaskMem(sdBuffer);
-    var signedDistances = Wrapper.FromDoubleArrayBufferToList(sdBytes);
+    return (bundle.Contains("S") ? bundle.Doubles("S") : new List<double>(),
+            bundle.Contains("I") ? bundle.Ints("I") : new List<int>(),
+            bundle.Contains("C") ? bundle.Points("C") : new List<Point3d>());
+  }
 
-    // Process face indices
-    var fiBytes = new byte[fiSize];
-    Marshal.Copy(fiBuffer, fiBytes, 0, fiSize);
-    Marshal.FreeCoTaskMem(fiBuffer);
-    var faceIndices = Wrapper.FromIntArrayBufferToList(fiBytes);
+  /// <summary>
+  /// Computes signed distance from query points to a mesh uploaded with
+  /// <see cref="MeshHandle.ForDistanceQueries"/>, reusing its distance index.
+  /// </summary>
+  /// <param name="mesh">Mesh handle</param>
+  /// <param name="queryPoints">Points to query</param>
+  /// <param name="signedType">Method for computing signed distance (1-4)</param>
+  /// <param name="outputs">Outputs to compute; the others are returned empty. Without
+  /// Distance the sign is not computed.</param>
+  /// <returns>Tuple containing signed distances, face indices, and closest points</returns>
+  /// <exception cref="ArgumentNullException"></exception>
+  public static (List<double> SignedDistances, List<int> FaceIndices, List<Point3d> ClosestPoints)
+      GetSignedDistance(MeshHandle mesh,
+                        ref List<Point3d> queryPoints,
+                        int signedType = 4,
+                        SignedDistanceOutputs outputs = SignedDistanceOutputs.All) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+    if (queryPoints == null)
+      throw new ArgumentNullException(nameof(queryPoints));
+
+    var pointsBuffer = Wrapper.ToPointArrayBuffer(queryPoints);
+
+    var bundle = CallExBundle(SignedDistanceEx(pointsBuffer, signedType),
+                              null,
+                              meshHandle: mesh.Value,
+                              mask: (uint)outputs);
+
+    if (bundle == null) {
+      return (new List<double>(), new List<int>(), new List<Point3d>());
+    }
+
+    return (bundle.Contains("S") ? bundle.Doubles("S") : new List<double>(),
+            bundle.Contains("I") ? bundle.Ints("I") : new List<int>(),
+            bundle.Contains("C") ? bundle.Points("C") : new List<Point3d>());
+  }
+
+  /// <summary>
+  /// Finds the closest mesh point of each query point in one native call.
+  /// </summary>
+  /// <param name="mesh">Input mesh</param>
+  /// <param name="queryPoints">Points to query</param>
+  /// <returns>Tuple containing closest points, indices of the faces of <paramref name="mesh"/>
+  /// they lie on, barycentric coordinates in the closest triangle (quad ABCD being split into ABC
+  /// and ACD), and unit vertex normals interpolated at the closest points</returns>
+  /// <exception cref="ArgumentNullException"></exception>
+  public static (List<Point3d> ClosestPoints,
+                 List<int> FaceIndices,
+                 List<Point3d> Barycentric,
+                 List<Vector3d> Normals)
+      GetClosestPointNormals(ref Mesh mesh, ref List<Point3d> queryPoints) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+    if (queryPoints == null)
+      throw new ArgumentNullException(nameof(queryPoints));
+
+    // Face indices must refer to the input mesh, not to a triangulated copy of it
+    var meshBuffer = Wrapper.ToMeshBuffer(mesh, out int[] faceOfTriangle);
+    var pointsBuffer = Wrapper.ToPointArrayBuffer(queryPoints);
 
-    // Process closest points
-    var cpBytes = new byte[cpSize];
-    Marshal.Copy(cpBuffer, cpBytes, 0, cpSize);
-    Marshal.FreeCoTaskMem(cpBuffer);
-    var closestPoints = Wrapper.FromPointArrayBuffer(cpBytes).ToList();
+    var bundle = CallExBundle(
+        (ref NativeBridge.MeshInput input, ref NativeBridge.CallOptions options) =>
+            NativeBridge.IGM_closest_point_normal_ex(
+                ref input, pointsBuffer, pointsBuffer.Length, ref options),
+        meshBuffer);
+
+    if (bundle == null) {
+      return (new List<Point3d>(), new List<int>(), new List<Point3d>(), new List<Vector3d>());
+    }
 
-    return (signedDistances, faceIndices, closestPoints);
+    var faceIndices = bundle.Ints("FI");
+    if (faceOfTriangle != null) {
+      for (int i = 0; i < faceIndices.Count; i++) {
+        faceIndices[i] = faceOfTriangle[faceIndices[i]];
+      }
+    }
+    return (bundle.Points("CP"), faceIndices, bundle.Points("BC"), bundle.Vectors("N"));
   }
 
   /// <summary>
@@ -967,6 +1039,73 @@ public static class MeshUtils {
     return distances;
   }
 
+  /// <summary>
+  /// Precomputes heat geodesics data and keeps it in the native LRU cache.
+  /// The cache is memory-bounded: a handle that has not been used for a while may be dropped,
+  /// in which case TryGetHeatGeodesicDistances fails and the data has to be created again.
+  /// </summary>
+  /// <param name="mesh">Input mesh for geodesic computations</param>
+  /// <returns>Handle for the precomputed data, or 0 on failure</returns>
+  /// <exception cref="ArgumentNullException"></exception>
+  public static ulong CreateHeatGeodesics(ref Mesh mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBuffer(mesh);
+    if (!NativeBridge.IGM_heat_geodesic_create(meshBuffer, meshBuffer.Length, out ulong handle))
+      return 0;
+
+    return handle;
+  }
+
+  /// <summary>
+  /// Computes heat-based geodesic distances from source vertices with a handle from
+  /// CreateHeatGeodesics.
+  /// </summary>
+  /// <param name="heatHandle">Handle from CreateHeatGeodesics</param>
+  /// <param name="sourceVertices">List of source vertex indices</param>
+  /// <param name="distances">Geodesic distances from sources to all vertices</param>
+  /// <returns>False if the handle was released or evicted from the cache</returns>
+  /// <exception cref="ArgumentNullException"></exception>
+  public static bool TryGetHeatGeodesicDistances(ulong heatHandle,
+                                                 ref List<int> sourceVertices,
+                                                 out List<double> distances) {
+    if (sourceVertices == null)
+      throw new ArgumentNullException(nameof(sourceVertices));
+
+    distances = new List<double>();
+    var sourcesBuffer = Wrapper.ToIntArrayBuffer(sourceVertices);
+    var success = NativeBridge.IGM_heat_geodesic_distance(
+        heatHandle, sourcesBuffer, sourcesBuffer.Length, out IntPtr outBuffer, out int outSize);
+
+    if (!success || outBuffer == IntPtr.Zero) {
+      return false;
+    }
+
+    // Copy the result from unmanaged memory to a managed byte array
+    var byteArray = new byte[outSize];
+    Marshal.Copy(outBuffer, byteArray, 0, outSize);
+    Marshal.FreeCoTaskMem(outBuffer);  // Free the unmanaged memory
+
+    distances = Wrapper.FromDoubleArrayBufferToList(byteArray);
+    return true;
+  }
+
+  /// <summary>
+  /// Releases heat geodesics data created with CreateHeatGeodesics.
+  /// </summary>
+  public static void ReleaseHeatGeodesics(ulong heatHandle) {
+    if (heatHandle != 0)
+      NativeBridge.IGM_heat_geodesic_release(heatHandle);
+  }
+
+  /// <summary>
+  /// Sets the memory limit of the native heat geodesics cache (0 = unlimited).
+  /// </summary>
+  public static void SetHeatGeodesicCacheLimit(ulong maxBytes) {
+    NativeBridge.IGM_heat_geodesic_set_cache_limit(maxBytes);
+  }
+
   /// <summary>
   /// Generates random or uniform distributed points on mesh surface.
   /// /// </summary>
@@ -1396,5 +1535,306 @@ public static class MeshUtils {
 
     return sum;
   }
+
+  private delegate bool IntoExport(byte[] outBuffer, int outCapacity, out int outSize);
+
+  // Run an export in the into mode with its output built directly in a pooled managed buffer
+  // (pinned for the call), instead of a native allocation that is copied and freed. `capacity`
+  // is a first estimate; a call that reports a larger size is retried once with it.
+  private static T? CallInto<T>(IntoExport export, int capacity, Func<byte[], T> read)
+      where T : class {
+    var pool = ArrayPool<byte>.Shared;
+    for (int attempt = 0; attempt < 2; attempt++) {
+      var buffer = pool.Rent(capacity);
+      try {
+        if (export(buffer, buffer.Length, out int outSize))
+          return read(buffer);
+        if (outSize <= buffer.Length)
+          return null;  // Failed for another reason than the size
+
+        capacity = outSize;
+      } finally {
+        pool.Return(buffer);
+      }
+    }
+
+    return null;
+  }
+
+  private delegate bool ExExport(ref NativeBridge.MeshInput mesh,
+                                 ref NativeBridge.CallOptions options);
+
+  // Run an `_ex` export on the MeshData in `meshBuffer` (a MeshArrayData with `batch`), or on the
+  // mesh handle `meshHandle` when it is null. The arrays the structs point to stay pinned for the
+  // call.
+  private static bool CallEx(ExExport export,
+                             byte[]? meshBuffer,
+                             ulong meshHandle,
+                             bool batch,
+                             int outputMode,
+                             uint outputMask,
+                             IntPtr[]? outBuffers,
+                             int[] outSizes,
+                             byte[]? callerBuffer = null) {
+    var pinned = new object?[] { meshBuffer, outBuffers, outSizes, callerBuffer };
+    var handles = new GCHandle[pinned.Length];
+    try {
+      for (int i = 0; i < pinned.Length; i++) {
+        if (pinned[i] != null)
+          handles[i] = GCHandle.Alloc(pinned[i], GCHandleType.Pinned);
+      }
+
+      var mesh = new NativeBridge.MeshInput {
+        Buffer = Address(handles[0]),
+        Size = meshBuffer?.Length ?? 0,
+        Handle = meshHandle,
+        Batch = batch ? 1 : 0,
+      };
+      var options = new NativeBridge.CallOptions {
+        OutputMode = outputMode,
+        OutputMask = outputMask,
+        OutBuffers = Address(handles[1]),
+        OutSizes = Address(handles[2]),
+        CallerBuffer = Address(handles[3]),
+        CallerCapacity = callerBuffer?.Length ?? 0,
+      };
+      return export(ref mesh, ref options);
+    } finally {
+      foreach (var handle in handles) {
+        if (handle.IsAllocated)
+          handle.Free();
+      }
+    }
+
+    static IntPtr Address(GCHandle handle) =>
+        handle.IsAllocated ? handle.AddrOfPinnedObject() : IntPtr.Zero;
+  }
+
+  // Run an `_ex` export with the outputs selected in `mask` returned in one result bundle; null
+  // if the call fails
+  private static ResultBundle? CallExBundle(ExExport export,
+                                            byte[]? meshBuffer,
+                                            ulong meshHandle = 0,
+                                            bool batch = false,
+                                            uint mask = NativeBridge.AllOutputs) {
+    var outBuffers = new IntPtr[1];
+    var outSizes = new int[1];
+    if (!CallEx(export,
+                meshBuffer,
+                meshHandle,
+                batch,
+                NativeBridge.OutputBundle,
+                mask,
+                outBuffers,
+                outSizes) ||
+        outBuffers[0] == IntPtr.Zero)
+      return null;
+
+    return ResultBundle.FromNative(outBuffers[0], outSizes[0]);
+  }
+
+  // Run an `_ex` export on a batch of meshes; the bundle's column N holds the entries per mesh
+  private static ResultBundle? CallExBatch(ExExport export, IList<Mesh> meshes) {
+    if (meshes == null)
+      throw new ArgumentNullException(nameof(meshes));
+
+    return CallExBundle(export, Wrapper.ToMeshArrayBuffer(meshes), batch: true);
+  }
+
+  // The into mode of a single-output `_ex` export on `meshBuffer`, for CallInto
+  private static IntoExport IntoEx(ExExport export, byte[] meshBuffer) =>
+      (byte[] outBuffer, int _, out int outSize) => {
+        var outSizes = new int[1];
+        var success = CallEx(export,
+                             meshBuffer,
+                             0,
+                             false,
+                             NativeBridge.OutputInto,
+                             NativeBridge.AllOutputs,
+                             null,
+                             outSizes,
+                             outBuffer);
+        outSize = outSizes[0];
+        return success;
+      };
+
+  // IGM_signed_distance_ex on `pointsBuffer`, as an ExExport
+  private static ExExport SignedDistanceEx(byte[] pointsBuffer, int signedType) =>
+      (ref NativeBridge.MeshInput mesh, ref NativeBridge.CallOptions options) =>
+          NativeBridge.IGM_signed_distance_ex(
+              ref mesh, pointsBuffer, pointsBuffer.Length, signedType, ref options);
+
+  // Size of a PointArrayData/DoubleArrayData output of `count` elements of `stride` bytes, with
+  // room for the FlatBuffers header and padding
+  private static int IntoCapacity(int count, int stride) => count * stride + 256;
+
+  // Faces of the mesh once serialized, quads being split in two triangles
+  private static int TriangleCount(Mesh mesh) =>
+      mesh.Faces.TriangleCount + 2 * mesh.Faces.QuadCount;
+
+  // Copy a native output into managed memory and free it
+  private static byte[] TakeNativeBuffer(IntPtr buffer, int size) {
+    var byteArray = new byte[size];
+    Marshal.Copy(buffer, byteArray, 0, size);
+    Marshal.FreeCoTaskMem(buffer);  // Free the unmanaged memory
+    return byteArray;
+  }
+
+  private delegate bool BatchExport(byte[] inBuffer,
+                                    int inSize,
+                                    out IntPtr outBuffer,
+                                    out int outSize,
+                                    out IntPtr outBufferSizes,
+                                    out int outSizeSizes);
+
+  // Run a *_batch export and return the stacked values buffer with the per-mesh sizes
+  private static (byte[] Values, int[] Sizes)?
+      CallBatch(BatchExport export, IList<Mesh> meshes, bool preserveQuads = false) {
+    if (meshes == null)
+      throw new ArgumentNullException(nameof(meshes));
+
+    var meshesBuffer = Wrapper.ToMeshArrayBuffer(meshes, preserveQuads);
+    var success = export(meshesBuffer,
+                         meshesBuffer.Length,
+                         out IntPtr outBuffer,
+                         out int outSize,
+                         out IntPtr outBufferSizes,
+                         out int outSizeSizes);
+    if (!success || outBuffer == IntPtr.Zero || outBufferSizes == IntPtr.Zero) {
+      return null;
+    }
+
+    var values = TakeNativeBuffer(outBuffer, outSize);
+    var sizes = Wrapper.FromIntArrayBuffer(TakeNativeBuffer(outBufferSizes, outSizeSizes));
+    return (values, sizes);
+  }
+
+  /// <summary>
+  /// Computes the centroid of each mesh in one native call.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <returns>One centroid per mesh</returns>
+  public static List<Point3d> GetCentroidBatch(IList<Mesh> meshes) {
+    if (meshes == null)
+      throw new ArgumentNullException(nameof(meshes));
+
+    var meshesBuffer = Wrapper.ToMeshArrayBuffer(meshes);
+    var success = NativeBridge.IGM_centroid_batch(
+        meshesBuffer, meshesBuffer.Length, out IntPtr outBuffer, out int outSize);
+    if (!success || outBuffer == IntPtr.Zero) {
+      return new List<Point3d>();
+    }
+
+    return Wrapper.FromPointArrayBufferToList(TakeNativeBuffer(outBuffer, outSize));
+  }
+
+  /// <summary>
+  /// Computes the face barycenters of each mesh in one native call.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <returns>Face barycenters, one list per mesh</returns>
+  public static List<List<Point3d>> GetBarycenterBatch(IList<Mesh> meshes) {
+    var bundle = CallExBatch(NativeBridge.IGM_barycenter_ex, meshes);
+    if (bundle == null)
+      return new List<List<Point3d>>();
+
+    return Wrapper.SplitBySizes(bundle.Points("BC"), bundle.Ints("N").ToArray());
+  }
+
+  /// <summary>
+  /// Computes per-vertex normals of each mesh in one native call.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <returns>Vertex normals, one list per mesh</returns>
+  public static List<List<Vector3d>> GetNormalVertBatch(IList<Mesh> meshes) {
+    var bundle = CallExBatch(NativeBridge.IGM_vert_normals_ex, meshes);
+    if (bundle == null)
+      return new List<List<Vector3d>>();
+
+    return Wrapper.SplitBySizes(bundle.Vectors("VN"), bundle.Ints("N").ToArray());
+  }
+
+  /// <summary>
+  /// Computes per-face normals of each mesh in one native call.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <returns>Face normals, one list per mesh</returns>
+  public static List<List<Vector3d>> GetNormalFaceBatch(IList<Mesh> meshes) {
+    var bundle = CallExBatch(NativeBridge.IGM_face_normals_ex, meshes);
+    if (bundle == null)
+      return new List<List<Vector3d>>();
+
+    return Wrapper.SplitBySizes(bundle.Vectors("FN"), bundle.Ints("N").ToArray());
+  }
+
+  /// <summary>
+  /// Computes principal curvature directions and values of each mesh in one native call.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <param name="radius">Radius parameter for curvature computation</param>
+  /// <returns>Principal directions and values, one list per mesh</returns>
+  public static (List<List<Vector3d>> PD1,
+                 List<List<Vector3d>> PD2,
+                 List<List<double>> PV1,
+                 List<List<double>> PV2)
+      GetPrincipalCurvatureBatch(IList<Mesh> meshes, uint radius = 5) {
+    var bundle = CallExBatch(
+        (ref NativeBridge.MeshInput input, ref NativeBridge.CallOptions options) =>
+            NativeBridge.IGM_principal_curvature_ex(ref input, radius, ref options),
+        meshes);
+    if (bundle == null) {
+      return (new List<List<Vector3d>>(),
+              new List<List<Vector3d>>(),
+              new List<List<double>>(),
+              new List<List<double>>());
+    }
+
+    var sizes = bundle.Ints("N").ToArray();
+    return (Wrapper.SplitBySizes(bundle.Vectors("PD1"), sizes),
+            Wrapper.SplitBySizes(bundle.Vectors("PD2"), sizes),
+            Wrapper.SplitBySizes(bundle.Doubles("PV1"), sizes),
+            Wrapper.SplitBySizes(bundle.Doubles("PV2"), sizes));
+  }
+
+  /// <summary>
+  /// Computes Gaussian curvature of each mesh in one native call.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <returns>Per-vertex Gaussian curvature, one list per mesh</returns>
+  public static List<List<double>> GetGaussianCurvatureBatch(IList<Mesh> meshes) {
+    var bundle = CallExBatch(NativeBridge.IGM_gaussian_curvature_ex, meshes);
+    if (bundle == null)
+      return new List<List<double>>();
+
+    return Wrapper.SplitBySizes(bundle.Doubles("K"), bundle.Ints("N").ToArray());
+  }
+
+  /// <summary>
+  /// Gets the boundary loops of each mesh in one native call.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <returns>Boundary loops, one list of loops per mesh</returns>
+  public static List<List<List<int>>> GetBoundaryLoopBatch(IList<Mesh> meshes) {
+    var result = CallBatch(NativeBridge.IGM_boundary_loop_batch, meshes);
+    if (result == null)
+      return new List<List<List<int>>>();
+
+    var (values, sizes) = result.Value;
+    return Wrapper.SplitBySizes(Wrapper.FromNestedIntArrayBuffer(values), sizes);
+  }
+
+  /// <summary>
+  /// Computes quad planarity of each mesh in one native call. Triangle meshes report 0.
+  /// </summary>
+  /// <param name="meshes">Input meshes</param>
+  /// <returns>Per-face planarity, one list per mesh</returns>
+  public static List<List<double>> GetQuadPlanarityBatch(IList<Mesh> meshes) {
+    var result = CallBatch(NativeBridge.IGM_quad_planarity_batch, meshes, preserveQuads: true);
+    if (result == null)
+      return new List<List<double>>();
+
+    var (values, sizes) = result.Value;
+    return Wrapper.SplitBySizes(Wrapper.FromDoubleArrayBuffer(values), sizes);
+  }
 }
 }  // namespace GSP
@@ -1086,6 +1086,132 @@ public static class NativeBridge {
           inBuffer, inSize, inBufferSources, inSizeSources, out outBuffer, out outSize);
   }
 
+  // Heat Geodesic Create (integer handle, LRU cached)
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_heat_geodesic_create",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_heat_geodesic_createWin(byte[] inBuffer, int inSize, out ulong outHandle);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_heat_geodesic_create",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_heat_geodesic_createMac(byte[] inBuffer, int inSize, out ulong outHandle);
+
+  public static bool IGM_heat_geodesic_create(byte[] inBuffer, int inSize, out ulong outHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_heat_geodesic_createWin(inBuffer, inSize, out outHandle);
+    else
+      return IGM_heat_geodesic_createMac(inBuffer, inSize, out outHandle);
+  }
+
+  // Heat Geodesic Create from a mesh handle
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_heat_geodesic_create_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_heat_geodesic_create_hWin(ulong meshHandle, out ulong outHandle);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_heat_geodesic_create_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_heat_geodesic_create_hMac(ulong meshHandle, out ulong outHandle);
+
+  public static bool IGM_heat_geodesic_create_h(ulong meshHandle, out ulong outHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_heat_geodesic_create_hWin(meshHandle, out outHandle);
+    else
+      return IGM_heat_geodesic_create_hMac(meshHandle, out outHandle);
+  }
+
+  // Heat Geodesic Distance
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_heat_geodesic_distance",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_heat_geodesic_distanceWin(ulong heatHandle,
+                                                           byte[] inBufferSources,
+                                                           int inSizeSources,
+                                                           out IntPtr outBuffer,
+                                                           out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_heat_geodesic_distance",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_heat_geodesic_distanceMac(ulong heatHandle,
+                                                           byte[] inBufferSources,
+                                                           int inSizeSources,
+                                                           out IntPtr outBuffer,
+                                                           out int outSize);
+
+  public static bool IGM_heat_geodesic_distance(ulong heatHandle,
+                                                byte[] inBufferSources,
+                                                int inSizeSources,
+                                                out IntPtr outBuffer,
+                                                out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_heat_geodesic_distanceWin(heatHandle,
+                                           inBufferSources,
+                                           inSizeSources,
+                                           out outBuffer,
+                                           out outSize);
+    else
+      return IGM_heat_geodesic_distanceMac(heatHandle,
+                                           inBufferSources,
+                                           inSizeSources,
+                                           out outBuffer,
+                                           out outSize);
+  }
+
+  // Heat Geodesic Release
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_heat_geodesic_release",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_heat_geodesic_releaseWin(ulong heatHandle);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_heat_geodesic_release",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_heat_geodesic_releaseMac(ulong heatHandle);
+
+  public static bool IGM_heat_geodesic_release(ulong heatHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_heat_geodesic_releaseWin(heatHandle);
+    else
+      return IGM_heat_geodesic_releaseMac(heatHandle);
+  }
+
+  // Heat Geodesic Cache Limit
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_heat_geodesic_set_cache_limit",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_heat_geodesic_set_cache_limitWin(ulong maxBytes);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_heat_geodesic_set_cache_limit",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_heat_geodesic_set_cache_limitMac(ulong maxBytes);
+
+  public static void IGM_heat_geodesic_set_cache_limit(ulong maxBytes) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_heat_geodesic_set_cache_limitWin(maxBytes);
+    else
+      IGM_heat_geodesic_set_cache_limitMac(maxBytes);
+  }
+
+  // Heat Geodesic Cache Usage
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_heat_geodesic_cache_usage",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void
+  IGM_heat_geodesic_cache_usageWin(out ulong usedBytes, out int entryCount);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_heat_geodesic_cache_usage",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void
+  IGM_heat_geodesic_cache_usageMac(out ulong usedBytes, out int entryCount);
+
+  public static void IGM_heat_geodesic_cache_usage(out ulong usedBytes, out int entryCount) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_heat_geodesic_cache_usageWin(out usedBytes, out entryCount);
+    else
+      IGM_heat_geodesic_cache_usageMac(out usedBytes, out entryCount);
+  }
+
   // Random Points on Mesh
   [DllImport(WinLibName,
              EntryPoint = "IGM_random_point_on_mesh",
@@ -1266,5 +1392,2293 @@ public static class NativeBridge {
   }
 
 #endregion
+
+#region IG - MESH Handle Functions
+  // Same as the functions above, but taking a mesh handle from IGM_mesh_create
+  // instead of a serialized mesh buffer.
+
+  // Mesh Create -- upload a mesh once and get a handle for the `_h` functions
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_mesh_create", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_mesh_createWin(byte[] inBuffer, int inSize, out ulong outHandle);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_mesh_create", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_mesh_createMac(byte[] inBuffer, int inSize, out ulong outHandle);
+
+  public static bool IGM_mesh_create(byte[] inBuffer, int inSize, out ulong outHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_mesh_createWin(inBuffer, inSize, out outHandle);
+    else
+      return IGM_mesh_createMac(inBuffer, inSize, out outHandle);
+  }
+
+  // Mesh Release -- drop a handle returned by IGM_mesh_create
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_mesh_release", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_mesh_releaseWin(ulong meshHandle);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_mesh_release", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_mesh_releaseMac(ulong meshHandle);
+
+  public static bool IGM_mesh_release(ulong meshHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_mesh_releaseWin(meshHandle);
+    else
+      return IGM_mesh_releaseMac(meshHandle);
+  }
+
+  // Mesh Update Vertices -- move the vertices of a mesh handle, keeping its topology
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_mesh_update_vertices",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_mesh_update_verticesWin(ulong meshHandle, byte[] inBufferPoints, int inSizePoints);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_mesh_update_vertices",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_mesh_update_verticesMac(ulong meshHandle, byte[] inBufferPoints, int inSizePoints);
+
+  public static bool
+  IGM_mesh_update_vertices(ulong meshHandle, byte[] inBufferPoints, int inSizePoints) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_mesh_update_verticesWin(meshHandle, inBufferPoints, inSizePoints);
+    else
+      return IGM_mesh_update_verticesMac(meshHandle, inBufferPoints, inSizePoints);
+  }
+
+  // Mesh Dedup Stats
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_mesh_dedup_stats", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void
+  IGM_mesh_dedup_statsWin(out ulong hits, out ulong misses, out int entryCount);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_mesh_dedup_stats", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void
+  IGM_mesh_dedup_statsMac(out ulong hits, out ulong misses, out int entryCount);
+
+  public static void IGM_mesh_dedup_stats(out ulong hits, out ulong misses, out int entryCount) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_mesh_dedup_statsWin(out hits, out misses, out entryCount);
+    else
+      IGM_mesh_dedup_statsMac(out hits, out misses, out entryCount);
+  }
+
+  // Mesh Dedup Reset Stats
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_mesh_dedup_reset_stats",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_mesh_dedup_reset_statsWin();
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_mesh_dedup_reset_stats",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_mesh_dedup_reset_statsMac();
+
+  public static void IGM_mesh_dedup_reset_stats() {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_mesh_dedup_reset_statsWin();
+    else
+      IGM_mesh_dedup_reset_statsMac();
+  }
+
+  // Mesh Dedup Limit
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_mesh_dedup_set_limit",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_mesh_dedup_set_limitWin(ulong maxBytes);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_mesh_dedup_set_limit",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_mesh_dedup_set_limitMac(ulong maxBytes);
+
+  public static void IGM_mesh_dedup_set_limit(ulong maxBytes) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_mesh_dedup_set_limitWin(maxBytes);
+    else
+      IGM_mesh_dedup_set_limitMac(maxBytes);
+  }
+
+  // Set Num Threads
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_set_num_threads", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_set_num_threadsWin(int threadCount);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_set_num_threads", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_set_num_threadsMac(int threadCount);
+
+  public static bool IGM_set_num_threads(int threadCount) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_set_num_threadsWin(threadCount);
+    else
+      return IGM_set_num_threadsMac(threadCount);
+  }
+
+  // Get Num Threads
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_get_num_threads", CallingConvention = CallingConvention.Cdecl)]
+  private static extern int IGM_get_num_threadsWin();
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_get_num_threads", CallingConvention = CallingConvention.Cdecl)]
+  private static extern int IGM_get_num_threadsMac();
+
+  public static int IGM_get_num_threads() {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_get_num_threadsWin();
+    else
+      return IGM_get_num_threadsMac();
+  }
+
+  // Shutdown (stop the native worker threads before the library unloads)
+  [DllImport(WinLibName, EntryPoint = "IGM_shutdown", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_shutdownWin();
+  [DllImport(MacLibName, EntryPoint = "IGM_shutdown", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_shutdownMac();
+
+  public static void IGM_shutdown() {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_shutdownWin();
+    else
+      IGM_shutdownMac();
+  }
+
+  // Profile Snapshot (ProfileSnapshotData buffer)
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_profile_snapshot", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_profile_snapshotWin(out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_profile_snapshot", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_profile_snapshotMac(out IntPtr outBuffer, out int outSize);
+
+  public static bool IGM_profile_snapshot(out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_profile_snapshotWin(out outBuffer, out outSize);
+    else
+      return IGM_profile_snapshotMac(out outBuffer, out outSize);
+  }
+
+  // Profile Reset
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_profile_reset", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_profile_resetWin();
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_profile_reset", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_profile_resetMac();
+
+  public static void IGM_profile_reset() {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_profile_resetWin();
+    else
+      IGM_profile_resetMac();
+  }
+
+  // Trace Start (opt-in event trace, 0 = default capacity)
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_trace_start", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_trace_startWin(int capacity);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_trace_start", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_trace_startMac(int capacity);
+
+  public static bool IGM_trace_start(int capacity) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_trace_startWin(capacity);
+    else
+      return IGM_trace_startMac(capacity);
+  }
+
+  // Trace Stop
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_trace_stop", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_trace_stopWin();
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_trace_stop", CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_trace_stopMac();
+
+  public static void IGM_trace_stop() {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_trace_stopWin();
+    else
+      IGM_trace_stopMac();
+  }
+
+  // Trace Dump (Chrome trace JSON)
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_trace_dump", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_trace_dumpWin(string path);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_trace_dump", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_trace_dumpMac(string path);
+
+  public static bool IGM_trace_dump(string path) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_trace_dumpWin(path);
+    else
+      return IGM_trace_dumpMac(path);
+  }
+
+  // Memory Usage (subsystem -1 = total)
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_memory_usage", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_memory_usageWin(int subsystem, out ulong currentBytes, out ulong peakBytes);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_memory_usage", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_memory_usageMac(int subsystem, out ulong currentBytes, out ulong peakBytes);
+
+  public static bool IGM_memory_usage(int subsystem, out ulong currentBytes, out ulong peakBytes) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_memory_usageWin(subsystem, out currentBytes, out peakBytes);
+    else
+      return IGM_memory_usageMac(subsystem, out currentBytes, out peakBytes);
+  }
+
+  // Memory Reset Peaks
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_memory_reset_peaks",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_memory_reset_peaksWin();
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_memory_reset_peaks",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_memory_reset_peaksMac();
+
+  public static void IGM_memory_reset_peaks() {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_memory_reset_peaksWin();
+    else
+      IGM_memory_reset_peaksMac();
+  }
+
+  // Memory Budget (0 = no limit)
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_memory_set_budget",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_memory_set_budgetWin(ulong maxBytes);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_memory_set_budget",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern void IGM_memory_set_budgetMac(ulong maxBytes);
+
+  public static void IGM_memory_set_budget(ulong maxBytes) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      IGM_memory_set_budgetWin(maxBytes);
+    else
+      IGM_memory_set_budgetMac(maxBytes);
+  }
+
+  // Memory Budget
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_memory_get_budget",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern ulong IGM_memory_get_budgetWin();
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_memory_get_budget",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern ulong IGM_memory_get_budgetMac();
+
+  public static ulong IGM_memory_get_budget() {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_memory_get_budgetWin();
+    else
+      return IGM_memory_get_budgetMac();
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_write_triangle_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_write_triangle_mesh_hWin(ulong meshHandle, string filename);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_write_triangle_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_write_triangle_mesh_hMac(ulong meshHandle, string filename);
+
+  public static bool IGM_write_triangle_mesh_h(ulong meshHandle, string filename) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_write_triangle_mesh_hWin(meshHandle, filename);
+    else
+      return IGM_write_triangle_mesh_hMac(meshHandle, filename);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_centroid_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_centroid_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_centroid_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_centroid_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool IGM_centroid_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_centroid_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_centroid_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_barycenter_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_barycenter_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_barycenter_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_barycenter_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool IGM_barycenter_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_barycenter_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_barycenter_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_vert_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_vert_normals_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_vert_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_vert_normals_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool IGM_vert_normals_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_vert_normals_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_vert_normals_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_face_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_face_normals_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_face_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_face_normals_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool IGM_face_normals_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_face_normals_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_face_normals_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_corner_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_corner_normals_hWin(ulong meshHandle,
+                                                     double threshold_deg,
+                                                     out IntPtr outBuffer,
+                                                     out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_corner_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_corner_normals_hMac(ulong meshHandle,
+                                                     double threshold_deg,
+                                                     out IntPtr outBuffer,
+                                                     out int outSize);
+
+  public static bool IGM_corner_normals_h(ulong meshHandle,
+                                          double threshold_deg,
+                                          out IntPtr outBuffer,
+                                          out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_corner_normals_hWin(meshHandle, threshold_deg, out outBuffer, out outSize);
+    else
+      return IGM_corner_normals_hMac(meshHandle, threshold_deg, out outBuffer, out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_edge_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_edge_normals_hWin(ulong meshHandle,
+                                                   int weightingType,
+                                                   out IntPtr outBufferA,
+                                                   out int outSizeA,
+                                                   out IntPtr outBufferB,
+                                                   out int outSizeB,
+                                                   out IntPtr outBufferC,
+                                                   out int outSizeC);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_edge_normals_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_edge_normals_hMac(ulong meshHandle,
+                                                   int weightingType,
+                                                   out IntPtr outBufferA,
+                                                   out int outSizeA,
+                                                   out IntPtr outBufferB,
+                                                   out int outSizeB,
+                                                   out IntPtr outBufferC,
+                                                   out int outSizeC);
+
+  public static bool IGM_edge_normals_h(ulong meshHandle,
+                                        int weightingType,
+                                        out IntPtr outBufferA,
+                                        out int outSizeA,
+                                        out IntPtr outBufferB,
+                                        out int outSizeB,
+                                        out IntPtr outBufferC,
+                                        out int outSizeC) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_edge_normals_hWin(meshHandle,
+                                   weightingType,
+                                   out outBufferA,
+                                   out outSizeA,
+                                   out outBufferB,
+                                   out outSizeB,
+                                   out outBufferC,
+                                   out outSizeC);
+    else
+      return IGM_edge_normals_hMac(meshHandle,
+                                   weightingType,
+                                   out outBufferA,
+                                   out outSizeA,
+                                   out outBufferB,
+                                   out outSizeB,
+                                   out outBufferC,
+                                   out outSizeC);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_vert_vert_adjacency_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_vert_vert_adjacency_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_vert_vert_adjacency_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_vert_vert_adjacency_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_vert_vert_adjacency_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_vert_vert_adjacency_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_vert_vert_adjacency_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_vert_tri_adjacency_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_vert_tri_adjacency_hWin(ulong meshHandle,
+                                                         out IntPtr outBufferVT,
+                                                         out int outSizeVT,
+                                                         out IntPtr outBufferVTI,
+                                                         out int outSizeVTI);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_vert_tri_adjacency_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_vert_tri_adjacency_hMac(ulong meshHandle,
+                                                         out IntPtr outBufferVT,
+                                                         out int outSizeVT,
+                                                         out IntPtr outBufferVTI,
+                                                         out int outSizeVTI);
+
+  public static bool IGM_vert_tri_adjacency_h(ulong meshHandle,
+                                              out IntPtr outBufferVT,
+                                              out int outSizeVT,
+                                              out IntPtr outBufferVTI,
+                                              out int outSizeVTI) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_vert_tri_adjacency_hWin(meshHandle,
+                                         out outBufferVT,
+                                         out outSizeVT,
+                                         out outBufferVTI,
+                                         out outSizeVTI);
+    else
+      return IGM_vert_tri_adjacency_hMac(meshHandle,
+                                         out outBufferVT,
+                                         out outSizeVT,
+                                         out outBufferVTI,
+                                         out outSizeVTI);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_tri_tri_adjacency_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_tri_tri_adjacency_hWin(ulong meshHandle,
+                                                        out IntPtr outBufferTT,
+                                                        out int outSizeTT,
+                                                        out IntPtr outBufferTTI,
+                                                        out int outSizeTTI);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_tri_tri_adjacency_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_tri_tri_adjacency_hMac(ulong meshHandle,
+                                                        out IntPtr outBufferTT,
+                                                        out int outSizeTT,
+                                                        out IntPtr outBufferTTI,
+                                                        out int outSizeTTI);
+
+  public static bool IGM_tri_tri_adjacency_h(ulong meshHandle,
+                                             out IntPtr outBufferTT,
+                                             out int outSizeTT,
+                                             out IntPtr outBufferTTI,
+                                             out int outSizeTTI) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_tri_tri_adjacency_hWin(meshHandle,
+                                        out outBufferTT,
+                                        out outSizeTT,
+                                        out outBufferTTI,
+                                        out outSizeTTI);
+    else
+      return IGM_tri_tri_adjacency_hMac(meshHandle,
+                                        out outBufferTT,
+                                        out outSizeTT,
+                                        out outBufferTTI,
+                                        out outSizeTTI);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_boundary_loop_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_boundary_loop_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_boundary_loop_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_boundary_loop_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool IGM_boundary_loop_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_boundary_loop_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_boundary_loop_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_boundary_facet_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_boundary_facet_hWin(ulong meshHandle,
+                                                     out IntPtr outBufferEL,
+                                                     out int outSizeEL,
+                                                     out IntPtr outBufferTL,
+                                                     out int outSizeTL);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_boundary_facet_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_boundary_facet_hMac(ulong meshHandle,
+                                                     out IntPtr outBufferEL,
+                                                     out int outSizeEL,
+                                                     out IntPtr outBufferTL,
+                                                     out int outSizeTL);
+
+  public static bool IGM_boundary_facet_h(ulong meshHandle,
+                                          out IntPtr outBufferEL,
+                                          out int outSizeEL,
+                                          out IntPtr outBufferTL,
+                                          out int outSizeTL) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_boundary_facet_hWin(meshHandle,
+                                     out outBufferEL,
+                                     out outSizeEL,
+                                     out outBufferTL,
+                                     out outSizeTL);
+    else
+      return IGM_boundary_facet_hMac(meshHandle,
+                                     out outBufferEL,
+                                     out outSizeEL,
+                                     out outBufferTL,
+                                     out outSizeTL);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_remap_VtoF_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_remap_VtoF_hWin(ulong meshHandle,
+                                                 byte[] inBufferScalar,
+                                                 int inSizeScalar,
+                                                 out IntPtr outBuffer,
+                                                 out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_remap_VtoF_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_remap_VtoF_hMac(ulong meshHandle,
+                                                 byte[] inBufferScalar,
+                                                 int inSizeScalar,
+                                                 out IntPtr outBuffer,
+                                                 out int outSize);
+
+  public static bool IGM_remap_VtoF_h(ulong meshHandle,
+                                      byte[] inBufferScalar,
+                                      int inSizeScalar,
+                                      out IntPtr outBuffer,
+                                      out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_remap_VtoF_hWin(meshHandle,
+                                 inBufferScalar,
+                                 inSizeScalar,
+                                 out outBuffer,
+                                 out outSize);
+    else
+      return IGM_remap_VtoF_hMac(meshHandle,
+                                 inBufferScalar,
+                                 inSizeScalar,
+                                 out outBuffer,
+                                 out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_remap_FtoV_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_remap_FtoV_hWin(ulong meshHandle,
+                                                 byte[] inBufferScalar,
+                                                 int inSizeScalar,
+                                                 out IntPtr outBuffer,
+                                                 out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_remap_FtoV_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_remap_FtoV_hMac(ulong meshHandle,
+                                                 byte[] inBufferScalar,
+                                                 int inSizeScalar,
+                                                 out IntPtr outBuffer,
+                                                 out int outSize);
+
+  public static bool IGM_remap_FtoV_h(ulong meshHandle,
+                                      byte[] inBufferScalar,
+                                      int inSizeScalar,
+                                      out IntPtr outBuffer,
+                                      out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_remap_FtoV_hWin(meshHandle,
+                                 inBufferScalar,
+                                 inSizeScalar,
+                                 out outBuffer,
+                                 out outSize);
+    else
+      return IGM_remap_FtoV_hMac(meshHandle,
+                                 inBufferScalar,
+                                 inSizeScalar,
+                                 out outBuffer,
+                                 out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_principal_curvature_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_principal_curvature_hWin(ulong meshHandle,
+                                                          uint radius,
+                                                          out IntPtr outBufferPD1,
+                                                          out int outSizePD1,
+                                                          out IntPtr outBufferPD2,
+                                                          out int outSizePD2,
+                                                          out IntPtr outBufferPV1,
+                                                          out int outSizePV1,
+                                                          out IntPtr outBufferPV2,
+                                                          out int outSizePV2);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_principal_curvature_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_principal_curvature_hMac(ulong meshHandle,
+                                                          uint radius,
+                                                          out IntPtr outBufferPD1,
+                                                          out int outSizePD1,
+                                                          out IntPtr outBufferPD2,
+                                                          out int outSizePD2,
+                                                          out IntPtr outBufferPV1,
+                                                          out int outSizePV1,
+                                                          out IntPtr outBufferPV2,
+                                                          out int outSizePV2);
+
+  public static bool IGM_principal_curvature_h(ulong meshHandle,
+                                               uint radius,
+                                               out IntPtr outBufferPD1,
+                                               out int outSizePD1,
+                                               out IntPtr outBufferPD2,
+                                               out int outSizePD2,
+                                               out IntPtr outBufferPV1,
+                                               out int outSizePV1,
+                                               out IntPtr outBufferPV2,
+                                               out int outSizePV2) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_principal_curvature_hWin(meshHandle,
+                                          radius,
+                                          out outBufferPD1,
+                                          out outSizePD1,
+                                          out outBufferPD2,
+                                          out outSizePD2,
+                                          out outBufferPV1,
+                                          out outSizePV1,
+                                          out outBufferPV2,
+                                          out outSizePV2);
+    else
+      return IGM_principal_curvature_hMac(meshHandle,
+                                          radius,
+                                          out outBufferPD1,
+                                          out outSizePD1,
+                                          out outBufferPD2,
+                                          out outSizePD2,
+                                          out outBufferPV1,
+                                          out outSizePV1,
+                                          out outBufferPV2,
+                                          out outSizePV2);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_gaussian_curvature_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_gaussian_curvature_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_gaussian_curvature_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_gaussian_curvature_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_gaussian_curvature_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_gaussian_curvature_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_gaussian_curvature_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_fast_winding_number_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_hWin(ulong meshHandle,
+                                                          byte[] inBufferPoints,
+                                                          int inSizePoints,
+                                                          out IntPtr outBuffer,
+                                                          out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_fast_winding_number_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_hMac(ulong meshHandle,
+                                                          byte[] inBufferPoints,
+                                                          int inSizePoints,
+                                                          out IntPtr outBuffer,
+                                                          out int outSize);
+
+  public static bool IGM_fast_winding_number_h(ulong meshHandle,
+                                               byte[] inBufferPoints,
+                                               int inSizePoints,
+                                               out IntPtr outBuffer,
+                                               out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_fast_winding_number_hWin(meshHandle,
+                                          inBufferPoints,
+                                          inSizePoints,
+                                          out outBuffer,
+                                          out outSize);
+    else
+      return IGM_fast_winding_number_hMac(meshHandle,
+                                          inBufferPoints,
+                                          inSizePoints,
+                                          out outBuffer,
+                                          out outSize);
+  }
+
+  // Fast Winding Number Create (precompute handle, LRU cached)
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_fast_winding_number_create",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_createWin(byte[] inBufferMesh,
+                                                               int inSizeMesh,
+                                                               int order,
+                                                               out ulong outHandle);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_fast_winding_number_create",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_createMac(byte[] inBufferMesh,
+                                                               int inSizeMesh,
+                                                               int order,
+                                                               out ulong outHandle);
+
+  public static bool IGM_fast_winding_number_create(byte[] inBufferMesh,
+                                                    int inSizeMesh,
+                                                    int order,
+                                                    out ulong outHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_fast_winding_number_createWin(inBufferMesh, inSizeMesh, order, out outHandle);
+    else
+      return IGM_fast_winding_number_createMac(inBufferMesh, inSizeMesh, order, out outHandle);
+  }
+
+  // Fast Winding Number Create from a mesh handle
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_fast_winding_number_create_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_fast_winding_number_create_hWin(ulong meshHandle, int order, out ulong outHandle);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_fast_winding_number_create_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_fast_winding_number_create_hMac(ulong meshHandle, int order, out ulong outHandle);
+
+  public static bool
+  IGM_fast_winding_number_create_h(ulong meshHandle, int order, out ulong outHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_fast_winding_number_create_hWin(meshHandle, order, out outHandle);
+    else
+      return IGM_fast_winding_number_create_hMac(meshHandle, order, out outHandle);
+  }
+
+  // Fast Winding Number Query
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_fast_winding_number_query",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_queryWin(ulong windingNumberHandle,
+                                                              double accuracy,
+                                                              byte[] inBufferPoints,
+                                                              int inSizePoints,
+                                                              out IntPtr outBuffer,
+                                                              out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_fast_winding_number_query",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_queryMac(ulong windingNumberHandle,
+                                                              double accuracy,
+                                                              byte[] inBufferPoints,
+                                                              int inSizePoints,
+                                                              out IntPtr outBuffer,
+                                                              out int outSize);
+
+  public static bool IGM_fast_winding_number_query(ulong windingNumberHandle,
+                                                   double accuracy,
+                                                   byte[] inBufferPoints,
+                                                   int inSizePoints,
+                                                   out IntPtr outBuffer,
+                                                   out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_fast_winding_number_queryWin(windingNumberHandle,
+                                              accuracy,
+                                              inBufferPoints,
+                                              inSizePoints,
+                                              out outBuffer,
+                                              out outSize);
+    else
+      return IGM_fast_winding_number_queryMac(windingNumberHandle,
+                                              accuracy,
+                                              inBufferPoints,
+                                              inSizePoints,
+                                              out outBuffer,
+                                              out outSize);
+  }
+
+  // Fast Winding Number Release
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_fast_winding_number_release",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_releaseWin(ulong windingNumberHandle);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_fast_winding_number_release",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_fast_winding_number_releaseMac(ulong windingNumberHandle);
+
+  public static bool IGM_fast_winding_number_release(ulong windingNumberHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_fast_winding_number_releaseWin(windingNumberHandle);
+    else
+      return IGM_fast_winding_number_releaseMac(windingNumberHandle);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_signed_distance_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_signed_distance_hWin(ulong meshHandle,
+                                                      byte[] inBufferPoints,
+                                                      int inSizePoints,
+                                                      int signedType,
+                                                      out IntPtr outBufferSD,
+                                                      out int outSizeSD,
+                                                      out IntPtr outBufferFI,
+                                                      out int outSizeFI,
+                                                      out IntPtr outBufferCP,
+                                                      out int outSizeCP);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_signed_distance_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_signed_distance_hMac(ulong meshHandle,
+                                                      byte[] inBufferPoints,
+                                                      int inSizePoints,
+                                                      int signedType,
+                                                      out IntPtr outBufferSD,
+                                                      out int outSizeSD,
+                                                      out IntPtr outBufferFI,
+                                                      out int outSizeFI,
+                                                      out IntPtr outBufferCP,
+                                                      out int outSizeCP);
+
+  public static bool IGM_signed_distance_h(ulong meshHandle,
+                                           byte[] inBufferPoints,
+                                           int inSizePoints,
+                                           int signedType,
+                                           out IntPtr outBufferSD,
+                                           out int outSizeSD,
+                                           out IntPtr outBufferFI,
+                                           out int outSizeFI,
+                                           out IntPtr outBufferCP,
+                                           out int outSizeCP) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_signed_distance_hWin(meshHandle,
+                                      inBufferPoints,
+                                      inSizePoints,
+                                      signedType,
+                                      out outBufferSD,
+                                      out outSizeSD,
+                                      out outBufferFI,
+                                      out outSizeFI,
+                                      out outBufferCP,
+                                      out outSizeCP);
+    else
+      return IGM_signed_distance_hMac(meshHandle,
+                                      inBufferPoints,
+                                      inSizePoints,
+                                      signedType,
+                                      out outBufferSD,
+                                      out outSizeSD,
+                                      out outBufferFI,
+                                      out outSizeFI,
+                                      out outBufferCP,
+                                      out outSizeCP);
+  }
+
+  // Closest Point Normal (batched)
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_closest_point_normal",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_closest_point_normalWin(byte[] inBufferMesh,
+                                                         int inSizeMesh,
+                                                         byte[] inBufferPoints,
+                                                         int inSizePoints,
+                                                         out IntPtr outBufferCP,
+                                                         out int outSizeCP,
+                                                         out IntPtr outBufferFI,
+                                                         out int outSizeFI,
+                                                         out IntPtr outBufferBC,
+                                                         out int outSizeBC,
+                                                         out IntPtr outBufferN,
+                                                         out int outSizeN);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_closest_point_normal",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_closest_point_normalMac(byte[] inBufferMesh,
+                                                         int inSizeMesh,
+                                                         byte[] inBufferPoints,
+                                                         int inSizePoints,
+                                                         out IntPtr outBufferCP,
+                                                         out int outSizeCP,
+                                                         out IntPtr outBufferFI,
+                                                         out int outSizeFI,
+                                                         out IntPtr outBufferBC,
+                                                         out int outSizeBC,
+                                                         out IntPtr outBufferN,
+                                                         out int outSizeN);
+
+  public static bool IGM_closest_point_normal(byte[] inBufferMesh,
+                                              int inSizeMesh,
+                                              byte[] inBufferPoints,
+                                              int inSizePoints,
+                                              out IntPtr outBufferCP,
+                                              out int outSizeCP,
+                                              out IntPtr outBufferFI,
+                                              out int outSizeFI,
+                                              out IntPtr outBufferBC,
+                                              out int outSizeBC,
+                                              out IntPtr outBufferN,
+                                              out int outSizeN) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_closest_point_normalWin(inBufferMesh,
+                                         inSizeMesh,
+                                         inBufferPoints,
+                                         inSizePoints,
+                                         out outBufferCP,
+                                         out outSizeCP,
+                                         out outBufferFI,
+                                         out outSizeFI,
+                                         out outBufferBC,
+                                         out outSizeBC,
+                                         out outBufferN,
+                                         out outSizeN);
+    else
+      return IGM_closest_point_normalMac(inBufferMesh,
+                                         inSizeMesh,
+                                         inBufferPoints,
+                                         inSizePoints,
+                                         out outBufferCP,
+                                         out outSizeCP,
+                                         out outBufferFI,
+                                         out outSizeFI,
+                                         out outBufferBC,
+                                         out outSizeBC,
+                                         out outBufferN,
+                                         out outSizeN);
+  }
+
+  // Closest Point Normal from a mesh handle
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_closest_point_normal_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_closest_point_normal_hWin(ulong meshHandle,
+                                                           byte[] inBufferPoints,
+                                                           int inSizePoints,
+                                                           out IntPtr outBufferCP,
+                                                           out int outSizeCP,
+                                                           out IntPtr outBufferFI,
+                                                           out int outSizeFI,
+                                                           out IntPtr outBufferBC,
+                                                           out int outSizeBC,
+                                                           out IntPtr outBufferN,
+                                                           out int outSizeN);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_closest_point_normal_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_closest_point_normal_hMac(ulong meshHandle,
+                                                           byte[] inBufferPoints,
+                                                           int inSizePoints,
+                                                           out IntPtr outBufferCP,
+                                                           out int outSizeCP,
+                                                           out IntPtr outBufferFI,
+                                                           out int outSizeFI,
+                                                           out IntPtr outBufferBC,
+                                                           out int outSizeBC,
+                                                           out IntPtr outBufferN,
+                                                           out int outSizeN);
+
+  public static bool IGM_closest_point_normal_h(ulong meshHandle,
+                                                byte[] inBufferPoints,
+                                                int inSizePoints,
+                                                out IntPtr outBufferCP,
+                                                out int outSizeCP,
+                                                out IntPtr outBufferFI,
+                                                out int outSizeFI,
+                                                out IntPtr outBufferBC,
+                                                out int outSizeBC,
+                                                out IntPtr outBufferN,
+                                                out int outSizeN) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_closest_point_normal_hWin(meshHandle,
+                                           inBufferPoints,
+                                           inSizePoints,
+                                           out outBufferCP,
+                                           out outSizeCP,
+                                           out outBufferFI,
+                                           out outSizeFI,
+                                           out outBufferBC,
+                                           out outSizeBC,
+                                           out outBufferN,
+                                           out outSizeN);
+    else
+      return IGM_closest_point_normal_hMac(meshHandle,
+                                           inBufferPoints,
+                                           inSizePoints,
+                                           out outBufferCP,
+                                           out outSizeCP,
+                                           out outBufferFI,
+                                           out outSizeFI,
+                                           out outBufferBC,
+                                           out outSizeBC,
+                                           out outBufferN,
+                                           out outSizeN);
+  }
+
+  // Distance Index Build -- mesh handle with its AABB tree prebuilt
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_distance_index_build",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_distance_index_buildWin(byte[] inBufferMesh,
+                                                         int inSizeMesh,
+                                                         int signedType,
+                                                         out ulong outHandle);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_distance_index_build",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_distance_index_buildMac(byte[] inBufferMesh,
+                                                         int inSizeMesh,
+                                                         int signedType,
+                                                         out ulong outHandle);
+
+  public static bool IGM_distance_index_build(byte[] inBufferMesh,
+                                              int inSizeMesh,
+                                              int signedType,
+                                              out ulong outHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_distance_index_buildWin(inBufferMesh, inSizeMesh, signedType, out outHandle);
+    else
+      return IGM_distance_index_buildMac(inBufferMesh, inSizeMesh, signedType, out outHandle);
+  }
+
+  // Signed Distance Query against a distance index handle
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_signed_distance_query",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_signed_distance_queryWin(ulong indexHandle,
+                                                          byte[] inBufferPoints,
+                                                          int inSizePoints,
+                                                          int signedType,
+                                                          out IntPtr outBufferSD,
+                                                          out int outSizeSD,
+                                                          out IntPtr outBufferFI,
+                                                          out int outSizeFI,
+                                                          out IntPtr outBufferCP,
+                                                          out int outSizeCP);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_signed_distance_query",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_signed_distance_queryMac(ulong indexHandle,
+                                                          byte[] inBufferPoints,
+                                                          int inSizePoints,
+                                                          int signedType,
+                                                          out IntPtr outBufferSD,
+                                                          out int outSizeSD,
+                                                          out IntPtr outBufferFI,
+                                                          out int outSizeFI,
+                                                          out IntPtr outBufferCP,
+                                                          out int outSizeCP);
+
+  public static bool IGM_signed_distance_query(ulong indexHandle,
+                                               byte[] inBufferPoints,
+                                               int inSizePoints,
+                                               int signedType,
+                                               out IntPtr outBufferSD,
+                                               out int outSizeSD,
+                                               out IntPtr outBufferFI,
+                                               out int outSizeFI,
+                                               out IntPtr outBufferCP,
+                                               out int outSizeCP) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_signed_distance_queryWin(indexHandle,
+                                          inBufferPoints,
+                                          inSizePoints,
+                                          signedType,
+                                          out outBufferSD,
+                                          out outSizeSD,
+                                          out outBufferFI,
+                                          out outSizeFI,
+                                          out outBufferCP,
+                                          out outSizeCP);
+    else
+      return IGM_signed_distance_queryMac(indexHandle,
+                                          inBufferPoints,
+                                          inSizePoints,
+                                          signedType,
+                                          out outBufferSD,
+                                          out outSizeSD,
+                                          out outBufferFI,
+                                          out outSizeFI,
+                                          out outBufferCP,
+                                          out outSizeCP);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_quad_planarity_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_quad_planarity_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_quad_planarity_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_quad_planarity_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool IGM_quad_planarity_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_quad_planarity_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_quad_planarity_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_planarize_quad_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_planarize_quad_mesh_hWin(ulong meshHandle,
+                                                          int maxIter,
+                                                          double threshold,
+                                                          out IntPtr outBuffer,
+                                                          out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_planarize_quad_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_planarize_quad_mesh_hMac(ulong meshHandle,
+                                                          int maxIter,
+                                                          double threshold,
+                                                          out IntPtr outBuffer,
+                                                          out int outSize);
+
+  public static bool IGM_planarize_quad_mesh_h(ulong meshHandle,
+                                               int maxIter,
+                                               double threshold,
+                                               out IntPtr outBuffer,
+                                               out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_planarize_quad_mesh_hWin(meshHandle,
+                                          maxIter,
+                                          threshold,
+                                          out outBuffer,
+                                          out outSize);
+    else
+      return IGM_planarize_quad_mesh_hMac(meshHandle,
+                                          maxIter,
+                                          threshold,
+                                          out outBuffer,
+                                          out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_laplacian_scalar_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_laplacian_scalar_hWin(ulong meshHandle,
+                                                       byte[] inBufferIndices,
+                                                       int inSizeIndices,
+                                                       byte[] inBufferValues,
+                                                       int inSizeValues,
+                                                       out IntPtr outBuffer,
+                                                       out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_laplacian_scalar_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_laplacian_scalar_hMac(ulong meshHandle,
+                                                       byte[] inBufferIndices,
+                                                       int inSizeIndices,
+                                                       byte[] inBufferValues,
+                                                       int inSizeValues,
+                                                       out IntPtr outBuffer,
+                                                       out int outSize);
+
+  public static bool IGM_laplacian_scalar_h(ulong meshHandle,
+                                            byte[] inBufferIndices,
+                                            int inSizeIndices,
+                                            byte[] inBufferValues,
+                                            int inSizeValues,
+                                            out IntPtr outBuffer,
+                                            out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_laplacian_scalar_hWin(meshHandle,
+                                       inBufferIndices,
+                                       inSizeIndices,
+                                       inBufferValues,
+                                       inSizeValues,
+                                       out outBuffer,
+                                       out outSize);
+    else
+      return IGM_laplacian_scalar_hMac(meshHandle,
+                                       inBufferIndices,
+                                       inSizeIndices,
+                                       inBufferValues,
+                                       inSizeValues,
+                                       out outBuffer,
+                                       out outSize);
+  }
+
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_param_harmonic_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_param_harmonic_hWin(ulong meshHandle, int k, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_param_harmonic_h", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_param_harmonic_hMac(ulong meshHandle, int k, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_param_harmonic_h(ulong meshHandle, int k, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_param_harmonic_hWin(meshHandle, k, out outBuffer, out outSize);
+    else
+      return IGM_param_harmonic_hMac(meshHandle, k, out outBuffer, out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_heat_geodesic_precompute_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_heat_geodesic_precompute_hWin(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_heat_geodesic_precompute_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_heat_geodesic_precompute_hMac(ulong meshHandle, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_heat_geodesic_precompute_h(ulong meshHandle, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_heat_geodesic_precompute_hWin(meshHandle, out outBuffer, out outSize);
+    else
+      return IGM_heat_geodesic_precompute_hMac(meshHandle, out outBuffer, out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_random_point_on_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_random_point_on_mesh_hWin(ulong meshHandle,
+                                                           int N,
+                                                           out IntPtr outBufferPoints,
+                                                           out int outSizePoints,
+                                                           out IntPtr outBufferFI,
+                                                           out int outSizeFI);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_random_point_on_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_random_point_on_mesh_hMac(ulong meshHandle,
+                                                           int N,
+                                                           out IntPtr outBufferPoints,
+                                                           out int outSizePoints,
+                                                           out IntPtr outBufferFI,
+                                                           out int outSizeFI);
+
+  public static bool IGM_random_point_on_mesh_h(ulong meshHandle,
+                                                int N,
+                                                out IntPtr outBufferPoints,
+                                                out int outSizePoints,
+                                                out IntPtr outBufferFI,
+                                                out int outSizeFI) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_random_point_on_mesh_hWin(meshHandle,
+                                           N,
+                                           out outBufferPoints,
+                                           out outSizePoints,
+                                           out outBufferFI,
+                                           out outSizeFI);
+    else
+      return IGM_random_point_on_mesh_hMac(meshHandle,
+                                           N,
+                                           out outBufferPoints,
+                                           out outSizePoints,
+                                           out outBufferFI,
+                                           out outSizeFI);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_blue_noise_sampling_on_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_blue_noise_sampling_on_mesh_hWin(ulong meshHandle,
+                                                                  int N,
+                                                                  out IntPtr outBufferPoints,
+                                                                  out int outSizePoints,
+                                                                  out IntPtr outBufferFI,
+                                                                  out int outSizeFI);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_blue_noise_sampling_on_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_blue_noise_sampling_on_mesh_hMac(ulong meshHandle,
+                                                                  int N,
+                                                                  out IntPtr outBufferPoints,
+                                                                  out int outSizePoints,
+                                                                  out IntPtr outBufferFI,
+                                                                  out int outSizeFI);
+
+  public static bool IGM_blue_noise_sampling_on_mesh_h(ulong meshHandle,
+                                                       int N,
+                                                       out IntPtr outBufferPoints,
+                                                       out int outSizePoints,
+                                                       out IntPtr outBufferFI,
+                                                       out int outSizeFI) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_blue_noise_sampling_on_mesh_hWin(meshHandle,
+                                                  N,
+                                                  out outBufferPoints,
+                                                  out outSizePoints,
+                                                  out outBufferFI,
+                                                  out outSizeFI);
+    else
+      return IGM_blue_noise_sampling_on_mesh_hMac(meshHandle,
+                                                  N,
+                                                  out outBufferPoints,
+                                                  out outSizePoints,
+                                                  out outBufferFI,
+                                                  out outSizeFI);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_extract_isoline_from_scalar_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_extract_isoline_from_scalar_hWin(ulong meshHandle,
+                                                                  byte[] inBufferScalar,
+                                                                  int inSizeScalar,
+                                                                  byte[] inBufferIsoValues,
+                                                                  int inSizeIsoValues,
+                                                                  out IntPtr outBuffer,
+                                                                  out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_extract_isoline_from_scalar_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_extract_isoline_from_scalar_hMac(ulong meshHandle,
+                                                                  byte[] inBufferScalar,
+                                                                  int inSizeScalar,
+                                                                  byte[] inBufferIsoValues,
+                                                                  int inSizeIsoValues,
+                                                                  out IntPtr outBuffer,
+                                                                  out int outSize);
+
+  public static bool IGM_extract_isoline_from_scalar_h(ulong meshHandle,
+                                                       byte[] inBufferScalar,
+                                                       int inSizeScalar,
+                                                       byte[] inBufferIsoValues,
+                                                       int inSizeIsoValues,
+                                                       out IntPtr outBuffer,
+                                                       out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_extract_isoline_from_scalar_hWin(meshHandle,
+                                                  inBufferScalar,
+                                                  inSizeScalar,
+                                                  inBufferIsoValues,
+                                                  inSizeIsoValues,
+                                                  out outBuffer,
+                                                  out outSize);
+    else
+      return IGM_extract_isoline_from_scalar_hMac(meshHandle,
+                                                  inBufferScalar,
+                                                  inSizeScalar,
+                                                  inBufferIsoValues,
+                                                  inSizeIsoValues,
+                                                  out outBuffer,
+                                                  out outSize);
+  }
+
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_constrained_scalar_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_constrained_scalar_hWin(ulong meshHandle,
+                                                         byte[] inBufferIndices,
+                                                         int inSizeIndices,
+                                                         byte[] inBufferValues,
+                                                         int inSizeValues,
+                                                         out IntPtr outBuffer,
+                                                         out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_constrained_scalar_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_constrained_scalar_hMac(ulong meshHandle,
+                                                         byte[] inBufferIndices,
+                                                         int inSizeIndices,
+                                                         byte[] inBufferValues,
+                                                         int inSizeValues,
+                                                         out IntPtr outBuffer,
+                                                         out int outSize);
+
+  public static bool IGM_constrained_scalar_h(ulong meshHandle,
+                                              byte[] inBufferIndices,
+                                              int inSizeIndices,
+                                              byte[] inBufferValues,
+                                              int inSizeValues,
+                                              out IntPtr outBuffer,
+                                              out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_constrained_scalar_hWin(meshHandle,
+                                         inBufferIndices,
+                                         inSizeIndices,
+                                         inBufferValues,
+                                         inSizeValues,
+                                         out outBuffer,
+                                         out outSize);
+    else
+      return IGM_constrained_scalar_hMac(meshHandle,
+                                         inBufferIndices,
+                                         inSizeIndices,
+                                         inBufferValues,
+                                         inSizeValues,
+                                         out outBuffer,
+                                         out outSize);
+  }
+
+  // Submit Signed Distance (asynchronous job)
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_submit_signed_distance",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_signed_distanceWin(byte[] inBufferMesh,
+                                                           int inSizeMesh,
+                                                           byte[] inBufferPoints,
+                                                           int inSizePoints,
+                                                           int signedType,
+                                                           out ulong outJob);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_submit_signed_distance",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_signed_distanceMac(byte[] inBufferMesh,
+                                                           int inSizeMesh,
+                                                           byte[] inBufferPoints,
+                                                           int inSizePoints,
+                                                           int signedType,
+                                                           out ulong outJob);
+
+  public static bool IGM_submit_signed_distance(byte[] inBufferMesh,
+                                                int inSizeMesh,
+                                                byte[] inBufferPoints,
+                                                int inSizePoints,
+                                                int signedType,
+                                                out ulong outJob) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_submit_signed_distanceWin(inBufferMesh,
+                                           inSizeMesh,
+                                           inBufferPoints,
+                                           inSizePoints,
+                                           signedType,
+                                           out outJob);
+    else
+      return IGM_submit_signed_distanceMac(inBufferMesh,
+                                           inSizeMesh,
+                                           inBufferPoints,
+                                           inSizePoints,
+                                           signedType,
+                                           out outJob);
+  }
+
+  // Submit Signed Distance from a mesh handle
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_submit_signed_distance_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_signed_distance_hWin(ulong meshHandle,
+                                                             byte[] inBufferPoints,
+                                                             int inSizePoints,
+                                                             int signedType,
+                                                             out ulong outJob);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_submit_signed_distance_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_signed_distance_hMac(ulong meshHandle,
+                                                             byte[] inBufferPoints,
+                                                             int inSizePoints,
+                                                             int signedType,
+                                                             out ulong outJob);
+
+  public static bool IGM_submit_signed_distance_h(ulong meshHandle,
+                                                  byte[] inBufferPoints,
+                                                  int inSizePoints,
+                                                  int signedType,
+                                                  out ulong outJob) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_submit_signed_distance_hWin(meshHandle,
+                                             inBufferPoints,
+                                             inSizePoints,
+                                             signedType,
+                                             out outJob);
+    else
+      return IGM_submit_signed_distance_hMac(meshHandle,
+                                             inBufferPoints,
+                                             inSizePoints,
+                                             signedType,
+                                             out outJob);
+  }
+
+  // Submit Planarize Quad Mesh (asynchronous job)
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_submit_planarize_quad_mesh",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_planarize_quad_meshWin(byte[] inBuffer,
+                                                               int inSize,
+                                                               int maxIter,
+                                                               double threshold,
+                                                               out ulong outJob);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_submit_planarize_quad_mesh",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_planarize_quad_meshMac(byte[] inBuffer,
+                                                               int inSize,
+                                                               int maxIter,
+                                                               double threshold,
+                                                               out ulong outJob);
+
+  public static bool IGM_submit_planarize_quad_mesh(byte[] inBuffer,
+                                                    int inSize,
+                                                    int maxIter,
+                                                    double threshold,
+                                                    out ulong outJob) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_submit_planarize_quad_meshWin(inBuffer, inSize, maxIter, threshold, out outJob);
+    else
+      return IGM_submit_planarize_quad_meshMac(inBuffer, inSize, maxIter, threshold, out outJob);
+  }
+
+  // Submit Planarize Quad Mesh from a mesh handle
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_submit_planarize_quad_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_planarize_quad_mesh_hWin(ulong meshHandle,
+                                                                 int maxIter,
+                                                                 double threshold,
+                                                                 out ulong outJob);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_submit_planarize_quad_mesh_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_submit_planarize_quad_mesh_hMac(ulong meshHandle,
+                                                                 int maxIter,
+                                                                 double threshold,
+                                                                 out ulong outJob);
+
+  public static bool IGM_submit_planarize_quad_mesh_h(ulong meshHandle,
+                                                      int maxIter,
+                                                      double threshold,
+                                                      out ulong outJob) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_submit_planarize_quad_mesh_hWin(meshHandle, maxIter, threshold, out outJob);
+    else
+      return IGM_submit_planarize_quad_mesh_hMac(meshHandle, maxIter, threshold, out outJob);
+  }
+
+  // Submit Heat Geodesic Precompute (asynchronous job)
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_submit_heat_geodesic_precompute",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_submit_heat_geodesic_precomputeWin(byte[] inBuffer, int inSize, out ulong outJob);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_submit_heat_geodesic_precompute",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_submit_heat_geodesic_precomputeMac(byte[] inBuffer, int inSize, out ulong outJob);
+
+  public static bool
+  IGM_submit_heat_geodesic_precompute(byte[] inBuffer, int inSize, out ulong outJob) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_submit_heat_geodesic_precomputeWin(inBuffer, inSize, out outJob);
+    else
+      return IGM_submit_heat_geodesic_precomputeMac(inBuffer, inSize, out outJob);
+  }
+
+  // Submit Heat Geodesic Precompute from a mesh handle
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_submit_heat_geodesic_precompute_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_submit_heat_geodesic_precompute_hWin(ulong meshHandle, out ulong outJob);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_submit_heat_geodesic_precompute_h",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_submit_heat_geodesic_precompute_hMac(ulong meshHandle, out ulong outJob);
+
+  public static bool IGM_submit_heat_geodesic_precompute_h(ulong meshHandle, out ulong outJob) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_submit_heat_geodesic_precompute_hWin(meshHandle, out outJob);
+    else
+      return IGM_submit_heat_geodesic_precompute_hMac(meshHandle, out outJob);
+  }
+
+  // Job Status
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_job_status", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_statusWin(ulong jobHandle, out int outStatus);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_job_status", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_statusMac(ulong jobHandle, out int outStatus);
+
+  public static bool IGM_job_status(ulong jobHandle, out int outStatus) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_job_statusWin(jobHandle, out outStatus);
+    else
+      return IGM_job_statusMac(jobHandle, out outStatus);
+  }
+
+  // Job Wait
+  [DllImport(WinLibName, EntryPoint = "IGM_job_wait", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_waitWin(ulong jobHandle, int timeoutMs, out int outStatus);
+  [DllImport(MacLibName, EntryPoint = "IGM_job_wait", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_waitMac(ulong jobHandle, int timeoutMs, out int outStatus);
+
+  public static bool IGM_job_wait(ulong jobHandle, int timeoutMs, out int outStatus) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_job_waitWin(jobHandle, timeoutMs, out outStatus);
+    else
+      return IGM_job_waitMac(jobHandle, timeoutMs, out outStatus);
+  }
+
+  // Job Result
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_job_result", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_job_resultWin(ulong jobHandle, int outputIndex, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_job_result", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_job_resultMac(ulong jobHandle, int outputIndex, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_job_result(ulong jobHandle, int outputIndex, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_job_resultWin(jobHandle, outputIndex, out outBuffer, out outSize);
+    else
+      return IGM_job_resultMac(jobHandle, outputIndex, out outBuffer, out outSize);
+  }
+
+  // Job Release
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_job_release", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_releaseWin(ulong jobHandle);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_job_release", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_releaseMac(ulong jobHandle);
+
+  public static bool IGM_job_release(ulong jobHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_job_releaseWin(jobHandle);
+    else
+      return IGM_job_releaseMac(jobHandle);
+  }
+
+  // Job Cancel
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_job_cancel", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_cancelWin(ulong jobHandle);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_job_cancel", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_cancelMac(ulong jobHandle);
+
+  public static bool IGM_job_cancel(ulong jobHandle) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_job_cancelWin(jobHandle);
+    else
+      return IGM_job_cancelMac(jobHandle);
+  }
+
+  // Job Progress
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_job_progress", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_progressWin(ulong jobHandle, out double outFraction);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_job_progress", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_job_progressMac(ulong jobHandle, out double outFraction);
+
+  public static bool IGM_job_progress(ulong jobHandle, out double outFraction) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_job_progressWin(jobHandle, out outFraction);
+    else
+      return IGM_job_progressMac(jobHandle, out outFraction);
+  }
+
+#endregion
+
+#region IG - MESH Batch Functions
+  // Batch variants take a MeshArrayData buffer and stack the per-mesh results, with the number
+  // of entries each mesh contributed in the Sizes buffer. Operations with an `_ex` function take
+  // batches there, with MeshInput.Batch set.
+
+  // Centroid of every mesh
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_centroid_batch",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_centroid_batchWin(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_centroid_batch",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_centroid_batchMac(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_centroid_batch(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_centroid_batchWin(inBuffer, inSize, out outBuffer, out outSize);
+    else
+      return IGM_centroid_batchMac(inBuffer, inSize, out outBuffer, out outSize);
+  }
+
+  // Boundary loops, the sizes count loops per mesh
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_boundary_loop_batch",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_boundary_loop_batchWin(byte[] inBuffer,
+                                                        int inSize,
+                                                        out IntPtr outBuffer,
+                                                        out int outSize,
+                                                        out IntPtr outBufferSizes,
+                                                        out int outSizeSizes);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_boundary_loop_batch",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_boundary_loop_batchMac(byte[] inBuffer,
+                                                        int inSize,
+                                                        out IntPtr outBuffer,
+                                                        out int outSize,
+                                                        out IntPtr outBufferSizes,
+                                                        out int outSizeSizes);
+
+  public static bool IGM_boundary_loop_batch(byte[] inBuffer,
+                                             int inSize,
+                                             out IntPtr outBuffer,
+                                             out int outSize,
+                                             out IntPtr outBufferSizes,
+                                             out int outSizeSizes) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_boundary_loop_batchWin(inBuffer,
+                                        inSize,
+                                        out outBuffer,
+                                        out outSize,
+                                        out outBufferSizes,
+                                        out outSizeSizes);
+    else
+      return IGM_boundary_loop_batchMac(inBuffer,
+                                        inSize,
+                                        out outBuffer,
+                                        out outSize,
+                                        out outBufferSizes,
+                                        out outSizeSizes);
+  }
+
+  // Quad planarity
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_quad_planarity_batch",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_quad_planarity_batchWin(byte[] inBuffer,
+                                                         int inSize,
+                                                         out IntPtr outBuffer,
+                                                         out int outSize,
+                                                         out IntPtr outBufferSizes,
+                                                         out int outSizeSizes);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_quad_planarity_batch",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_quad_planarity_batchMac(byte[] inBuffer,
+                                                         int inSize,
+                                                         out IntPtr outBuffer,
+                                                         out int outSize,
+                                                         out IntPtr outBufferSizes,
+                                                         out int outSizeSizes);
+
+  public static bool IGM_quad_planarity_batch(byte[] inBuffer,
+                                              int inSize,
+                                              out IntPtr outBuffer,
+                                              out int outSize,
+                                              out IntPtr outBufferSizes,
+                                              out int outSizeSizes) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_quad_planarity_batchWin(inBuffer,
+                                         inSize,
+                                         out outBuffer,
+                                         out outSize,
+                                         out outBufferSizes,
+                                         out outSizeSizes);
+    else
+      return IGM_quad_planarity_batchMac(inBuffer,
+                                         inSize,
+                                         out outBuffer,
+                                         out outSize,
+                                         out outBufferSizes,
+                                         out outSizeSizes);
+  }
+#endregion
+
+
+#region IG - MESH Pipeline Functions
+
+  // Run a PipelineData description, returns a PipelineResultData
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_pipeline_run", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_pipeline_runWin(byte[] inBuffer,
+                                                 int inSize,
+                                                 out IntPtr outBuffer,
+                                                 out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_pipeline_run", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_pipeline_runMac(byte[] inBuffer,
+                                                 int inSize,
+                                                 out IntPtr outBuffer,
+                                                 out int outSize);
+
+  public static bool IGM_pipeline_run(byte[] inBuffer,
+                                      int inSize,
+                                      out IntPtr outBuffer,
+                                      out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_pipeline_runWin(inBuffer, inSize, out outBuffer, out outSize);
+    else
+      return IGM_pipeline_runMac(inBuffer, inSize, out outBuffer, out outSize);
+  }
+
+  // Pipeline Run -- output built in a caller buffer
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_pipeline_run_into",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_pipeline_run_intoWin(byte[] inBuffer,
+                                                      int inSize,
+                                                      byte[] outBuffer,
+                                                      int outCapacity,
+                                                      out int outSize);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_pipeline_run_into",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_pipeline_run_intoMac(byte[] inBuffer,
+                                                      int inSize,
+                                                      byte[] outBuffer,
+                                                      int outCapacity,
+                                                      out int outSize);
+
+  public static bool IGM_pipeline_run_into(byte[] inBuffer,
+                                           int inSize,
+                                           byte[] outBuffer,
+                                           int outCapacity,
+                                           out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_pipeline_run_intoWin(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+    else
+      return IGM_pipeline_run_intoMac(inBuffer, inSize, outBuffer, outCapacity, out outSize);
+  }
+#endregion
+
+
+#region IG - MESH Extended Call Functions
+  // One `_ex` function per operation with several outputs or calling conventions, taking the mesh
+  // and the output options as structs; see the `_ex` section of BridgeAPI.h
+
+  /// <summary>
+  /// Mesh argument of the `_ex` functions: the handle if nonzero, else the MeshData in Buffer, or
+  /// a MeshArrayData with Batch set. Buffer must stay pinned for the call.
+  /// </summary>
+  [StructLayout(LayoutKind.Sequential)]
+  public struct MeshInput {
+    public IntPtr Buffer;
+    public int Size;
+    public ulong Handle;
+    public int Batch;
+  }
+
+  // Output modes of CallOptions
+  public const int OutputSeparate = 0;  // A native buffer per output in OutBuffers/OutSizes
+  public const int OutputBundle = 1;    // One ResultBundleData in OutBuffers[0]/OutSizes[0]
+  public const int OutputInto = 2;      // The one selected output in CallerBuffer
+  public const uint AllOutputs = 0xFFFFFFFFu;
+
+  /// <summary>
+  /// Output options of the `_ex` functions. OutBuffers (IntPtr[]), OutSizes (int[]) and
+  /// CallerBuffer point to pinned arrays; Progress is a ProgressCallback function pointer or
+  /// IntPtr.Zero.
+  /// </summary>
+  [StructLayout(LayoutKind.Sequential)]
+  public struct CallOptions {
+    public int OutputMode;
+    public uint OutputMask;
+    public IntPtr OutBuffers;
+    public IntPtr OutSizes;
+    public IntPtr CallerBuffer;
+    public int CallerCapacity;
+    public IntPtr Progress;
+    public IntPtr ProgressContext;
+  }
+
+  /// <summary>
+  /// Progress callback of CallOptions: receives the fraction done in [0, 1] and returns false to
+  /// cancel. It may be called from native worker threads, one at a time.
+  /// </summary>
+  [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+  public delegate bool ProgressCallback(IntPtr context, double fraction);
+
+  // Barycenter
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_barycenter_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_barycenter_exWin(ref MeshInput mesh, ref CallOptions options);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_barycenter_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_barycenter_exMac(ref MeshInput mesh, ref CallOptions options);
+
+  public static bool IGM_barycenter_ex(ref MeshInput mesh, ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_barycenter_exWin(ref mesh, ref options);
+    else
+      return IGM_barycenter_exMac(ref mesh, ref options);
+  }
+
+  // Vertex Normals
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_vert_normals_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_vert_normals_exWin(ref MeshInput mesh, ref CallOptions options);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_vert_normals_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_vert_normals_exMac(ref MeshInput mesh, ref CallOptions options);
+
+  public static bool IGM_vert_normals_ex(ref MeshInput mesh, ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_vert_normals_exWin(ref mesh, ref options);
+    else
+      return IGM_vert_normals_exMac(ref mesh, ref options);
+  }
+
+  // Face Normals
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_face_normals_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_face_normals_exWin(ref MeshInput mesh, ref CallOptions options);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_face_normals_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_face_normals_exMac(ref MeshInput mesh, ref CallOptions options);
+
+  public static bool IGM_face_normals_ex(ref MeshInput mesh, ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_face_normals_exWin(ref mesh, ref options);
+    else
+      return IGM_face_normals_exMac(ref mesh, ref options);
+  }
+
+  // Edge Normals
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_edge_normals_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_edge_normals_exWin(ref MeshInput mesh,
+                                                    int weightingType,
+                                                    ref CallOptions options);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_edge_normals_ex", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_edge_normals_exMac(ref MeshInput mesh,
+                                                    int weightingType,
+                                                    ref CallOptions options);
+
+  public static bool IGM_edge_normals_ex(ref MeshInput mesh,
+                                         int weightingType,
+                                         ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_edge_normals_exWin(ref mesh, weightingType, ref options);
+    else
+      return IGM_edge_normals_exMac(ref mesh, weightingType, ref options);
+  }
+
+  // Vertex-Triangle Adjacency
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_vert_tri_adjacency_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_vert_tri_adjacency_exWin(ref MeshInput mesh,
+                                                          ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_vert_tri_adjacency_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_vert_tri_adjacency_exMac(ref MeshInput mesh,
+                                                          ref CallOptions options);
+
+  public static bool IGM_vert_tri_adjacency_ex(ref MeshInput mesh, ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_vert_tri_adjacency_exWin(ref mesh, ref options);
+    else
+      return IGM_vert_tri_adjacency_exMac(ref mesh, ref options);
+  }
+
+  // Triangle-Triangle Adjacency
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_tri_tri_adjacency_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_tri_tri_adjacency_exWin(ref MeshInput mesh,
+                                                         ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_tri_tri_adjacency_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_tri_tri_adjacency_exMac(ref MeshInput mesh,
+                                                         ref CallOptions options);
+
+  public static bool IGM_tri_tri_adjacency_ex(ref MeshInput mesh, ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_tri_tri_adjacency_exWin(ref mesh, ref options);
+    else
+      return IGM_tri_tri_adjacency_exMac(ref mesh, ref options);
+  }
+
+  // Boundary Facet
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_boundary_facet_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_boundary_facet_exWin(ref MeshInput mesh, ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_boundary_facet_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_boundary_facet_exMac(ref MeshInput mesh, ref CallOptions options);
+
+  public static bool IGM_boundary_facet_ex(ref MeshInput mesh, ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_boundary_facet_exWin(ref mesh, ref options);
+    else
+      return IGM_boundary_facet_exMac(ref mesh, ref options);
+  }
+
+  // Principal Curvature
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_principal_curvature_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_principal_curvature_exWin(ref MeshInput mesh,
+                                                           uint radius,
+                                                           ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_principal_curvature_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_principal_curvature_exMac(ref MeshInput mesh,
+                                                           uint radius,
+                                                           ref CallOptions options);
+
+  public static bool IGM_principal_curvature_ex(ref MeshInput mesh,
+                                                uint radius,
+                                                ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_principal_curvature_exWin(ref mesh, radius, ref options);
+    else
+      return IGM_principal_curvature_exMac(ref mesh, radius, ref options);
+  }
+
+  // Gaussian Curvature
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_gaussian_curvature_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_gaussian_curvature_exWin(ref MeshInput mesh,
+                                                          ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_gaussian_curvature_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_gaussian_curvature_exMac(ref MeshInput mesh,
+                                                          ref CallOptions options);
+
+  public static bool IGM_gaussian_curvature_ex(ref MeshInput mesh, ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_gaussian_curvature_exWin(ref mesh, ref options);
+    else
+      return IGM_gaussian_curvature_exMac(ref mesh, ref options);
+  }
+
+  // Signed Distance
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_signed_distance_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_signed_distance_exWin(ref MeshInput mesh,
+                                                       byte[] inBufferPoints,
+                                                       int inSizePoints,
+                                                       int signedType,
+                                                       ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_signed_distance_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_signed_distance_exMac(ref MeshInput mesh,
+                                                       byte[] inBufferPoints,
+                                                       int inSizePoints,
+                                                       int signedType,
+                                                       ref CallOptions options);
+
+  public static bool IGM_signed_distance_ex(ref MeshInput mesh,
+                                            byte[] inBufferPoints,
+                                            int inSizePoints,
+                                            int signedType,
+                                            ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_signed_distance_exWin(ref mesh,
+                                       inBufferPoints,
+                                       inSizePoints,
+                                       signedType,
+                                       ref options);
+    else
+      return IGM_signed_distance_exMac(ref mesh,
+                                       inBufferPoints,
+                                       inSizePoints,
+                                       signedType,
+                                       ref options);
+  }
+
+  // Closest Point Normal
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_closest_point_normal_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_closest_point_normal_exWin(ref MeshInput mesh,
+                                                            byte[] inBufferPoints,
+                                                            int inSizePoints,
+                                                            ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_closest_point_normal_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_closest_point_normal_exMac(ref MeshInput mesh,
+                                                            byte[] inBufferPoints,
+                                                            int inSizePoints,
+                                                            ref CallOptions options);
+
+  public static bool IGM_closest_point_normal_ex(ref MeshInput mesh,
+                                                 byte[] inBufferPoints,
+                                                 int inSizePoints,
+                                                 ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_closest_point_normal_exWin(ref mesh, inBufferPoints, inSizePoints, ref options);
+    else
+      return IGM_closest_point_normal_exMac(ref mesh, inBufferPoints, inSizePoints, ref options);
+  }
+
+  // Planarize Quad Mesh
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_planarize_quad_mesh_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_planarize_quad_mesh_exWin(ref MeshInput mesh,
+                                                           int maxIter,
+                                                           double threshold,
+                                                           ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_planarize_quad_mesh_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_planarize_quad_mesh_exMac(ref MeshInput mesh,
+                                                           int maxIter,
+                                                           double threshold,
+                                                           ref CallOptions options);
+
+  public static bool IGM_planarize_quad_mesh_ex(ref MeshInput mesh,
+                                                int maxIter,
+                                                double threshold,
+                                                ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_planarize_quad_mesh_exWin(ref mesh, maxIter, threshold, ref options);
+    else
+      return IGM_planarize_quad_mesh_exMac(ref mesh, maxIter, threshold, ref options);
+  }
+
+  // Random Point On Mesh
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_random_point_on_mesh_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_random_point_on_mesh_exWin(ref MeshInput mesh,
+                                                            int N,
+                                                            ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_random_point_on_mesh_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_random_point_on_mesh_exMac(ref MeshInput mesh,
+                                                            int N,
+                                                            ref CallOptions options);
+
+  public static bool IGM_random_point_on_mesh_ex(ref MeshInput mesh,
+                                                 int N,
+                                                 ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_random_point_on_mesh_exWin(ref mesh, N, ref options);
+    else
+      return IGM_random_point_on_mesh_exMac(ref mesh, N, ref options);
+  }
+
+  // Blue Noise Sampling On Mesh
+  [DllImport(WinLibName,
+             EntryPoint = "IGM_blue_noise_sampling_on_mesh_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_blue_noise_sampling_on_mesh_exWin(ref MeshInput mesh,
+                                                                   int N,
+                                                                   ref CallOptions options);
+  [DllImport(MacLibName,
+             EntryPoint = "IGM_blue_noise_sampling_on_mesh_ex",
+             CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool IGM_blue_noise_sampling_on_mesh_exMac(ref MeshInput mesh,
+                                                                   int N,
+                                                                   ref CallOptions options);
+
+  public static bool IGM_blue_noise_sampling_on_mesh_ex(ref MeshInput mesh,
+                                                        int N,
+                                                        ref CallOptions options) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_blue_noise_sampling_on_mesh_exWin(ref mesh, N, ref options);
+    else
+      return IGM_blue_noise_sampling_on_mesh_exMac(ref mesh, N, ref options);
+  }
+#endregion
+
+#region IG - MESH Single Precision Functions
+
+  // Barycenters -- MeshDataF in, PointArrayDataF out
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_barycenter_f", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_barycenter_fWin(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_barycenter_f", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_barycenter_fMac(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_barycenter_f(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_barycenter_fWin(inBuffer, inSize, out outBuffer, out outSize);
+    else
+      return IGM_barycenter_fMac(inBuffer, inSize, out outBuffer, out outSize);
+  }
+
+  // Face Normals -- MeshDataF in, PointArrayDataF out
+  [DllImport(
+      WinLibName, EntryPoint = "IGM_face_normals_f", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_face_normals_fWin(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+  [DllImport(
+      MacLibName, EntryPoint = "IGM_face_normals_f", CallingConvention = CallingConvention.Cdecl)]
+  private static extern bool
+  IGM_face_normals_fMac(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize);
+
+  public static bool
+  IGM_face_normals_f(byte[] inBuffer, int inSize, out IntPtr outBuffer, out int outSize) {
+    if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+      return IGM_face_normals_fWin(inBuffer, inSize, out outBuffer, out outSize);
+    else
+      return IGM_face_normals_fMac(inBuffer, inSize, out outBuffer, out outSize);
+  }
+#endregion
+
 }
 }
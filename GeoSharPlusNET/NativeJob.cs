@@ -0,0 +1,151 @@
+using System.Runtime.InteropServices;
+using Rhino.Geometry;
+
+namespace GSP {
+public enum NativeJobStatus {
+  Queued = 0,
+  Running = 1,
+  Succeeded = 2,
+  Failed = 3,
+  Cancelled = 4,
+}
+
+/// <summary>
+/// Owns a native job started with one of the IGM_submit_ functions. The computation runs on
+/// native background threads; poll <see cref="Status"/> or <see cref="Wait"/>, then take the
+/// outputs with <see cref="TryTakeResult"/>. Disposing releases the job; a job still running then
+/// finishes in the background and its outputs are discarded.
+/// </summary>
+public sealed class NativeJob : IDisposable {
+  private ulong _handle;
+
+  private NativeJob(ulong handle) {
+    _handle = handle;
+  }
+
+  public ulong Value => _handle;
+
+  public bool IsValid => _handle != 0;
+
+  /// <summary>
+  /// Signed distance of the points to the mesh. Outputs: 0 signed distances, 1 face indices,
+  /// 2 closest points.
+  /// </summary>
+  public static NativeJob SignedDistance(MeshHandle mesh, List<Point3d> points, int signedType) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+    if (points == null)
+      throw new ArgumentNullException(nameof(points));
+
+    var pointsBuffer = Wrapper.ToPointArrayBuffer(points);
+    if (!NativeBridge.IGM_submit_signed_distance_h(
+            mesh.Value, pointsBuffer, pointsBuffer.Length, signedType, out ulong job)) {
+      throw new InvalidOperationException("Failed to submit the signed distance job.");
+    }
+
+    return new NativeJob(job);
+  }
+
+  /// <summary>
+  /// Planarizes a quad mesh. Output: 0 the planarized mesh.
+  /// </summary>
+  public static NativeJob PlanarizeQuadMesh(Mesh mesh, int maxIterations, double threshold) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBuffer(mesh, preserveQuads: true);
+    if (!NativeBridge.IGM_submit_planarize_quad_mesh(
+            meshBuffer, meshBuffer.Length, maxIterations, threshold, out ulong job)) {
+      throw new InvalidOperationException("Failed to submit the planarization job.");
+    }
+
+    return new NativeJob(job);
+  }
+
+  /// <summary>
+  /// Heat geodesics precompute. Output: 0 the precompute handle (a one-element double array).
+  /// </summary>
+  public static NativeJob HeatGeodesicPrecompute(Mesh mesh) {
+    if (mesh == null)
+      throw new ArgumentNullException(nameof(mesh));
+
+    var meshBuffer = Wrapper.ToMeshBuffer(mesh);
+    if (!NativeBridge.IGM_submit_heat_geodesic_precompute(
+            meshBuffer, meshBuffer.Length, out ulong job)) {
+      throw new InvalidOperationException("Failed to submit the heat geodesics job.");
+    }
+
+    return new NativeJob(job);
+  }
+
+  public NativeJobStatus Status {
+    get {
+      if (!NativeBridge.IGM_job_status(_handle, out int status))
+        throw new ObjectDisposedException(nameof(NativeJob));
+      return (NativeJobStatus)status;
+    }
+  }
+
+  public bool IsDone =>
+      Status is NativeJobStatus.Succeeded or NativeJobStatus.Failed or NativeJobStatus.Cancelled;
+
+  /// <summary>
+  /// Fraction of the job done so far, in [0, 1]
+  /// </summary>
+  public double Progress {
+    get {
+      if (!NativeBridge.IGM_job_progress(_handle, out double fraction))
+        throw new ObjectDisposedException(nameof(NativeJob));
+      return fraction;
+    }
+  }
+
+  /// <summary>
+  /// Asks the job to stop at its next progress check; it then ends as Cancelled without outputs.
+  /// </summary>
+  public void Cancel() {
+    if (_handle != 0)
+      NativeBridge.IGM_job_cancel(_handle);
+  }
+
+  /// <summary>
+  /// Waits up to timeoutMs milliseconds (negative = until done) and returns the status then.
+  /// </summary>
+  public NativeJobStatus Wait(int timeoutMs = -1) {
+    if (!NativeBridge.IGM_job_wait(_handle, timeoutMs, out int status))
+      throw new ObjectDisposedException(nameof(NativeJob));
+    return (NativeJobStatus)status;
+  }
+
+  /// <summary>
+  /// Takes output `index` of a succeeded job as a serialized buffer (see the factory methods for
+  /// the outputs of each job). Each output can be taken once.
+  /// </summary>
+  public bool TryTakeResult(int index, out byte[] buffer) {
+    buffer = Array.Empty<byte>();
+    if (!NativeBridge.IGM_job_result(_handle, index, out IntPtr outBuffer, out int outSize) ||
+        outBuffer == IntPtr.Zero)
+      return false;
+
+    buffer = new byte[outSize];
+    Marshal.Copy(outBuffer, buffer, 0, outSize);
+    Marshal.FreeCoTaskMem(outBuffer);
+    return true;
+  }
+
+  public void Dispose() {
+    Release();
+    GC.SuppressFinalize(this);
+  }
+
+  ~NativeJob() {
+    Release();
+  }
+
+  private void Release() {
+    var handle = Interlocked.Exchange(ref _handle, 0);
+    if (handle != 0)
+      NativeBridge.IGM_job_release(handle);
+  }
+}
+}
@@ -0,0 +1,124 @@
+using System.Runtime.InteropServices;
+using Google.FlatBuffers;
+using Rhino.Geometry;
+
+namespace GSP {
+// Output masks of the `_ex` functions (CallOptions.OutputMask): bit i selects the i-th output
+[Flags]
+public enum SignedDistanceOutputs : uint {
+  Distance = 1,
+  FaceIndex = 2,
+  ClosestPoint = 4,
+  All = Distance | FaceIndex | ClosestPoint,
+}
+
+[Flags]
+public enum PrincipalCurvatureOutputs : uint {
+  MaxDirection = 1,
+  MinDirection = 2,
+  MaxValue = 4,
+  MinValue = 8,
+  All = MaxDirection | MinDirection | MaxValue | MinValue,
+}
+
+[Flags]
+public enum VertexTriangleOutputs : uint {
+  Triangles = 1,
+  Corners = 2,
+  All = Triangles | Corners,
+}
+
+/// <summary>
+/// Outputs of an `_ex` call in bundle mode: one ResultBundleData buffer holding every selected
+/// output as a named column, so a single native allocation is copied and freed.
+/// </summary>
+public sealed class ResultBundle {
+  private readonly FB.ResultBundleData _data;
+
+  private ResultBundle(byte[] buffer) {
+    _data = FB.ResultBundleData.GetRootAsResultBundleData(new ByteBuffer(buffer));
+  }
+
+  /// <summary>
+  /// Copies a bundle returned by a native export and frees the native buffer.
+  /// </summary>
+  public static ResultBundle FromNative(IntPtr buffer, int size) {
+    var bytes = new byte[size];
+    Marshal.Copy(buffer, bytes, 0, size);
+    Marshal.FreeCoTaskMem(buffer);
+    return new ResultBundle(bytes);
+  }
+
+  /// <summary>
+  /// Whether the bundle holds a column `name`; masked exports leave out unselected ones
+  /// </summary>
+  public bool Contains(string name) {
+    for (int i = 0; i < _data.ColumnsLength; i++) {
+      var column = _data.Columns(i);
+      if (column.HasValue && column.Value.Name == name)
+        return true;
+    }
+    return false;
+  }
+
+  public List<Point3d> Points(string name) {
+    var column = Column(name, FB.ResultColumnType.Points);
+    var points = new List<Point3d>(column.PointsLength);
+    for (int i = 0; i < column.PointsLength; i++) {
+      var point = column.Points(i);
+      points.Add(point.HasValue ? new Point3d(point.Value.X, point.Value.Y, point.Value.Z)
+                                : new Point3d(0, 0, 0));
+    }
+    return points;
+  }
+
+  public List<Vector3d> Vectors(string name) => Points(name).ConvertAll(p => new Vector3d(p));
+
+  public List<double> Doubles(string name) =>
+      new List<double>(Column(name, FB.ResultColumnType.Doubles).GetDoublesArray() ??
+                       Array.Empty<double>());
+
+  public List<int> Ints(string name) =>
+      new List<int>(Column(name, FB.ResultColumnType.Ints).GetIntsArray() ?? Array.Empty<int>());
+
+  public List<(int, int)> IntPairs(string name) {
+    var column = Column(name, FB.ResultColumnType.IntPairs);
+    var pairs = new List<(int, int)>(column.PairsLength);
+    for (int i = 0; i < column.PairsLength; i++) {
+      var pair = column.Pairs(i);
+      pairs.Add(pair.HasValue ? (pair.Value.X, pair.Value.Y) : (0, 0));
+    }
+    return pairs;
+  }
+
+  /// <summary>
+  /// Flat values split into runs of the recorded sizes, as in an IntNestedArrayData buffer
+  /// </summary>
+  public List<List<int>> NestedInts(string name) {
+    var column = Column(name, FB.ResultColumnType.NestedInts);
+    var values = column.GetIntsArray() ?? Array.Empty<int>();
+    var nested = new List<List<int>>(column.SizesLength);
+    int offset = 0;
+    for (int i = 0; i < column.SizesLength; i++) {
+      var size = Math.Min(column.Sizes(i), values.Length - offset);
+      nested.Add(new List<int>(new ArraySegment<int>(values, offset, size)));
+      offset += size;
+    }
+    return nested;
+  }
+
+  private FB.ResultColumnData Column(string name, FB.ResultColumnType type) {
+    for (int i = 0; i < _data.ColumnsLength; i++) {
+      var column = _data.Columns(i);
+      if (!column.HasValue || column.Value.Name != name)
+        continue;
+      if (column.Value.Type != type)
+        throw new InvalidOperationException($"Result column {name} holds {column.Value.Type}.");
+
+      return column.Value;
+    }
+
+    throw new KeyNotFoundException($"The result bundle has no column {name}.");
+  }
+}
+}
@@ -99,16 +99,127 @@ public static class Wrapper {
   public static List<Vector3d> FromVector3dArrayBufferToList(byte[] buffer) =>
       new List<Vector3d>(FromVector3dArrayBuffer(buffer));
 
+  // Single-precision point arrays (PointArrayDataF), as returned by the *_f exports
+  public static Point3f[] FromPointArrayFBuffer(byte[] buffer) {
+    var pointArray = FB.PointArrayDataF.GetRootAsPointArrayDataF(new ByteBuffer(buffer));
+
+    var res = new Point3f[pointArray.PointsLength];
+    for (int i = 0; i < pointArray.PointsLength; i++) {
+      var pt = pointArray.Points(i);
+      res[i] = pt.HasValue ? new Point3f(pt.Value.X, pt.Value.Y, pt.Value.Z) : new Point3f(0, 0, 0);
+    }
+    return res;
+  }
+
+  public static Vector3f[] FromVector3fArrayBuffer(byte[] buffer) =>
+      Array.ConvertAll(FromPointArrayFBuffer(buffer), p => new Vector3f(p.X, p.Y, p.Z));
+
 #endregion
 
 #region Mesh Operations
 
   public static byte[] ToMeshBuffer(Mesh mesh, bool preserveQuads = false) {
     var builder = new FlatBufferBuilder(1024);
+    var meshOffset = AddMeshData(builder, mesh, preserveQuads);
+    builder.Finish(meshOffset.Value);
 
-    // Check if mesh has quads
+    return builder.SizedByteArray();
+  }
+
+  // MeshData buffer whose face indices can be mapped back to `mesh`. Triangle and quad meshes are
+  // sent as they are, and the native side maps the triangles of a quad back to it. A mesh mixing
+  // both is split here instead, quad ABCD into ABC and ACD as the native side splits it, and
+  // faceOfTriangle gives the face of `mesh` each triangle came from (null if not split).
+  public static byte[] ToMeshBuffer(Mesh mesh, out int[] faceOfTriangle) {
+    faceOfTriangle = null;
     bool hasQuads = false;
     bool hasTriangles = false;
+    foreach (var face in mesh.Faces) {
+      if (face.IsTriangle) {
+        hasTriangles = true;
+      } else {
+        hasQuads = true;
+      }
+    }
+    if (!(hasQuads && hasTriangles)) {
+      return ToMeshBuffer(mesh, preserveQuads: true);
+    }
+
+    var split = mesh.DuplicateMesh();
+    split.Faces.Clear();
+    var faces = new List<int>(mesh.Faces.Count * 2);
+    for (int i = 0; i < mesh.Faces.Count; i++) {
+      var face = mesh.Faces[i];
+      split.Faces.AddFace(face.A, face.B, face.C);
+      faces.Add(i);
+      if (face.IsQuad) {
+        split.Faces.AddFace(face.A, face.C, face.D);
+        faces.Add(i);
+      }
+    }
+
+    faceOfTriangle = faces.ToArray();
+    return ToMeshBuffer(split);
+  }
+
+  // Several meshes in one MeshArrayData buffer, for the batch exports
+  public static byte[] ToMeshArrayBuffer(IList<Mesh> meshes, bool preserveQuads = false) {
+    var builder = new FlatBufferBuilder(1024);
+
+    var meshOffsets = new Offset<FB.MeshData>[meshes.Count];
+    for (int i = 0; i < meshes.Count; i++) {
+      meshOffsets[i] = AddMeshData(builder, meshes[i], preserveQuads);
+    }
+    var meshesOffset = FB.MeshArrayData.CreateMeshesVector(builder, meshOffsets);
+    var arrayOffset = FB.MeshArrayData.CreateMeshArrayData(builder, meshesOffset);
+    builder.Finish(arrayOffset.Value);
+
+    return builder.SizedByteArray();
+  }
+
+  // MeshDataF buffer for the *_f exports: Rhino's single-precision vertices are sent as they are
+  public static byte[] ToMeshBufferF(Mesh mesh, bool preserveQuads = false) {
+    var builder = new FlatBufferBuilder(1024);
+    var workingMesh = WorkingMesh(mesh, preserveQuads, out bool hasQuads);
+
+    FB.MeshDataF.StartVerticesVector(builder, workingMesh.Vertices.Count);
+    for (int i = workingMesh.Vertices.Count - 1; i >= 0; i--) {
+      var vertex = workingMesh.Vertices[i];
+      FB.Vec3f.CreateVec3f(builder, vertex.X, vertex.Y, vertex.Z);
+    }
+    var verticesOffset = builder.EndVector();
+
+    VectorOffset facesOffset = default;
+    VectorOffset quadFacesOffset = default;
+    if (hasQuads) {
+      FB.MeshDataF.StartQuadFacesVector(builder, workingMesh.Faces.Count);
+      for (int i = workingMesh.Faces.Count - 1; i >= 0; i--) {
+        var face = workingMesh.Faces[i];
+        FB.Vec4i.CreateVec4i(builder, face.A, face.B, face.C, face.D);
+      }
+      quadFacesOffset = builder.EndVector();
+    } else {
+      FB.MeshDataF.StartFacesVector(builder, workingMesh.Faces.Count);
+      for (int i = workingMesh.Faces.Count - 1; i >= 0; i--) {
+        var face = workingMesh.Faces[i];
+        FB.Vec3i.CreateVec3i(builder, face.A, face.B, face.C);
+      }
+      facesOffset = builder.EndVector();
+    }
+
+    var meshOffset =
+        FB.MeshDataF.CreateMeshDataF(builder, verticesOffset, facesOffset, quadFacesOffset);
+    builder.Finish(meshOffset.Value);
+
+    return builder.SizedByteArray();
+  }
+
+  // The mesh as it is serialized: itself, or a triangulated copy if it mixes triangles and quads
+  // or has quads that are not preserved
+  private static Mesh WorkingMesh(Mesh mesh, bool preserveQuads, out bool hasQuads) {
+    // Check if mesh has quads
+    hasQuads = false;
+    bool hasTriangles = false;
 
     foreach (var face in mesh.Faces) {
       if (face.IsTriangle) {
@@ -133,9 +244,16 @@ public static class Wrapper {
       workingMesh = mesh.DuplicateMesh();
       workingMesh.Faces.ConvertQuadsToTriangles();
       hasQuads = false;
-      hasTriangles = true;
     }
 
+    return workingMesh;
+  }
+
+  internal static Offset<FB.MeshData>
+  AddMeshData(FlatBufferBuilder builder, Mesh mesh, bool preserveQuads) {
+    var workingMesh = WorkingMesh(mesh, preserveQuads, out bool hasQuads);
+    bool hasTriangles = !hasQuads;
+
     // Add vertices
     FB.MeshData.StartVerticesVector(builder, workingMesh.Vertices.Count);
     for (int i = workingMesh.Vertices.Count - 1; i >= 0; i--) {
@@ -173,10 +291,7 @@ public static class Wrapper {
     } else {
       FB.MeshData.AddFaces(builder, facesOffset);
     }
-    var meshOffset = FB.MeshData.EndMeshData(builder);
-    builder.Finish(meshOffset.Value);
-
-    return builder.SizedByteArray();
+    return FB.MeshData.EndMeshData(builder);
   }
 
   public static Mesh FromMeshBuffer(byte[] buffer) {
@@ -441,6 +556,21 @@ public static class Wrapper {
     return result;
   }
 
+  // Split values stacked by a batch export back into one list per mesh
+  public static List<List<T>> SplitBySizes<T>(IList<T> values, int[] sizes) {
+    var result = new List<List<T>>(sizes.Length);
+    int offset = 0;
+    foreach (var size in sizes) {
+      var part = new List<T>(size);
+      for (int i = 0; i < size && offset < values.Count; i++) {
+        part.Add(values[offset++]);
+      }
+      result.Add(part);
+    }
+
+    return result;
+  }
+
 #endregion
 }
 }
@@ -20,6 +20,8 @@ struct Vec3;
 
 struct Vec2;
 
+struct Vec3f;
+
 struct Vec3i;
 
 struct Vec2i;
@@ -78,6 +80,35 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(8) Vec2 FLATBUFFERS_FINAL_CLASS {
 };
 FLATBUFFERS_STRUCT_END(Vec2, 16);
 
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec3f FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  Vec3f()
+      : x_(0),
+        y_(0),
+        z_(0) {
+  }
+  Vec3f(float _x, float _y, float _z)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)),
+        z_(::flatbuffers::EndianScalar(_z)) {
+  }
+  float x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  float y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+  float z() const {
+    return ::flatbuffers::EndianScalar(z_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Vec3f, 12);
+
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec3i FLATBUFFERS_FINAL_CLASS {
  private:
   int32_t x_;
@@ -0,0 +1,109 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_MESHARRAY_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_MESHARRAY_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "mesh_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct MeshArrayData;
+struct MeshArrayDataBuilder;
+
+struct MeshArrayData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MeshArrayDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MESHES = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshData>> *meshes() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshData>> *>(VT_MESHES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_MESHES) &&
+           verifier.VerifyVector(meshes()) &&
+           verifier.VerifyVectorOfTables(meshes()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MeshArrayDataBuilder {
+  typedef MeshArrayData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_meshes(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshData>>> meshes) {
+    fbb_.AddOffset(MeshArrayData::VT_MESHES, meshes);
+  }
+  explicit MeshArrayDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MeshArrayData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MeshArrayData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MeshArrayData> CreateMeshArrayData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::MeshData>>> meshes = 0) {
+  MeshArrayDataBuilder builder_(_fbb);
+  builder_.add_meshes(meshes);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MeshArrayData> CreateMeshArrayDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::MeshData>> *meshes = nullptr) {
+  auto meshes__ = meshes ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::MeshData>>(*meshes) : 0;
+  return GSP::FB::CreateMeshArrayData(
+      _fbb,
+      meshes__);
+}
+
+inline const GSP::FB::MeshArrayData *GetMeshArrayData(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::MeshArrayData>(buf);
+}
+
+inline const GSP::FB::MeshArrayData *GetSizePrefixedMeshArrayData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::MeshArrayData>(buf);
+}
+
+inline bool VerifyMeshArrayDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::MeshArrayData>(nullptr);
+}
+
+inline bool VerifySizePrefixedMeshArrayDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::MeshArrayData>(nullptr);
+}
+
+inline void FinishMeshArrayDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MeshArrayData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedMeshArrayDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MeshArrayData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_MESHARRAY_GSP_FB_H_
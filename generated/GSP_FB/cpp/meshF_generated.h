@@ -0,0 +1,136 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_MESHF_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_MESHF_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct MeshDataF;
+struct MeshDataFBuilder;
+
+struct MeshDataF FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MeshDataFBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VERTICES = 4,
+    VT_FACES = 6,
+    VT_QUAD_FACES = 8
+  };
+  const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *vertices() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *>(VT_VERTICES);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec3i *> *faces() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3i *> *>(VT_FACES);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec4i *> *quad_faces() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec4i *> *>(VT_QUAD_FACES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_VERTICES) &&
+           verifier.VerifyVector(vertices()) &&
+           VerifyOffset(verifier, VT_FACES) &&
+           verifier.VerifyVector(faces()) &&
+           VerifyOffset(verifier, VT_QUAD_FACES) &&
+           verifier.VerifyVector(quad_faces()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MeshDataFBuilder {
+  typedef MeshDataF Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_vertices(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> vertices) {
+    fbb_.AddOffset(MeshDataF::VT_VERTICES, vertices);
+  }
+  void add_faces(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3i *>> faces) {
+    fbb_.AddOffset(MeshDataF::VT_FACES, faces);
+  }
+  void add_quad_faces(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec4i *>> quad_faces) {
+    fbb_.AddOffset(MeshDataF::VT_QUAD_FACES, quad_faces);
+  }
+  explicit MeshDataFBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MeshDataF> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MeshDataF>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MeshDataF> CreateMeshDataF(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> vertices = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3i *>> faces = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec4i *>> quad_faces = 0) {
+  MeshDataFBuilder builder_(_fbb);
+  builder_.add_quad_faces(quad_faces);
+  builder_.add_faces(faces);
+  builder_.add_vertices(vertices);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MeshDataF> CreateMeshDataFDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<GSP::FB::Vec3f> *vertices = nullptr,
+    const std::vector<GSP::FB::Vec3i> *faces = nullptr,
+    const std::vector<GSP::FB::Vec4i> *quad_faces = nullptr) {
+  auto vertices__ = vertices ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3f>(*vertices) : 0;
+  auto faces__ = faces ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3i>(*faces) : 0;
+  auto quad_faces__ = quad_faces ? _fbb.CreateVectorOfStructs<GSP::FB::Vec4i>(*quad_faces) : 0;
+  return GSP::FB::CreateMeshDataF(
+      _fbb,
+      vertices__,
+      faces__,
+      quad_faces__);
+}
+
+inline const GSP::FB::MeshDataF *GetMeshDataF(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::MeshDataF>(buf);
+}
+
+inline const GSP::FB::MeshDataF *GetSizePrefixedMeshDataF(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::MeshDataF>(buf);
+}
+
+inline bool VerifyMeshDataFBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::MeshDataF>(nullptr);
+}
+
+inline bool VerifySizePrefixedMeshDataFBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::MeshDataF>(nullptr);
+}
+
+inline void FinishMeshDataFBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MeshDataF> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedMeshDataFBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::MeshDataF> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_MESHF_GSP_FB_H_
@@ -0,0 +1,177 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_PIPELINERESULT_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_PIPELINERESULT_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct PipelineOutputData;
+struct PipelineOutputDataBuilder;
+
+struct PipelineResultData;
+struct PipelineResultDataBuilder;
+
+struct PipelineOutputData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PipelineOutputDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_POINTS = 4,
+    VT_VALUES = 6
+  };
+  const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *points() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *>(VT_POINTS);
+  }
+  const ::flatbuffers::Vector<double> *values() const {
+    return GetPointer<const ::flatbuffers::Vector<double> *>(VT_VALUES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_POINTS) &&
+           verifier.VerifyVector(points()) &&
+           VerifyOffset(verifier, VT_VALUES) &&
+           verifier.VerifyVector(values()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PipelineOutputDataBuilder {
+  typedef PipelineOutputData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_points(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points) {
+    fbb_.AddOffset(PipelineOutputData::VT_POINTS, points);
+  }
+  void add_values(::flatbuffers::Offset<::flatbuffers::Vector<double>> values) {
+    fbb_.AddOffset(PipelineOutputData::VT_VALUES, values);
+  }
+  explicit PipelineOutputDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PipelineOutputData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PipelineOutputData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PipelineOutputData> CreatePipelineOutputData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> values = 0) {
+  PipelineOutputDataBuilder builder_(_fbb);
+  builder_.add_values(values);
+  builder_.add_points(points);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PipelineOutputData> CreatePipelineOutputDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<GSP::FB::Vec3> *points = nullptr,
+    const std::vector<double> *values = nullptr) {
+  auto points__ = points ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3>(*points) : 0;
+  auto values__ = values ? _fbb.CreateVector<double>(*values) : 0;
+  return GSP::FB::CreatePipelineOutputData(
+      _fbb,
+      points__,
+      values__);
+}
+
+struct PipelineResultData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PipelineResultDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_OUTPUTS = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineOutputData>> *outputs() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineOutputData>> *>(VT_OUTPUTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_OUTPUTS) &&
+           verifier.VerifyVector(outputs()) &&
+           verifier.VerifyVectorOfTables(outputs()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PipelineResultDataBuilder {
+  typedef PipelineResultData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_outputs(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineOutputData>>> outputs) {
+    fbb_.AddOffset(PipelineResultData::VT_OUTPUTS, outputs);
+  }
+  explicit PipelineResultDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PipelineResultData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PipelineResultData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PipelineResultData> CreatePipelineResultData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineOutputData>>> outputs = 0) {
+  PipelineResultDataBuilder builder_(_fbb);
+  builder_.add_outputs(outputs);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PipelineResultData> CreatePipelineResultDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::PipelineOutputData>> *outputs = nullptr) {
+  auto outputs__ = outputs ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::PipelineOutputData>>(*outputs) : 0;
+  return GSP::FB::CreatePipelineResultData(
+      _fbb,
+      outputs__);
+}
+
+inline const GSP::FB::PipelineResultData *GetPipelineResultData(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::PipelineResultData>(buf);
+}
+
+inline const GSP::FB::PipelineResultData *GetSizePrefixedPipelineResultData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::PipelineResultData>(buf);
+}
+
+inline bool VerifyPipelineResultDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::PipelineResultData>(nullptr);
+}
+
+inline bool VerifySizePrefixedPipelineResultDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::PipelineResultData>(nullptr);
+}
+
+inline void FinishPipelineResultDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PipelineResultData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedPipelineResultDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PipelineResultData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_PIPELINERESULT_GSP_FB_H_
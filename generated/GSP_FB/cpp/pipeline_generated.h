@@ -0,0 +1,279 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_PIPELINE_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_PIPELINE_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "mesh_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct PipelineStepData;
+struct PipelineStepDataBuilder;
+
+struct PipelineData;
+struct PipelineDataBuilder;
+
+enum class PipelineOp : uint8_t {
+  Mesh = 0,
+  Values = 1,
+  VertexNormals = 2,
+  FaceNormals = 3,
+  Barycenters = 4,
+  GaussianCurvature = 5,
+  RemapVtoF = 6,
+  RemapFtoV = 7,
+  Isolines = 8,
+  MIN = Mesh,
+  MAX = Isolines
+};
+
+inline const PipelineOp (&EnumValuesPipelineOp())[9] {
+  static const PipelineOp values[] = {
+    PipelineOp::Mesh,
+    PipelineOp::Values,
+    PipelineOp::VertexNormals,
+    PipelineOp::FaceNormals,
+    PipelineOp::Barycenters,
+    PipelineOp::GaussianCurvature,
+    PipelineOp::RemapVtoF,
+    PipelineOp::RemapFtoV,
+    PipelineOp::Isolines
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesPipelineOp() {
+  static const char * const names[10] = {
+    "Mesh",
+    "Values",
+    "VertexNormals",
+    "FaceNormals",
+    "Barycenters",
+    "GaussianCurvature",
+    "RemapVtoF",
+    "RemapFtoV",
+    "Isolines",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNamePipelineOp(PipelineOp e) {
+  if (::flatbuffers::IsOutRange(e, PipelineOp::Mesh, PipelineOp::Isolines)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesPipelineOp()[index];
+}
+
+struct PipelineStepData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PipelineStepDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_OP = 4,
+    VT_INPUTS = 6,
+    VT_VALUES = 8,
+    VT_MESH = 10,
+    VT_MESH_HANDLE = 12
+  };
+  GSP::FB::PipelineOp op() const {
+    return static_cast<GSP::FB::PipelineOp>(GetField<uint8_t>(VT_OP, 0));
+  }
+  const ::flatbuffers::Vector<int32_t> *inputs() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_INPUTS);
+  }
+  const ::flatbuffers::Vector<double> *values() const {
+    return GetPointer<const ::flatbuffers::Vector<double> *>(VT_VALUES);
+  }
+  const GSP::FB::MeshData *mesh() const {
+    return GetPointer<const GSP::FB::MeshData *>(VT_MESH);
+  }
+  uint64_t mesh_handle() const {
+    return GetField<uint64_t>(VT_MESH_HANDLE, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_OP, 1) &&
+           VerifyOffset(verifier, VT_INPUTS) &&
+           verifier.VerifyVector(inputs()) &&
+           VerifyOffset(verifier, VT_VALUES) &&
+           verifier.VerifyVector(values()) &&
+           VerifyOffset(verifier, VT_MESH) &&
+           verifier.VerifyTable(mesh()) &&
+           VerifyField<uint64_t>(verifier, VT_MESH_HANDLE, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct PipelineStepDataBuilder {
+  typedef PipelineStepData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_op(GSP::FB::PipelineOp op) {
+    fbb_.AddElement<uint8_t>(PipelineStepData::VT_OP, static_cast<uint8_t>(op), 0);
+  }
+  void add_inputs(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> inputs) {
+    fbb_.AddOffset(PipelineStepData::VT_INPUTS, inputs);
+  }
+  void add_values(::flatbuffers::Offset<::flatbuffers::Vector<double>> values) {
+    fbb_.AddOffset(PipelineStepData::VT_VALUES, values);
+  }
+  void add_mesh(::flatbuffers::Offset<GSP::FB::MeshData> mesh) {
+    fbb_.AddOffset(PipelineStepData::VT_MESH, mesh);
+  }
+  void add_mesh_handle(uint64_t mesh_handle) {
+    fbb_.AddElement<uint64_t>(PipelineStepData::VT_MESH_HANDLE, mesh_handle, 0);
+  }
+  explicit PipelineStepDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PipelineStepData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PipelineStepData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PipelineStepData> CreatePipelineStepData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::PipelineOp op = GSP::FB::PipelineOp::Mesh,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> inputs = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> values = 0,
+    ::flatbuffers::Offset<GSP::FB::MeshData> mesh = 0,
+    uint64_t mesh_handle = 0) {
+  PipelineStepDataBuilder builder_(_fbb);
+  builder_.add_mesh_handle(mesh_handle);
+  builder_.add_mesh(mesh);
+  builder_.add_values(values);
+  builder_.add_inputs(inputs);
+  builder_.add_op(op);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PipelineStepData> CreatePipelineStepDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    GSP::FB::PipelineOp op = GSP::FB::PipelineOp::Mesh,
+    const std::vector<int32_t> *inputs = nullptr,
+    const std::vector<double> *values = nullptr,
+    ::flatbuffers::Offset<GSP::FB::MeshData> mesh = 0,
+    uint64_t mesh_handle = 0) {
+  auto inputs__ = inputs ? _fbb.CreateVector<int32_t>(*inputs) : 0;
+  auto values__ = values ? _fbb.CreateVector<double>(*values) : 0;
+  return GSP::FB::CreatePipelineStepData(
+      _fbb,
+      op,
+      inputs__,
+      values__,
+      mesh,
+      mesh_handle);
+}
+
+struct PipelineData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PipelineDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_STEPS = 4,
+    VT_OUTPUTS = 6
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineStepData>> *steps() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineStepData>> *>(VT_STEPS);
+  }
+  const ::flatbuffers::Vector<int32_t> *outputs() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_OUTPUTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_STEPS) &&
+           verifier.VerifyVector(steps()) &&
+           verifier.VerifyVectorOfTables(steps()) &&
+           VerifyOffset(verifier, VT_OUTPUTS) &&
+           verifier.VerifyVector(outputs()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PipelineDataBuilder {
+  typedef PipelineData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_steps(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineStepData>>> steps) {
+    fbb_.AddOffset(PipelineData::VT_STEPS, steps);
+  }
+  void add_outputs(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> outputs) {
+    fbb_.AddOffset(PipelineData::VT_OUTPUTS, outputs);
+  }
+  explicit PipelineDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PipelineData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PipelineData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PipelineData> CreatePipelineData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::PipelineStepData>>> steps = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> outputs = 0) {
+  PipelineDataBuilder builder_(_fbb);
+  builder_.add_outputs(outputs);
+  builder_.add_steps(steps);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PipelineData> CreatePipelineDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::PipelineStepData>> *steps = nullptr,
+    const std::vector<int32_t> *outputs = nullptr) {
+  auto steps__ = steps ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::PipelineStepData>>(*steps) : 0;
+  auto outputs__ = outputs ? _fbb.CreateVector<int32_t>(*outputs) : 0;
+  return GSP::FB::CreatePipelineData(
+      _fbb,
+      steps__,
+      outputs__);
+}
+
+inline const GSP::FB::PipelineData *GetPipelineData(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::PipelineData>(buf);
+}
+
+inline const GSP::FB::PipelineData *GetSizePrefixedPipelineData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::PipelineData>(buf);
+}
+
+inline bool VerifyPipelineDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::PipelineData>(nullptr);
+}
+
+inline bool VerifySizePrefixedPipelineDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::PipelineData>(nullptr);
+}
+
+inline void FinishPipelineDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PipelineData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedPipelineDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PipelineData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_PIPELINE_GSP_FB_H_
@@ -0,0 +1,108 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_POINTARRAYF_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_POINTARRAYF_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct PointArrayDataF;
+struct PointArrayDataFBuilder;
+
+struct PointArrayDataF FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PointArrayDataFBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_POINTS = 4
+  };
+  const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *points() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3f *> *>(VT_POINTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_POINTS) &&
+           verifier.VerifyVector(points()) &&
+           verifier.EndTable();
+  }
+};
+
+struct PointArrayDataFBuilder {
+  typedef PointArrayDataF Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_points(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> points) {
+    fbb_.AddOffset(PointArrayDataF::VT_POINTS, points);
+  }
+  explicit PointArrayDataFBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<PointArrayDataF> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<PointArrayDataF>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<PointArrayDataF> CreatePointArrayDataF(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3f *>> points = 0) {
+  PointArrayDataFBuilder builder_(_fbb);
+  builder_.add_points(points);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<PointArrayDataF> CreatePointArrayDataFDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<GSP::FB::Vec3f> *points = nullptr) {
+  auto points__ = points ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3f>(*points) : 0;
+  return GSP::FB::CreatePointArrayDataF(
+      _fbb,
+      points__);
+}
+
+inline const GSP::FB::PointArrayDataF *GetPointArrayDataF(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::PointArrayDataF>(buf);
+}
+
+inline const GSP::FB::PointArrayDataF *GetSizePrefixedPointArrayDataF(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::PointArrayDataF>(buf);
+}
+
+inline bool VerifyPointArrayDataFBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::PointArrayDataF>(nullptr);
+}
+
+inline bool VerifySizePrefixedPointArrayDataFBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::PointArrayDataF>(nullptr);
+}
+
+inline void FinishPointArrayDataFBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PointArrayDataF> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedPointArrayDataFBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::PointArrayDataF> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_POINTARRAYF_GSP_FB_H_
@@ -0,0 +1,293 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_PROFILE_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_PROFILE_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+namespace GSP {
+namespace FB {
+
+struct ProfileEntryData;
+struct ProfileEntryDataBuilder;
+
+struct ProfileSnapshotData;
+struct ProfileSnapshotDataBuilder;
+
+struct ProfileEntryData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ProfileEntryDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_CALLS = 6,
+    VT_TOTAL_NS = 8,
+    VT_MAX_NS = 10,
+    VT_DESERIALIZE_NS = 12,
+    VT_DESERIALIZE_MAX_NS = 14,
+    VT_COMPUTE_NS = 16,
+    VT_COMPUTE_MAX_NS = 18,
+    VT_SERIALIZE_NS = 20,
+    VT_SERIALIZE_MAX_NS = 22,
+    VT_BYTES_IN = 24,
+    VT_BYTES_OUT = 26
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  uint64_t calls() const {
+    return GetField<uint64_t>(VT_CALLS, 0);
+  }
+  uint64_t total_ns() const {
+    return GetField<uint64_t>(VT_TOTAL_NS, 0);
+  }
+  uint64_t max_ns() const {
+    return GetField<uint64_t>(VT_MAX_NS, 0);
+  }
+  uint64_t deserialize_ns() const {
+    return GetField<uint64_t>(VT_DESERIALIZE_NS, 0);
+  }
+  uint64_t deserialize_max_ns() const {
+    return GetField<uint64_t>(VT_DESERIALIZE_MAX_NS, 0);
+  }
+  uint64_t compute_ns() const {
+    return GetField<uint64_t>(VT_COMPUTE_NS, 0);
+  }
+  uint64_t compute_max_ns() const {
+    return GetField<uint64_t>(VT_COMPUTE_MAX_NS, 0);
+  }
+  uint64_t serialize_ns() const {
+    return GetField<uint64_t>(VT_SERIALIZE_NS, 0);
+  }
+  uint64_t serialize_max_ns() const {
+    return GetField<uint64_t>(VT_SERIALIZE_MAX_NS, 0);
+  }
+  uint64_t bytes_in() const {
+    return GetField<uint64_t>(VT_BYTES_IN, 0);
+  }
+  uint64_t bytes_out() const {
+    return GetField<uint64_t>(VT_BYTES_OUT, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint64_t>(verifier, VT_CALLS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_TOTAL_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_MAX_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_DESERIALIZE_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_DESERIALIZE_MAX_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_COMPUTE_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_COMPUTE_MAX_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_SERIALIZE_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_SERIALIZE_MAX_NS, 8) &&
+           VerifyField<uint64_t>(verifier, VT_BYTES_IN, 8) &&
+           VerifyField<uint64_t>(verifier, VT_BYTES_OUT, 8) &&
+           verifier.EndTable();
+  }
+};
+
+struct ProfileEntryDataBuilder {
+  typedef ProfileEntryData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(ProfileEntryData::VT_NAME, name);
+  }
+  void add_calls(uint64_t calls) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_CALLS, calls, 0);
+  }
+  void add_total_ns(uint64_t total_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_TOTAL_NS, total_ns, 0);
+  }
+  void add_max_ns(uint64_t max_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_MAX_NS, max_ns, 0);
+  }
+  void add_deserialize_ns(uint64_t deserialize_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_DESERIALIZE_NS, deserialize_ns, 0);
+  }
+  void add_deserialize_max_ns(uint64_t deserialize_max_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_DESERIALIZE_MAX_NS, deserialize_max_ns, 0);
+  }
+  void add_compute_ns(uint64_t compute_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_COMPUTE_NS, compute_ns, 0);
+  }
+  void add_compute_max_ns(uint64_t compute_max_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_COMPUTE_MAX_NS, compute_max_ns, 0);
+  }
+  void add_serialize_ns(uint64_t serialize_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_SERIALIZE_NS, serialize_ns, 0);
+  }
+  void add_serialize_max_ns(uint64_t serialize_max_ns) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_SERIALIZE_MAX_NS, serialize_max_ns, 0);
+  }
+  void add_bytes_in(uint64_t bytes_in) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_BYTES_IN, bytes_in, 0);
+  }
+  void add_bytes_out(uint64_t bytes_out) {
+    fbb_.AddElement<uint64_t>(ProfileEntryData::VT_BYTES_OUT, bytes_out, 0);
+  }
+  explicit ProfileEntryDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ProfileEntryData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ProfileEntryData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ProfileEntryData> CreateProfileEntryData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    uint64_t calls = 0,
+    uint64_t total_ns = 0,
+    uint64_t max_ns = 0,
+    uint64_t deserialize_ns = 0,
+    uint64_t deserialize_max_ns = 0,
+    uint64_t compute_ns = 0,
+    uint64_t compute_max_ns = 0,
+    uint64_t serialize_ns = 0,
+    uint64_t serialize_max_ns = 0,
+    uint64_t bytes_in = 0,
+    uint64_t bytes_out = 0) {
+  ProfileEntryDataBuilder builder_(_fbb);
+  builder_.add_bytes_out(bytes_out);
+  builder_.add_bytes_in(bytes_in);
+  builder_.add_serialize_max_ns(serialize_max_ns);
+  builder_.add_serialize_ns(serialize_ns);
+  builder_.add_compute_max_ns(compute_max_ns);
+  builder_.add_compute_ns(compute_ns);
+  builder_.add_deserialize_max_ns(deserialize_max_ns);
+  builder_.add_deserialize_ns(deserialize_ns);
+  builder_.add_max_ns(max_ns);
+  builder_.add_total_ns(total_ns);
+  builder_.add_calls(calls);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ProfileEntryData> CreateProfileEntryDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    uint64_t calls = 0,
+    uint64_t total_ns = 0,
+    uint64_t max_ns = 0,
+    uint64_t deserialize_ns = 0,
+    uint64_t deserialize_max_ns = 0,
+    uint64_t compute_ns = 0,
+    uint64_t compute_max_ns = 0,
+    uint64_t serialize_ns = 0,
+    uint64_t serialize_max_ns = 0,
+    uint64_t bytes_in = 0,
+    uint64_t bytes_out = 0) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return GSP::FB::CreateProfileEntryData(
+      _fbb,
+      name__,
+      calls,
+      total_ns,
+      max_ns,
+      deserialize_ns,
+      deserialize_max_ns,
+      compute_ns,
+      compute_max_ns,
+      serialize_ns,
+      serialize_max_ns,
+      bytes_in,
+      bytes_out);
+}
+
+struct ProfileSnapshotData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ProfileSnapshotDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENTRIES = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ProfileEntryData>> *entries() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ProfileEntryData>> *>(VT_ENTRIES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.VerifyVector(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ProfileSnapshotDataBuilder {
+  typedef ProfileSnapshotData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_entries(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ProfileEntryData>>> entries) {
+    fbb_.AddOffset(ProfileSnapshotData::VT_ENTRIES, entries);
+  }
+  explicit ProfileSnapshotDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ProfileSnapshotData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ProfileSnapshotData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ProfileSnapshotData> CreateProfileSnapshotData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ProfileEntryData>>> entries = 0) {
+  ProfileSnapshotDataBuilder builder_(_fbb);
+  builder_.add_entries(entries);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ProfileSnapshotData> CreateProfileSnapshotDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::ProfileEntryData>> *entries = nullptr) {
+  auto entries__ = entries ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::ProfileEntryData>>(*entries) : 0;
+  return GSP::FB::CreateProfileSnapshotData(
+      _fbb,
+      entries__);
+}
+
+inline const GSP::FB::ProfileSnapshotData *GetProfileSnapshotData(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::ProfileSnapshotData>(buf);
+}
+
+inline const GSP::FB::ProfileSnapshotData *GetSizePrefixedProfileSnapshotData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::ProfileSnapshotData>(buf);
+}
+
+inline bool VerifyProfileSnapshotDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::ProfileSnapshotData>(nullptr);
+}
+
+inline bool VerifySizePrefixedProfileSnapshotDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::ProfileSnapshotData>(nullptr);
+}
+
+inline void FinishProfileSnapshotDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::ProfileSnapshotData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedProfileSnapshotDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::ProfileSnapshotData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_PROFILE_GSP_FB_H_
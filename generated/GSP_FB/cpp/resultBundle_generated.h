@@ -0,0 +1,284 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_RESULTBUNDLE_GSP_FB_H_
+#define FLATBUFFERS_GENERATED_RESULTBUNDLE_GSP_FB_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+#include "base_generated.h"
+
+namespace GSP {
+namespace FB {
+
+struct ResultColumnData;
+struct ResultColumnDataBuilder;
+
+struct ResultBundleData;
+struct ResultBundleDataBuilder;
+
+enum class ResultColumnType : uint8_t {
+  Points = 0,
+  Doubles = 1,
+  Ints = 2,
+  IntPairs = 3,
+  NestedInts = 4,
+  MIN = Points,
+  MAX = NestedInts
+};
+
+inline const ResultColumnType (&EnumValuesResultColumnType())[5] {
+  static const ResultColumnType values[] = {
+    ResultColumnType::Points,
+    ResultColumnType::Doubles,
+    ResultColumnType::Ints,
+    ResultColumnType::IntPairs,
+    ResultColumnType::NestedInts
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesResultColumnType() {
+  static const char * const names[6] = {
+    "Points",
+    "Doubles",
+    "Ints",
+    "IntPairs",
+    "NestedInts",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameResultColumnType(ResultColumnType e) {
+  if (::flatbuffers::IsOutRange(e, ResultColumnType::Points, ResultColumnType::NestedInts)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesResultColumnType()[index];
+}
+
+struct ResultColumnData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ResultColumnDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_TYPE = 6,
+    VT_POINTS = 8,
+    VT_DOUBLES = 10,
+    VT_INTS = 12,
+    VT_PAIRS = 14,
+    VT_SIZES = 16
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  GSP::FB::ResultColumnType type() const {
+    return static_cast<GSP::FB::ResultColumnType>(GetField<uint8_t>(VT_TYPE, 0));
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *points() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec3 *> *>(VT_POINTS);
+  }
+  const ::flatbuffers::Vector<double> *doubles() const {
+    return GetPointer<const ::flatbuffers::Vector<double> *>(VT_DOUBLES);
+  }
+  const ::flatbuffers::Vector<int32_t> *ints() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_INTS);
+  }
+  const ::flatbuffers::Vector<const GSP::FB::Vec2i *> *pairs() const {
+    return GetPointer<const ::flatbuffers::Vector<const GSP::FB::Vec2i *> *>(VT_PAIRS);
+  }
+  const ::flatbuffers::Vector<int32_t> *sizes() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_SIZES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyField<uint8_t>(verifier, VT_TYPE, 1) &&
+           VerifyOffset(verifier, VT_POINTS) &&
+           verifier.VerifyVector(points()) &&
+           VerifyOffset(verifier, VT_DOUBLES) &&
+           verifier.VerifyVector(doubles()) &&
+           VerifyOffset(verifier, VT_INTS) &&
+           verifier.VerifyVector(ints()) &&
+           VerifyOffset(verifier, VT_PAIRS) &&
+           verifier.VerifyVector(pairs()) &&
+           VerifyOffset(verifier, VT_SIZES) &&
+           verifier.VerifyVector(sizes()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ResultColumnDataBuilder {
+  typedef ResultColumnData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(ResultColumnData::VT_NAME, name);
+  }
+  void add_type(GSP::FB::ResultColumnType type) {
+    fbb_.AddElement<uint8_t>(ResultColumnData::VT_TYPE, static_cast<uint8_t>(type), 0);
+  }
+  void add_points(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points) {
+    fbb_.AddOffset(ResultColumnData::VT_POINTS, points);
+  }
+  void add_doubles(::flatbuffers::Offset<::flatbuffers::Vector<double>> doubles) {
+    fbb_.AddOffset(ResultColumnData::VT_DOUBLES, doubles);
+  }
+  void add_ints(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> ints) {
+    fbb_.AddOffset(ResultColumnData::VT_INTS, ints);
+  }
+  void add_pairs(::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec2i *>> pairs) {
+    fbb_.AddOffset(ResultColumnData::VT_PAIRS, pairs);
+  }
+  void add_sizes(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> sizes) {
+    fbb_.AddOffset(ResultColumnData::VT_SIZES, sizes);
+  }
+  explicit ResultColumnDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ResultColumnData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ResultColumnData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ResultColumnData> CreateResultColumnData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    GSP::FB::ResultColumnType type = GSP::FB::ResultColumnType::Points,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec3 *>> points = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> doubles = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> ints = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GSP::FB::Vec2i *>> pairs = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> sizes = 0) {
+  ResultColumnDataBuilder builder_(_fbb);
+  builder_.add_sizes(sizes);
+  builder_.add_pairs(pairs);
+  builder_.add_ints(ints);
+  builder_.add_doubles(doubles);
+  builder_.add_points(points);
+  builder_.add_name(name);
+  builder_.add_type(type);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ResultColumnData> CreateResultColumnDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    GSP::FB::ResultColumnType type = GSP::FB::ResultColumnType::Points,
+    const std::vector<GSP::FB::Vec3> *points = nullptr,
+    const std::vector<double> *doubles = nullptr,
+    const std::vector<int32_t> *ints = nullptr,
+    const std::vector<GSP::FB::Vec2i> *pairs = nullptr,
+    const std::vector<int32_t> *sizes = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto points__ = points ? _fbb.CreateVectorOfStructs<GSP::FB::Vec3>(*points) : 0;
+  auto doubles__ = doubles ? _fbb.CreateVector<double>(*doubles) : 0;
+  auto ints__ = ints ? _fbb.CreateVector<int32_t>(*ints) : 0;
+  auto pairs__ = pairs ? _fbb.CreateVectorOfStructs<GSP::FB::Vec2i>(*pairs) : 0;
+  auto sizes__ = sizes ? _fbb.CreateVector<int32_t>(*sizes) : 0;
+  return GSP::FB::CreateResultColumnData(
+      _fbb,
+      name__,
+      type,
+      points__,
+      doubles__,
+      ints__,
+      pairs__,
+      sizes__);
+}
+
+struct ResultBundleData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ResultBundleDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_COLUMNS = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ResultColumnData>> *columns() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ResultColumnData>> *>(VT_COLUMNS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_COLUMNS) &&
+           verifier.VerifyVector(columns()) &&
+           verifier.VerifyVectorOfTables(columns()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ResultBundleDataBuilder {
+  typedef ResultBundleData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_columns(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ResultColumnData>>> columns) {
+    fbb_.AddOffset(ResultBundleData::VT_COLUMNS, columns);
+  }
+  explicit ResultBundleDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ResultBundleData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ResultBundleData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ResultBundleData> CreateResultBundleData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GSP::FB::ResultColumnData>>> columns = 0) {
+  ResultBundleDataBuilder builder_(_fbb);
+  builder_.add_columns(columns);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ResultBundleData> CreateResultBundleDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GSP::FB::ResultColumnData>> *columns = nullptr) {
+  auto columns__ = columns ? _fbb.CreateVector<::flatbuffers::Offset<GSP::FB::ResultColumnData>>(*columns) : 0;
+  return GSP::FB::CreateResultBundleData(
+      _fbb,
+      columns__);
+}
+
+inline const GSP::FB::ResultBundleData *GetResultBundleData(const void *buf) {
+  return ::flatbuffers::GetRoot<GSP::FB::ResultBundleData>(buf);
+}
+
+inline const GSP::FB::ResultBundleData *GetSizePrefixedResultBundleData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GSP::FB::ResultBundleData>(buf);
+}
+
+inline bool VerifyResultBundleDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GSP::FB::ResultBundleData>(nullptr);
+}
+
+inline bool VerifySizePrefixedResultBundleDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GSP::FB::ResultBundleData>(nullptr);
+}
+
+inline void FinishResultBundleDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::ResultBundleData> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedResultBundleDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GSP::FB::ResultBundleData> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace FB
+}  // namespace GSP
+
+#endif  // FLATBUFFERS_GENERATED_RESULTBUNDLE_GSP_FB_H_
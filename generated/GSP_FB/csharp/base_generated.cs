@@ -105,6 +105,57 @@ public class Vec2T
   }
 }
 
+public struct Vec3f : IFlatbufferObject
+{
+  private Struct __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Struct(_i, _bb); }
+  public Vec3f __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public float X { get { return __p.bb.GetFloat(__p.bb_pos + 0); } }
+  public float Y { get { return __p.bb.GetFloat(__p.bb_pos + 4); } }
+  public float Z { get { return __p.bb.GetFloat(__p.bb_pos + 8); } }
+
+  public static Offset<GSP.FB.Vec3f> CreateVec3f(FlatBufferBuilder builder, float X, float Y, float Z) {
+    builder.Prep(4, 12);
+    builder.PutFloat(Z);
+    builder.PutFloat(Y);
+    builder.PutFloat(X);
+    return new Offset<GSP.FB.Vec3f>(builder.Offset);
+  }
+  public Vec3fT UnPack() {
+    var _o = new Vec3fT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(Vec3fT _o) {
+    _o.X = this.X;
+    _o.Y = this.Y;
+    _o.Z = this.Z;
+  }
+  public static Offset<GSP.FB.Vec3f> Pack(FlatBufferBuilder builder, Vec3fT _o) {
+    if (_o == null) return default(Offset<GSP.FB.Vec3f>);
+    return CreateVec3f(
+      builder,
+      _o.X,
+      _o.Y,
+      _o.Z);
+  }
+}
+
+public class Vec3fT
+{
+  public float X { get; set; }
+  public float Y { get; set; }
+  public float Z { get; set; }
+
+  public Vec3fT() {
+    this.X = 0.0f;
+    this.Y = 0.0f;
+    this.Z = 0.0f;
+  }
+}
+
 public struct Vec3i : IFlatbufferObject
 {
   private Struct __p;
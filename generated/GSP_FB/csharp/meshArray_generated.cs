@@ -0,0 +1,97 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MeshArrayData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MeshArrayData GetRootAsMeshArrayData(ByteBuffer _bb) { return GetRootAsMeshArrayData(_bb, new MeshArrayData()); }
+  public static MeshArrayData GetRootAsMeshArrayData(ByteBuffer _bb, MeshArrayData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMeshArrayData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MeshArrayDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MeshArrayData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.MeshData? Meshes(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.MeshData?)(new GSP.FB.MeshData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int MeshesLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.MeshArrayData> CreateMeshArrayData(FlatBufferBuilder builder,
+      VectorOffset meshesOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    MeshArrayData.AddMeshes(builder, meshesOffset);
+    return MeshArrayData.EndMeshArrayData(builder);
+  }
+
+  public static void StartMeshArrayData(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddMeshes(FlatBufferBuilder builder, VectorOffset meshesOffset) { builder.AddOffset(0, meshesOffset.Value, 0); }
+  public static VectorOffset CreateMeshesVector(FlatBufferBuilder builder, Offset<GSP.FB.MeshData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateMeshesVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.MeshData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateMeshesVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.MeshData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateMeshesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.MeshData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartMeshesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.MeshArrayData> EndMeshArrayData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MeshArrayData>(o);
+  }
+  public static void FinishMeshArrayDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshArrayData> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedMeshArrayDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshArrayData> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public MeshArrayDataT UnPack() {
+    var _o = new MeshArrayDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MeshArrayDataT _o) {
+    _o.Meshes = new List<GSP.FB.MeshDataT>();
+    for (var _j = 0; _j < this.MeshesLength; ++_j) {_o.Meshes.Add(this.Meshes(_j).HasValue ? this.Meshes(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.MeshArrayData> Pack(FlatBufferBuilder builder, MeshArrayDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MeshArrayData>);
+    var _meshes = default(VectorOffset);
+    if (_o.Meshes != null) {
+      var __meshes = new Offset<GSP.FB.MeshData>[_o.Meshes.Count];
+      for (var _j = 0; _j < __meshes.Length; ++_j) { __meshes[_j] = GSP.FB.MeshData.Pack(builder, _o.Meshes[_j]); }
+      _meshes = CreateMeshesVector(builder, __meshes);
+    }
+    return CreateMeshArrayData(
+      builder,
+      _meshes);
+  }
+}
+
+public class MeshArrayDataT
+{
+  public List<GSP.FB.MeshDataT> Meshes { get; set; }
+
+  public MeshArrayDataT() {
+    this.Meshes = null;
+  }
+  public static MeshArrayDataT DeserializeFromBinary(byte[] fbBuffer) {
+    return MeshArrayData.GetRootAsMeshArrayData(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    MeshArrayData.FinishMeshArrayDataBuffer(fbb, MeshArrayData.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class MeshArrayDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Meshes*/, GSP.FB.MeshDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,129 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MeshDataF : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static MeshDataF GetRootAsMeshDataF(ByteBuffer _bb) { return GetRootAsMeshDataF(_bb, new MeshDataF()); }
+  public static MeshDataF GetRootAsMeshDataF(ByteBuffer _bb, MeshDataF obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyMeshDataF(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, MeshDataFVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MeshDataF __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.Vec3f? Vertices(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.Vec3f?)(new GSP.FB.Vec3f()).__assign(__p.__vector(o) + j * 12, __p.bb) : null; }
+  public int VerticesLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.Vec3i? Faces(int j) { int o = __p.__offset(6); return o != 0 ? (GSP.FB.Vec3i?)(new GSP.FB.Vec3i()).__assign(__p.__vector(o) + j * 12, __p.bb) : null; }
+  public int FacesLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public GSP.FB.Vec4i? QuadFaces(int j) { int o = __p.__offset(8); return o != 0 ? (GSP.FB.Vec4i?)(new GSP.FB.Vec4i()).__assign(__p.__vector(o) + j * 16, __p.bb) : null; }
+  public int QuadFacesLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.MeshDataF> CreateMeshDataF(FlatBufferBuilder builder,
+      VectorOffset verticesOffset = default(VectorOffset),
+      VectorOffset facesOffset = default(VectorOffset),
+      VectorOffset quad_facesOffset = default(VectorOffset)) {
+    builder.StartTable(3);
+    MeshDataF.AddQuadFaces(builder, quad_facesOffset);
+    MeshDataF.AddFaces(builder, facesOffset);
+    MeshDataF.AddVertices(builder, verticesOffset);
+    return MeshDataF.EndMeshDataF(builder);
+  }
+
+  public static void StartMeshDataF(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void AddVertices(FlatBufferBuilder builder, VectorOffset verticesOffset) { builder.AddOffset(0, verticesOffset.Value, 0); }
+  public static void StartVerticesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(12, numElems, 4); }
+  public static void AddFaces(FlatBufferBuilder builder, VectorOffset facesOffset) { builder.AddOffset(1, facesOffset.Value, 0); }
+  public static void StartFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(12, numElems, 4); }
+  public static void AddQuadFaces(FlatBufferBuilder builder, VectorOffset quadFacesOffset) { builder.AddOffset(2, quadFacesOffset.Value, 0); }
+  public static void StartQuadFacesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(16, numElems, 4); }
+  public static Offset<GSP.FB.MeshDataF> EndMeshDataF(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.MeshDataF>(o);
+  }
+  public static void FinishMeshDataFBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshDataF> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedMeshDataFBuffer(FlatBufferBuilder builder, Offset<GSP.FB.MeshDataF> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public MeshDataFT UnPack() {
+    var _o = new MeshDataFT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(MeshDataFT _o) {
+    _o.Vertices = new List<GSP.FB.Vec3fT>();
+    for (var _j = 0; _j < this.VerticesLength; ++_j) {_o.Vertices.Add(this.Vertices(_j).HasValue ? this.Vertices(_j).Value.UnPack() : null);}
+    _o.Faces = new List<GSP.FB.Vec3iT>();
+    for (var _j = 0; _j < this.FacesLength; ++_j) {_o.Faces.Add(this.Faces(_j).HasValue ? this.Faces(_j).Value.UnPack() : null);}
+    _o.QuadFaces = new List<GSP.FB.Vec4iT>();
+    for (var _j = 0; _j < this.QuadFacesLength; ++_j) {_o.QuadFaces.Add(this.QuadFaces(_j).HasValue ? this.QuadFaces(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.MeshDataF> Pack(FlatBufferBuilder builder, MeshDataFT _o) {
+    if (_o == null) return default(Offset<GSP.FB.MeshDataF>);
+    var _vertices = default(VectorOffset);
+    if (_o.Vertices != null) {
+      StartVerticesVector(builder, _o.Vertices.Count);
+      for (var _j = _o.Vertices.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3f.Pack(builder, _o.Vertices[_j]); }
+      _vertices = builder.EndVector();
+    }
+    var _faces = default(VectorOffset);
+    if (_o.Faces != null) {
+      StartFacesVector(builder, _o.Faces.Count);
+      for (var _j = _o.Faces.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3i.Pack(builder, _o.Faces[_j]); }
+      _faces = builder.EndVector();
+    }
+    var _quad_faces = default(VectorOffset);
+    if (_o.QuadFaces != null) {
+      StartQuadFacesVector(builder, _o.QuadFaces.Count);
+      for (var _j = _o.QuadFaces.Count - 1; _j >= 0; --_j) { GSP.FB.Vec4i.Pack(builder, _o.QuadFaces[_j]); }
+      _quad_faces = builder.EndVector();
+    }
+    return CreateMeshDataF(
+      builder,
+      _vertices,
+      _faces,
+      _quad_faces);
+  }
+}
+
+public class MeshDataFT
+{
+  public List<GSP.FB.Vec3fT> Vertices { get; set; }
+  public List<GSP.FB.Vec3iT> Faces { get; set; }
+  public List<GSP.FB.Vec4iT> QuadFaces { get; set; }
+
+  public MeshDataFT() {
+    this.Vertices = null;
+    this.Faces = null;
+    this.QuadFaces = null;
+  }
+  public static MeshDataFT DeserializeFromBinary(byte[] fbBuffer) {
+    return MeshDataF.GetRootAsMeshDataF(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    MeshDataF.FinishMeshDataFBuffer(fbb, MeshDataF.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class MeshDataFVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfData(tablePos, 4 /*Vertices*/, 12 /*GSP.FB.Vec3f*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Faces*/, 12 /*GSP.FB.Vec3i*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 8 /*QuadFaces*/, 16 /*GSP.FB.Vec4i*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
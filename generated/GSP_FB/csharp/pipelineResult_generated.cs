@@ -0,0 +1,193 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct PipelineOutputData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static PipelineOutputData GetRootAsPipelineOutputData(ByteBuffer _bb) { return GetRootAsPipelineOutputData(_bb, new PipelineOutputData()); }
+  public static PipelineOutputData GetRootAsPipelineOutputData(ByteBuffer _bb, PipelineOutputData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public PipelineOutputData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.Vec3? Points(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(__p.__vector(o) + j * 24, __p.bb) : null; }
+  public int PointsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public double Values(int j) { int o = __p.__offset(6); return o != 0 ? __p.bb.GetDouble(__p.__vector(o) + j * 8) : (double)0; }
+  public int ValuesLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<double> GetValuesBytes() { return __p.__vector_as_span<double>(6, 8); }
+#else
+  public ArraySegment<byte>? GetValuesBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public double[] GetValuesArray() { return __p.__vector_as_array<double>(6); }
+
+  public static Offset<GSP.FB.PipelineOutputData> CreatePipelineOutputData(FlatBufferBuilder builder,
+      VectorOffset pointsOffset = default(VectorOffset),
+      VectorOffset valuesOffset = default(VectorOffset)) {
+    builder.StartTable(2);
+    PipelineOutputData.AddValues(builder, valuesOffset);
+    PipelineOutputData.AddPoints(builder, pointsOffset);
+    return PipelineOutputData.EndPipelineOutputData(builder);
+  }
+
+  public static void StartPipelineOutputData(FlatBufferBuilder builder) { builder.StartTable(2); }
+  public static void AddPoints(FlatBufferBuilder builder, VectorOffset pointsOffset) { builder.AddOffset(0, pointsOffset.Value, 0); }
+  public static void StartPointsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(24, numElems, 8); }
+  public static void AddValues(FlatBufferBuilder builder, VectorOffset valuesOffset) { builder.AddOffset(1, valuesOffset.Value, 0); }
+  public static VectorOffset CreateValuesVector(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); for (int i = data.Length - 1; i >= 0; i--) builder.AddDouble(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, ArraySegment<double> data) { builder.StartVector(8, data.Count, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<double>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartValuesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 8); }
+  public static Offset<GSP.FB.PipelineOutputData> EndPipelineOutputData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.PipelineOutputData>(o);
+  }
+  public PipelineOutputDataT UnPack() {
+    var _o = new PipelineOutputDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(PipelineOutputDataT _o) {
+    _o.Points = new List<GSP.FB.Vec3T>();
+    for (var _j = 0; _j < this.PointsLength; ++_j) {_o.Points.Add(this.Points(_j).HasValue ? this.Points(_j).Value.UnPack() : null);}
+    _o.Values = new List<double>();
+    for (var _j = 0; _j < this.ValuesLength; ++_j) {_o.Values.Add(this.Values(_j));}
+  }
+  public static Offset<GSP.FB.PipelineOutputData> Pack(FlatBufferBuilder builder, PipelineOutputDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.PipelineOutputData>);
+    var _points = default(VectorOffset);
+    if (_o.Points != null) {
+      StartPointsVector(builder, _o.Points.Count);
+      for (var _j = _o.Points.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3.Pack(builder, _o.Points[_j]); }
+      _points = builder.EndVector();
+    }
+    var _values = default(VectorOffset);
+    if (_o.Values != null) {
+      var __values = _o.Values.ToArray();
+      _values = CreateValuesVector(builder, __values);
+    }
+    return CreatePipelineOutputData(
+      builder,
+      _points,
+      _values);
+  }
+}
+
+public class PipelineOutputDataT
+{
+  public List<GSP.FB.Vec3T> Points { get; set; }
+  public List<double> Values { get; set; }
+
+  public PipelineOutputDataT() {
+    this.Points = null;
+    this.Values = null;
+  }
+}
+
+
+static public class PipelineOutputDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfData(tablePos, 4 /*Points*/, 24 /*GSP.FB.Vec3*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Values*/, 8 /*double*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+public struct PipelineResultData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static PipelineResultData GetRootAsPipelineResultData(ByteBuffer _bb) { return GetRootAsPipelineResultData(_bb, new PipelineResultData()); }
+  public static PipelineResultData GetRootAsPipelineResultData(ByteBuffer _bb, PipelineResultData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyPipelineResultData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, PipelineResultDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public PipelineResultData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.PipelineOutputData? Outputs(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.PipelineOutputData?)(new GSP.FB.PipelineOutputData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int OutputsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.PipelineResultData> CreatePipelineResultData(FlatBufferBuilder builder,
+      VectorOffset outputsOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    PipelineResultData.AddOutputs(builder, outputsOffset);
+    return PipelineResultData.EndPipelineResultData(builder);
+  }
+
+  public static void StartPipelineResultData(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddOutputs(FlatBufferBuilder builder, VectorOffset outputsOffset) { builder.AddOffset(0, outputsOffset.Value, 0); }
+  public static VectorOffset CreateOutputsVector(FlatBufferBuilder builder, Offset<GSP.FB.PipelineOutputData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateOutputsVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.PipelineOutputData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateOutputsVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.PipelineOutputData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateOutputsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.PipelineOutputData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartOutputsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.PipelineResultData> EndPipelineResultData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.PipelineResultData>(o);
+  }
+  public static void FinishPipelineResultDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PipelineResultData> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedPipelineResultDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PipelineResultData> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public PipelineResultDataT UnPack() {
+    var _o = new PipelineResultDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(PipelineResultDataT _o) {
+    _o.Outputs = new List<GSP.FB.PipelineOutputDataT>();
+    for (var _j = 0; _j < this.OutputsLength; ++_j) {_o.Outputs.Add(this.Outputs(_j).HasValue ? this.Outputs(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.PipelineResultData> Pack(FlatBufferBuilder builder, PipelineResultDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.PipelineResultData>);
+    var _outputs = default(VectorOffset);
+    if (_o.Outputs != null) {
+      var __outputs = new Offset<GSP.FB.PipelineOutputData>[_o.Outputs.Count];
+      for (var _j = 0; _j < __outputs.Length; ++_j) { __outputs[_j] = GSP.FB.PipelineOutputData.Pack(builder, _o.Outputs[_j]); }
+      _outputs = CreateOutputsVector(builder, __outputs);
+    }
+    return CreatePipelineResultData(
+      builder,
+      _outputs);
+  }
+}
+
+public class PipelineResultDataT
+{
+  public List<GSP.FB.PipelineOutputDataT> Outputs { get; set; }
+
+  public PipelineResultDataT() {
+    this.Outputs = null;
+  }
+  public static PipelineResultDataT DeserializeFromBinary(byte[] fbBuffer) {
+    return PipelineResultData.GetRootAsPipelineResultData(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    PipelineResultData.FinishPipelineResultDataBuffer(fbb, PipelineResultData.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class PipelineResultDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Outputs*/, GSP.FB.PipelineOutputDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,270 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public enum PipelineOp : byte
+{
+  Mesh = 0,
+  Values = 1,
+  VertexNormals = 2,
+  FaceNormals = 3,
+  Barycenters = 4,
+  GaussianCurvature = 5,
+  RemapVtoF = 6,
+  RemapFtoV = 7,
+  Isolines = 8,
+};
+
+public struct PipelineStepData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static PipelineStepData GetRootAsPipelineStepData(ByteBuffer _bb) { return GetRootAsPipelineStepData(_bb, new PipelineStepData()); }
+  public static PipelineStepData GetRootAsPipelineStepData(ByteBuffer _bb, PipelineStepData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public PipelineStepData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.PipelineOp Op { get { int o = __p.__offset(4); return o != 0 ? (GSP.FB.PipelineOp)__p.bb.Get(o + __p.bb_pos) : GSP.FB.PipelineOp.Mesh; } }
+  public int Inputs(int j) { int o = __p.__offset(6); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int InputsLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetInputsBytes() { return __p.__vector_as_span<int>(6, 4); }
+#else
+  public ArraySegment<byte>? GetInputsBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public int[] GetInputsArray() { return __p.__vector_as_array<int>(6); }
+  public double Values(int j) { int o = __p.__offset(8); return o != 0 ? __p.bb.GetDouble(__p.__vector(o) + j * 8) : (double)0; }
+  public int ValuesLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<double> GetValuesBytes() { return __p.__vector_as_span<double>(8, 8); }
+#else
+  public ArraySegment<byte>? GetValuesBytes() { return __p.__vector_as_arraysegment(8); }
+#endif
+  public double[] GetValuesArray() { return __p.__vector_as_array<double>(8); }
+  public GSP.FB.MeshData? Mesh { get { int o = __p.__offset(10); return o != 0 ? (GSP.FB.MeshData?)(new GSP.FB.MeshData()).__assign(__p.__indirect(o + __p.bb_pos), __p.bb) : null; } }
+  public ulong MeshHandle { get { int o = __p.__offset(12); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+
+  public static Offset<GSP.FB.PipelineStepData> CreatePipelineStepData(FlatBufferBuilder builder,
+      GSP.FB.PipelineOp op = GSP.FB.PipelineOp.Mesh,
+      VectorOffset inputsOffset = default(VectorOffset),
+      VectorOffset valuesOffset = default(VectorOffset),
+      Offset<GSP.FB.MeshData> meshOffset = default(Offset<GSP.FB.MeshData>),
+      ulong mesh_handle = 0) {
+    builder.StartTable(5);
+    PipelineStepData.AddMeshHandle(builder, mesh_handle);
+    PipelineStepData.AddMesh(builder, meshOffset);
+    PipelineStepData.AddValues(builder, valuesOffset);
+    PipelineStepData.AddInputs(builder, inputsOffset);
+    PipelineStepData.AddOp(builder, op);
+    return PipelineStepData.EndPipelineStepData(builder);
+  }
+
+  public static void StartPipelineStepData(FlatBufferBuilder builder) { builder.StartTable(5); }
+  public static void AddOp(FlatBufferBuilder builder, GSP.FB.PipelineOp op) { builder.AddByte(0, (byte)op, 0); }
+  public static void AddInputs(FlatBufferBuilder builder, VectorOffset inputsOffset) { builder.AddOffset(1, inputsOffset.Value, 0); }
+  public static VectorOffset CreateInputsVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateInputsVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateInputsVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateInputsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartInputsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddValues(FlatBufferBuilder builder, VectorOffset valuesOffset) { builder.AddOffset(2, valuesOffset.Value, 0); }
+  public static VectorOffset CreateValuesVector(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); for (int i = data.Length - 1; i >= 0; i--) builder.AddDouble(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, ArraySegment<double> data) { builder.StartVector(8, data.Count, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateValuesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<double>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartValuesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 8); }
+  public static void AddMesh(FlatBufferBuilder builder, Offset<GSP.FB.MeshData> meshOffset) { builder.AddOffset(3, meshOffset.Value, 0); }
+  public static void AddMeshHandle(FlatBufferBuilder builder, ulong meshHandle) { builder.AddUlong(4, meshHandle, 0); }
+  public static Offset<GSP.FB.PipelineStepData> EndPipelineStepData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.PipelineStepData>(o);
+  }
+  public PipelineStepDataT UnPack() {
+    var _o = new PipelineStepDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(PipelineStepDataT _o) {
+    _o.Op = this.Op;
+    _o.Inputs = new List<int>();
+    for (var _j = 0; _j < this.InputsLength; ++_j) {_o.Inputs.Add(this.Inputs(_j));}
+    _o.Values = new List<double>();
+    for (var _j = 0; _j < this.ValuesLength; ++_j) {_o.Values.Add(this.Values(_j));}
+    _o.Mesh = this.Mesh.HasValue ? this.Mesh.Value.UnPack() : null;
+    _o.MeshHandle = this.MeshHandle;
+  }
+  public static Offset<GSP.FB.PipelineStepData> Pack(FlatBufferBuilder builder, PipelineStepDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.PipelineStepData>);
+    var _inputs = default(VectorOffset);
+    if (_o.Inputs != null) {
+      var __inputs = _o.Inputs.ToArray();
+      _inputs = CreateInputsVector(builder, __inputs);
+    }
+    var _values = default(VectorOffset);
+    if (_o.Values != null) {
+      var __values = _o.Values.ToArray();
+      _values = CreateValuesVector(builder, __values);
+    }
+    var _mesh = _o.Mesh == null ? default(Offset<GSP.FB.MeshData>) : GSP.FB.MeshData.Pack(builder, _o.Mesh);
+    return CreatePipelineStepData(
+      builder,
+      _o.Op,
+      _inputs,
+      _values,
+      _mesh,
+      _o.MeshHandle);
+  }
+}
+
+public class PipelineStepDataT
+{
+  public GSP.FB.PipelineOp Op { get; set; }
+  public List<int> Inputs { get; set; }
+  public List<double> Values { get; set; }
+  public GSP.FB.MeshDataT Mesh { get; set; }
+  public ulong MeshHandle { get; set; }
+
+  public PipelineStepDataT() {
+    this.Op = GSP.FB.PipelineOp.Mesh;
+    this.Inputs = null;
+    this.Values = null;
+    this.Mesh = null;
+    this.MeshHandle = 0;
+  }
+}
+
+
+static public class PipelineStepDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*Op*/, 1 /*GSP.FB.PipelineOp*/, 1, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Inputs*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 8 /*Values*/, 8 /*double*/, false)
+      && verifier.VerifyTable(tablePos, 10 /*Mesh*/, GSP.FB.MeshDataVerify.Verify, false)
+      && verifier.VerifyField(tablePos, 12 /*MeshHandle*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+public struct PipelineData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static PipelineData GetRootAsPipelineData(ByteBuffer _bb) { return GetRootAsPipelineData(_bb, new PipelineData()); }
+  public static PipelineData GetRootAsPipelineData(ByteBuffer _bb, PipelineData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyPipelineData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, PipelineDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public PipelineData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.PipelineStepData? Steps(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.PipelineStepData?)(new GSP.FB.PipelineStepData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int StepsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public int Outputs(int j) { int o = __p.__offset(6); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int OutputsLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetOutputsBytes() { return __p.__vector_as_span<int>(6, 4); }
+#else
+  public ArraySegment<byte>? GetOutputsBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public int[] GetOutputsArray() { return __p.__vector_as_array<int>(6); }
+
+  public static Offset<GSP.FB.PipelineData> CreatePipelineData(FlatBufferBuilder builder,
+      VectorOffset stepsOffset = default(VectorOffset),
+      VectorOffset outputsOffset = default(VectorOffset)) {
+    builder.StartTable(2);
+    PipelineData.AddOutputs(builder, outputsOffset);
+    PipelineData.AddSteps(builder, stepsOffset);
+    return PipelineData.EndPipelineData(builder);
+  }
+
+  public static void StartPipelineData(FlatBufferBuilder builder) { builder.StartTable(2); }
+  public static void AddSteps(FlatBufferBuilder builder, VectorOffset stepsOffset) { builder.AddOffset(0, stepsOffset.Value, 0); }
+  public static VectorOffset CreateStepsVector(FlatBufferBuilder builder, Offset<GSP.FB.PipelineStepData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateStepsVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.PipelineStepData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateStepsVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.PipelineStepData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateStepsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.PipelineStepData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartStepsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddOutputs(FlatBufferBuilder builder, VectorOffset outputsOffset) { builder.AddOffset(1, outputsOffset.Value, 0); }
+  public static VectorOffset CreateOutputsVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateOutputsVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateOutputsVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateOutputsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartOutputsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.PipelineData> EndPipelineData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.PipelineData>(o);
+  }
+  public static void FinishPipelineDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PipelineData> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedPipelineDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PipelineData> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public PipelineDataT UnPack() {
+    var _o = new PipelineDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(PipelineDataT _o) {
+    _o.Steps = new List<GSP.FB.PipelineStepDataT>();
+    for (var _j = 0; _j < this.StepsLength; ++_j) {_o.Steps.Add(this.Steps(_j).HasValue ? this.Steps(_j).Value.UnPack() : null);}
+    _o.Outputs = new List<int>();
+    for (var _j = 0; _j < this.OutputsLength; ++_j) {_o.Outputs.Add(this.Outputs(_j));}
+  }
+  public static Offset<GSP.FB.PipelineData> Pack(FlatBufferBuilder builder, PipelineDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.PipelineData>);
+    var _steps = default(VectorOffset);
+    if (_o.Steps != null) {
+      var __steps = new Offset<GSP.FB.PipelineStepData>[_o.Steps.Count];
+      for (var _j = 0; _j < __steps.Length; ++_j) { __steps[_j] = GSP.FB.PipelineStepData.Pack(builder, _o.Steps[_j]); }
+      _steps = CreateStepsVector(builder, __steps);
+    }
+    var _outputs = default(VectorOffset);
+    if (_o.Outputs != null) {
+      var __outputs = _o.Outputs.ToArray();
+      _outputs = CreateOutputsVector(builder, __outputs);
+    }
+    return CreatePipelineData(
+      builder,
+      _steps,
+      _outputs);
+  }
+}
+
+public class PipelineDataT
+{
+  public List<GSP.FB.PipelineStepDataT> Steps { get; set; }
+  public List<int> Outputs { get; set; }
+
+  public PipelineDataT() {
+    this.Steps = null;
+    this.Outputs = null;
+  }
+  public static PipelineDataT DeserializeFromBinary(byte[] fbBuffer) {
+    return PipelineData.GetRootAsPipelineData(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    PipelineData.FinishPipelineDataBuffer(fbb, PipelineData.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class PipelineDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Steps*/, GSP.FB.PipelineStepDataVerify.Verify, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Outputs*/, 4 /*int*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
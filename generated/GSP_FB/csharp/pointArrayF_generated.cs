@@ -0,0 +1,93 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct PointArrayDataF : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static PointArrayDataF GetRootAsPointArrayDataF(ByteBuffer _bb) { return GetRootAsPointArrayDataF(_bb, new PointArrayDataF()); }
+  public static PointArrayDataF GetRootAsPointArrayDataF(ByteBuffer _bb, PointArrayDataF obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyPointArrayDataF(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, PointArrayDataFVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public PointArrayDataF __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.Vec3f? Points(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.Vec3f?)(new GSP.FB.Vec3f()).__assign(__p.__vector(o) + j * 12, __p.bb) : null; }
+  public int PointsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.PointArrayDataF> CreatePointArrayDataF(FlatBufferBuilder builder,
+      VectorOffset pointsOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    PointArrayDataF.AddPoints(builder, pointsOffset);
+    return PointArrayDataF.EndPointArrayDataF(builder);
+  }
+
+  public static void StartPointArrayDataF(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddPoints(FlatBufferBuilder builder, VectorOffset pointsOffset) { builder.AddOffset(0, pointsOffset.Value, 0); }
+  public static void StartPointsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(12, numElems, 4); }
+  public static Offset<GSP.FB.PointArrayDataF> EndPointArrayDataF(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.PointArrayDataF>(o);
+  }
+  public static void FinishPointArrayDataFBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PointArrayDataF> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedPointArrayDataFBuffer(FlatBufferBuilder builder, Offset<GSP.FB.PointArrayDataF> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public PointArrayDataFT UnPack() {
+    var _o = new PointArrayDataFT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(PointArrayDataFT _o) {
+    _o.Points = new List<GSP.FB.Vec3fT>();
+    for (var _j = 0; _j < this.PointsLength; ++_j) {_o.Points.Add(this.Points(_j).HasValue ? this.Points(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.PointArrayDataF> Pack(FlatBufferBuilder builder, PointArrayDataFT _o) {
+    if (_o == null) return default(Offset<GSP.FB.PointArrayDataF>);
+    var _points = default(VectorOffset);
+    if (_o.Points != null) {
+      StartPointsVector(builder, _o.Points.Count);
+      for (var _j = _o.Points.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3f.Pack(builder, _o.Points[_j]); }
+      _points = builder.EndVector();
+    }
+    return CreatePointArrayDataF(
+      builder,
+      _points);
+  }
+}
+
+public class PointArrayDataFT
+{
+  public List<GSP.FB.Vec3fT> Points { get; set; }
+
+  public PointArrayDataFT() {
+    this.Points = null;
+  }
+  public static PointArrayDataFT DeserializeFromBinary(byte[] fbBuffer) {
+    return PointArrayDataF.GetRootAsPointArrayDataF(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    PointArrayDataF.FinishPointArrayDataFBuffer(fbb, PointArrayDataF.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class PointArrayDataFVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfData(tablePos, 4 /*Points*/, 12 /*GSP.FB.Vec3f*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
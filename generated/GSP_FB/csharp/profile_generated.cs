@@ -0,0 +1,263 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct ProfileEntryData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static ProfileEntryData GetRootAsProfileEntryData(ByteBuffer _bb) { return GetRootAsProfileEntryData(_bb, new ProfileEntryData()); }
+  public static ProfileEntryData GetRootAsProfileEntryData(ByteBuffer _bb, ProfileEntryData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ProfileEntryData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public string Name { get { int o = __p.__offset(4); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetNameBytes() { return __p.__vector_as_span<byte>(4, 1); }
+#else
+  public ArraySegment<byte>? GetNameBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public byte[] GetNameArray() { return __p.__vector_as_array<byte>(4); }
+  public ulong Calls { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong TotalNs { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong MaxNs { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong DeserializeNs { get { int o = __p.__offset(12); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong DeserializeMaxNs { get { int o = __p.__offset(14); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong ComputeNs { get { int o = __p.__offset(16); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong ComputeMaxNs { get { int o = __p.__offset(18); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong SerializeNs { get { int o = __p.__offset(20); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong SerializeMaxNs { get { int o = __p.__offset(22); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong BytesIn { get { int o = __p.__offset(24); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public ulong BytesOut { get { int o = __p.__offset(26); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+
+  public static Offset<GSP.FB.ProfileEntryData> CreateProfileEntryData(FlatBufferBuilder builder,
+      StringOffset nameOffset = default(StringOffset),
+      ulong calls = 0,
+      ulong total_ns = 0,
+      ulong max_ns = 0,
+      ulong deserialize_ns = 0,
+      ulong deserialize_max_ns = 0,
+      ulong compute_ns = 0,
+      ulong compute_max_ns = 0,
+      ulong serialize_ns = 0,
+      ulong serialize_max_ns = 0,
+      ulong bytes_in = 0,
+      ulong bytes_out = 0) {
+    builder.StartTable(12);
+    ProfileEntryData.AddBytesOut(builder, bytes_out);
+    ProfileEntryData.AddBytesIn(builder, bytes_in);
+    ProfileEntryData.AddSerializeMaxNs(builder, serialize_max_ns);
+    ProfileEntryData.AddSerializeNs(builder, serialize_ns);
+    ProfileEntryData.AddComputeMaxNs(builder, compute_max_ns);
+    ProfileEntryData.AddComputeNs(builder, compute_ns);
+    ProfileEntryData.AddDeserializeMaxNs(builder, deserialize_max_ns);
+    ProfileEntryData.AddDeserializeNs(builder, deserialize_ns);
+    ProfileEntryData.AddMaxNs(builder, max_ns);
+    ProfileEntryData.AddTotalNs(builder, total_ns);
+    ProfileEntryData.AddCalls(builder, calls);
+    ProfileEntryData.AddName(builder, nameOffset);
+    return ProfileEntryData.EndProfileEntryData(builder);
+  }
+
+  public static void StartProfileEntryData(FlatBufferBuilder builder) { builder.StartTable(12); }
+  public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
+  public static void AddCalls(FlatBufferBuilder builder, ulong calls) { builder.AddUlong(1, calls, 0); }
+  public static void AddTotalNs(FlatBufferBuilder builder, ulong totalNs) { builder.AddUlong(2, totalNs, 0); }
+  public static void AddMaxNs(FlatBufferBuilder builder, ulong maxNs) { builder.AddUlong(3, maxNs, 0); }
+  public static void AddDeserializeNs(FlatBufferBuilder builder, ulong deserializeNs) { builder.AddUlong(4, deserializeNs, 0); }
+  public static void AddDeserializeMaxNs(FlatBufferBuilder builder, ulong deserializeMaxNs) { builder.AddUlong(5, deserializeMaxNs, 0); }
+  public static void AddComputeNs(FlatBufferBuilder builder, ulong computeNs) { builder.AddUlong(6, computeNs, 0); }
+  public static void AddComputeMaxNs(FlatBufferBuilder builder, ulong computeMaxNs) { builder.AddUlong(7, computeMaxNs, 0); }
+  public static void AddSerializeNs(FlatBufferBuilder builder, ulong serializeNs) { builder.AddUlong(8, serializeNs, 0); }
+  public static void AddSerializeMaxNs(FlatBufferBuilder builder, ulong serializeMaxNs) { builder.AddUlong(9, serializeMaxNs, 0); }
+  public static void AddBytesIn(FlatBufferBuilder builder, ulong bytesIn) { builder.AddUlong(10, bytesIn, 0); }
+  public static void AddBytesOut(FlatBufferBuilder builder, ulong bytesOut) { builder.AddUlong(11, bytesOut, 0); }
+  public static Offset<GSP.FB.ProfileEntryData> EndProfileEntryData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.ProfileEntryData>(o);
+  }
+  public ProfileEntryDataT UnPack() {
+    var _o = new ProfileEntryDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(ProfileEntryDataT _o) {
+    _o.Name = this.Name;
+    _o.Calls = this.Calls;
+    _o.TotalNs = this.TotalNs;
+    _o.MaxNs = this.MaxNs;
+    _o.DeserializeNs = this.DeserializeNs;
+    _o.DeserializeMaxNs = this.DeserializeMaxNs;
+    _o.ComputeNs = this.ComputeNs;
+    _o.ComputeMaxNs = this.ComputeMaxNs;
+    _o.SerializeNs = this.SerializeNs;
+    _o.SerializeMaxNs = this.SerializeMaxNs;
+    _o.BytesIn = this.BytesIn;
+    _o.BytesOut = this.BytesOut;
+  }
+  public static Offset<GSP.FB.ProfileEntryData> Pack(FlatBufferBuilder builder, ProfileEntryDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.ProfileEntryData>);
+    var _name = _o.Name == null ? default(StringOffset) : builder.CreateString(_o.Name);
+    return CreateProfileEntryData(
+      builder,
+      _name,
+      _o.Calls,
+      _o.TotalNs,
+      _o.MaxNs,
+      _o.DeserializeNs,
+      _o.DeserializeMaxNs,
+      _o.ComputeNs,
+      _o.ComputeMaxNs,
+      _o.SerializeNs,
+      _o.SerializeMaxNs,
+      _o.BytesIn,
+      _o.BytesOut);
+  }
+}
+
+public class ProfileEntryDataT
+{
+  public string Name { get; set; }
+  public ulong Calls { get; set; }
+  public ulong TotalNs { get; set; }
+  public ulong MaxNs { get; set; }
+  public ulong DeserializeNs { get; set; }
+  public ulong DeserializeMaxNs { get; set; }
+  public ulong ComputeNs { get; set; }
+  public ulong ComputeMaxNs { get; set; }
+  public ulong SerializeNs { get; set; }
+  public ulong SerializeMaxNs { get; set; }
+  public ulong BytesIn { get; set; }
+  public ulong BytesOut { get; set; }
+
+  public ProfileEntryDataT() {
+    this.Name = null;
+    this.Calls = 0;
+    this.TotalNs = 0;
+    this.MaxNs = 0;
+    this.DeserializeNs = 0;
+    this.DeserializeMaxNs = 0;
+    this.ComputeNs = 0;
+    this.ComputeMaxNs = 0;
+    this.SerializeNs = 0;
+    this.SerializeMaxNs = 0;
+    this.BytesIn = 0;
+    this.BytesOut = 0;
+  }
+}
+
+
+static public class ProfileEntryDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyString(tablePos, 4 /*Name*/, false)
+      && verifier.VerifyField(tablePos, 6 /*Calls*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 8 /*TotalNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 10 /*MaxNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 12 /*DeserializeNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 14 /*DeserializeMaxNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 16 /*ComputeNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 18 /*ComputeMaxNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 20 /*SerializeNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 22 /*SerializeMaxNs*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 24 /*BytesIn*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyField(tablePos, 26 /*BytesOut*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+public struct ProfileSnapshotData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static ProfileSnapshotData GetRootAsProfileSnapshotData(ByteBuffer _bb) { return GetRootAsProfileSnapshotData(_bb, new ProfileSnapshotData()); }
+  public static ProfileSnapshotData GetRootAsProfileSnapshotData(ByteBuffer _bb, ProfileSnapshotData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyProfileSnapshotData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, ProfileSnapshotDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ProfileSnapshotData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.ProfileEntryData? Entries(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.ProfileEntryData?)(new GSP.FB.ProfileEntryData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int EntriesLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.ProfileSnapshotData> CreateProfileSnapshotData(FlatBufferBuilder builder,
+      VectorOffset entriesOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    ProfileSnapshotData.AddEntries(builder, entriesOffset);
+    return ProfileSnapshotData.EndProfileSnapshotData(builder);
+  }
+
+  public static void StartProfileSnapshotData(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddEntries(FlatBufferBuilder builder, VectorOffset entriesOffset) { builder.AddOffset(0, entriesOffset.Value, 0); }
+  public static VectorOffset CreateEntriesVector(FlatBufferBuilder builder, Offset<GSP.FB.ProfileEntryData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateEntriesVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.ProfileEntryData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateEntriesVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.ProfileEntryData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateEntriesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.ProfileEntryData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartEntriesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.ProfileSnapshotData> EndProfileSnapshotData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.ProfileSnapshotData>(o);
+  }
+  public static void FinishProfileSnapshotDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.ProfileSnapshotData> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedProfileSnapshotDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.ProfileSnapshotData> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public ProfileSnapshotDataT UnPack() {
+    var _o = new ProfileSnapshotDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(ProfileSnapshotDataT _o) {
+    _o.Entries = new List<GSP.FB.ProfileEntryDataT>();
+    for (var _j = 0; _j < this.EntriesLength; ++_j) {_o.Entries.Add(this.Entries(_j).HasValue ? this.Entries(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.ProfileSnapshotData> Pack(FlatBufferBuilder builder, ProfileSnapshotDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.ProfileSnapshotData>);
+    var _entries = default(VectorOffset);
+    if (_o.Entries != null) {
+      var __entries = new Offset<GSP.FB.ProfileEntryData>[_o.Entries.Count];
+      for (var _j = 0; _j < __entries.Length; ++_j) { __entries[_j] = GSP.FB.ProfileEntryData.Pack(builder, _o.Entries[_j]); }
+      _entries = CreateEntriesVector(builder, __entries);
+    }
+    return CreateProfileSnapshotData(
+      builder,
+      _entries);
+  }
+}
+
+public class ProfileSnapshotDataT
+{
+  public List<GSP.FB.ProfileEntryDataT> Entries { get; set; }
+
+  public ProfileSnapshotDataT() {
+    this.Entries = null;
+  }
+  public static ProfileSnapshotDataT DeserializeFromBinary(byte[] fbBuffer) {
+    return ProfileSnapshotData.GetRootAsProfileSnapshotData(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    ProfileSnapshotData.FinishProfileSnapshotDataBuffer(fbb, ProfileSnapshotData.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class ProfileSnapshotDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Entries*/, GSP.FB.ProfileEntryDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,299 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace GSP.FB
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public enum ResultColumnType : byte
+{
+  Points = 0,
+  Doubles = 1,
+  Ints = 2,
+  IntPairs = 3,
+  NestedInts = 4,
+};
+
+public struct ResultColumnData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static ResultColumnData GetRootAsResultColumnData(ByteBuffer _bb) { return GetRootAsResultColumnData(_bb, new ResultColumnData()); }
+  public static ResultColumnData GetRootAsResultColumnData(ByteBuffer _bb, ResultColumnData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ResultColumnData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public string Name { get { int o = __p.__offset(4); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetNameBytes() { return __p.__vector_as_span<byte>(4, 1); }
+#else
+  public ArraySegment<byte>? GetNameBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public byte[] GetNameArray() { return __p.__vector_as_array<byte>(4); }
+  public GSP.FB.ResultColumnType Type { get { int o = __p.__offset(6); return o != 0 ? (GSP.FB.ResultColumnType)__p.bb.Get(o + __p.bb_pos) : GSP.FB.ResultColumnType.Points; } }
+  public GSP.FB.Vec3? Points(int j) { int o = __p.__offset(8); return o != 0 ? (GSP.FB.Vec3?)(new GSP.FB.Vec3()).__assign(__p.__vector(o) + j * 24, __p.bb) : null; }
+  public int PointsLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public double Doubles(int j) { int o = __p.__offset(10); return o != 0 ? __p.bb.GetDouble(__p.__vector(o) + j * 8) : (double)0; }
+  public int DoublesLength { get { int o = __p.__offset(10); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<double> GetDoublesBytes() { return __p.__vector_as_span<double>(10, 8); }
+#else
+  public ArraySegment<byte>? GetDoublesBytes() { return __p.__vector_as_arraysegment(10); }
+#endif
+  public double[] GetDoublesArray() { return __p.__vector_as_array<double>(10); }
+  public int Ints(int j) { int o = __p.__offset(12); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int IntsLength { get { int o = __p.__offset(12); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetIntsBytes() { return __p.__vector_as_span<int>(12, 4); }
+#else
+  public ArraySegment<byte>? GetIntsBytes() { return __p.__vector_as_arraysegment(12); }
+#endif
+  public int[] GetIntsArray() { return __p.__vector_as_array<int>(12); }
+  public GSP.FB.Vec2i? Pairs(int j) { int o = __p.__offset(14); return o != 0 ? (GSP.FB.Vec2i?)(new GSP.FB.Vec2i()).__assign(__p.__vector(o) + j * 8, __p.bb) : null; }
+  public int PairsLength { get { int o = __p.__offset(14); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public int Sizes(int j) { int o = __p.__offset(16); return o != 0 ? __p.bb.GetInt(__p.__vector(o) + j * 4) : (int)0; }
+  public int SizesLength { get { int o = __p.__offset(16); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<int> GetSizesBytes() { return __p.__vector_as_span<int>(16, 4); }
+#else
+  public ArraySegment<byte>? GetSizesBytes() { return __p.__vector_as_arraysegment(16); }
+#endif
+  public int[] GetSizesArray() { return __p.__vector_as_array<int>(16); }
+
+  public static Offset<GSP.FB.ResultColumnData> CreateResultColumnData(FlatBufferBuilder builder,
+      StringOffset nameOffset = default(StringOffset),
+      GSP.FB.ResultColumnType type = GSP.FB.ResultColumnType.Points,
+      VectorOffset pointsOffset = default(VectorOffset),
+      VectorOffset doublesOffset = default(VectorOffset),
+      VectorOffset intsOffset = default(VectorOffset),
+      VectorOffset pairsOffset = default(VectorOffset),
+      VectorOffset sizesOffset = default(VectorOffset)) {
+    builder.StartTable(7);
+    ResultColumnData.AddSizes(builder, sizesOffset);
+    ResultColumnData.AddPairs(builder, pairsOffset);
+    ResultColumnData.AddInts(builder, intsOffset);
+    ResultColumnData.AddDoubles(builder, doublesOffset);
+    ResultColumnData.AddPoints(builder, pointsOffset);
+    ResultColumnData.AddName(builder, nameOffset);
+    ResultColumnData.AddType(builder, type);
+    return ResultColumnData.EndResultColumnData(builder);
+  }
+
+  public static void StartResultColumnData(FlatBufferBuilder builder) { builder.StartTable(7); }
+  public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
+  public static void AddType(FlatBufferBuilder builder, GSP.FB.ResultColumnType type) { builder.AddByte(1, (byte)type, 0); }
+  public static void AddPoints(FlatBufferBuilder builder, VectorOffset pointsOffset) { builder.AddOffset(2, pointsOffset.Value, 0); }
+  public static void StartPointsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(24, numElems, 8); }
+  public static void AddDoubles(FlatBufferBuilder builder, VectorOffset doublesOffset) { builder.AddOffset(3, doublesOffset.Value, 0); }
+  public static VectorOffset CreateDoublesVector(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); for (int i = data.Length - 1; i >= 0; i--) builder.AddDouble(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateDoublesVectorBlock(FlatBufferBuilder builder, double[] data) { builder.StartVector(8, data.Length, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDoublesVectorBlock(FlatBufferBuilder builder, ArraySegment<double> data) { builder.StartVector(8, data.Count, 8); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDoublesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<double>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartDoublesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 8); }
+  public static void AddInts(FlatBufferBuilder builder, VectorOffset intsOffset) { builder.AddOffset(4, intsOffset.Value, 0); }
+  public static VectorOffset CreateIntsVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateIntsVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateIntsVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateIntsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartIntsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddPairs(FlatBufferBuilder builder, VectorOffset pairsOffset) { builder.AddOffset(5, pairsOffset.Value, 0); }
+  public static void StartPairsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(8, numElems, 4); }
+  public static void AddSizes(FlatBufferBuilder builder, VectorOffset sizesOffset) { builder.AddOffset(6, sizesOffset.Value, 0); }
+  public static VectorOffset CreateSizesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateSizesVectorBlock(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateSizesVectorBlock(FlatBufferBuilder builder, ArraySegment<int> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateSizesVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<int>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartSizesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.ResultColumnData> EndResultColumnData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.ResultColumnData>(o);
+  }
+  public ResultColumnDataT UnPack() {
+    var _o = new ResultColumnDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(ResultColumnDataT _o) {
+    _o.Name = this.Name;
+    _o.Type = this.Type;
+    _o.Points = new List<GSP.FB.Vec3T>();
+    for (var _j = 0; _j < this.PointsLength; ++_j) {_o.Points.Add(this.Points(_j).HasValue ? this.Points(_j).Value.UnPack() : null);}
+    _o.Doubles = new List<double>();
+    for (var _j = 0; _j < this.DoublesLength; ++_j) {_o.Doubles.Add(this.Doubles(_j));}
+    _o.Ints = new List<int>();
+    for (var _j = 0; _j < this.IntsLength; ++_j) {_o.Ints.Add(this.Ints(_j));}
+    _o.Pairs = new List<GSP.FB.Vec2iT>();
+    for (var _j = 0; _j < this.PairsLength; ++_j) {_o.Pairs.Add(this.Pairs(_j).HasValue ? this.Pairs(_j).Value.UnPack() : null);}
+    _o.Sizes = new List<int>();
+    for (var _j = 0; _j < this.SizesLength; ++_j) {_o.Sizes.Add(this.Sizes(_j));}
+  }
+  public static Offset<GSP.FB.ResultColumnData> Pack(FlatBufferBuilder builder, ResultColumnDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.ResultColumnData>);
+    var _name = _o.Name == null ? default(StringOffset) : builder.CreateString(_o.Name);
+    var _points = default(VectorOffset);
+    if (_o.Points != null) {
+      StartPointsVector(builder, _o.Points.Count);
+      for (var _j = _o.Points.Count - 1; _j >= 0; --_j) { GSP.FB.Vec3.Pack(builder, _o.Points[_j]); }
+      _points = builder.EndVector();
+    }
+    var _doubles = default(VectorOffset);
+    if (_o.Doubles != null) {
+      var __doubles = _o.Doubles.ToArray();
+      _doubles = CreateDoublesVector(builder, __doubles);
+    }
+    var _ints = default(VectorOffset);
+    if (_o.Ints != null) {
+      var __ints = _o.Ints.ToArray();
+      _ints = CreateIntsVector(builder, __ints);
+    }
+    var _pairs = default(VectorOffset);
+    if (_o.Pairs != null) {
+      StartPairsVector(builder, _o.Pairs.Count);
+      for (var _j = _o.Pairs.Count - 1; _j >= 0; --_j) { GSP.FB.Vec2i.Pack(builder, _o.Pairs[_j]); }
+      _pairs = builder.EndVector();
+    }
+    var _sizes = default(VectorOffset);
+    if (_o.Sizes != null) {
+      var __sizes = _o.Sizes.ToArray();
+      _sizes = CreateSizesVector(builder, __sizes);
+    }
+    return CreateResultColumnData(
+      builder,
+      _name,
+      _o.Type,
+      _points,
+      _doubles,
+      _ints,
+      _pairs,
+      _sizes);
+  }
+}
+
+public class ResultColumnDataT
+{
+  public string Name { get; set; }
+  public GSP.FB.ResultColumnType Type { get; set; }
+  public List<GSP.FB.Vec3T> Points { get; set; }
+  public List<double> Doubles { get; set; }
+  public List<int> Ints { get; set; }
+  public List<GSP.FB.Vec2iT> Pairs { get; set; }
+  public List<int> Sizes { get; set; }
+
+  public ResultColumnDataT() {
+    this.Name = null;
+    this.Type = GSP.FB.ResultColumnType.Points;
+    this.Points = null;
+    this.Doubles = null;
+    this.Ints = null;
+    this.Pairs = null;
+    this.Sizes = null;
+  }
+}
+
+
+static public class ResultColumnDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyString(tablePos, 4 /*Name*/, false)
+      && verifier.VerifyField(tablePos, 6 /*Type*/, 1 /*GSP.FB.ResultColumnType*/, 1, false)
+      && verifier.VerifyVectorOfData(tablePos, 8 /*Points*/, 24 /*GSP.FB.Vec3*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 10 /*Doubles*/, 8 /*double*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 12 /*Ints*/, 4 /*int*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 14 /*Pairs*/, 8 /*GSP.FB.Vec2i*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 16 /*Sizes*/, 4 /*int*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+public struct ResultBundleData : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_2_10(); }
+  public static ResultBundleData GetRootAsResultBundleData(ByteBuffer _bb) { return GetRootAsResultBundleData(_bb, new ResultBundleData()); }
+  public static ResultBundleData GetRootAsResultBundleData(ByteBuffer _bb, ResultBundleData obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool VerifyResultBundleData(ByteBuffer _bb) {Google.FlatBuffers.Verifier verifier = new Google.FlatBuffers.Verifier(_bb); return verifier.VerifyBuffer("", false, ResultBundleDataVerify.Verify); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ResultBundleData __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public GSP.FB.ResultColumnData? Columns(int j) { int o = __p.__offset(4); return o != 0 ? (GSP.FB.ResultColumnData?)(new GSP.FB.ResultColumnData()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int ColumnsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<GSP.FB.ResultBundleData> CreateResultBundleData(FlatBufferBuilder builder,
+      VectorOffset columnsOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    ResultBundleData.AddColumns(builder, columnsOffset);
+    return ResultBundleData.EndResultBundleData(builder);
+  }
+
+  public static void StartResultBundleData(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddColumns(FlatBufferBuilder builder, VectorOffset columnsOffset) { builder.AddOffset(0, columnsOffset.Value, 0); }
+  public static VectorOffset CreateColumnsVector(FlatBufferBuilder builder, Offset<GSP.FB.ResultColumnData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateColumnsVectorBlock(FlatBufferBuilder builder, Offset<GSP.FB.ResultColumnData>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateColumnsVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<GSP.FB.ResultColumnData>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateColumnsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<GSP.FB.ResultColumnData>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartColumnsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<GSP.FB.ResultBundleData> EndResultBundleData(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<GSP.FB.ResultBundleData>(o);
+  }
+  public static void FinishResultBundleDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.ResultBundleData> offset) { builder.Finish(offset.Value); }
+  public static void FinishSizePrefixedResultBundleDataBuffer(FlatBufferBuilder builder, Offset<GSP.FB.ResultBundleData> offset) { builder.FinishSizePrefixed(offset.Value); }
+  public ResultBundleDataT UnPack() {
+    var _o = new ResultBundleDataT();
+    this.UnPackTo(_o);
+    return _o;
+  }
+  public void UnPackTo(ResultBundleDataT _o) {
+    _o.Columns = new List<GSP.FB.ResultColumnDataT>();
+    for (var _j = 0; _j < this.ColumnsLength; ++_j) {_o.Columns.Add(this.Columns(_j).HasValue ? this.Columns(_j).Value.UnPack() : null);}
+  }
+  public static Offset<GSP.FB.ResultBundleData> Pack(FlatBufferBuilder builder, ResultBundleDataT _o) {
+    if (_o == null) return default(Offset<GSP.FB.ResultBundleData>);
+    var _columns = default(VectorOffset);
+    if (_o.Columns != null) {
+      var __columns = new Offset<GSP.FB.ResultColumnData>[_o.Columns.Count];
+      for (var _j = 0; _j < __columns.Length; ++_j) { __columns[_j] = GSP.FB.ResultColumnData.Pack(builder, _o.Columns[_j]); }
+      _columns = CreateColumnsVector(builder, __columns);
+    }
+    return CreateResultBundleData(
+      builder,
+      _columns);
+  }
+}
+
+public class ResultBundleDataT
+{
+  public List<GSP.FB.ResultColumnDataT> Columns { get; set; }
+
+  public ResultBundleDataT() {
+    this.Columns = null;
+  }
+  public static ResultBundleDataT DeserializeFromBinary(byte[] fbBuffer) {
+    return ResultBundleData.GetRootAsResultBundleData(new ByteBuffer(fbBuffer)).UnPack();
+  }
+  public byte[] SerializeToBinary() {
+    var fbb = new FlatBufferBuilder(0x10000);
+    ResultBundleData.FinishResultBundleDataBuffer(fbb, ResultBundleData.Pack(fbb, this));
+    return fbb.DataBuffer.ToSizedArray();
+  }
+}
+
+
+static public class ResultBundleDataVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Columns*/, GSP.FB.ResultColumnDataVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
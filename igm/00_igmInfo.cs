@@ -35,6 +35,17 @@ public class IGM_CategoryIcon : GH_AssemblyPriority {
       // Log error but don't prevent plugin from loading
       System.Diagnostics.Debug.WriteLine($"Failed to set category icon: {ex.Message}");
     }
+
+    // Stop the native worker threads on a regular thread at exit, before the library unloads
+    AppDomain.CurrentDomain.ProcessExit += (sender, args) => {
+      try {
+        if (GSP.NativeBridge.IsNativeLibraryLoaded) {
+          GSP.NativeBridge.IGM_shutdown();
+        }
+      } catch (Exception ex) {
+        System.Diagnostics.Debug.WriteLine($"Failed to stop native threads: {ex.Message}");
+      }
+    };
     return GH_LoadingInstruction.Proceed;
   }
 }
@@ -120,14 +120,17 @@ public class IGM_vert_tri_adjacency : GH_Component {
     }
 
     // call the cpp function to solve the adjacency list
-    var (vt, vi) = MeshUtils.GetAdjacencyVT(ref mesh);
+    // only the connected outputs are serialized back
+    var outputs = (VertexTriangleOutputs)Helper.ConnectedOutputs(this) & VertexTriangleOutputs.All;
+    var (vt, vi) = MeshUtils.GetAdjacencyVT(ref mesh, outputs);
 
     Grasshopper.DataTree<int> adjVT = new Grasshopper.DataTree<int>();
     Grasshopper.DataTree<int> adjVTI = new Grasshopper.DataTree<int>();
     for (int i = 0; i < vt.Count; i++) {
-      var path = new Grasshopper.Kernel.Data.GH_Path(i);
-      adjVT.AddRange(vt[i], path);
-      adjVTI.AddRange(vi[i], path);
+      adjVT.AddRange(vt[i], new Grasshopper.Kernel.Data.GH_Path(i));
+    }
+    for (int i = 0; i < vi.Count; i++) {
+      adjVTI.AddRange(vi[i], new Grasshopper.Kernel.Data.GH_Path(i));
     }
 
     DA.SetDataTree(0, adjVT);
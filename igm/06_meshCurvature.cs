@@ -76,7 +76,10 @@ public class IGM_principal_curvature : GH_Component {
     }  // make sure the value is unit
 
     // call the cpp function to solve the adjacency list
-    var (PD1, PD2, PV1, PV2) = MeshUtils.GetPrincipalCurvature(ref mesh, (uint)r);
+    // only the connected outputs are serialized back
+    var outputs =
+        (PrincipalCurvatureOutputs)Helper.ConnectedOutputs(this) & PrincipalCurvatureOutputs.All;
+    var (PD1, PD2, PV1, PV2) = MeshUtils.GetPrincipalCurvature(ref mesh, (uint)r, outputs);
 
     // output
     DA.SetDataList(0, PD1);
@@ -5,6 +5,9 @@ using System.Collections.Generic;
 
 namespace igm {
 public class IGM_winding_number : GH_Component {
+  Rhino.Geometry.Mesh wn_mesh;
+  ulong wnHandle;
+
   /// <summary>
   /// Initializes a new instance of the MyComponent1 class.
   /// </summary>
@@ -50,13 +53,36 @@ public class IGM_winding_number : GH_Component {
       return;
     }
 
-    // call the cpp function to solve the adjacency list
-    var w = MeshUtils.GetFastWindingNumber(ref mesh, ref Q);
+    // Keep the precompute across solves while the mesh stays the same
+    var meshSame =
+        (wn_mesh != null && Rhino.Geometry.InstanceReferenceGeometry.GeometryEquals(mesh, wn_mesh));
+    if (wnHandle == 0 || !meshSame) {
+      UpdatePrecomputedData(mesh);
+    }
+
+    // The native cache may have evicted the data to stay under its memory limit
+    if (!MeshUtils.TryGetFastWindingNumber(wnHandle, ref Q, out var w)) {
+      UpdatePrecomputedData(mesh);
+      MeshUtils.TryGetFastWindingNumber(wnHandle, ref Q, out w);
+    }
 
     // output
     DA.SetDataList(0, w);
   }
 
+  private void UpdatePrecomputedData(Rhino.Geometry.Mesh mesh) {
+    MeshUtils.ReleaseFastWindingNumber(wnHandle);
+    wnHandle = MeshUtils.CreateFastWindingNumber(ref mesh);
+    wn_mesh = mesh;
+  }
+
+  public override void RemovedFromDocument(GH_Document document) {
+    MeshUtils.ReleaseFastWindingNumber(wnHandle);
+    wnHandle = 0;
+    wn_mesh = null;
+    base.RemovedFromDocument(document);
+  }
+
   /// <summary>
   /// Provides an Icon for the component.
   /// </summary>
@@ -69,7 +69,9 @@ public class IGM_signed_distance : GH_Component {
     if (!DA.GetData(2, ref st)) {}
 
     // call the cpp function to solve the adjacency list
-    var (sd, fi, cp) = MeshUtils.GetSignedDistance(ref mesh, ref Q, st);
+    // only the connected outputs are computed
+    var outputs = (SignedDistanceOutputs)Helper.ConnectedOutputs(this) & SignedDistanceOutputs.All;
+    var (sd, fi, cp) = MeshUtils.GetSignedDistance(ref mesh, ref Q, st, outputs);
 
     // output
     DA.SetDataList(0, sd);
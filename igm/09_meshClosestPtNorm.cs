@@ -1,5 +1,7 @@
 using System;
+using System.Collections.Generic;
 using Grasshopper.Kernel;
+using GSP;
 using Rhino.Geometry;
 
 namespace igm {
@@ -7,7 +9,7 @@ public class IGM_meshClosestPtNorm : GH_Component {
   public IGM_meshClosestPtNorm()
       : base("Mesh Closest Point Normal",
              "igClosestPtNorm",
-             "Get the normal vector on the mesh from the closest point of a given point.",
+             "Get the normal vector on the mesh from the closest point of the given points.",
              "igMesh",
              "09::Utils") {}
 
@@ -17,34 +19,46 @@ public class IGM_meshClosestPtNorm : GH_Component {
 
   protected override void RegisterInputParams(GH_Component.GH_InputParamManager pManager) {
     pManager.AddMeshParameter("Mesh", "M", "Base mesh for calculation.", GH_ParamAccess.item);
-    pManager.AddPointParameter("Point", "P", "Point to calculate from.", GH_ParamAccess.item);
+    pManager.AddPointParameter("Point", "P", "Points to calculate from.", GH_ParamAccess.list);
   }
 
   protected override void RegisterOutputParams(GH_Component.GH_OutputParamManager pManager) {
-    pManager.AddPointParameter("Closest Point", "CP", "Closest point on the mesh.", GH_ParamAccess.item);
-    pManager.AddVectorParameter("Normal", "N", "Normal vector at the closest point.", GH_ParamAccess.item);
+    pManager.AddPointParameter(
+        "Closest Point", "CP", "Closest points on the mesh.", GH_ParamAccess.list);
+    pManager.AddVectorParameter(
+        "Normal", "N", "Normal vectors at the closest points.", GH_ParamAccess.list);
+    pManager.AddIntegerParameter(
+        "Face Index", "FI", "Mesh faces containing the closest points.", GH_ParamAccess.list);
+    pManager.AddPointParameter(
+        "Barycentric",
+        "B",
+        "Barycentric coordinates of the closest points in their triangles; quad ABCD is split " +
+            "into ABC and ACD.",
+        GH_ParamAccess.list);
   }
 
   protected override void SolveInstance(IGH_DataAccess DA) {
     Rhino.Geometry.Mesh mesh = new Rhino.Geometry.Mesh();
-    Rhino.Geometry.Point3d pt = Rhino.Geometry.Point3d.Unset;
+    List<Point3d> pts = new List<Point3d>();
 
     if (!DA.GetData(0, ref mesh)) {
       return;
     }
-    if (!DA.GetData(1, ref pt)) {
+    if (!DA.GetDataList(1, pts)) {
       return;
     }
 
-    if (!mesh.IsValid || !pt.IsValid) {
+    if (!mesh.IsValid) {
       return;
     }
 
-    MeshPoint mPt = mesh.ClosestMeshPoint(pt, 0.0);
-    Vector3d nrml = mesh.NormalAt(mPt);
+    // One native, BVH-accelerated call for the whole list
+    var (cp, fi, bc, nrml) = MeshUtils.GetClosestPointNormals(ref mesh, ref pts);
 
-    DA.SetData(0, mPt.Point);
-    DA.SetData(1, nrml);
+    DA.SetDataList(0, cp);
+    DA.SetDataList(1, nrml);
+    DA.SetDataList(2, fi);
+    DA.SetDataList(3, bc);
   }
 }
 }
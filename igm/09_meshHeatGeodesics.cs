@@ -6,7 +6,7 @@ using GSP;
 namespace igm {
 public class IGM_heat_geodesic_dist : GH_Component {
   Rhino.Geometry.Mesh heat_mesh;
-  static long geoDataHandle;
+  ulong geoDataHandle;
 
   /// <summary>
   /// Initializes a new instance of the MyComponent1 class.
@@ -69,16 +69,32 @@ public class IGM_heat_geodesic_dist : GH_Component {
     var meshSame = (heat_mesh != null &&
                     Rhino.Geometry.InstanceReferenceGeometry.GeometryEquals(mesh, heat_mesh));
     if (redo || geoDataHandle == 0 || !meshSame) {
-      geoDataHandle = MeshUtils.GetHeatGeodesicPrecomputedData(ref mesh);
-      heat_mesh = mesh;
+      UpdatePrecomputedData(mesh);
     }
 
-    var D = MeshUtils.GetHeatGeodesicDistances(geoDataHandle, ref gamma);
+    // The native cache may have evicted the data to stay under its memory limit
+    if (!MeshUtils.TryGetHeatGeodesicDistances(geoDataHandle, ref gamma, out var D)) {
+      UpdatePrecomputedData(mesh);
+      MeshUtils.TryGetHeatGeodesicDistances(geoDataHandle, ref gamma, out D);
+    }
 
     // output
     DA.SetDataList(0, D);
   }
 
+  private void UpdatePrecomputedData(Rhino.Geometry.Mesh mesh) {
+    MeshUtils.ReleaseHeatGeodesics(geoDataHandle);
+    geoDataHandle = MeshUtils.CreateHeatGeodesics(ref mesh);
+    heat_mesh = mesh;
+  }
+
+  public override void RemovedFromDocument(GH_Document document) {
+    MeshUtils.ReleaseHeatGeodesics(geoDataHandle);
+    geoDataHandle = 0;
+    heat_mesh = null;
+    base.RemovedFromDocument(document);
+  }
+
   /// <summary>
   /// Provides an Icon for the component.
   /// </summary>
@@ -13,5 +13,16 @@ internal class Helper {
     _this.Message = _mode.ToUpper();
     _this.ExpireSolution(true);
   }
+
+  // Output mask with bit i set when output i has recipients; all outputs when none has, so a
+  // component previewed on its own still computes everything
+  public static uint ConnectedOutputs(GH_Component _this) {
+    uint mask = 0;
+    for (int i = 0; i < _this.Params.Output.Count && i < 32; i++) {
+      if (_this.Params.Output[i].Recipients.Count > 0)
+        mask |= 1u << i;
+    }
+    return mask != 0 ? mask : ~0u;
+  }
 }
 }